@@ -134,6 +134,30 @@
 // experimental feature: use __builtin_memcpy instead of union to do bit_cast
 #define CK_EXPERIMENTAL_USE_MEMCPY_FOR_BIT_CAST 1
 
+// generate Sequence with __make_integer_seq and index type packs with __type_pack_element
+// instead of recursive template instantiation, to reduce compile time
+#ifndef CK_USE_BUILTIN_MAKE_INTEGER_SEQ
+#if defined(__has_builtin)
+#if __has_builtin(__make_integer_seq)
+#define CK_USE_BUILTIN_MAKE_INTEGER_SEQ 1
+#endif
+#endif
+#endif
+#ifndef CK_USE_BUILTIN_MAKE_INTEGER_SEQ
+#define CK_USE_BUILTIN_MAKE_INTEGER_SEQ 0
+#endif
+
+#ifndef CK_USE_BUILTIN_TYPE_PACK_ELEMENT
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define CK_USE_BUILTIN_TYPE_PACK_ELEMENT 1
+#endif
+#endif
+#endif
+#ifndef CK_USE_BUILTIN_TYPE_PACK_ELEMENT
+#define CK_USE_BUILTIN_TYPE_PACK_ELEMENT 0
+#endif
+
 // experimental feature: optimize for inter-wave scheduling policy
 #define CK_EXPERIMENTAL_INTER_WAVE_SCHEDULING 1
 #define CK_EXPERIMENTAL_INTER_WAVE_SCHEDULING_MAC_CLUSTERS 1
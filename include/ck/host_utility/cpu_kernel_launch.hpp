@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/parallel_for.hpp"
+#include "ck/host_utility/timer.hpp"
+
+namespace ck {
+
+inline std::size_t get_cpu_num_thread()
+{
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// Splits [0, n) into contiguous ranges, one per thread, and calls f(begin, end) on each range.
+// The calling thread runs the first range.
+template <typename F>
+void cpu_parallel_for(index_t n, F f, std::size_t num_thread = get_cpu_num_thread())
+{
+    if(n <= 0)
+    {
+        return;
+    }
+
+    parallel_for_each_range(
+        static_cast<std::size_t>(n), num_thread, [&f](std::size_t begin, std::size_t end) {
+            f(static_cast<index_t>(begin), static_cast<index_t>(end));
+        });
+}
+
+// Host counterpart of launch_and_time_kernel: runs kernel() and, when timing, returns the mean
+// wall time in ms of the timed runs, see ck::benchmark().
+template <typename F>
+float launch_and_time_cpu_kernel(const StreamConfig& stream_config, F kernel)
+{
+#if CK_TIME_KERNEL
+    if(stream_config.time_kernel_)
+    {
+        HostClock clock;
+
+        return benchmark(stream_config, clock, kernel);
+    }
+    else
+    {
+        kernel();
+
+        return 0;
+    }
+#else
+    (void)stream_config;
+
+    kernel();
+
+    return 0;
+#endif
+}
+
+} // namespace ck
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <map>
 #include <hip/hip_runtime.h>
@@ -51,4 +52,77 @@ inline std::string get_device_name()
     return name;
 }
 
+// Limits of the current device for the roofline of kernels, a value is 0 or missing when unknown
+struct DeviceCapability
+{
+    std::string name_;
+    int num_cu_                 = 0;
+    std::size_t lds_size_       = 0; // bytes of LDS of a CU
+    float clock_mhz_            = 0; // peak engine clock
+    float bandwidth_gb_per_sec_ = 0; // peak memory bandwidth
+
+    // peak dense TFlops of each data type, named "f64", "f32", "f16", "bf16" or "int8", with the
+    // matrix cores when the device has them
+    std::map<std::string, float> peak_tflops_;
+};
+
+// dense flops per clock of a CU for each data type, by the gfx name of get_device_name()
+inline const std::map<std::string, float>* get_device_flops_per_clock(const std::string& name)
+{
+    // clang-format off
+    static const std::map<std::string, std::map<std::string, float>> flops_per_clock = {
+        {"gfx906",  {{"f64", 64},  {"f32", 128}, {"f16", 256},  {"int8", 512}}},
+        {"gfx908",  {{"f64", 64},  {"f32", 256}, {"f16", 1024}, {"bf16", 512},  {"int8", 1024}}},
+        {"gfx90a",  {{"f64", 256}, {"f32", 256}, {"f16", 1024}, {"bf16", 1024}, {"int8", 1024}}},
+        {"gfx940",  {{"f64", 256}, {"f32", 256}, {"f16", 2048}, {"bf16", 2048}, {"int8", 4096}}},
+        {"gfx941",  {{"f64", 256}, {"f32", 256}, {"f16", 2048}, {"bf16", 2048}, {"int8", 4096}}},
+        {"gfx942",  {{"f64", 256}, {"f32", 256}, {"f16", 2048}, {"bf16", 2048}, {"int8", 4096}}},
+        {"gfx1030", {{"f64", 8},   {"f32", 128}, {"f16", 256},  {"int8", 512}}},
+        {"gfx1100", {{"f32", 256}, {"f16", 512},  {"bf16", 512},  {"int8", 512}}},
+        {"gfx1101", {{"f32", 256}, {"f16", 512},  {"bf16", 512},  {"int8", 512}}},
+        {"gfx1102", {{"f32", 256}, {"f16", 512},  {"bf16", 512},  {"int8", 512}}},
+    };
+    // clang-format on
+
+    const auto match = flops_per_clock.find(name);
+
+    return match == flops_per_clock.end() ? nullptr : &match->second;
+}
+
+// Queries the current device. The peak memory bandwidth is that of double data rate memory at the
+// reported memory clock, and the peak TFlops are only known for the devices of
+// get_device_flops_per_clock().
+inline DeviceCapability get_device_capability()
+{
+    DeviceCapability capability;
+
+    hipDeviceProp_t props{};
+    int device;
+
+    if(hipGetDevice(&device) != hipSuccess || hipGetDeviceProperties(&props, device) != hipSuccess)
+    {
+        return capability;
+    }
+
+    capability.name_      = get_device_name();
+    capability.num_cu_    = props.multiProcessorCount;
+    capability.lds_size_  = props.maxSharedMemoryPerMultiProcessor;
+    capability.clock_mhz_ = static_cast<float>(props.clockRate) / 1.E3f;
+
+    // kHz, and bits of the bus
+    capability.bandwidth_gb_per_sec_ = 2.f * static_cast<float>(props.memoryClockRate) / 1.E6f *
+                                       static_cast<float>(props.memoryBusWidth / 8);
+
+    if(const auto flops_per_clock = get_device_flops_per_clock(capability.name_))
+    {
+        for(const auto& [data_type, flops] : *flops_per_clock)
+        {
+            capability.peak_tflops_[data_type] =
+                flops * static_cast<float>(capability.num_cu_) * capability.clock_mhz_ / 1.E6f;
+        }
+    }
+
+    return capability;
+}
+
 } // namespace ck
@@ -8,6 +8,7 @@
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/timer.hpp"
 
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
@@ -20,45 +21,25 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
 #if CK_TIME_KERNEL
     if(stream_config.time_kernel_)
     {
-        printf("%s: grid_dim {%d, %d, %d}, block_dim {%d, %d, %d} \n",
-               __func__,
-               grid_dim.x,
-               grid_dim.y,
-               grid_dim.z,
-               block_dim.x,
-               block_dim.y,
-               block_dim.z);
-
-        const int nrepeat = 10;
-
-        printf("Warm up 1 time\n");
-
-        // warm up
-        kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
-
-        printf("Start running %d times...\n", nrepeat);
-
-        hipEvent_t start, stop;
-
-        hip_check_error(hipEventCreate(&start));
-        hip_check_error(hipEventCreate(&stop));
-
-        hip_check_error(hipDeviceSynchronize());
-        hip_check_error(hipEventRecord(start, stream_config.stream_id_));
-
-        for(int i = 0; i < nrepeat; ++i)
+        if(stream_config.log_level_ > 0)
         {
-            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+            printf("%s: grid_dim {%d, %d, %d}, block_dim {%d, %d, %d} \n",
+                   __func__,
+                   grid_dim.x,
+                   grid_dim.y,
+                   grid_dim.z,
+                   block_dim.x,
+                   block_dim.y,
+                   block_dim.z);
         }
 
-        hip_check_error(hipEventRecord(stop, stream_config.stream_id_));
-        hip_check_error(hipEventSynchronize(stop));
+        ck::HipEventClock clock{stream_config.stream_id_};
 
-        float total_time = 0;
-
-        hip_check_error(hipEventElapsedTime(&total_time, start, stop));
+        hip_check_error(hipDeviceSynchronize());
 
-        return total_time / nrepeat;
+        return ck::benchmark(stream_config, clock, [&]() {
+            kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+        });
     }
     else
     {
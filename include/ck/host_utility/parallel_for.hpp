@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ck {
+
+struct joinable_thread : std::thread
+{
+    template <typename... Xs>
+    joinable_thread(Xs&&... xs) : std::thread(std::forward<Xs>(xs)...)
+    {
+    }
+
+    joinable_thread(joinable_thread&&) = default;
+    joinable_thread& operator=(joinable_thread&&) = default;
+
+    ~joinable_thread()
+    {
+        if(this->joinable())
+            this->join();
+    }
+};
+
+// Calls f(begin, end) for contiguous ranges splitting [0, size) among at most num_thread threads,
+// the calling thread runs the first range. Returns when all the ranges are done, the threads are
+// joined as well when f throws on the calling thread.
+template <typename F>
+void parallel_for_each_range(std::size_t size, std::size_t num_thread, F&& f)
+{
+    if(size == 0)
+    {
+        return;
+    }
+
+    num_thread = std::max(std::min(num_thread, size), std::size_t{1});
+
+    const std::size_t work_per_thread = (size + num_thread - 1) / num_thread;
+
+    std::vector<joinable_thread> threads(num_thread - 1);
+
+    for(std::size_t it = 1; it < num_thread; ++it)
+    {
+        const std::size_t iw_begin = std::min(it * work_per_thread, size);
+        const std::size_t iw_end   = std::min(iw_begin + work_per_thread, size);
+
+        threads[it - 1] = joinable_thread([&f, iw_begin, iw_end] { f(iw_begin, iw_end); });
+    }
+
+    f(std::size_t{0}, std::min(work_per_thread, size));
+}
+
+} // namespace ck
@@ -0,0 +1,302 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/hip_check_error.hpp"
+
+namespace ck {
+
+// Statistics in ms of the times of repeated runs of a kernel
+struct TimingStatistics
+{
+    // number of timed runs, and how many of them were rejected as outliers and are not part of
+    // the statistics below
+    int num_run_     = 0;
+    int num_outlier_ = 0;
+
+    float mean_   = 0;
+    float min_    = 0;
+    float median_ = 0;
+    float p90_    = 0;
+    float max_    = 0;
+    float stddev_ = 0;
+
+    // half width of the 95% confidence interval of the mean
+    float ci95_ = 0;
+
+    // times of all the runs in the order they ran, outliers included, e.g. for significance tests
+    // between two sets of runs
+    std::vector<float> times_;
+
+    float GetRelativeCI95() const { return mean_ > 0 ? ci95_ / mean_ : 0; }
+
+    // sorted_times must be sorted, p in [0, 1], linear interpolation between the closest ranks
+    static double GetPercentile(const std::vector<double>& sorted_times, double p)
+    {
+        const double rank  = p * static_cast<double>(sorted_times.size() - 1);
+        const auto i       = static_cast<std::size_t>(rank);
+        const double frac  = rank - static_cast<double>(i);
+        const double lower = sorted_times[i];
+        const double upper = sorted_times[std::min(i + 1, sorted_times.size() - 1)];
+
+        return lower + frac * (upper - lower);
+    }
+
+    // two-sided 95% quantile of Student's t-distribution with dof degrees of freedom
+    static double GetStudentT95(std::size_t dof)
+    {
+        static constexpr std::array<double, 30> t95{
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+            2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+            2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+        return dof == 0 ? 0 : dof <= t95.size() ? t95[dof - 1] : 1.960;
+    }
+
+    // When reject_outliers is set, the times outside of Tukey's fences [Q1 - 1.5 IQR, Q3 + 1.5 IQR]
+    // are left out, e.g. runs preempted by another process or delayed by a clock change.
+    static TimingStatistics Compute(const std::vector<float>& times, bool reject_outliers)
+    {
+        TimingStatistics statistics;
+
+        statistics.num_run_ = static_cast<int>(times.size());
+        statistics.times_   = times;
+
+        if(times.empty())
+        {
+            return statistics;
+        }
+
+        std::vector<double> sorted_times(times.begin(), times.end());
+
+        std::sort(sorted_times.begin(), sorted_times.end());
+
+        if(reject_outliers && sorted_times.size() >= 4)
+        {
+            const double q1  = GetPercentile(sorted_times, 0.25);
+            const double q3  = GetPercentile(sorted_times, 0.75);
+            const double iqr = q3 - q1;
+
+            const auto first = std::lower_bound(
+                sorted_times.begin(), sorted_times.end(), q1 - 1.5 * iqr);
+            const auto last =
+                std::upper_bound(sorted_times.begin(), sorted_times.end(), q3 + 1.5 * iqr);
+
+            sorted_times = std::vector<double>(first, last);
+
+            statistics.num_outlier_ = statistics.num_run_ - static_cast<int>(sorted_times.size());
+        }
+
+        const std::size_t n = sorted_times.size();
+
+        const double mean =
+            std::accumulate(sorted_times.begin(), sorted_times.end(), 0.0) / static_cast<double>(n);
+
+        double sum_square = 0;
+
+        for(double time : sorted_times)
+        {
+            sum_square += (time - mean) * (time - mean);
+        }
+
+        const double stddev = n > 1 ? std::sqrt(sum_square / static_cast<double>(n - 1)) : 0;
+
+        statistics.mean_   = static_cast<float>(mean);
+        statistics.min_    = static_cast<float>(sorted_times.front());
+        statistics.median_ = static_cast<float>(GetPercentile(sorted_times, 0.5));
+        statistics.p90_    = static_cast<float>(GetPercentile(sorted_times, 0.9));
+        statistics.max_    = static_cast<float>(sorted_times.back());
+        statistics.stddev_ = static_cast<float>(stddev);
+        statistics.ci95_ =
+            static_cast<float>(GetStudentT95(n - 1) * stddev / std::sqrt(static_cast<double>(n)));
+
+        return statistics;
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const TimingStatistics& statistics)
+{
+    os << std::setprecision(5) << "mean " << statistics.mean_ << " ms +/- " << statistics.ci95_
+       << " (95% CI), min " << statistics.min_ << ", median " << statistics.median_ << ", p90 "
+       << statistics.p90_ << ", max " << statistics.max_ << ", stddev " << statistics.stddev_
+       << ", " << statistics.num_run_ << " runs, " << statistics.num_outlier_ << " outliers";
+
+    return os;
+}
+
+// A clock measures the intervals between calls to Start() and Stop(), GetElapsedTimes() returns
+// their lengths in ms since the last Reset(). Any type with these members can be passed to
+// benchmark().
+
+// Times the work submitted to a HIP stream between Start() and Stop() with HIP events, without
+// synchronizing the stream until GetElapsedTimes().
+struct HipEventClock
+{
+    explicit HipEventClock(hipStream_t stream_id) : stream_id_(stream_id) {}
+
+    HipEventClock(const HipEventClock&) = delete;
+    HipEventClock& operator=(const HipEventClock&) = delete;
+
+    ~HipEventClock()
+    {
+        for(auto event : events_)
+        {
+            (void)hipEventDestroy(event);
+        }
+    }
+
+    void Start() { Record(); }
+
+    void Stop()
+    {
+        Record();
+
+        ++num_interval_;
+    }
+
+    std::vector<float> GetElapsedTimes() const
+    {
+        std::vector<float> times(num_interval_);
+
+        if(num_interval_ == 0)
+        {
+            return times;
+        }
+
+        hip_check_error(hipEventSynchronize(events_[2 * num_interval_ - 1]));
+
+        for(std::size_t i = 0; i < num_interval_; ++i)
+        {
+            hip_check_error(hipEventElapsedTime(&times[i], events_[2 * i], events_[2 * i + 1]));
+        }
+
+        return times;
+    }
+
+    void Reset()
+    {
+        num_event_    = 0;
+        num_interval_ = 0;
+    }
+
+    private:
+    // the events are reused after a Reset()
+    void Record()
+    {
+        if(num_event_ == events_.size())
+        {
+            hipEvent_t event;
+
+            hip_check_error(hipEventCreate(&event));
+
+            events_.push_back(event);
+        }
+
+        hip_check_error(hipEventRecord(events_[num_event_++], stream_id_));
+    }
+
+    hipStream_t stream_id_;
+    std::vector<hipEvent_t> events_;
+    std::size_t num_event_    = 0;
+    std::size_t num_interval_ = 0;
+};
+
+// Times the work done by the host between Start() and Stop() with std::chrono::steady_clock
+struct HostClock
+{
+    void Start() { start_ = std::chrono::steady_clock::now(); }
+
+    void Stop()
+    {
+        const auto stop = std::chrono::steady_clock::now();
+
+        times_.push_back(std::chrono::duration<float, std::milli>(stop - start_).count());
+    }
+
+    std::vector<float> GetElapsedTimes() const { return times_; }
+
+    void Reset() { times_.clear(); }
+
+    private:
+    std::chrono::steady_clock::time_point start_;
+    std::vector<float> times_;
+};
+
+// Runs run() stream_config.cold_niters_ times untimed, then timed with clock in batches of
+// stream_config.nrepeat_ runs. When stream_config.target_ci_ > 0, batches are added until the 95%
+// confidence interval of the mean is within target_ci_ of the mean or max_nrepeat_ runs are done.
+// Returns the mean time in ms, the other statistics are written to
+// stream_config.timing_statistics_ when it is set.
+template <typename Clock, typename F>
+float benchmark(const StreamConfig& stream_config, Clock& clock, F run)
+{
+    const int nrepeat     = std::max(stream_config.nrepeat_, 1);
+    const int max_nrepeat = std::max(stream_config.max_nrepeat_, nrepeat);
+
+    if(stream_config.log_level_ > 0)
+    {
+        std::cout << "Warm up " << stream_config.cold_niters_ << " times" << std::endl;
+    }
+
+    for(int i = 0; i < stream_config.cold_niters_; ++i)
+    {
+        run();
+    }
+
+    if(stream_config.log_level_ > 0)
+    {
+        std::cout << "Start running " << nrepeat << " times..." << std::endl;
+    }
+
+    clock.Reset();
+
+    TimingStatistics statistics;
+
+    int num_run = 0;
+
+    while(true)
+    {
+        for(int i = 0; i < nrepeat && num_run < max_nrepeat; ++i, ++num_run)
+        {
+            clock.Start();
+            run();
+            clock.Stop();
+        }
+
+        statistics =
+            TimingStatistics::Compute(clock.GetElapsedTimes(), stream_config.reject_outliers_);
+
+        if(stream_config.target_ci_ <= 0 || num_run >= max_nrepeat ||
+           statistics.GetRelativeCI95() <= stream_config.target_ci_)
+        {
+            break;
+        }
+    }
+
+    if(stream_config.log_level_ > 0)
+    {
+        std::cout << statistics << std::endl;
+    }
+
+    if(stream_config.timing_statistics_ != nullptr)
+    {
+        *stream_config.timing_statistics_ = statistics;
+    }
+
+    return statistics.mean_;
+}
+
+} // namespace ck
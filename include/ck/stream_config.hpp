@@ -6,9 +6,24 @@
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
 
+namespace ck {
+struct TimingStatistics;
+} // namespace ck
+
 struct StreamConfig
 {
     hipStream_t stream_id_ = nullptr;
     bool time_kernel_      = false;
     int log_level_         = 0;
+
+    // timing settings, see ck::benchmark() in ck/host_utility/timer.hpp. The mean time is the
+    // plain mean of the runs unless reject_outliers_ is set
+    int cold_niters_      = 1;
+    int nrepeat_          = 10;
+    float target_ci_      = 0;
+    int max_nrepeat_      = 1000;
+    bool reject_outliers_ = false;
+
+    // when set, receives the statistics of the timed runs
+    ck::TimingStatistics* timing_statistics_ = nullptr;
 };
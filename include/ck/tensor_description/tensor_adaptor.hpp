@@ -479,4 +479,584 @@ __host__ __device__ constexpr auto chain_tensor_adaptors(const X& x, const Xs&..
     return chain_tensor_adaptors(x, chain_tensor_adaptors(xs...));
 }
 
+// Simplification of transform chains
+//
+// Coordinate calculation and movement go through every transform of a chain. Adjacent transforms
+// that cancel or compose are fused into fewer transforms, with fewer hidden dimensions:
+//   1. PassThrough is removed, the dimension it reads takes the id of the one it writes.
+//   2. UnMerge reading exactly the dimensions written by a Merge, in the same order and with the
+//      same lengths known at compile time, is the identity from the upper dimension of the Merge
+//      to the lower dimension of the UnMerge, and becomes a PassThrough.
+//   3. Embed (or UnMerge) reading a dimension written by another Embed (or UnMerge) is composed
+//      into a single Embed.
+// Each rule needs the dimensions it removes to be read by no other transform and not to be top
+// dimensions. A PassThrough from a top dimension to a bottom dimension is kept: the lengths of
+// top dimensions come from the transforms reading them. Every rule keeps the mapping from top
+// index to bottom index, for top indices in range.
+namespace detail {
+
+enum struct TransformKind
+{
+    Other,
+    PassThrough,
+    Embed,
+    UnMerge,
+    Merge
+};
+
+template <typename Transform>
+struct transform_kind
+{
+    static constexpr TransformKind value = TransformKind::Other;
+};
+
+template <typename LowLength>
+struct transform_kind<PassThrough<LowLength>>
+{
+    static constexpr TransformKind value = TransformKind::PassThrough;
+};
+
+template <typename UpLengths, typename Coefficients, bool B>
+struct transform_kind<Embed<UpLengths, Coefficients, B>>
+{
+    static constexpr TransformKind value = TransformKind::Embed;
+};
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+struct transform_kind<UnMerge<UpLengths, Use24BitIntegerCalculation>>
+{
+    static constexpr TransformKind value = TransformKind::UnMerge;
+};
+
+template <typename LowLengths>
+struct transform_kind<Merge_v1_carry_check<LowLengths>>
+{
+    static constexpr TransformKind value = TransformKind::Merge;
+};
+
+template <typename LowLengths>
+struct transform_kind<Merge_v2_magic_division<LowLengths>>
+{
+    static constexpr TransformKind value = TransformKind::Merge;
+};
+
+template <typename LowLengths>
+struct transform_kind<Merge_v2r2_magic_division<LowLengths>>
+{
+    static constexpr TransformKind value = TransformKind::Merge;
+};
+
+template <typename LowLengths>
+struct transform_kind<Merge_v3_division_mod<LowLengths>>
+{
+    static constexpr TransformKind value = TransformKind::Merge;
+};
+
+// lengths of an UnMerge or a Merge on the side of the dimension they split or merge, -1 for a
+// length not known at compile time
+template <typename Length>
+__host__ __device__ constexpr index_t get_static_length()
+{
+    if constexpr(is_known_at_compile_time<remove_cvref_t<Length>>::value)
+    {
+        return remove_cvref_t<Length>::value;
+    }
+    else
+    {
+        return -1;
+    }
+}
+
+template <typename Lengths>
+struct static_lengths;
+
+template <typename... Lengths>
+struct static_lengths<Tuple<Lengths...>>
+{
+    using type = Sequence<get_static_length<Lengths>()...>;
+};
+
+template <typename Transform>
+struct transform_split_lengths
+{
+    using type = Sequence<>;
+};
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+struct transform_split_lengths<UnMerge<UpLengths, Use24BitIntegerCalculation>>
+{
+    using type = typename static_lengths<UpLengths>::type;
+};
+
+template <typename LowLengths>
+struct transform_split_lengths<Merge_v1_carry_check<LowLengths>>
+{
+    using type = typename static_lengths<LowLengths>::type;
+};
+
+template <typename LowLengths>
+struct transform_split_lengths<Merge_v2_magic_division<LowLengths>>
+{
+    using type = typename static_lengths<LowLengths>::type;
+};
+
+template <typename LowLengths>
+struct transform_split_lengths<Merge_v2r2_magic_division<LowLengths>>
+{
+    using type = typename static_lengths<LowLengths>::type;
+};
+
+template <typename LowLengths>
+struct transform_split_lengths<Merge_v3_division_mod<LowLengths>>
+{
+    using type = typename static_lengths<LowLengths>::type;
+};
+
+enum struct TransformChainSimplificationRule
+{
+    None,
+    RemovePassThrough,
+    UnMergeMerge,
+    ComposeEmbed
+};
+
+struct TransformChainSimplification
+{
+    TransformChainSimplificationRule rule_;
+    index_t itran_; // transform to remove or replace
+    index_t jtran_; // transform above itran_ to fuse into it
+    index_t idim_;  // upper dimension of itran_ written by jtran_
+};
+
+template <typename Transforms,
+          typename LowerDimensionHiddenIdss,
+          typename UpperDimensionHiddenIdss,
+          typename BottomDimensionHiddenIds,
+          typename TopDimensionHiddenIds>
+struct transform_chain_graph;
+
+template <typename... Transforms,
+          typename... LowerIds,
+          typename... UpperIds,
+          typename BottomDimensionHiddenIds,
+          typename TopDimensionHiddenIds>
+struct transform_chain_graph<Tuple<Transforms...>,
+                             Tuple<LowerIds...>,
+                             Tuple<UpperIds...>,
+                             BottomDimensionHiddenIds,
+                             TopDimensionHiddenIds>
+{
+    static constexpr index_t ntransform_ = sizeof...(Transforms);
+
+    using Kinds = Sequence<static_cast<index_t>(transform_kind<Transforms>::value)...>;
+
+    // ids of all transforms flattened
+    using LowerSizes = Sequence<LowerIds::Size()...>;
+    using UpperSizes = Sequence<UpperIds::Size()...>;
+    using LowerFlat  = typename sequence_merge<Sequence<>, LowerIds...>::type;
+    using UpperFlat  = typename sequence_merge<Sequence<>, UpperIds...>::type;
+
+    // lengths split by the UnMerges and merged by the Merges, flattened
+    using SplitLengthSizes = Sequence<transform_split_lengths<Transforms>::type::Size()...>;
+    using SplitLengthsFlat =
+        typename sequence_merge<Sequence<>, typename transform_split_lengths<Transforms>::type...>::
+            type;
+
+    __host__ __device__ static constexpr TransformKind GetKind(index_t itran)
+    {
+        return static_cast<TransformKind>(Kinds::At(itran));
+    }
+
+    __host__ __device__ static constexpr index_t GetNumOfLower(index_t itran)
+    {
+        return LowerSizes::At(itran);
+    }
+
+    __host__ __device__ static constexpr index_t GetNumOfUpper(index_t itran)
+    {
+        return UpperSizes::At(itran);
+    }
+
+    __host__ __device__ static constexpr index_t GetLowerId(index_t itran, index_t idim)
+    {
+        index_t offset = 0;
+
+        for(index_t i = 0; i < itran; ++i)
+        {
+            offset += LowerSizes::At(i);
+        }
+
+        return LowerFlat::At(offset + idim);
+    }
+
+    __host__ __device__ static constexpr index_t GetUpperId(index_t itran, index_t idim)
+    {
+        index_t offset = 0;
+
+        for(index_t i = 0; i < itran; ++i)
+        {
+            offset += UpperSizes::At(i);
+        }
+
+        return UpperFlat::At(offset + idim);
+    }
+
+    __host__ __device__ static constexpr index_t GetSplitLength(index_t itran, index_t idim)
+    {
+        index_t offset = 0;
+
+        for(index_t i = 0; i < itran; ++i)
+        {
+            offset += SplitLengthSizes::At(i);
+        }
+
+        return SplitLengthsFlat::At(offset + idim);
+    }
+
+    __host__ __device__ static constexpr bool IsTop(index_t id)
+    {
+        for(index_t i = 0; i < TopDimensionHiddenIds::Size(); ++i)
+        {
+            if(TopDimensionHiddenIds::At(i) == id)
+                return true;
+        }
+
+        return false;
+    }
+
+    __host__ __device__ static constexpr bool IsBottom(index_t id)
+    {
+        for(index_t i = 0; i < BottomDimensionHiddenIds::Size(); ++i)
+        {
+            if(BottomDimensionHiddenIds::At(i) == id)
+                return true;
+        }
+
+        return false;
+    }
+
+    // whether hidden dimension id is only read by transform itran
+    __host__ __device__ static constexpr bool IsReadOnlyBy(index_t id, index_t itran)
+    {
+        if(IsTop(id))
+            return false;
+
+        for(index_t jtran = 0; jtran < ntransform_; ++jtran)
+        {
+            for(index_t idim = 0; idim < GetNumOfUpper(jtran); ++idim)
+            {
+                if(jtran != itran && GetUpperId(jtran, idim) == id)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    __host__ __device__ static constexpr bool IsAffine(index_t itran)
+    {
+        return GetKind(itran) == TransformKind::Embed || GetKind(itran) == TransformKind::UnMerge;
+    }
+
+    // first simplification found, from the bottom of the chain
+    __host__ __device__ static constexpr TransformChainSimplification FindSimplification()
+    {
+        using Rule = TransformChainSimplificationRule;
+
+        for(index_t itran = 0; itran < ntransform_; ++itran)
+        {
+            if(GetKind(itran) == TransformKind::PassThrough &&
+               !(IsBottom(GetLowerId(itran, 0)) && IsTop(GetUpperId(itran, 0))))
+            {
+                return TransformChainSimplification{Rule::RemovePassThrough, itran, -1, -1};
+            }
+
+            for(index_t jtran = itran + 1; jtran < ntransform_; ++jtran)
+            {
+                if(GetKind(itran) == TransformKind::UnMerge &&
+                   GetKind(jtran) == TransformKind::Merge &&
+                   GetNumOfLower(jtran) == GetNumOfUpper(itran))
+                {
+                    bool is_identity = true;
+
+                    for(index_t idim = 0; idim < GetNumOfUpper(itran); ++idim)
+                    {
+                        const index_t id = GetUpperId(itran, idim);
+
+                        // the lengths have to match, which is only known at compile time
+                        const index_t length = GetSplitLength(itran, idim);
+
+                        is_identity &= GetLowerId(jtran, idim) == id && IsReadOnlyBy(id, itran) &&
+                                       length > 0 && GetSplitLength(jtran, idim) == length;
+                    }
+
+                    if(is_identity)
+                    {
+                        return TransformChainSimplification{Rule::UnMergeMerge, itran, jtran, -1};
+                    }
+                }
+
+                if(IsAffine(itran) && IsAffine(jtran) && GetNumOfLower(jtran) == 1)
+                {
+                    for(index_t idim = 0; idim < GetNumOfUpper(itran); ++idim)
+                    {
+                        const index_t id = GetUpperId(itran, idim);
+
+                        if(GetLowerId(jtran, 0) == id && IsReadOnlyBy(id, itran))
+                        {
+                            return TransformChainSimplification{
+                                Rule::ComposeEmbed, itran, jtran, idim};
+                        }
+                    }
+                }
+            }
+        }
+
+        return TransformChainSimplification{Rule::None, -1, -1, -1};
+    }
+};
+
+template <index_t From, index_t To, index_t... Is>
+__host__ __device__ constexpr auto rename_hidden_id(Sequence<Is...>)
+{
+    return Sequence<(Is == From ? To : Is)...>{};
+}
+
+template <index_t From, index_t To, typename... Seqs>
+__host__ __device__ constexpr auto rename_hidden_id(Tuple<Seqs...>)
+{
+    return Tuple<decltype(rename_hidden_id<From, To>(Seqs{}))...>{};
+}
+
+// number of distinct hidden ids less than id
+template <typename SortedUniqueIds>
+__host__ __device__ constexpr index_t get_hidden_id_rank(index_t id)
+{
+    index_t rank = 0;
+
+    for(index_t i = 0; i < SortedUniqueIds::Size(); ++i)
+    {
+        rank += SortedUniqueIds::At(i) < id ? 1 : 0;
+    }
+
+    return rank;
+}
+
+template <typename SortedUniqueIds, index_t... Is>
+__host__ __device__ constexpr auto renumber_hidden_ids(Sequence<Is...>)
+{
+    return Sequence<get_hidden_id_rank<SortedUniqueIds>(Is)...>{};
+}
+
+template <typename SortedUniqueIds, typename... Seqs>
+__host__ __device__ constexpr auto renumber_hidden_ids(Tuple<Seqs...>)
+{
+    return Tuple<decltype(renumber_hidden_ids<SortedUniqueIds>(Seqs{}))...>{};
+}
+
+// indices [0, N) without I
+template <index_t I, index_t N>
+using sequence_without_t =
+    typename sequence_merge<typename arithmetic_sequence_gen<0, I, 1>::type,
+                            typename arithmetic_sequence_gen<I + 1, N, 1>::type>::type;
+
+template <index_t I, typename X, typename Y>
+__host__ __device__ constexpr auto container_replace_element(const X& x, const Y& y)
+{
+    constexpr index_t n = X::Size();
+
+    using Before = typename arithmetic_sequence_gen<0, I, 1>::type;
+    using After  = typename arithmetic_sequence_gen<I + 1, n, 1>::type;
+
+    return container_concat(
+        get_container_subset(x, Before{}), make_tuple(y), get_container_subset(x, After{}));
+}
+
+template <typename Transform>
+__host__ __device__ constexpr auto get_embed_coefficients(const Transform& tran)
+{
+    if constexpr(transform_kind<Transform>::value == TransformKind::UnMerge)
+    {
+        return tran.up_lengths_scan_;
+    }
+    else
+    {
+        return tran.coefficients_;
+    }
+}
+
+// returns the simplified transforms, lower and upper ids of the transforms, bottom and top ids
+template <typename Transforms,
+          typename LowerDimensionHiddenIdss,
+          typename UpperDimensionHiddenIdss,
+          typename BottomDimensionHiddenIds,
+          typename TopDimensionHiddenIds>
+__host__ __device__ constexpr auto simplify_transform_chain(const Transforms& transforms,
+                                                            LowerDimensionHiddenIdss,
+                                                            UpperDimensionHiddenIdss,
+                                                            BottomDimensionHiddenIds,
+                                                            TopDimensionHiddenIds)
+{
+    using Graph = transform_chain_graph<Transforms,
+                                        LowerDimensionHiddenIdss,
+                                        UpperDimensionHiddenIdss,
+                                        BottomDimensionHiddenIds,
+                                        TopDimensionHiddenIds>;
+    using Rule  = TransformChainSimplificationRule;
+
+    constexpr index_t ntransform = Transforms::Size();
+    constexpr auto simplification = Graph::FindSimplification();
+    constexpr index_t itran       = simplification.itran_;
+    constexpr index_t jtran       = simplification.jtran_;
+
+    if constexpr(simplification.rule_ == Rule::RemovePassThrough)
+    {
+        constexpr index_t id_low = Graph::GetLowerId(itran, 0);
+        constexpr index_t id_up  = Graph::GetUpperId(itran, 0);
+
+        using Keep = sequence_without_t<itran, ntransform>;
+
+        constexpr auto low_idss = get_container_subset(LowerDimensionHiddenIdss{}, Keep{});
+        constexpr auto up_idss  = get_container_subset(UpperDimensionHiddenIdss{}, Keep{});
+
+        return simplify_transform_chain(get_container_subset(transforms, Keep{}),
+                                        rename_hidden_id<id_up, id_low>(low_idss),
+                                        rename_hidden_id<id_up, id_low>(up_idss),
+                                        BottomDimensionHiddenIds{},
+                                        rename_hidden_id<id_up, id_low>(TopDimensionHiddenIds{}));
+    }
+    else if constexpr(simplification.rule_ == Rule::UnMergeMerge)
+    {
+        const auto& merge = transforms.At(Number<jtran>{});
+
+        const auto pass_through =
+            make_pass_through_transform(merge.GetUpperLengths()[Number<0>{}]);
+
+        using Keep = sequence_without_t<jtran, ntransform>;
+
+        return simplify_transform_chain(
+            get_container_subset(container_replace_element<itran>(transforms, pass_through),
+                                 Keep{}),
+            get_container_subset(LowerDimensionHiddenIdss{}, Keep{}),
+            get_container_subset(
+                container_replace_element<itran>(UpperDimensionHiddenIdss{},
+                                                 UpperDimensionHiddenIdss{}.At(Number<jtran>{})),
+                Keep{}),
+            BottomDimensionHiddenIds{},
+            TopDimensionHiddenIds{});
+    }
+    else if constexpr(simplification.rule_ == Rule::ComposeEmbed)
+    {
+        constexpr index_t idim = simplification.idim_;
+        constexpr index_t ndim = Graph::GetNumOfUpper(itran);
+
+        using Before = typename arithmetic_sequence_gen<0, idim, 1>::type;
+        using After  = typename arithmetic_sequence_gen<idim + 1, ndim, 1>::type;
+
+        const auto& tran_i = transforms.At(Number<itran>{});
+        const auto& tran_j = transforms.At(Number<jtran>{});
+
+        const auto coefficients_i = get_embed_coefficients(tran_i);
+        const auto coefficient    = coefficients_i[Number<idim>{}];
+
+        const auto embed = make_embed_transform(
+            container_concat(get_container_subset(tran_i.GetUpperLengths(), Before{}),
+                             tran_j.GetUpperLengths(),
+                             get_container_subset(tran_i.GetUpperLengths(), After{})),
+            container_concat(
+                get_container_subset(coefficients_i, Before{}),
+                transform_tuples([&](auto c) { return c * coefficient; },
+                                 get_embed_coefficients(tran_j)),
+                get_container_subset(coefficients_i, After{})));
+
+        constexpr auto ids_up_i = UpperDimensionHiddenIdss{}.At(Number<itran>{});
+        constexpr auto ids_up_j = UpperDimensionHiddenIdss{}.At(Number<jtran>{});
+
+        constexpr auto ids_up = merge_sequences(
+            ids_up_i.Extract(Before{}), ids_up_j, ids_up_i.Extract(After{}));
+
+        using Keep = sequence_without_t<jtran, ntransform>;
+
+        return simplify_transform_chain(
+            get_container_subset(container_replace_element<itran>(transforms, embed), Keep{}),
+            get_container_subset(LowerDimensionHiddenIdss{}, Keep{}),
+            get_container_subset(
+                container_replace_element<itran>(UpperDimensionHiddenIdss{}, ids_up), Keep{}),
+            BottomDimensionHiddenIds{},
+            TopDimensionHiddenIds{});
+    }
+    else
+    {
+        // renumber the hidden ids left
+        using AllIds = typename sequence_merge<typename Graph::LowerFlat,
+                                               typename Graph::UpperFlat,
+                                               BottomDimensionHiddenIds,
+                                               TopDimensionHiddenIds>::type;
+
+        using SortedUniqueIds =
+            typename sequence_unique_sort<AllIds, math::less<index_t>, math::equal<index_t>>::type;
+
+        return make_tuple(transforms,
+                          renumber_hidden_ids<SortedUniqueIds>(LowerDimensionHiddenIdss{}),
+                          renumber_hidden_ids<SortedUniqueIds>(UpperDimensionHiddenIdss{}),
+                          renumber_hidden_ids<SortedUniqueIds>(BottomDimensionHiddenIds{}),
+                          renumber_hidden_ids<SortedUniqueIds>(TopDimensionHiddenIds{}));
+    }
+}
+
+} // namespace detail
+
+// Fuses the transforms of the adaptor that cancel or compose, following the rules of the
+// simplification of transform chains above. The simplified adaptor calculates the same bottom
+// index for every top index in range.
+template <typename TensorAdaptor>
+__host__ __device__ constexpr auto simplify_tensor_adaptor(const TensorAdaptor& adaptor)
+{
+    const auto chain =
+        detail::simplify_transform_chain(adaptor.GetTransforms(),
+                                         TensorAdaptor::GetLowerDimensionHiddenIdss(),
+                                         TensorAdaptor::GetUpperDimensionHiddenIdss(),
+                                         TensorAdaptor::GetBottomDimensionHiddenIds(),
+                                         TensorAdaptor::GetTopDimensionHiddenIds());
+
+    const auto& transforms = chain.At(Number<0>{});
+
+    return ck::TensorAdaptor<remove_cvref_t<decltype(transforms)>,
+                             remove_cvref_t<decltype(chain.At(Number<1>{}))>,
+                             remove_cvref_t<decltype(chain.At(Number<2>{}))>,
+                             remove_cvref_t<decltype(chain.At(Number<3>{}))>,
+                             remove_cvref_t<decltype(chain.At(Number<4>{}))>>{transforms};
+}
+
+// Same as simplify_tensor_adaptor(), for a descriptor: the simplified descriptor calculates the
+// same offset and validity for every visible index in range, with fewer hidden dimensions to
+// update when a coordinate moves.
+template <typename Transforms,
+          typename LowerDimensionIdss,
+          typename UpperDimensionIdss,
+          typename VisibleDimensionIds,
+          typename ElementSpaceSize>
+__host__ __device__ constexpr auto
+simplify_tensor_descriptor(const TensorDescriptor<Transforms,
+                                                  LowerDimensionIdss,
+                                                  UpperDimensionIdss,
+                                                  VisibleDimensionIds,
+                                                  ElementSpaceSize>& desc)
+{
+    // hidden dimension 0 is the offset, it keeps id 0 after renumbering
+    const auto chain = detail::simplify_transform_chain(desc.GetTransforms(),
+                                                        LowerDimensionIdss{},
+                                                        UpperDimensionIdss{},
+                                                        Sequence<0>{},
+                                                        VisibleDimensionIds{});
+
+    const auto& transforms = chain.At(Number<0>{});
+
+    return TensorDescriptor<remove_cvref_t<decltype(transforms)>,
+                            remove_cvref_t<decltype(chain.At(Number<1>{}))>,
+                            remove_cvref_t<decltype(chain.At(Number<2>{}))>,
+                            remove_cvref_t<decltype(chain.At(Number<4>{}))>,
+                            ElementSpaceSize>{transforms, desc.GetElementSpaceSize()};
+}
+
 } // namespace ck
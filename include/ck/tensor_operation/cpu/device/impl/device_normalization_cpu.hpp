@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/ignore.hpp"
+#include "ck/tensor_operation/gpu/device/device_normalization.hpp"
+#include "ck/tensor_operation/cpu/grid/gridwise_normalization_cpu.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// DeviceNormalization running on the host CPU, the buffers passed to MakeArgumentPointer() are
+// host buffers. As with DeviceNormalizationImpl, the saved mean and inverse variance are not
+// written.
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename YDataType,
+          typename AccElementwiseOperation,
+          index_t Rank,
+          index_t NumReduceDim,
+          index_t VectorSize,
+          index_t MinWorkPerThread>
+struct DeviceNormalizationCpu : public DeviceNormalization<XDataType,
+                                                           GammaDataType,
+                                                           BetaDataType,
+                                                           AccDataType,
+                                                           YDataType,
+                                                           AccElementwiseOperation,
+                                                           Rank,
+                                                           NumReduceDim>
+{
+    using GridwiseNormalization = cpu::GridwiseNormalizationCpu<XDataType,
+                                                                GammaDataType,
+                                                                BetaDataType,
+                                                                AccDataType,
+                                                                YDataType,
+                                                                AccElementwiseOperation,
+                                                                VectorSize,
+                                                                MinWorkPerThread>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::vector<index_t> lengths,
+                 const std::vector<index_t> xStrides,
+                 const std::vector<index_t> gammaStrides,
+                 const std::vector<index_t> betaStrides,
+                 const std::vector<index_t> yStrides,
+                 const std::vector<index_t> reduceDims,
+                 AccElementwiseOperation acc_elementwise_op,
+                 AccDataType epsilon,
+                 const XDataType* p_x,
+                 const GammaDataType* p_gamma,
+                 const BetaDataType* p_beta,
+                 YDataType* p_y)
+            : p_x_(p_x),
+              p_gamma_(p_gamma),
+              p_beta_(p_beta),
+              p_y_(p_y),
+              acc_elementwise_op_(acc_elementwise_op),
+              valid_(true)
+        {
+            if(lengths.size() != Rank || xStrides.size() != Rank || gammaStrides.size() != Rank ||
+               betaStrides.size() != Rank || yStrides.size() != Rank ||
+               reduceDims.size() != NumReduceDim)
+            {
+                valid_ = false;
+                return;
+            }
+
+            for(auto dim : reduceDims)
+            {
+                if(dim < 0 || dim >= Rank)
+                {
+                    valid_ = false;
+                    return;
+                }
+            }
+
+            const auto invariantDims = cpu::TensorIndexer::GetDims(Rank, reduceDims);
+
+            problem_ = typename GridwiseNormalization::Problem{
+                cpu::TensorIndexer{lengths, xStrides, invariantDims},
+                cpu::TensorIndexer{lengths, xStrides, reduceDims},
+                cpu::TensorIndexer{lengths, gammaStrides, invariantDims},
+                cpu::TensorIndexer{lengths, gammaStrides, reduceDims},
+                cpu::TensorIndexer{lengths, betaStrides, invariantDims},
+                cpu::TensorIndexer{lengths, betaStrides, reduceDims},
+                cpu::TensorIndexer{lengths, yStrides, invariantDims},
+                cpu::TensorIndexer{lengths, yStrides, reduceDims},
+                epsilon};
+        }
+
+        const XDataType* p_x_;
+        const GammaDataType* p_gamma_;
+        const BetaDataType* p_beta_;
+        YDataType* p_y_;
+        AccElementwiseOperation acc_elementwise_op_;
+        typename GridwiseNormalization::Problem problem_;
+        bool valid_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            return launch_and_time_cpu_kernel(stream_config, [&]() {
+                GridwiseNormalization::Run(arg.p_x_,
+                                           arg.p_gamma_,
+                                           arg.p_beta_,
+                                           arg.p_y_,
+                                           arg.problem_,
+                                           arg.acc_elementwise_op_);
+            });
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg) { return arg.valid_; }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const std::vector<index_t> lengths,
+                        const std::vector<index_t> xStrides,
+                        const std::vector<index_t> gammaStrides,
+                        const std::vector<index_t> betaStrides,
+                        const std::vector<index_t> yStrides,
+                        const std::vector<index_t> reduceDims,
+                        AccDataType epsilon,
+                        const void* p_x,
+                        const void* p_gamma,
+                        const void* p_beta,
+                        void* p_y,
+                        void* p_saveMean,
+                        void* p_saveInvVar,
+                        AccElementwiseOperation acc_elementwise_op) override
+    {
+        ignore = p_saveMean;
+        ignore = p_saveInvVar;
+
+        return std::make_unique<Argument>(lengths,
+                                          xStrides,
+                                          gammaStrides,
+                                          betaStrides,
+                                          yStrides,
+                                          reduceDims,
+                                          acc_elementwise_op,
+                                          epsilon,
+                                          static_cast<const XDataType*>(p_x),
+                                          static_cast<const GammaDataType*>(p_gamma),
+                                          static_cast<const BetaDataType*>(p_beta),
+                                          static_cast<YDataType*>(p_y));
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceNormalizationCpu<"
+            << "VectorSize_" << VectorSize << ","
+            << "MinWorkPerThread_" << MinWorkPerThread << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
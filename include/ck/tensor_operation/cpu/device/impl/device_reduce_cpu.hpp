@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <sstream>
+
+#include "ck/tensor_operation/gpu/device/device_reduce.hpp"
+#include "ck/tensor_operation/cpu/grid/gridwise_reduction_cpu.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// DeviceReduce running on the host CPU, the buffers passed to MakeArgumentPointer() are host
+// buffers. Any layout of the input and output is supported.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          index_t Rank,
+          index_t NumReduceDim,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan,
+          bool OutputIndex,
+          index_t VectorSize,
+          index_t MinWorkPerThread>
+struct DeviceReduceCpu
+    : public DeviceReduce<Rank, NumReduceDim, InElementwiseOperation, AccElementwiseOperation>
+{
+    using IndexDataType = int32_t;
+
+    static constexpr index_t NumInvariantDim = Rank - NumReduceDim;
+    static constexpr index_t NumDstDim       = (NumInvariantDim == 0) ? 1 : NumInvariantDim;
+
+    using GridwiseReduce = cpu::GridwiseReductionCpu<InDataType,
+                                                     AccDataType,
+                                                     OutDataType,
+                                                     IndexDataType,
+                                                     ReduceOperation,
+                                                     InElementwiseOperation,
+                                                     AccElementwiseOperation,
+                                                     PropagateNan,
+                                                     OutputIndex,
+                                                     VectorSize,
+                                                     MinWorkPerThread>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(const std::array<index_t, Rank> inLengths,
+                 const std::array<index_t, Rank> inStrides,
+                 const std::array<index_t, NumDstDim> outLengths,
+                 const std::array<index_t, NumDstDim> outStrides,
+                 const std::array<int, NumReduceDim> reduceDims,
+                 float alpha,
+                 float beta,
+                 const InDataType* in_dev,
+                 OutDataType* out_dev,
+                 IndexDataType* out_index_dev,
+                 const InElementwiseOperation in_elementwise_op,
+                 const AccElementwiseOperation acc_elementwise_op)
+            : in_dev_{in_dev},
+              out_dev_{out_dev},
+              out_index_dev_{out_index_dev},
+              in_elementwise_op_{in_elementwise_op},
+              acc_elementwise_op_{acc_elementwise_op},
+              valid_{true}
+        {
+            for(std::size_t i = 0; i < NumReduceDim; ++i)
+            {
+                if(reduceDims[i] < 0 || reduceDims[i] >= Rank)
+                {
+                    valid_ = false;
+                    return;
+                }
+            }
+
+            const auto invariantDims = cpu::TensorIndexer::GetDims(Rank, reduceDims);
+
+            // the output dimensions follow the invariant dimensions of the input
+            for(std::size_t i = 0; i < invariantDims.size(); ++i)
+            {
+                if(outLengths[i] != inLengths[static_cast<std::size_t>(invariantDims[i])])
+                {
+                    valid_ = false;
+                    return;
+                }
+            }
+
+            problem_ = typename GridwiseReduce::Problem{
+                cpu::TensorIndexer{inLengths, inStrides, invariantDims},
+                cpu::TensorIndexer{inLengths, inStrides, reduceDims},
+                cpu::TensorIndexer{outLengths, outStrides},
+                alpha,
+                beta};
+        }
+
+        const InDataType* in_dev_;
+        OutDataType* out_dev_;
+        IndexDataType* out_index_dev_;
+        InElementwiseOperation in_elementwise_op_;
+        AccElementwiseOperation acc_elementwise_op_;
+        typename GridwiseReduce::Problem problem_;
+        bool valid_;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            return launch_and_time_cpu_kernel(stream_config, [&]() {
+                GridwiseReduce::Run(arg.in_dev_,
+                                    arg.out_dev_,
+                                    arg.out_index_dev_,
+                                    arg.problem_,
+                                    arg.in_elementwise_op_,
+                                    arg.acc_elementwise_op_);
+            });
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        return arg.valid_ && (!OutputIndex || arg.out_index_dev_ != nullptr);
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const std::array<index_t, Rank> inLengths,
+                        const std::array<index_t, Rank> inStrides,
+                        const std::array<index_t, NumDstDim> outLengths,
+                        const std::array<index_t, NumDstDim> outStrides,
+                        const std::array<int, NumReduceDim> reduceDims,
+                        float alpha,
+                        float beta,
+                        const void* in_dev,
+                        const void* in_index_dev,
+                        void* out_dev,
+                        void* out_index_dev,
+                        const InElementwiseOperation in_elementwise_op,
+                        const AccElementwiseOperation acc_elementwise_op) override
+    {
+        (void)in_index_dev;
+
+        return std::make_unique<Argument>(inLengths,
+                                          inStrides,
+                                          outLengths,
+                                          outStrides,
+                                          reduceDims,
+                                          alpha,
+                                          beta,
+                                          static_cast<const InDataType*>(in_dev),
+                                          static_cast<OutDataType*>(out_dev),
+                                          static_cast<IndexDataType*>(out_index_dev),
+                                          in_elementwise_op,
+                                          acc_elementwise_op);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceReduceCpu<"
+            << "VectorSize_" << VectorSize << ","
+            << "MinWorkPerThread_" << MinWorkPerThread << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+// Memory offsets of the elements of some dimensions of a strided tensor, enumerated by a linear
+// index in row-major order of the selected dimensions. Dimensions of length 1 are dropped and
+// neighbouring dimensions that are contiguous with each other are merged, so that a packed range
+// is walked as a single dimension of stride 1.
+struct TensorIndexer
+{
+    TensorIndexer() = default;
+
+    template <typename Lengths, typename Strides, typename Dims>
+    TensorIndexer(const Lengths& lengths, const Strides& strides, const Dims& dims)
+    {
+        for(auto dim : dims)
+        {
+            const long_index_t length = lengths[static_cast<std::size_t>(dim)];
+            const long_index_t stride = strides[static_cast<std::size_t>(dim)];
+
+            length_ *= length;
+
+            if(length == 1)
+            {
+                continue;
+            }
+
+            if(!lengths_.empty() && strides_.back() == length * stride)
+            {
+                lengths_.back() *= length;
+                strides_.back() = stride;
+            }
+            else
+            {
+                lengths_.push_back(length);
+                strides_.push_back(stride);
+            }
+        }
+    }
+
+    // all dimensions
+    template <typename Lengths, typename Strides>
+    TensorIndexer(const Lengths& lengths, const Strides& strides)
+        : TensorIndexer(lengths,
+                        strides,
+                        GetDims(static_cast<index_t>(lengths.size()), std::vector<index_t>{}))
+    {
+    }
+
+    // dimensions of [0, rank) that are not in excluded_dims, in increasing order
+    template <typename Dims>
+    static std::vector<index_t> GetDims(index_t rank, const Dims& excluded_dims)
+    {
+        std::vector<index_t> dims;
+
+        for(index_t dim = 0; dim < rank; ++dim)
+        {
+            if(std::find(excluded_dims.begin(), excluded_dims.end(), dim) == excluded_dims.end())
+            {
+                dims.push_back(dim);
+            }
+        }
+
+        return dims;
+    }
+
+    long_index_t GetLength() const { return length_; }
+
+    bool IsPacked() const { return lengths_.empty() || (lengths_.size() == 1 && strides_[0] == 1); }
+
+    long_index_t GetOffset(long_index_t i) const
+    {
+        long_index_t offset = 0;
+
+        for(std::size_t d = lengths_.size(); d-- > 0;)
+        {
+            offset += i % lengths_[d] * strides_[d];
+            i /= lengths_[d];
+        }
+
+        return offset;
+    }
+
+    // calls f(i, offset) for i in [begin, end), with one index computation per run along the
+    // innermost merged dimension
+    template <typename F>
+    void ForEachOffset(long_index_t begin, long_index_t end, F&& f) const
+    {
+        if(lengths_.empty())
+        {
+            for(long_index_t i = begin; i < end; ++i)
+            {
+                f(i, long_index_t{0});
+            }
+
+            return;
+        }
+
+        const long_index_t inner_length = lengths_.back();
+        const long_index_t inner_stride = strides_.back();
+
+        for(long_index_t i = begin; i < end;)
+        {
+            const long_index_t offset = GetOffset(i);
+            const long_index_t run    = std::min(end - i, inner_length - i % inner_length);
+
+            if(inner_stride == 1)
+            {
+                for(long_index_t k = 0; k < run; ++k)
+                {
+                    f(i + k, offset + k);
+                }
+            }
+            else
+            {
+                for(long_index_t k = 0; k < run; ++k)
+                {
+                    f(i + k, offset + k * inner_stride);
+                }
+            }
+
+            i += run;
+        }
+    }
+
+    private:
+    std::vector<long_index_t> lengths_;
+    std::vector<long_index_t> strides_;
+    long_index_t length_ = 1;
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
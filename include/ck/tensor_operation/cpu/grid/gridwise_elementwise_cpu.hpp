@@ -0,0 +1,300 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/functional4.hpp"
+#include "ck/utility/tuple_helper.hpp"
+#include "ck/tensor_operation/cpu/grid/cpu_tensor_indexer.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+// Elementwise operation on the host: out_0, .., out_m = op(in_0, .., in_n) for every element of an
+// NumDim dimensional shape, with each tensor having its own strides.
+//
+// The dimensions are first merged wherever all the tensors are contiguous across them, so that
+// tensors with the same packed layout are walked as a single dimension. The elements are then
+// distributed over the threads in contiguous ranges of the linear index, and walked in runs along
+// the innermost merged dimension. When all the tensors have a stride of 1 in that dimension, the
+// run is processed in blocks of VectorSize unrolled elements that the compiler maps to SIMD
+// instructions.
+template <typename InDataTypePointerTuple,
+          typename OutDataTypePointerTuple,
+          typename ElementwiseOperation,
+          index_t NumDim,
+          index_t VectorSize,
+          index_t MinWorkPerThread>
+struct GridwiseElementwiseCpu
+{
+    static_assert(VectorSize > 0 && MinWorkPerThread > 0, "wrong! invalid configuration");
+
+    static constexpr index_t NumInput  = InDataTypePointerTuple::Size();
+    static constexpr index_t NumOutput = OutDataTypePointerTuple::Size();
+
+    struct Problem
+    {
+        long_index_t length_;
+        long_index_t inner_length_;
+        std::array<TensorIndexer, NumInput> in_outer_;
+        std::array<TensorIndexer, NumOutput> out_outer_;
+        std::array<long_index_t, NumInput> in_inner_strides_;
+        std::array<long_index_t, NumOutput> out_inner_strides_;
+    };
+
+    static Problem
+    MakeProblem(const std::array<index_t, NumDim>& lengths,
+                const std::array<std::array<index_t, NumDim>, NumInput>& in_strides,
+                const std::array<std::array<index_t, NumDim>, NumOutput>& out_strides)
+    {
+        constexpr index_t NumTensor = NumInput + NumOutput;
+
+        auto get_stride = [&](index_t t, index_t d) {
+            const auto dim = static_cast<std::size_t>(d);
+
+            return t < NumInput
+                       ? long_index_t{in_strides[static_cast<std::size_t>(t)][dim]}
+                       : long_index_t{out_strides[static_cast<std::size_t>(t - NumInput)][dim]};
+        };
+
+        // dimensions merged over all the tensors
+        std::vector<long_index_t> merged_lengths;
+        std::array<std::vector<long_index_t>, NumTensor> merged_strides;
+
+        Problem problem;
+
+        problem.length_ = 1;
+
+        for(index_t d = 0; d < NumDim; ++d)
+        {
+            const long_index_t length = lengths[static_cast<std::size_t>(d)];
+
+            problem.length_ *= length;
+
+            if(length == 1)
+            {
+                continue;
+            }
+
+            bool is_contiguous = !merged_lengths.empty();
+
+            for(index_t t = 0; t < NumTensor && is_contiguous; ++t)
+            {
+                is_contiguous = merged_strides[static_cast<std::size_t>(t)].back() ==
+                                length * get_stride(t, d);
+            }
+
+            if(is_contiguous)
+            {
+                merged_lengths.back() *= length;
+            }
+            else
+            {
+                merged_lengths.push_back(length);
+            }
+
+            for(index_t t = 0; t < NumTensor; ++t)
+            {
+                auto& strides = merged_strides[static_cast<std::size_t>(t)];
+
+                if(is_contiguous)
+                {
+                    strides.back() = get_stride(t, d);
+                }
+                else
+                {
+                    strides.push_back(get_stride(t, d));
+                }
+            }
+        }
+
+        if(merged_lengths.empty())
+        {
+            merged_lengths.push_back(1);
+
+            for(auto& strides : merged_strides)
+            {
+                strides.push_back(0);
+            }
+        }
+
+        const auto outer_dims = TensorIndexer::GetDims(
+            static_cast<index_t>(merged_lengths.size()),
+            std::vector<index_t>{static_cast<index_t>(merged_lengths.size()) - 1});
+
+        problem.inner_length_ = merged_lengths.back();
+
+        for(std::size_t t = 0; t < NumTensor; ++t)
+        {
+            const auto& strides = merged_strides[t];
+
+            if(t < NumInput)
+            {
+                problem.in_outer_[t]         = TensorIndexer{merged_lengths, strides, outer_dims};
+                problem.in_inner_strides_[t] = strides.back();
+            }
+            else
+            {
+                const std::size_t u = t - NumInput;
+
+                problem.out_outer_[u]         = TensorIndexer{merged_lengths, strides, outer_dims};
+                problem.out_inner_strides_[u] = strides.back();
+            }
+        }
+
+        return problem;
+    }
+
+    static void Run(const InDataTypePointerTuple& p_ins,
+                    const OutDataTypePointerTuple& p_outs,
+                    const Problem& problem,
+                    const ElementwiseOperation& elementwise_op,
+                    std::size_t num_thread = get_cpu_num_thread())
+    {
+        if(problem.length_ == 0)
+        {
+            return;
+        }
+
+        const bool is_inner_packed =
+            std::all_of(problem.in_inner_strides_.begin(),
+                        problem.in_inner_strides_.end(),
+                        [](long_index_t stride) { return stride == 1; }) &&
+            std::all_of(problem.out_inner_strides_.begin(),
+                        problem.out_inner_strides_.end(),
+                        [](long_index_t stride) { return stride == 1; });
+
+        const auto num_thread_for_work =
+            static_cast<std::size_t>(std::max(problem.length_ / MinWorkPerThread, long_index_t{1}));
+
+        const long_index_t inner_length = problem.inner_length_;
+
+        cpu_parallel_for(
+            static_cast<index_t>(problem.length_),
+            [&](index_t begin, index_t end) {
+                for(long_index_t i = begin; i < end;)
+                {
+                    const long_index_t row = i / inner_length;
+                    const long_index_t col = i % inner_length;
+                    const long_index_t run = std::min(end - i, inner_length - col);
+
+                    const auto p_in_run = generate_tuple(
+                        [&](auto I) {
+                            return p_ins[I] + problem.in_outer_[I].GetOffset(row) +
+                                   col * problem.in_inner_strides_[I];
+                        },
+                        Number<NumInput>{});
+
+                    const auto p_out_run = generate_tuple(
+                        [&](auto I) {
+                            return p_outs[I] + problem.out_outer_[I].GetOffset(row) +
+                                   col * problem.out_inner_strides_[I];
+                        },
+                        Number<NumOutput>{});
+
+                    if(is_inner_packed)
+                    {
+                        RunPacked(p_in_run, p_out_run, run, elementwise_op);
+                    }
+                    else
+                    {
+                        RunStrided(p_in_run, p_out_run, run, problem, elementwise_op);
+                    }
+
+                    i += run;
+                }
+            },
+            std::min(num_thread, num_thread_for_work));
+    }
+
+    private:
+    template <typename InPointers, typename OutPointers>
+    static void Apply(const InPointers& p_ins,
+                      const OutPointers& p_outs,
+                      const std::array<long_index_t, NumInput>& in_offsets,
+                      const std::array<long_index_t, NumOutput>& out_offsets,
+                      const ElementwiseOperation& elementwise_op)
+    {
+        const auto in_data_refs = generate_tie(
+            // return type should be lvalue
+            [&](auto I) -> const auto& { return p_ins[I][in_offsets[I]]; },
+            Number<NumInput>{});
+
+        auto out_data_refs = generate_tie(
+            // return type should be lvalue
+            [&](auto I) -> auto& { return p_outs[I][out_offsets[I]]; },
+            Number<NumOutput>{});
+
+        unpack2(elementwise_op, out_data_refs, in_data_refs);
+    }
+
+    template <typename InPointers, typename OutPointers>
+    static void RunPacked(const InPointers& p_ins,
+                          const OutPointers& p_outs,
+                          long_index_t length,
+                          const ElementwiseOperation& elementwise_op)
+    {
+        auto apply = [&](long_index_t k) {
+            const auto in_data_refs = generate_tie(
+                // return type should be lvalue
+                [&](auto I) -> const auto& { return p_ins[I][k]; },
+                Number<NumInput>{});
+
+            auto out_data_refs = generate_tie(
+                // return type should be lvalue
+                [&](auto I) -> auto& { return p_outs[I][k]; },
+                Number<NumOutput>{});
+
+            unpack2(elementwise_op, out_data_refs, in_data_refs);
+        };
+
+        long_index_t k = 0;
+
+        for(; k + VectorSize <= length; k += VectorSize)
+        {
+            static_for<0, VectorSize, 1>{}([&](auto v) { apply(k + v); });
+        }
+
+        for(; k < length; ++k)
+        {
+            apply(k);
+        }
+    }
+
+    template <typename InPointers, typename OutPointers>
+    static void RunStrided(const InPointers& p_ins,
+                           const OutPointers& p_outs,
+                           long_index_t length,
+                           const Problem& problem,
+                           const ElementwiseOperation& elementwise_op)
+    {
+        std::array<long_index_t, NumInput> in_offsets   = {};
+        std::array<long_index_t, NumOutput> out_offsets = {};
+
+        for(long_index_t k = 0; k < length; ++k)
+        {
+            Apply(p_ins, p_outs, in_offsets, out_offsets, elementwise_op);
+
+            for(std::size_t t = 0; t < NumInput; ++t)
+            {
+                in_offsets[t] += problem.in_inner_strides_[t];
+            }
+
+            for(std::size_t t = 0; t < NumOutput; ++t)
+            {
+                out_offsets[t] += problem.out_inner_strides_[t];
+            }
+        }
+    }
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/math.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/cpu/thread/cpu_gemm_micro_kernel.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+// Blocked GEMM on the host, possibly batched: c[g, m, n] = c_op(sum_k a_op(a[g, m, k]) *
+// b_op(b[g, k, n])), with the same element-wise semantics as ReferenceGemm.
+//
+// C tiles of MPerBlock x NPerBlock are distributed over the threads. For each KPerBlock slice,
+// a thread packs the A and B blocks, converted to AccDataType and padded with zeros, into panels
+// of the micro-kernel's MPerThread rows and NPerThread columns, and accumulates the tile with
+// the micro-kernel in a buffer of AccDataType. The tile is written to C once, after the last slice.
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t KPerBlock,
+          CpuGemmMicroKernelType MicroKernelType>
+struct GridwiseGemmCpu
+{
+    using MicroKernel = CpuGemmMicroKernel<AccDataType, MicroKernelType>;
+
+    static constexpr index_t MPerThread = MicroKernel::MPerThread;
+    static constexpr index_t NPerThread = MicroKernel::NPerThread;
+
+    static_assert(MPerBlock % MPerThread == 0 && NPerBlock % NPerThread == 0 && KPerBlock > 0,
+                  "wrong! block tile is not a multiple of the micro-kernel tile");
+
+    static constexpr bool IsRowMajor(const tensor_layout::gemm::RowMajor&) { return true; }
+    static constexpr bool IsRowMajor(const tensor_layout::gemm::ColumnMajor&) { return false; }
+
+    static constexpr bool ARowMajor = IsRowMajor(ALayout{});
+    static constexpr bool BRowMajor = IsRowMajor(BLayout{});
+    static constexpr bool CRowMajor = IsRowMajor(CLayout{});
+
+    struct Problem
+    {
+        index_t M;
+        index_t N;
+        index_t K;
+        index_t StrideA;
+        index_t StrideB;
+        index_t StrideC;
+        index_t BatchCount   = 1;
+        index_t BatchStrideA = 0;
+        index_t BatchStrideB = 0;
+        index_t BatchStrideC = 0;
+    };
+
+    static bool CheckValidity(const Problem& problem)
+    {
+        if(!MicroKernel::IsSupported())
+        {
+            return false;
+        }
+
+        if(problem.M < 0 || problem.N < 0 || problem.K < 0 || problem.BatchCount < 0)
+        {
+            return false;
+        }
+
+        // strides of the contiguous dimensions can not be smaller than their lengths
+        const bool valid_stride_a = problem.StrideA >= (ARowMajor ? problem.K : problem.M);
+        const bool valid_stride_b = problem.StrideB >= (BRowMajor ? problem.N : problem.K);
+        const bool valid_stride_c = problem.StrideC >= (CRowMajor ? problem.N : problem.M);
+
+        return valid_stride_a && valid_stride_b && valid_stride_c && problem.BatchStrideA >= 0 &&
+               problem.BatchStrideB >= 0 && problem.BatchStrideC >= 0;
+    }
+
+    static void Run(const ADataType* p_a,
+                    const BDataType* p_b,
+                    CDataType* p_c,
+                    const Problem& problem,
+                    const AElementwiseOperation& a_element_op,
+                    const BElementwiseOperation& b_element_op,
+                    const CElementwiseOperation& c_element_op,
+                    std::size_t num_thread = get_cpu_num_thread())
+    {
+        const index_t MBlock = math::integer_divide_ceil(problem.M, MPerBlock);
+        const index_t NBlock = math::integer_divide_ceil(problem.N, NPerBlock);
+
+        const index_t num_tile = problem.BatchCount * MBlock * NBlock;
+
+        cpu_parallel_for(
+            num_tile,
+            [&](index_t tile_begin, index_t tile_end) {
+                std::vector<AccDataType> a_block(MPerBlock * KPerBlock);
+                std::vector<AccDataType> b_block(KPerBlock * NPerBlock);
+                std::vector<AccDataType> c_block(MPerBlock * NPerBlock);
+
+                for(index_t tile = tile_begin; tile < tile_end; ++tile)
+                {
+                    // tiles along N are the fastest, so that consecutive tiles reuse rows of A
+                    const index_t g      = tile / (MBlock * NBlock);
+                    const index_t m_tile = tile / NBlock % MBlock;
+                    const index_t n_tile = tile % NBlock;
+
+                    RunTile(p_a + static_cast<long_index_t>(g) * problem.BatchStrideA,
+                            p_b + static_cast<long_index_t>(g) * problem.BatchStrideB,
+                            p_c + static_cast<long_index_t>(g) * problem.BatchStrideC,
+                            problem,
+                            m_tile * MPerBlock,
+                            n_tile * NPerBlock,
+                            a_element_op,
+                            b_element_op,
+                            c_element_op,
+                            a_block.data(),
+                            b_block.data(),
+                            c_block.data());
+                }
+            },
+            num_thread);
+    }
+
+    private:
+    static long_index_t GetOffsetA(const Problem& problem, index_t m, index_t k)
+    {
+        return ARowMajor ? static_cast<long_index_t>(m) * problem.StrideA + k
+                         : static_cast<long_index_t>(k) * problem.StrideA + m;
+    }
+
+    static long_index_t GetOffsetB(const Problem& problem, index_t k, index_t n)
+    {
+        return BRowMajor ? static_cast<long_index_t>(k) * problem.StrideB + n
+                         : static_cast<long_index_t>(n) * problem.StrideB + k;
+    }
+
+    static long_index_t GetOffsetC(const Problem& problem, index_t m, index_t n)
+    {
+        return CRowMajor ? static_cast<long_index_t>(m) * problem.StrideC + n
+                         : static_cast<long_index_t>(n) * problem.StrideC + m;
+    }
+
+    static void RunTile(const ADataType* p_a,
+                        const BDataType* p_b,
+                        CDataType* p_c,
+                        const Problem& problem,
+                        index_t m_begin,
+                        index_t n_begin,
+                        const AElementwiseOperation& a_element_op,
+                        const BElementwiseOperation& b_element_op,
+                        const CElementwiseOperation& c_element_op,
+                        AccDataType* p_a_block,
+                        AccDataType* p_b_block,
+                        AccDataType* p_c_block)
+    {
+        const index_t m_length = std::min(MPerBlock, problem.M - m_begin);
+        const index_t n_length = std::min(NPerBlock, problem.N - n_begin);
+
+        // micro-kernel tiles that hold at least one element of C
+        const index_t m_thread = math::integer_divide_ceil(m_length, MPerThread);
+        const index_t n_thread = math::integer_divide_ceil(n_length, NPerThread);
+
+        std::fill(p_c_block, p_c_block + MPerBlock * NPerBlock, AccDataType{0});
+
+        for(index_t k_begin = 0; k_begin < problem.K; k_begin += KPerBlock)
+        {
+            const index_t k_length = std::min(KPerBlock, problem.K - k_begin);
+
+            // A panels: [m_thread][k][MPerThread]
+            for(index_t mt = 0; mt < m_thread; ++mt)
+            {
+                AccDataType* p_panel = p_a_block + mt * MPerThread * KPerBlock;
+
+                for(index_t i = 0; i < MPerThread; ++i)
+                {
+                    const index_t m = mt * MPerThread + i;
+
+                    for(index_t k = 0; k < k_length; ++k)
+                    {
+                        AccDataType v = 0;
+
+                        if(m < m_length)
+                        {
+                            ADataType v_a;
+
+                            a_element_op(v_a, p_a[GetOffsetA(problem, m_begin + m, k_begin + k)]);
+
+                            v = type_convert<AccDataType>(v_a);
+                        }
+
+                        p_panel[k * MPerThread + i] = v;
+                    }
+                }
+            }
+
+            // B panels: [n_thread][k][NPerThread]
+            for(index_t nt = 0; nt < n_thread; ++nt)
+            {
+                AccDataType* p_panel = p_b_block + nt * NPerThread * KPerBlock;
+
+                for(index_t k = 0; k < k_length; ++k)
+                {
+                    for(index_t j = 0; j < NPerThread; ++j)
+                    {
+                        const index_t n = nt * NPerThread + j;
+
+                        AccDataType v = 0;
+
+                        if(n < n_length)
+                        {
+                            BDataType v_b;
+
+                            b_element_op(v_b, p_b[GetOffsetB(problem, k_begin + k, n_begin + n)]);
+
+                            v = type_convert<AccDataType>(v_b);
+                        }
+
+                        p_panel[k * NPerThread + j] = v;
+                    }
+                }
+            }
+
+            for(index_t mt = 0; mt < m_thread; ++mt)
+            {
+                for(index_t nt = 0; nt < n_thread; ++nt)
+                {
+                    MicroKernel::Run(k_length,
+                                     p_a_block + mt * MPerThread * KPerBlock,
+                                     p_b_block + nt * NPerThread * KPerBlock,
+                                     p_c_block + mt * MPerThread * NPerBlock + nt * NPerThread,
+                                     NPerBlock);
+                }
+            }
+        }
+
+        for(index_t m = 0; m < m_length; ++m)
+        {
+            for(index_t n = 0; n < n_length; ++n)
+            {
+                AccDataType v_c;
+
+                c_element_op(v_c, p_c_block[m * NPerBlock + n]);
+
+                p_c[GetOffsetC(problem, m_begin + m, n_begin + n)] = type_convert<CDataType>(v_c);
+            }
+        }
+    }
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/cpu/grid/cpu_tensor_indexer.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+// Normalization on the host with the semantics of ReferenceLayernorm: y = acc_op((x - mean(x)) /
+// sqrt(var(x) + epsilon) * gamma + beta), with mean and variance taken over the reduced
+// dimensions.
+//
+// Rows of the invariant dimensions are distributed over the threads. Each row of x is read from
+// memory once into a per-thread AccDataType buffer. Its mean and variance are computed with
+// Welford's online algorithm in VectorSize independent lanes, which are merged at the end with
+// Chan's formula. The rows of gamma and beta are gathered into per-thread buffers too, and are
+// only gathered again when their offset changes, which is not the case when they are broadcast
+// along the invariant dimensions.
+template <typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename YDataType,
+          typename AccElementwiseOperation,
+          index_t VectorSize,
+          index_t MinWorkPerThread>
+struct GridwiseNormalizationCpu
+{
+    static_assert(VectorSize > 0 && MinWorkPerThread > 0, "wrong! invalid configuration");
+
+    struct Problem
+    {
+        TensorIndexer x_invariant_;
+        TensorIndexer x_reduce_;
+        TensorIndexer gamma_invariant_;
+        TensorIndexer gamma_reduce_;
+        TensorIndexer beta_invariant_;
+        TensorIndexer beta_reduce_;
+        TensorIndexer y_invariant_;
+        TensorIndexer y_reduce_;
+        AccDataType epsilon_;
+    };
+
+    static void Run(const XDataType* p_x,
+                    const GammaDataType* p_gamma,
+                    const BetaDataType* p_beta,
+                    YDataType* p_y,
+                    const Problem& problem,
+                    const AccElementwiseOperation& acc_element_op,
+                    std::size_t num_thread = get_cpu_num_thread())
+    {
+        const long_index_t invariant_length = problem.x_invariant_.GetLength();
+        const long_index_t reduce_length    = problem.x_reduce_.GetLength();
+
+        if(invariant_length == 0 || reduce_length == 0)
+        {
+            return;
+        }
+
+        const auto num_thread_for_work = static_cast<std::size_t>(
+            std::max(invariant_length * reduce_length / MinWorkPerThread, long_index_t{1}));
+
+        cpu_parallel_for(
+            static_cast<index_t>(invariant_length),
+            [&](index_t row_begin, index_t row_end) {
+                const auto buffer_size = static_cast<std::size_t>(reduce_length);
+
+                RowBuffer buffer{std::vector<AccDataType>(buffer_size),
+                                 std::vector<AccDataType>(buffer_size),
+                                 std::vector<AccDataType>(buffer_size),
+                                 -1,
+                                 -1};
+
+                for(index_t row = row_begin; row < row_end; ++row)
+                {
+                    RunRow(p_x, p_gamma, p_beta, p_y, problem, acc_element_op, row, buffer);
+                }
+            },
+            std::min(num_thread, num_thread_for_work));
+    }
+
+    private:
+    struct RowBuffer
+    {
+        std::vector<AccDataType> x_;
+        std::vector<AccDataType> gamma_;
+        std::vector<AccDataType> beta_;
+        long_index_t gamma_offset_;
+        long_index_t beta_offset_;
+    };
+
+    template <typename DataType>
+    static void Gather(const DataType* p_row,
+                       const TensorIndexer& indexer,
+                       long_index_t length,
+                       AccDataType* buffer)
+    {
+        indexer.ForEachOffset(0, length, [&](long_index_t k, long_index_t offset) {
+            buffer[k] = type_convert<AccDataType>(p_row[offset]);
+        });
+    }
+
+    static void RunRow(const XDataType* p_x,
+                       const GammaDataType* p_gamma,
+                       const BetaDataType* p_beta,
+                       YDataType* p_y,
+                       const Problem& problem,
+                       const AccElementwiseOperation& acc_element_op,
+                       long_index_t row,
+                       RowBuffer& buffer)
+    {
+        const auto reduce_length = static_cast<index_t>(problem.x_reduce_.GetLength());
+
+        AccDataType* x     = buffer.x_.data();
+        AccDataType* gamma = buffer.gamma_.data();
+        AccDataType* beta  = buffer.beta_.data();
+
+        Gather(p_x + problem.x_invariant_.GetOffset(row), problem.x_reduce_, reduce_length, x);
+
+        const long_index_t gamma_offset = problem.gamma_invariant_.GetOffset(row);
+        const long_index_t beta_offset  = problem.beta_invariant_.GetOffset(row);
+
+        if(gamma_offset != buffer.gamma_offset_)
+        {
+            Gather(p_gamma + gamma_offset, problem.gamma_reduce_, reduce_length, gamma);
+
+            buffer.gamma_offset_ = gamma_offset;
+        }
+
+        if(beta_offset != buffer.beta_offset_)
+        {
+            Gather(p_beta + beta_offset, problem.beta_reduce_, reduce_length, beta);
+
+            buffer.beta_offset_ = beta_offset;
+        }
+
+        // Welford, with the same count in all lanes for the full vectors
+        AccDataType lane_mean[VectorSize] = {};
+        AccDataType lane_m2[VectorSize]   = {};
+        AccDataType lane_count            = 0;
+
+        index_t j = 0;
+
+        for(; j + VectorSize <= reduce_length; j += VectorSize)
+        {
+            lane_count += 1;
+
+            const AccDataType inv_count = 1 / lane_count;
+
+            for(index_t v = 0; v < VectorSize; ++v)
+            {
+                const AccDataType delta = x[j + v] - lane_mean[v];
+
+                lane_mean[v] += delta * inv_count;
+                lane_m2[v] += delta * (x[j + v] - lane_mean[v]);
+            }
+        }
+
+        AccDataType count = lane_count;
+        AccDataType mean  = lane_mean[0];
+        AccDataType m2    = lane_m2[0];
+
+        // Chan
+        for(index_t v = 1; v < VectorSize; ++v)
+        {
+            const AccDataType new_count = count + lane_count;
+
+            if(new_count > 0)
+            {
+                const AccDataType delta = lane_mean[v] - mean;
+
+                mean += delta * lane_count / new_count;
+                m2 += lane_m2[v] + delta * delta * count * lane_count / new_count;
+            }
+
+            count = new_count;
+        }
+
+        for(; j < reduce_length; ++j)
+        {
+            count += 1;
+
+            const AccDataType delta = x[j] - mean;
+
+            mean += delta / count;
+            m2 += delta * (x[j] - mean);
+        }
+
+        const AccDataType inv_std = 1 / std::sqrt(m2 / count + problem.epsilon_);
+
+        YDataType* p_y_row = p_y + problem.y_invariant_.GetOffset(row);
+
+        problem.y_reduce_.ForEachOffset(0, reduce_length, [&](long_index_t k, long_index_t offset) {
+            AccDataType y = (x[k] - mean) * inv_std * gamma[k] + beta[k];
+
+            acc_element_op(y, y);
+
+            p_y_row[offset] = type_convert<YDataType>(y);
+        });
+    }
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/math.hpp"
+#include "ck/utility/reduction_common.hpp"
+#include "ck/utility/reduction_functions_accumulate.hpp"
+#include "ck/tensor_operation/cpu/grid/cpu_tensor_indexer.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+// Reduction on the host with the semantics of ReductionHost: out[i] = alpha * acc_op(reduce_j
+// in_op(in[i, j])) + beta * out[i], with j the linear index over the reduced dimensions.
+//
+// Rows of the invariant dimensions are distributed over the threads. When there are fewer rows
+// than threads, each row is also split into chunks along the reduced dimensions: every chunk is
+// reduced into a partial result, and the partials of a row are merged in order at the end. Within
+// a chunk the elements are converted to AccDataType in tiles of KTileSize and, unless indices are
+// output, accumulated into VectorSize independent lanes that the compiler maps to SIMD registers.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          typename IndexDataType,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan,
+          bool OutputIndex,
+          index_t VectorSize,
+          index_t MinWorkPerThread>
+struct GridwiseReductionCpu
+{
+    static_assert(VectorSize > 0 && MinWorkPerThread > 0, "wrong! invalid configuration");
+
+    static constexpr index_t KTileSize = 1024;
+
+    using Accumulation = detail::AccumulateWithNanCheck<PropagateNan, ReduceOperation, AccDataType>;
+
+    using AccumulationWithIndex = detail::
+        AccumulateWithIndexAndNanCheck<PropagateNan, ReduceOperation, AccDataType, IndexDataType>;
+
+    struct Problem
+    {
+        TensorIndexer in_invariant_;
+        TensorIndexer in_reduce_;
+        TensorIndexer out_;
+        float alpha_;
+        float beta_;
+    };
+
+    static void Run(const InDataType* p_in,
+                    OutDataType* p_out,
+                    IndexDataType* p_out_index,
+                    const Problem& problem,
+                    const InElementwiseOperation& in_element_op,
+                    const AccElementwiseOperation& acc_element_op,
+                    std::size_t num_thread = get_cpu_num_thread())
+    {
+        const long_index_t invariant_length = problem.in_invariant_.GetLength();
+        const long_index_t reduce_length    = problem.in_reduce_.GetLength();
+
+        if(invariant_length == 0)
+        {
+            return;
+        }
+
+        const auto num_thread_for_work = static_cast<std::size_t>(
+            std::max(invariant_length * reduce_length / MinWorkPerThread, long_index_t{1}));
+
+        num_thread = std::min(num_thread, num_thread_for_work);
+
+        const auto thread_count = static_cast<long_index_t>(num_thread);
+
+        // split the rows when there are not enough of them to keep all the threads busy
+        long_index_t num_split = 1;
+
+        if(invariant_length < thread_count)
+        {
+            num_split = std::min(math::integer_divide_ceil(thread_count, invariant_length),
+                                 math::integer_divide_ceil(reduce_length, MinWorkPerThread));
+            num_split = std::max(num_split, long_index_t{1});
+        }
+
+        if(num_split == 1)
+        {
+            cpu_parallel_for(
+                static_cast<index_t>(invariant_length),
+                [&](index_t row_begin, index_t row_end) {
+                    for(index_t row = row_begin; row < row_end; ++row)
+                    {
+                        AccDataType value =
+                            ReduceOperation::template GetIdentityValue<AccDataType>();
+                        IndexDataType index = 0;
+
+                        ReduceChunk(
+                            p_in, problem, row, 0, reduce_length, in_element_op, value, index);
+
+                        Store(p_out, p_out_index, problem, row, acc_element_op, value, index);
+                    }
+                },
+                num_thread);
+
+            return;
+        }
+
+        const long_index_t split_length = math::integer_divide_ceil(reduce_length, num_split);
+
+        const auto num_chunk = static_cast<std::size_t>(invariant_length * num_split);
+
+        std::vector<AccDataType> partial_values(num_chunk);
+        std::vector<IndexDataType> partial_indices(OutputIndex ? num_chunk : 0);
+
+        cpu_parallel_for(
+            static_cast<index_t>(invariant_length * num_split),
+            [&](index_t chunk_begin, index_t chunk_end) {
+                for(index_t chunk = chunk_begin; chunk < chunk_end; ++chunk)
+                {
+                    const long_index_t row   = chunk / num_split;
+                    const long_index_t begin =
+                        std::min(chunk % num_split * split_length, reduce_length);
+                    const long_index_t end = std::min(begin + split_length, reduce_length);
+
+                    AccDataType value   = ReduceOperation::template GetIdentityValue<AccDataType>();
+                    IndexDataType index = 0;
+
+                    ReduceChunk(p_in, problem, row, begin, end, in_element_op, value, index);
+
+                    partial_values[static_cast<std::size_t>(chunk)] = value;
+
+                    if constexpr(OutputIndex)
+                    {
+                        partial_indices[static_cast<std::size_t>(chunk)] = index;
+                    }
+                }
+            },
+            num_thread);
+
+        for(long_index_t row = 0; row < invariant_length; ++row)
+        {
+            AccDataType value   = ReduceOperation::template GetIdentityValue<AccDataType>();
+            IndexDataType index = 0;
+
+            for(long_index_t split = 0; split < num_split; ++split)
+            {
+                const auto chunk = static_cast<std::size_t>(row * num_split + split);
+
+                if constexpr(OutputIndex)
+                {
+                    AccumulationWithIndex::Calculate(
+                        value, partial_values[chunk], index, partial_indices[chunk]);
+                }
+                else
+                {
+                    Accumulation::Calculate(value, partial_values[chunk]);
+                }
+            }
+
+            Store(p_out, p_out_index, problem, row, acc_element_op, value, index);
+        }
+    }
+
+    private:
+    // accumulates the elements [begin, end) of a row into value and index
+    static void ReduceChunk(const InDataType* p_in,
+                            const Problem& problem,
+                            long_index_t row,
+                            long_index_t begin,
+                            long_index_t end,
+                            const InElementwiseOperation& in_element_op,
+                            AccDataType& value,
+                            IndexDataType& index)
+    {
+        const InDataType* p_row = p_in + problem.in_invariant_.GetOffset(row);
+
+        AccDataType tile[KTileSize];
+        AccDataType lanes[VectorSize];
+
+        std::fill(lanes, lanes + VectorSize, value);
+
+        for(long_index_t tile_begin = begin; tile_begin < end; tile_begin += KTileSize)
+        {
+            const long_index_t tile_end = std::min(tile_begin + KTileSize, end);
+            const auto tile_length      = static_cast<index_t>(tile_end - tile_begin);
+
+            problem.in_reduce_.ForEachOffset(
+                tile_begin, tile_end, [&](long_index_t j, long_index_t offset) {
+                    AccDataType v = type_convert<AccDataType>(p_row[offset]);
+
+                    in_element_op(v, v);
+
+                    tile[j - tile_begin] = v;
+                });
+
+            if constexpr(OutputIndex)
+            {
+                // in order, so that the first of equal values is selected as with ReductionHost
+                for(index_t j = 0; j < tile_length; ++j)
+                {
+                    AccumulationWithIndex::Calculate(
+                        value, tile[j], index, static_cast<IndexDataType>(tile_begin + j));
+                }
+            }
+            else
+            {
+                index_t j = 0;
+
+                for(; j + VectorSize <= tile_length; j += VectorSize)
+                {
+                    for(index_t v = 0; v < VectorSize; ++v)
+                    {
+                        Accumulation::Calculate(lanes[v], tile[j + v]);
+                    }
+                }
+
+                for(; j < tile_length; ++j)
+                {
+                    Accumulation::Calculate(lanes[0], tile[j]);
+                }
+            }
+        }
+
+        if constexpr(!OutputIndex)
+        {
+            value = lanes[0];
+
+            for(index_t v = 1; v < VectorSize; ++v)
+            {
+                Accumulation::Calculate(value, lanes[v]);
+            }
+        }
+    }
+
+    static void Store(OutDataType* p_out,
+                      IndexDataType* p_out_index,
+                      const Problem& problem,
+                      long_index_t row,
+                      const AccElementwiseOperation& acc_element_op,
+                      AccDataType value,
+                      IndexDataType index)
+    {
+        acc_element_op(value, value);
+
+        if(!float_equal_one{}(problem.alpha_))
+        {
+            value *= type_convert<AccDataType>(problem.alpha_);
+        }
+
+        const long_index_t out_offset = problem.out_.GetOffset(row);
+
+        if(!float_equal_zero{}(problem.beta_))
+        {
+            value += type_convert<AccDataType>(p_out[out_offset]) *
+                     type_convert<AccDataType>(problem.beta_);
+        }
+
+        p_out[out_offset] = type_convert<OutDataType>(value);
+
+        if constexpr(OutputIndex)
+        {
+            p_out_index[out_offset] = index;
+        }
+    }
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
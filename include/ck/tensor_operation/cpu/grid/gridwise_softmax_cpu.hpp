@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/reduction_common.hpp"
+#include "ck/tensor_operation/cpu/grid/cpu_tensor_indexer.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+// Softmax on the host with the semantics of ReferenceSoftmax: out = alpha * exp(in - max(in)) /
+// sum(exp(in - max(in))) + beta * out, with max and sum taken over the reduced dimensions.
+//
+// Rows of the invariant dimensions are distributed over the threads. Each row is read from memory
+// once: it is gathered into a per-thread AccDataType buffer that stays in cache while the maximum,
+// the exponentials and their sum are computed, and is then scaled into the output. The max and
+// sum use VectorSize independent lanes that the compiler maps to SIMD registers.
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          index_t VectorSize,
+          index_t MinWorkPerThread>
+struct GridwiseSoftmaxCpu
+{
+    static_assert(VectorSize > 0 && MinWorkPerThread > 0, "wrong! invalid configuration");
+
+    struct Problem
+    {
+        TensorIndexer in_invariant_;
+        TensorIndexer in_reduce_;
+        TensorIndexer out_invariant_;
+        TensorIndexer out_reduce_;
+        AccDataType alpha_;
+        AccDataType beta_;
+    };
+
+    static void Run(const InDataType* p_in,
+                    OutDataType* p_out,
+                    const Problem& problem,
+                    std::size_t num_thread = get_cpu_num_thread())
+    {
+        const long_index_t invariant_length = problem.in_invariant_.GetLength();
+        const long_index_t reduce_length    = problem.in_reduce_.GetLength();
+
+        if(invariant_length == 0 || reduce_length == 0)
+        {
+            return;
+        }
+
+        const auto num_thread_for_work = static_cast<std::size_t>(
+            std::max(invariant_length * reduce_length / MinWorkPerThread, long_index_t{1}));
+
+        cpu_parallel_for(
+            static_cast<index_t>(invariant_length),
+            [&](index_t row_begin, index_t row_end) {
+                std::vector<AccDataType> buffer(static_cast<std::size_t>(reduce_length));
+
+                for(index_t row = row_begin; row < row_end; ++row)
+                {
+                    RunRow(p_in, p_out, problem, row, buffer.data());
+                }
+            },
+            std::min(num_thread, num_thread_for_work));
+    }
+
+    private:
+    static void RunRow(const InDataType* p_in,
+                       OutDataType* p_out,
+                       const Problem& problem,
+                       long_index_t row,
+                       AccDataType* buffer)
+    {
+        const InDataType* p_in_row = p_in + problem.in_invariant_.GetOffset(row);
+        OutDataType* p_out_row     = p_out + problem.out_invariant_.GetOffset(row);
+
+        const auto reduce_length = static_cast<index_t>(problem.in_reduce_.GetLength());
+
+        problem.in_reduce_.ForEachOffset(
+            0, reduce_length, [&](long_index_t k, long_index_t offset) {
+                buffer[k] = type_convert<AccDataType>(p_in_row[offset]);
+            });
+
+        AccDataType lanes[VectorSize];
+
+        // max
+        std::fill(lanes, lanes + VectorSize, std::numeric_limits<AccDataType>::lowest());
+
+        index_t j = 0;
+
+        for(; j + VectorSize <= reduce_length; j += VectorSize)
+        {
+            for(index_t v = 0; v < VectorSize; ++v)
+            {
+                lanes[v] = std::max(lanes[v], buffer[j + v]);
+            }
+        }
+
+        for(; j < reduce_length; ++j)
+        {
+            lanes[0] = std::max(lanes[0], buffer[j]);
+        }
+
+        const AccDataType max = *std::max_element(lanes, lanes + VectorSize);
+
+        // exp and sum
+        std::fill(lanes, lanes + VectorSize, AccDataType{0});
+
+        for(j = 0; j + VectorSize <= reduce_length; j += VectorSize)
+        {
+            for(index_t v = 0; v < VectorSize; ++v)
+            {
+                buffer[j + v] = std::exp(buffer[j + v] - max);
+                lanes[v] += buffer[j + v];
+            }
+        }
+
+        for(; j < reduce_length; ++j)
+        {
+            buffer[j] = std::exp(buffer[j] - max);
+            lanes[0] += buffer[j];
+        }
+
+        AccDataType sum = 0;
+
+        for(index_t v = 0; v < VectorSize; ++v)
+        {
+            sum += lanes[v];
+        }
+
+        // scale
+        const AccDataType alpha = problem.alpha_;
+        const AccDataType beta  = problem.beta_;
+
+        if(float_equal_zero{}(beta))
+        {
+            problem.out_reduce_.ForEachOffset(
+                0, reduce_length, [&](long_index_t k, long_index_t offset) {
+                    p_out_row[offset] = type_convert<OutDataType>(alpha * buffer[k] / sum);
+                });
+        }
+        else
+        {
+            problem.out_reduce_.ForEachOffset(
+                0, reduce_length, [&](long_index_t k, long_index_t offset) {
+                    const AccDataType out = type_convert<AccDataType>(p_out_row[offset]);
+
+                    p_out_row[offset] =
+                        type_convert<OutDataType>(alpha * buffer[k] / sum + beta * out);
+                });
+        }
+    }
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
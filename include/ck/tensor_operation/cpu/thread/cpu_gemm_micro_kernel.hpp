@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+#include "ck/ck.hpp"
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_CPU_GEMM_X86 1
+#include <immintrin.h>
+#else
+#define CK_CPU_GEMM_X86 0
+#endif
+
+namespace ck {
+namespace tensor_operation {
+namespace cpu {
+
+enum struct CpuGemmMicroKernelType
+{
+    Generic, // plain C++, any accumulation type
+    Avx2,    // 6x16 fp32 tile in ymm registers, needs AVX2 and FMA
+    Avx512,  // 8x32 fp32 tile in zmm registers, needs AVX-512F
+};
+
+inline std::string get_cpu_gemm_micro_kernel_name(CpuGemmMicroKernelType type)
+{
+    switch(type)
+    {
+    case CpuGemmMicroKernelType::Generic: return "Generic";
+    case CpuGemmMicroKernelType::Avx2: return "Avx2";
+    case CpuGemmMicroKernelType::Avx512: return "Avx512";
+    default: return "Unknown";
+    }
+}
+
+// Register tile of a CPU GEMM: c[MPerThread, NPerThread] += a * b over K, with a packed as K
+// columns of MPerThread values and b as K rows of NPerThread values. c has a row stride of ldc.
+template <typename AccDataType, CpuGemmMicroKernelType Type>
+struct CpuGemmMicroKernel;
+
+template <typename AccDataType>
+struct CpuGemmMicroKernel<AccDataType, CpuGemmMicroKernelType::Generic>
+{
+    static constexpr index_t MPerThread = 4;
+    static constexpr index_t NPerThread = 8;
+
+    static bool IsSupported() { return true; }
+
+    static void
+    Run(index_t K, const AccDataType* p_a, const AccDataType* p_b, AccDataType* p_c, index_t ldc)
+    {
+        AccDataType c[MPerThread][NPerThread];
+
+        for(index_t i = 0; i < MPerThread; ++i)
+        {
+            for(index_t j = 0; j < NPerThread; ++j)
+            {
+                c[i][j] = p_c[i * ldc + j];
+            }
+        }
+
+        for(index_t k = 0; k < K; ++k)
+        {
+            for(index_t i = 0; i < MPerThread; ++i)
+            {
+                for(index_t j = 0; j < NPerThread; ++j)
+                {
+                    c[i][j] += p_a[k * MPerThread + i] * p_b[k * NPerThread + j];
+                }
+            }
+        }
+
+        for(index_t i = 0; i < MPerThread; ++i)
+        {
+            for(index_t j = 0; j < NPerThread; ++j)
+            {
+                p_c[i * ldc + j] = c[i][j];
+            }
+        }
+    }
+};
+
+#if CK_CPU_GEMM_X86
+namespace detail {
+
+__attribute__((target("avx2,fma"))) inline void
+gemm_micro_kernel_6x16_avx2(index_t K, const float* p_a, const float* p_b, float* p_c, index_t ldc)
+{
+    __m256 c[6][2];
+
+    for(index_t i = 0; i < 6; ++i)
+    {
+        c[i][0] = _mm256_loadu_ps(p_c + i * ldc);
+        c[i][1] = _mm256_loadu_ps(p_c + i * ldc + 8);
+    }
+
+    for(index_t k = 0; k < K; ++k)
+    {
+        const __m256 b0 = _mm256_loadu_ps(p_b + k * 16);
+        const __m256 b1 = _mm256_loadu_ps(p_b + k * 16 + 8);
+
+        for(index_t i = 0; i < 6; ++i)
+        {
+            const __m256 a = _mm256_broadcast_ss(p_a + k * 6 + i);
+
+            c[i][0] = _mm256_fmadd_ps(a, b0, c[i][0]);
+            c[i][1] = _mm256_fmadd_ps(a, b1, c[i][1]);
+        }
+    }
+
+    for(index_t i = 0; i < 6; ++i)
+    {
+        _mm256_storeu_ps(p_c + i * ldc, c[i][0]);
+        _mm256_storeu_ps(p_c + i * ldc + 8, c[i][1]);
+    }
+}
+
+__attribute__((target("avx512f"))) inline void gemm_micro_kernel_8x32_avx512(
+    index_t K, const float* p_a, const float* p_b, float* p_c, index_t ldc)
+{
+    __m512 c[8][2];
+
+    for(index_t i = 0; i < 8; ++i)
+    {
+        c[i][0] = _mm512_loadu_ps(p_c + i * ldc);
+        c[i][1] = _mm512_loadu_ps(p_c + i * ldc + 16);
+    }
+
+    for(index_t k = 0; k < K; ++k)
+    {
+        const __m512 b0 = _mm512_loadu_ps(p_b + k * 32);
+        const __m512 b1 = _mm512_loadu_ps(p_b + k * 32 + 16);
+
+        for(index_t i = 0; i < 8; ++i)
+        {
+            const __m512 a = _mm512_set1_ps(p_a[k * 8 + i]);
+
+            c[i][0] = _mm512_fmadd_ps(a, b0, c[i][0]);
+            c[i][1] = _mm512_fmadd_ps(a, b1, c[i][1]);
+        }
+    }
+
+    for(index_t i = 0; i < 8; ++i)
+    {
+        _mm512_storeu_ps(p_c + i * ldc, c[i][0]);
+        _mm512_storeu_ps(p_c + i * ldc + 16, c[i][1]);
+    }
+}
+
+} // namespace detail
+#endif // CK_CPU_GEMM_X86
+
+template <>
+struct CpuGemmMicroKernel<float, CpuGemmMicroKernelType::Avx2>
+{
+    static constexpr index_t MPerThread = 6;
+    static constexpr index_t NPerThread = 16;
+
+    static bool IsSupported()
+    {
+#if CK_CPU_GEMM_X86
+        static const bool supported =
+            __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    static void Run(index_t K, const float* p_a, const float* p_b, float* p_c, index_t ldc)
+    {
+#if CK_CPU_GEMM_X86
+        detail::gemm_micro_kernel_6x16_avx2(K, p_a, p_b, p_c, ldc);
+#else
+        (void)K, (void)p_a, (void)p_b, (void)p_c, (void)ldc;
+#endif
+    }
+};
+
+template <>
+struct CpuGemmMicroKernel<float, CpuGemmMicroKernelType::Avx512>
+{
+    static constexpr index_t MPerThread = 8;
+    static constexpr index_t NPerThread = 32;
+
+    static bool IsSupported()
+    {
+#if CK_CPU_GEMM_X86
+        static const bool supported = __builtin_cpu_supports("avx512f");
+
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    static void Run(index_t K, const float* p_a, const float* p_b, float* p_c, index_t ldc)
+    {
+#if CK_CPU_GEMM_X86
+        detail::gemm_micro_kernel_8x32_avx512(K, p_a, p_b, p_c, ldc);
+#else
+        (void)K, (void)p_a, (void)p_b, (void)p_c, (void)ldc;
+#endif
+    }
+};
+
+} // namespace cpu
+} // namespace tensor_operation
+} // namespace ck
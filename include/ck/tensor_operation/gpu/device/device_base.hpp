@@ -38,6 +38,19 @@ struct BaseInvoker
     virtual ~BaseInvoker() {}
 };
 
+// Block-level tiling of an instance. It is known at compile time, so it can be queried from the
+// instance type alone, without building an Argument or allocating the instance.
+struct BlockTileDescriptor
+{
+    int block_size_           = 0;
+    int m_per_block_          = 0;
+    int n_per_block_          = 0;
+    int k_per_block_          = 0;
+    int num_prefetch_         = 0;
+    int pipeline_version_     = 0; // 0: not applicable, 1: v1, 2: v2
+    bool interwave_scheduler_ = false;
+};
+
 struct BaseOperator
 {
     BaseOperator()                    = default;
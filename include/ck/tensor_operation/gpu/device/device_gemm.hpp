@@ -4,6 +4,7 @@
 #pragma once
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/instance_metadata.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -35,6 +36,8 @@ struct DeviceGemm : public BaseOperator
                         CElementwiseOperation c_element_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    virtual GemmInstanceMetadata GetInstanceMetadata() const { return GemmInstanceMetadata{}; }
 };
 
 } // namespace device
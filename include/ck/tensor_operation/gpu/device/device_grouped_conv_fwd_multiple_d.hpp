@@ -6,6 +6,7 @@
 #include <array>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/instance_metadata.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -58,6 +59,11 @@ struct DeviceGroupedConvFwdMultipleD : public BaseOperator
         const CDEElementwiseOperation& cde_element_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    virtual ConvFwdInstanceMetadata<NDimSpatial> GetInstanceMetadata() const
+    {
+        return ConvFwdInstanceMetadata<NDimSpatial>{};
+    }
 };
 
 } // namespace device
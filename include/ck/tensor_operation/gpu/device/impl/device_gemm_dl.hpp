@@ -567,6 +567,11 @@ struct DeviceGemmDl : public DeviceGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    static constexpr BlockTileDescriptor GetBlockTileDescriptor()
+    {
+        return BlockTileDescriptor{BlockSize, MPerBlock, NPerBlock, K0PerBlock * K1};
+    }
+
     // polymorphic
     std::string GetTypeString() const override
     {
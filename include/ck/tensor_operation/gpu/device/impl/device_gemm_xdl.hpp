@@ -529,6 +529,34 @@ struct DeviceGemmXdl : public DeviceGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // only MNPadding is implemented, K always has to be divisible by K1
+    static constexpr GemmInstanceMetadata InstanceMetadata{
+        true,
+        BlockTileDescriptor{BlockSize,
+                            MPerBlock,
+                            NPerBlock,
+                            K0PerBlock * K1,
+                            NumPrefetch,
+                            PipelineVer == PipelineVersion::v1 ? 1 : 2,
+                            LoopSched == LoopScheduler::Interwave},
+        GemmSpec,
+        GemmSpec == GemmSpecialization::MNPadding,
+        GemmSpec == GemmSpecialization::MNPadding,
+        false,
+        K1,
+        K1,
+        is_same_v<tensor_layout::gemm::RowMajor, CLayout>,
+        ABlockTransferSrcVectorDim == 2,
+        ABlockTransferSrcScalarPerVector,
+        BBlockTransferSrcVectorDim == 2,
+        BBlockTransferSrcScalarPerVector,
+        CThreadTransferDstScalarPerVector};
+
+    static constexpr BlockTileDescriptor GetBlockTileDescriptor() { return InstanceMetadata.tile_; }
+
+    // polymorphic
+    GemmInstanceMetadata GetInstanceMetadata() const override { return InstanceMetadata; }
+
     // polymorphic
     std::string GetTypeString() const override
     {
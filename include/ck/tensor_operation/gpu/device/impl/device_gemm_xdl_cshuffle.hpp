@@ -664,6 +664,33 @@ struct DeviceGemm_Xdl_CShuffle : public DeviceGemm<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    static constexpr GemmInstanceMetadata InstanceMetadata{
+        true,
+        BlockTileDescriptor{BlockSize,
+                            MPerBlock,
+                            NPerBlock,
+                            KPerBlock,
+                            NumGemmKPrefetchStage,
+                            PipelineVer == PipelineVersion::v1 ? 1 : 2,
+                            LoopSched == LoopScheduler::Interwave},
+        GemmSpec,
+        is_m_padded(GemmSpec),
+        is_n_padded(GemmSpec),
+        is_k_padded(GemmSpec),
+        AK1,
+        BK1,
+        is_same_v<tensor_layout::gemm::RowMajor, CLayout>,
+        ABlockTransferSrcVectorDim == 2,
+        ABlockTransferSrcScalarPerVector,
+        BBlockTransferSrcVectorDim == 2,
+        BBlockTransferSrcScalarPerVector,
+        CShuffleBlockTransferScalarPerVector_NPerBlock};
+
+    static constexpr BlockTileDescriptor GetBlockTileDescriptor() { return InstanceMetadata.tile_; }
+
+    // polymorphic
+    GemmInstanceMetadata GetInstanceMetadata() const override { return InstanceMetadata; }
+
     // polymorphic
     std::string GetTypeString() const override
     {
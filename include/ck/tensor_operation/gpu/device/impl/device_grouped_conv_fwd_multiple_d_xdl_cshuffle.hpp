@@ -928,6 +928,35 @@ struct DeviceGroupedConvFwdMultipleD_Xdl_CShuffle
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    static constexpr ConvFwdInstanceMetadata<NDimSpatial> InstanceMetadata{
+        true,
+        GemmInstanceMetadata{true,
+                             BlockTileDescriptor{BlockSize,
+                                                 MPerBlock,
+                                                 NPerBlock,
+                                                 KPerBlock,
+                                                 NumGemmKPrefetchStage,
+                                                 1,
+                                                 LoopSched == LoopScheduler::Interwave},
+                             GemmSpec,
+                             is_m_padded(GemmSpec),
+                             is_n_padded(GemmSpec),
+                             is_k_padded(GemmSpec),
+                             AK1,
+                             BK1,
+                             true,
+                             ABlockTransferSrcVectorDim == 2,
+                             ABlockTransferSrcScalarPerVector,
+                             BBlockTransferSrcVectorDim == 2,
+                             BBlockTransferSrcScalarPerVector,
+                             CDEBlockTransferScalarPerVector_NPerBlock},
+        ConvForwardSpecialization};
+
+    ConvFwdInstanceMetadata<NDimSpatial> GetInstanceMetadata() const override
+    {
+        return InstanceMetadata;
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
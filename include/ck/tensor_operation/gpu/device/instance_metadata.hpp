@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <string>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+constexpr bool is_m_padded(GemmSpecialization s)
+{
+    return s == GemmSpecialization::MPadding || s == GemmSpecialization::MNPadding ||
+           s == GemmSpecialization::MKPadding || s == GemmSpecialization::MNKPadding;
+}
+
+constexpr bool is_n_padded(GemmSpecialization s)
+{
+    return s == GemmSpecialization::NPadding || s == GemmSpecialization::MNPadding ||
+           s == GemmSpecialization::NKPadding || s == GemmSpecialization::MNKPadding;
+}
+
+constexpr bool is_k_padded(GemmSpecialization s)
+{
+    return s == GemmSpecialization::KPadding || s == GemmSpecialization::MKPadding ||
+           s == GemmSpecialization::NKPadding || s == GemmSpecialization::MNKPadding;
+}
+
+// Compile-time description of a GEMM instance.
+//
+// IsSupportedProblem() only looks at the problem sizes, so hundreds of instances can be pruned
+// without building grid descriptors through MakeArgumentPointer(). It checks tile divisibility
+// (unless the dimension is padded), K1 alignment, the pipeline constraint on the number of K
+// loops and that vector loads/stores of A, B and C do not cross the end of the vectorized
+// dimension. IsSupportedArgument() remains the final authority, since it also checks the device.
+struct GemmInstanceMetadata
+{
+    // false for instances that do not provide metadata: they are never pruned
+    bool is_valid_ = false;
+
+    BlockTileDescriptor tile_;
+    GemmSpecialization gemm_spec_ = GemmSpecialization::Default;
+
+    // padding actually applied by the instance
+    bool pad_m_ = false;
+    bool pad_n_ = false;
+    bool pad_k_ = false;
+
+    index_t ak1_ = 1;
+    index_t bk1_ = 1;
+
+    // C[M, N]: N is contiguous for row-major C
+    bool c_n_contiguous_ = true;
+
+    // vector access of global memory, in number of elements
+    bool a_vector_along_k_           = true;
+    index_t a_src_scalar_per_vector_ = 1;
+    bool b_vector_along_k_           = true;
+    index_t b_src_scalar_per_vector_ = 1;
+    index_t c_dst_scalar_per_vector_ = 1;
+
+    constexpr index_t GetPaddedLength(index_t length, index_t per_block, bool pad) const
+    {
+        return pad ? (length + per_block - 1) / per_block * per_block : length;
+    }
+
+    constexpr bool IsSupportedProblem(index_t M, index_t N, index_t K) const
+    {
+        if(!is_valid_)
+        {
+            return true;
+        }
+
+        // K1 split, only relaxed by K padding
+        if(!pad_k_ && (K % ak1_ != 0 || K % bk1_ != 0))
+        {
+            return false;
+        }
+
+        // tile divisibility
+        if((!pad_m_ && M % tile_.m_per_block_ != 0) || (!pad_n_ && N % tile_.n_per_block_ != 0) ||
+           (!pad_k_ && K % tile_.k_per_block_ != 0))
+        {
+            return false;
+        }
+
+        // pipeline v2 consumes two K blocks per iteration
+        const index_t k_padded   = GetPaddedLength(K, tile_.k_per_block_, pad_k_);
+        const index_t num_k_loop = k_padded / tile_.k_per_block_;
+
+        if(tile_.pipeline_version_ == 2 && num_k_loop % 2 != 0)
+        {
+            return false;
+        }
+
+        // vector access must not cross the end of the vectorized dimension
+        if(K % (a_vector_along_k_ ? a_src_scalar_per_vector_ : 1) != 0 ||
+           M % (a_vector_along_k_ ? 1 : a_src_scalar_per_vector_) != 0)
+        {
+            return false;
+        }
+
+        if(K % (b_vector_along_k_ ? b_src_scalar_per_vector_ : 1) != 0 ||
+           N % (b_vector_along_k_ ? 1 : b_src_scalar_per_vector_) != 0)
+        {
+            return false;
+        }
+
+        if((c_n_contiguous_ ? N : M) % c_dst_scalar_per_vector_ != 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+};
+
+// Compile-time description of a forward convolution instance lowered to implicit GEMM
+// (GemmM = N * Ho * Wo, GemmN = K, GemmK = C * Y * X). The vector access of the implicit GEMM is
+// along C for the input and the weight, and along K for the output and the Ds.
+template <index_t NDimSpatial>
+struct ConvFwdInstanceMetadata
+{
+    bool is_valid_ = false;
+
+    GemmInstanceMetadata gemm_;
+    ConvolutionForwardSpecialization conv_spec_ = ConvolutionForwardSpecialization::Default;
+
+    // lengths are in the same G_N_C_Wis / G_K_C_Xs / G_N_K_Wos order as MakeArgumentPointer()
+    constexpr bool
+    IsSupportedProblem(const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+                       const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                       const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+                       const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                       const std::array<index_t, NDimSpatial>& input_left_pads,
+                       const std::array<index_t, NDimSpatial>& input_right_pads) const
+    {
+        if(!is_valid_)
+        {
+            return true;
+        }
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            const index_t X        = b_g_k_c_xs_lengths[i + 3];
+            const bool is_1x1_pad0 = X == 1 && input_left_pads[i] == 0 && input_right_pads[i] == 0;
+
+            if(conv_spec_ == ConvolutionForwardSpecialization::Filter1x1Stride1Pad0 &&
+               !(is_1x1_pad0 && conv_filter_strides[i] == 1))
+            {
+                return false;
+            }
+
+            if(conv_spec_ == ConvolutionForwardSpecialization::Filter1x1Pad0 && !is_1x1_pad0)
+            {
+                return false;
+            }
+        }
+
+        const index_t N = a_g_n_c_wis_lengths[1];
+        const index_t C = a_g_n_c_wis_lengths[2];
+        const index_t K = b_g_k_c_xs_lengths[1];
+
+        if(!(gemm_.a_vector_along_k_ && C % gemm_.a_src_scalar_per_vector_ == 0) ||
+           !(gemm_.b_vector_along_k_ && C % gemm_.b_src_scalar_per_vector_ == 0) ||
+           K % gemm_.c_dst_scalar_per_vector_ != 0)
+        {
+            return false;
+        }
+
+        index_t gemm_m = N;
+        index_t gemm_k = C;
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            gemm_m *= e_g_n_k_wos_lengths[i + 3];
+            gemm_k *= b_g_k_c_xs_lengths[i + 3];
+        }
+
+        // vector access was checked on the convolution tensors above, the implicit GEMM only
+        // adds the tile and pipeline constraints
+        GemmInstanceMetadata gemm = gemm_;
+
+        gemm.ak1_                     = 1;
+        gemm.bk1_                     = 1;
+        gemm.a_src_scalar_per_vector_ = 1;
+        gemm.b_src_scalar_per_vector_ = 1;
+        gemm.c_dst_scalar_per_vector_ = 1;
+
+        return gemm.IsSupportedProblem(gemm_m, K, gemm_k);
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -543,4 +543,158 @@ struct OffsettedBlockToCTileMap
     index_t block_start_;
 };
 
+// Stream-K: the main loop iterations of all the C tiles are split evenly over a persistent grid,
+// instead of giving whole tiles to workgroups, so no wave is left mostly idle.
+//
+// The iteration space is [tile, k_iter] flattened with k_iter fastest. Workgroup b runs the
+// iterations [GetIterBegin(b), GetIterEnd(b)): it may finish the tail of a tile, run whole tiles,
+// then start the head of another one. The owner of a tile is the workgroup running its first
+// iteration. A tile run by several workgroups needs a fix-up: the other workgroups, given by
+// GetPartialBlockRange(), store their partial accumulation in the workspace slot of their own
+// block id and the owner adds them up before writing C. Since only the first tile of a
+// workgroup can start in the middle, a workgroup writes at most one partial tile.
+template <index_t MPerBlock, index_t NPerBlock, index_t KPerBlock>
+struct BlockToCTileMap_GemmStreamK
+{
+    static constexpr auto I0 = Number<0>{};
+
+    __host__ __device__ BlockToCTileMap_GemmStreamK() = default;
+
+    __host__ __device__ BlockToCTileMap_GemmStreamK(index_t M,
+                                                    index_t N,
+                                                    index_t K,
+                                                    index_t grid_size,
+                                                    index_t M01 = 8)
+        : M0_(math::integer_divide_ceil(M, MPerBlock)),
+          N0_(math::integer_divide_ceil(N, NPerBlock)),
+          k_iters_per_tile_(math::integer_divide_ceil(K, KPerBlock)),
+          grid_size_(grid_size),
+          M01_(M01)
+    {
+        const index_t num_iter = GetNumIter();
+
+        // an empty grid is rejected by CheckValidity()
+        iters_per_block_    = grid_size_ > 0 ? num_iter / grid_size_ : 0;
+        num_big_block_      = grid_size_ > 0 ? num_iter % grid_size_ : 0;
+        big_block_iter_end_ = num_big_block_ * (iters_per_block_ + 1);
+    }
+
+    template <typename CGridDesc_M_N>
+    __host__ constexpr index_t CalculateGridSize(const CGridDesc_M_N& /* c_grid_desc_m_n */) const
+    {
+        return grid_size_;
+    }
+
+    __host__ __device__ constexpr index_t GetNumTile() const { return M0_ * N0_; }
+
+    __host__ __device__ constexpr index_t GetItersPerTile() const { return k_iters_per_tile_; }
+
+    __host__ __device__ constexpr index_t GetNumIter() const
+    {
+        return GetNumTile() * k_iters_per_tile_;
+    }
+
+    // the first num_iter % grid_size workgroups run one more iteration than the others
+    __host__ __device__ constexpr index_t GetIterBegin(index_t block_id) const
+    {
+        return block_id * iters_per_block_ + math::min(block_id, num_big_block_);
+    }
+
+    __host__ __device__ constexpr index_t GetIterEnd(index_t block_id) const
+    {
+        return GetIterBegin(block_id + 1);
+    }
+
+    __host__ __device__ constexpr index_t GetBlockOfIter(index_t iter) const
+    {
+        return iter < big_block_iter_end_
+                   ? iter / (iters_per_block_ + 1)
+                   : num_big_block_ + (iter - big_block_iter_end_) / iters_per_block_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileOfIter(index_t iter) const
+    {
+        return iter / k_iters_per_tile_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileIterBegin(index_t tile) const
+    {
+        return tile * k_iters_per_tile_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileIterEnd(index_t tile) const
+    {
+        return (tile + 1) * k_iters_per_tile_;
+    }
+
+    __host__ __device__ constexpr index_t GetTileOwner(index_t tile) const
+    {
+        return GetBlockOfIter(GetTileIterBegin(tile));
+    }
+
+    // workgroups [first, last) hold partial accumulations of the tile, empty for a tile run by its
+    // owner alone
+    __host__ __device__ constexpr auto GetPartialBlockRange(index_t tile) const
+    {
+        return make_tuple(GetTileOwner(tile) + 1, GetBlockOfIter(GetTileIterEnd(tile) - 1) + 1);
+    }
+
+    // whether the workgroup writes the partial accumulation of its first tile to the workspace
+    __host__ __device__ constexpr bool HasPartial(index_t block_id) const
+    {
+        const index_t iter_begin = GetIterBegin(block_id);
+
+        return iter_begin < GetIterEnd(block_id) && iter_begin % k_iters_per_tile_ != 0;
+    }
+
+    // one partial C tile and one flag per workgroup
+    __host__ constexpr std::size_t GetWorkSpaceSize(std::size_t acc_data_size) const
+    {
+        return grid_size_ * (MPerBlock * NPerBlock * acc_data_size + sizeof(uint32_t));
+    }
+
+    // maps a tile id to [m0, n0], M01 rows of tiles are walked column by column
+    template <typename TopIdx>
+    __host__ __device__ constexpr auto CalculateBottomIndex(const TopIdx& idx_top) const
+    {
+        const index_t tile = idx_top[I0];
+
+        const index_t idx_N0 = tile % N0_;
+        const index_t idx_M0 = tile / N0_;
+
+        const auto M01_adapt = (idx_M0 < M0_ - M0_ % M01_) ? M01_ : M0_ % M01_;
+
+        const index_t idx_M00          = idx_M0 / M01_;
+        const index_t idx_M01          = idx_M0 % M01_;
+        const index_t idx_N0_M01_local = idx_N0 + idx_M01 * N0_;
+
+        return make_tuple(idx_N0_M01_local % M01_adapt + idx_M00 * M01_,
+                          idx_N0_M01_local / M01_adapt);
+    }
+
+    template <typename CTileIdx, typename CTileDim>
+    __host__ __device__ bool ValidCTileIndex(const CTileIdx& /* c_tile_idx */,
+                                             const CTileDim& /* c_tile_dim */) const
+    {
+        return true; // tiles are only computed for tile id < GetNumTile()
+    }
+
+    // M, N or K <= 0 leaves no tile or no main loop iteration to split
+    template <typename CGridDesc_M_N>
+    __host__ bool CheckValidity(const CGridDesc_M_N& /* c_grid_desc_m_n */) const
+    {
+        return M0_ > 0 && N0_ > 0 && k_iters_per_tile_ > 0 && grid_size_ > 0 && M01_ > 0;
+    }
+
+    private:
+    index_t M0_;
+    index_t N0_;
+    index_t k_iters_per_tile_;
+    index_t grid_size_;
+    index_t M01_;
+    index_t iters_per_block_;
+    index_t num_big_block_;
+    index_t big_block_iter_end_;
+};
+
 } // namespace ck
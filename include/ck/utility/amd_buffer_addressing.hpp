@@ -297,7 +297,9 @@ __device__ typename vector_type<T, N>::type amd_buffer_load_impl(int32x4_t src_w
             (is_same<T, half_t>::value && (N == 1 || N == 2 || N == 4 || N == 8)) ||
             (is_same<T, bhalf_t>::value && (N == 1 || N == 2 || N == 4 || N == 8)) ||
             (is_same<T, int32_t>::value && (N == 1 || N == 2 || N == 4 || N == 8)) ||
-            (is_same<T, int8_t>::value && (N == 1 || N == 2 || N == 4 || N == 8 || N == 16)),
+            (is_same<T, int8_t>::value && (N == 1 || N == 2 || N == 4 || N == 8 || N == 16)) ||
+            ((is_same<T, f8_t>::value || is_same<T, bf8_t>::value) &&
+             (N == 1 || N == 2 || N == 4 || N == 8 || N == 16)),
         "wrong! not implemented");
 
     if constexpr(is_same<T, double>::value)
@@ -539,6 +541,12 @@ __device__ typename vector_type<T, N>::type amd_buffer_load_impl(int32x4_t src_w
 #endif
         }
     }
+    else if constexpr(is_same<T, f8_t>::value || is_same<T, bf8_t>::value)
+    {
+        // same bits as int8
+        return bit_cast<typename vector_type<T, N>::type>(amd_buffer_load_impl<int8_t, N>(
+            src_wave_buffer_resource, src_thread_addr_offset, src_wave_addr_offset));
+    }
 }
 
 template <typename T, index_t N>
@@ -553,7 +561,9 @@ __device__ void amd_buffer_store_impl(const typename vector_type<T, N>::type src
             (is_same<T, half_t>::value && (N == 1 || N == 2 || N == 4 || N == 8)) ||
             (is_same<T, bhalf_t>::value && (N == 1 || N == 2 || N == 4 || N == 8)) ||
             (is_same<T, int32_t>::value && (N == 1 || N == 2 || N == 4)) ||
-            (is_same<T, int8_t>::value && (N == 1 || N == 2 || N == 4 || N == 8 || N == 16)),
+            (is_same<T, int8_t>::value && (N == 1 || N == 2 || N == 4 || N == 8 || N == 16)) ||
+            ((is_same<T, f8_t>::value || is_same<T, bf8_t>::value) &&
+             (N == 1 || N == 2 || N == 4 || N == 8 || N == 16)),
         "wrong! not implemented");
 
     if constexpr(is_same<T, double>::value)
@@ -783,6 +793,15 @@ __device__ void amd_buffer_store_impl(const typename vector_type<T, N>::type src
                                                0);
         }
     }
+    else if constexpr(is_same<T, f8_t>::value || is_same<T, bf8_t>::value)
+    {
+        // same bits as int8
+        amd_buffer_store_impl<int8_t, N>(
+            bit_cast<typename vector_type<int8_t, N>::type>(src_thread_data),
+            dst_wave_buffer_resource,
+            dst_thread_addr_offset,
+            dst_wave_addr_offset);
+    }
 }
 
 template <typename T, index_t N>
@@ -3,12 +3,22 @@
 
 #pragma once
 
+#include "ck/utility/f8_utils.hpp"
 #include "ck/utility/statically_indexed_array.hpp"
 
 namespace ck {
 
 using bhalf_t = ushort;
 using half_t  = _Float16;
+// Storage of the 8-bit floats in the E4M3 and E5M2 encodings of F8E4M3Format and F8E5M2Format.
+// They have no arithmetic, values are converted to and from them with type_convert.
+enum struct f8_t : uint8_t
+{
+};
+
+enum struct bf8_t : uint8_t
+{
+};
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 using int4_t = _BitInt(4);
 #endif
@@ -90,6 +100,20 @@ struct scalar_type<vector_type<T, N>>
     static constexpr index_t vector_size = N;
 };
 
+// vector of a type that cannot be the element of an ext_vector_type, e.g. f8_t
+template <typename T, index_t N>
+struct non_native_vector_base
+{
+    T d_[N];
+};
+
+template <typename T, index_t N>
+struct scalar_type<non_native_vector_base<T, N>>
+{
+    using type                           = T;
+    static constexpr index_t vector_size = N;
+};
+
 //
 template <>
 struct scalar_type<double>
@@ -133,6 +157,20 @@ struct scalar_type<int8_t>
     static constexpr index_t vector_size = 1;
 };
 
+template <>
+struct scalar_type<f8_t>
+{
+    using type                           = f8_t;
+    static constexpr index_t vector_size = 1;
+};
+
+template <>
+struct scalar_type<bf8_t>
+{
+    using type                           = bf8_t;
+    static constexpr index_t vector_size = 1;
+};
+
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 template <>
 struct scalar_type<int4_t>
@@ -898,6 +936,128 @@ struct vector_type<T, 256>
     }
 };
 
+// vector_type of a type that cannot be the element of an ext_vector_type, accessed as scalars or
+// as the whole vector only
+template <typename T, index_t N>
+struct non_native_vector_type
+{
+    using d1_t = T;
+    using type = non_native_vector_base<T, N>;
+
+    union
+    {
+        type dN_;
+        StaticallyIndexedArray<d1_t, N> d1xN_;
+        StaticallyIndexedArray<type, 1> dNx1_;
+    } data_;
+
+    __host__ __device__ constexpr non_native_vector_type() : data_{type{}} {}
+
+    __host__ __device__ constexpr non_native_vector_type(type v) : data_{v} {}
+
+    template <typename X>
+    __host__ __device__ constexpr const auto& AsType() const
+    {
+        static_assert(is_same<X, d1_t>::value || is_same<X, type>::value, "wrong!");
+
+        if constexpr(is_same<X, d1_t>::value)
+        {
+            return data_.d1xN_;
+        }
+        else if constexpr(is_same<X, type>::value)
+        {
+            return data_.dNx1_;
+        }
+    }
+
+    template <typename X>
+    __host__ __device__ constexpr auto& AsType()
+    {
+        static_assert(is_same<X, d1_t>::value || is_same<X, type>::value, "wrong!");
+
+        if constexpr(is_same<X, d1_t>::value)
+        {
+            return data_.d1xN_;
+        }
+        else if constexpr(is_same<X, type>::value)
+        {
+            return data_.dNx1_;
+        }
+    }
+};
+
+template <>
+struct vector_type<f8_t, 2> : non_native_vector_type<f8_t, 2>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<f8_t, 4> : non_native_vector_type<f8_t, 4>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<f8_t, 8> : non_native_vector_type<f8_t, 8>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<f8_t, 16> : non_native_vector_type<f8_t, 16>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<f8_t, 32> : non_native_vector_type<f8_t, 32>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<f8_t, 64> : non_native_vector_type<f8_t, 64>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<bf8_t, 2> : non_native_vector_type<bf8_t, 2>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<bf8_t, 4> : non_native_vector_type<bf8_t, 4>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<bf8_t, 8> : non_native_vector_type<bf8_t, 8>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<bf8_t, 16> : non_native_vector_type<bf8_t, 16>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<bf8_t, 32> : non_native_vector_type<bf8_t, 32>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
+template <>
+struct vector_type<bf8_t, 64> : non_native_vector_type<bf8_t, 64>
+{
+    using non_native_vector_type::non_native_vector_type;
+};
+
 // fp64
 using double2_t = typename vector_type<double, 2>::type;
 using double4_t = typename vector_type<double, 4>::type;
@@ -942,6 +1102,22 @@ using int8x16_t = typename vector_type<int8_t, 16>::type;
 using int8x32_t = typename vector_type<int8_t, 32>::type;
 using int8x64_t = typename vector_type<int8_t, 64>::type;
 
+// f8
+using f8x2_t  = typename vector_type<f8_t, 2>::type;
+using f8x4_t  = typename vector_type<f8_t, 4>::type;
+using f8x8_t  = typename vector_type<f8_t, 8>::type;
+using f8x16_t = typename vector_type<f8_t, 16>::type;
+using f8x32_t = typename vector_type<f8_t, 32>::type;
+using f8x64_t = typename vector_type<f8_t, 64>::type;
+
+// bf8
+using bf8x2_t  = typename vector_type<bf8_t, 2>::type;
+using bf8x4_t  = typename vector_type<bf8_t, 4>::type;
+using bf8x8_t  = typename vector_type<bf8_t, 8>::type;
+using bf8x16_t = typename vector_type<bf8_t, 16>::type;
+using bf8x32_t = typename vector_type<bf8_t, 32>::type;
+using bf8x64_t = typename vector_type<bf8_t, 64>::type;
+
 // Convert X to Y
 template <typename Y, typename X>
 __host__ __device__ constexpr Y type_convert(X x)
@@ -1010,6 +1186,106 @@ inline __host__ __device__ constexpr bhalf_t type_convert<bhalf_t, float>(float
     return uint16_t(u.int32 >> 16);
 }
 
+// convert fp32 to fp8 with rounding to nearest even, saturated
+template <>
+inline __host__ __device__ constexpr f8_t type_convert<f8_t, float>(float x)
+{
+    return bit_cast<f8_t>(cast_to_f8<F8E4M3Format,
+                                     F8SaturationMode::Saturate,
+                                     F8RoundingMode::RoundToNearestEven>(x));
+}
+
+// convert fp8 to fp32
+template <>
+inline __host__ __device__ constexpr float type_convert<float, f8_t>(f8_t x)
+{
+    return cast_from_f8<F8E4M3Format>(bit_cast<uint8_t>(x));
+}
+
+// convert fp16 to fp8 with rounding to nearest even, saturated, fp16 to fp32 is exact
+template <>
+inline __host__ __device__ constexpr f8_t type_convert<f8_t, half_t>(half_t x)
+{
+    return type_convert<f8_t>(static_cast<float>(x));
+}
+
+// convert fp8 to fp16, exactly
+template <>
+inline __host__ __device__ constexpr half_t type_convert<half_t, f8_t>(f8_t x)
+{
+    return static_cast<half_t>(type_convert<float>(x));
+}
+
+// convert fp32 to bf8 with rounding to nearest even, saturated
+template <>
+inline __host__ __device__ constexpr bf8_t type_convert<bf8_t, float>(float x)
+{
+    return bit_cast<bf8_t>(cast_to_f8<F8E5M2Format,
+                                      F8SaturationMode::Saturate,
+                                      F8RoundingMode::RoundToNearestEven>(x));
+}
+
+// convert bf8 to fp32
+template <>
+inline __host__ __device__ constexpr float type_convert<float, bf8_t>(bf8_t x)
+{
+    return cast_from_f8<F8E5M2Format>(bit_cast<uint8_t>(x));
+}
+
+// convert fp16 to bf8 with rounding to nearest even, saturated, fp16 to fp32 is exact
+template <>
+inline __host__ __device__ constexpr bf8_t type_convert<bf8_t, half_t>(half_t x)
+{
+    return type_convert<bf8_t>(static_cast<float>(x));
+}
+
+// convert bf8 to fp16, exactly
+template <>
+inline __host__ __device__ constexpr half_t type_convert<half_t, bf8_t>(bf8_t x)
+{
+    return static_cast<half_t>(type_convert<float>(x));
+}
+
+template <typename Y>
+struct f8_format_of;
+
+template <>
+struct f8_format_of<f8_t>
+{
+    using type = F8E4M3Format;
+};
+
+template <>
+struct f8_format_of<bf8_t>
+{
+    using type = F8E5M2Format;
+};
+
+// Convert fp32 or fp16 to fp8 or bf8 with stochastic rounding, saturated. rng is a uniformly
+// distributed random number, the result is unbiased over its values.
+template <typename Y, typename X>
+__host__ __device__ constexpr Y f8_convert_sr(X x, uint32_t rng)
+{
+    static_assert(is_same_v<Y, f8_t> || is_same_v<Y, bf8_t>, "wrong! not an 8-bit float");
+    static_assert(is_same_v<X, float> || is_same_v<X, half_t>, "wrong! not implemented");
+
+    return bit_cast<Y>(cast_to_f8<typename f8_format_of<Y>::type,
+                                  F8SaturationMode::Saturate,
+                                  F8RoundingMode::Stochastic>(static_cast<float>(x), rng));
+}
+
+// Convert fp32 or fp16 to fp8 or bf8 with rounding to nearest even, values out of range to NaN
+template <typename Y, typename X>
+__host__ __device__ constexpr Y f8_convert_no_saturate(X x)
+{
+    static_assert(is_same_v<Y, f8_t> || is_same_v<Y, bf8_t>, "wrong! not an 8-bit float");
+    static_assert(is_same_v<X, float> || is_same_v<X, half_t>, "wrong! not implemented");
+
+    return bit_cast<Y>(cast_to_f8<typename f8_format_of<Y>::type,
+                                  F8SaturationMode::NoSaturate,
+                                  F8RoundingMode::RoundToNearestEven>(static_cast<float>(x)));
+}
+
 template <typename T>
 struct NumericLimits
 {
@@ -1044,6 +1320,46 @@ struct NumericLimits<half_t>
     __host__ __device__ static constexpr half_t QuietNaN() { return bit_cast<half_t>(binary_qnan); }
 };
 
+template <>
+struct NumericLimits<f8_t>
+{
+    using Format = F8E4M3Format;
+
+    __host__ __device__ static constexpr f8_t Min() { return bit_cast<f8_t>(Format::binary_min); }
+
+    __host__ __device__ static constexpr f8_t Max() { return bit_cast<f8_t>(Format::binary_max); }
+
+    __host__ __device__ static constexpr f8_t Lowest()
+    {
+        return bit_cast<f8_t>(Format::binary_lowest);
+    }
+
+    __host__ __device__ static constexpr f8_t QuietNaN()
+    {
+        return bit_cast<f8_t>(Format::binary_qnan);
+    }
+};
+
+template <>
+struct NumericLimits<bf8_t>
+{
+    using Format = F8E5M2Format;
+
+    __host__ __device__ static constexpr bf8_t Min() { return bit_cast<bf8_t>(Format::binary_min); }
+
+    __host__ __device__ static constexpr bf8_t Max() { return bit_cast<bf8_t>(Format::binary_max); }
+
+    __host__ __device__ static constexpr bf8_t Lowest()
+    {
+        return bit_cast<bf8_t>(Format::binary_lowest);
+    }
+
+    __host__ __device__ static constexpr bf8_t QuietNaN()
+    {
+        return bit_cast<bf8_t>(Format::binary_qnan);
+    }
+};
+
 #ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
 template <>
 struct NumericLimits<int4_t>
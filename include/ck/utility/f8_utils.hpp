@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/ck.hpp"
+#include "ck/utility/type.hpp"
+
+namespace ck {
+
+// rounding of conversions to 8-bit floats
+enum struct F8RoundingMode
+{
+    RoundToNearestEven,
+    Stochastic, // rounds up with a probability of the remainder over the spacing of the results
+};
+
+// conversion of values out of range of 8-bit floats
+enum struct F8SaturationMode
+{
+    Saturate,   // to the largest finite value of the same sign
+    NoSaturate, // to NaN
+};
+
+// Encoding of 8-bit floats with ExponentBits bits of exponent and MantissaBits bits of mantissa,
+// the one of the gfx940 conversion instructions: exponent bias of 2^(ExponentBits - 1), no
+// infinity, no negative zero, 0x80 is the only NaN
+template <index_t ExponentBits, index_t MantissaBits>
+struct F8Format
+{
+    static_assert(1 + ExponentBits + MantissaBits == 8, "wrong! not an 8-bit format");
+
+    static constexpr index_t exponent_bits = ExponentBits;
+    static constexpr index_t mantissa_bits = MantissaBits;
+    static constexpr index_t bias          = 1 << (ExponentBits - 1);
+
+    static constexpr uint8_t binary_min    = 1 << MantissaBits; // smallest normal
+    static constexpr uint8_t binary_max    = 0x7f;
+    static constexpr uint8_t binary_lowest = 0xff;
+    static constexpr uint8_t binary_qnan   = 0x80;
+};
+
+using F8E4M3Format = F8Format<4, 3>;
+using F8E5M2Format = F8Format<5, 2>;
+
+// Converts fp32 to the bits of an 8-bit float. NaN converts to NaN and infinities as values out
+// of range. For stochastic rounding, rng is a uniformly distributed random number: the result is
+// rounded up when the remainder, as a 32-bit fraction of the spacing, plus rng overflows.
+template <typename Format, F8SaturationMode Saturation, F8RoundingMode Rounding>
+__host__ __device__ constexpr uint8_t cast_to_f8(float x, uint32_t rng = 0)
+{
+    constexpr index_t mantissa_bits = Format::mantissa_bits;
+    constexpr int32_t min_exponent  = 1 - Format::bias; // of normals and subnormals
+
+    const uint32_t bits = bit_cast<uint32_t>(x);
+    const uint32_t sign = bits >> 31;
+
+    const uint8_t out_of_range = Saturation == F8SaturationMode::Saturate
+                                     ? static_cast<uint8_t>(sign << 7 | Format::binary_max)
+                                     : Format::binary_qnan;
+
+    const uint32_t exponent_field = (bits >> 23) & 0xff;
+    const uint32_t mantissa_field = bits & 0x7fffff;
+
+    if(exponent_field == 0xff)
+    {
+        if(mantissa_field != 0)
+        {
+            return Format::binary_qnan;
+        }
+
+        return out_of_range;
+    }
+
+    // |x| = m * 2^(e - 23)
+    const uint32_t m = exponent_field == 0 ? mantissa_field : mantissa_field | 0x800000;
+    const int32_t e  = exponent_field == 0 ? -126 : static_cast<int32_t>(exponent_field) - 127;
+
+    // the spacing of the results around |x| is 2^(exponent - mantissa_bits)
+    const int32_t exponent = e > min_exponent ? e : min_exponent;
+    const int32_t shift    = 23 - mantissa_bits + exponent - e;
+
+    // |x| = (q + remainder) * spacing, with the remainder as a 32-bit fraction
+    uint32_t q         = 0;
+    uint32_t remainder = 0;
+
+    if(shift < 32)
+    {
+        q         = m >> shift;
+        remainder = m << (32 - shift);
+    }
+    else if(shift < 32 + 24)
+    {
+        remainder = m >> (shift - 32);
+    }
+
+    if constexpr(Rounding == F8RoundingMode::RoundToNearestEven)
+    {
+        if(remainder > 0x80000000 || (remainder == 0x80000000 && (q & 1) != 0))
+        {
+            ++q;
+        }
+    }
+    else
+    {
+        if(remainder + static_cast<uint64_t>(rng) > 0xffffffff)
+        {
+            ++q;
+        }
+    }
+
+    // the exponent field follows from a carry of q into the hidden bit, for subnormals as well
+    const uint32_t magnitude =
+        (static_cast<uint32_t>(exponent + Format::bias - 1) << mantissa_bits) + q;
+
+    if(magnitude > Format::binary_max)
+    {
+        return out_of_range;
+    }
+
+    // there is no negative zero
+    return magnitude == 0 ? uint8_t{0} : static_cast<uint8_t>(sign << 7 | magnitude);
+}
+
+// converts the bits of an 8-bit float to fp32, exactly
+template <typename Format>
+__host__ __device__ constexpr float cast_from_f8(uint8_t x)
+{
+    constexpr index_t mantissa_bits = Format::mantissa_bits;
+
+    if(x == Format::binary_qnan)
+    {
+        return bit_cast<float>(uint32_t{0x7fc00000});
+    }
+
+    const uint32_t sign           = x >> 7;
+    const uint32_t exponent_field = (x >> mantissa_bits) & ((1 << Format::exponent_bits) - 1);
+    const uint32_t mantissa_field = x & ((1 << mantissa_bits) - 1);
+
+    if(exponent_field == 0)
+    {
+        // mantissa_field * 2^(1 - bias - mantissa_bits), both factors exact
+        const float scale =
+            bit_cast<float>(static_cast<uint32_t>(127 + 1 - Format::bias - mantissa_bits) << 23);
+        const float magnitude = static_cast<float>(mantissa_field) * scale;
+
+        return sign != 0 ? -magnitude : magnitude;
+    }
+
+    return bit_cast<float>(sign << 31 | (exponent_field - Format::bias + 127) << 23 |
+                           mantissa_field << (23 - mantissa_bits));
+}
+
+} // namespace ck
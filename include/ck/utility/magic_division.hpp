@@ -19,9 +19,8 @@ namespace ck {
 //   implemented, the int32_t dividend would be bit-wise interpreted as uint32_t and magic number
 //   division implementation for uint32_t is then used. Therefore, dividend value need to be
 //   non-negative.
-// TODO:
-//   1. Implement magic number divison for int32_t
-//   2. Implement magic number divison for unit32_t with 32-bit value range
+// MagicDivisionFullRange below handles int32_t dividends and the full 32-bit and 64-bit value
+// ranges, at the cost of a few more instructions per division.
 struct MagicDivision
 {
     // uint32_t
@@ -157,4 +156,234 @@ struct MagicDivision
     }
 };
 
+// magic number division over the full value range of uint32_t, int32_t, uint64_t and int64_t
+// dividends, following T. Granlund and P. Montgomery, "Division by Invariant Integers using
+// Multiplication", PLDI 1994:
+//   1. unsigned (figure 4.1): l = ceil(log2(d)), m = 2^N * (2^l - d) / d + 1,
+//      q = (mulhi(m, n) + n) >> l, the addition being done without overflow
+//   2. signed (figure 5.2): l = max(ceil(log2(|d|)), 1), m = 2^(N + l - 1) / |d| + 1 - 2^N,
+//      q rounds toward zero, as the built-in division does
+// Magic numbers are returned as (multiplier, shift), like MagicDivision. For a signed divisor, the
+// multiplier is signed and bit 7 of the shift is the sign of the divisor.
+// Dividing the most negative value by -1 overflows, as the built-in division does.
+struct MagicDivisionFullRange
+{
+    private:
+    // floor(r * 2^64 / d), r < d
+    __host__ __device__ static constexpr uint64_t DivideWide(uint64_t r, uint64_t d)
+    {
+        uint64_t q = 0;
+
+        for(uint32_t i = 0; i < 64; ++i)
+        {
+            const bool carry = (r >> 63) != 0;
+
+            r = r << 1;
+            q = q << 1;
+
+            if(carry || r >= d)
+            {
+                r = r - d;
+                q = q | 1;
+            }
+        }
+
+        return q;
+    }
+
+    // ceil(log2(d)), d > 0
+    template <typename UInt>
+    __host__ __device__ static constexpr uint32_t CeilLog2(UInt d)
+    {
+        uint32_t l = 0;
+
+        while(l < sizeof(UInt) * 8 && (UInt{1} << l) < d)
+        {
+            ++l;
+        }
+
+        return l;
+    }
+
+    static constexpr uint32_t divisor_sign_bit = 0x80;
+
+    public:
+    // uint32_t
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(uint32_t divisor)
+    {
+        // division by 0 is undefined, the "else" logic below is to quiet down run-time error
+        if(divisor >= 1)
+        {
+            const uint32_t shift = CeilLog2(divisor);
+
+            const uint64_t one        = 1;
+            const uint64_t multiplier = ((one << 32) * ((one << shift) - divisor)) / divisor + 1;
+
+            return make_tuple(uint32_t(multiplier), shift);
+        }
+        else
+        {
+            return make_tuple(uint32_t(0), uint32_t(0));
+        }
+    }
+
+    // int32_t
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(int32_t divisor)
+    {
+        if(divisor != 0)
+        {
+            const uint32_t d_abs = divisor > 0 ? uint32_t(divisor) : 0U - uint32_t(divisor);
+            const uint32_t l     = d_abs > 1 ? CeilLog2(d_abs) : 1;
+
+            // 2^(l - 1) mod |d|
+            const uint64_t r          = d_abs == 1 ? 0 : uint64_t{1} << (l - 1);
+            const uint32_t multiplier = uint32_t((r << 32) / d_abs + 1);
+
+            return make_tuple(int32_t(multiplier),
+                              (l - 1) | (divisor < 0 ? divisor_sign_bit : 0U));
+        }
+        else
+        {
+            return make_tuple(int32_t(0), uint32_t(0));
+        }
+    }
+
+    // uint64_t
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(uint64_t divisor)
+    {
+        if(divisor >= 1)
+        {
+            const uint32_t shift = CeilLog2(divisor);
+
+            // 2^l - d, l being 64 for divisors above 2^63
+            const uint64_t r = (shift < 64 ? uint64_t{1} << shift : 0) - divisor;
+
+            return make_tuple(DivideWide(r, divisor) + 1, shift);
+        }
+        else
+        {
+            return make_tuple(uint64_t(0), uint32_t(0));
+        }
+    }
+
+    // int64_t
+    __host__ __device__ static constexpr auto CalculateMagicNumbers(int64_t divisor)
+    {
+        if(divisor != 0)
+        {
+            const uint64_t d_abs = divisor > 0 ? uint64_t(divisor) : 0ULL - uint64_t(divisor);
+            const uint32_t l     = d_abs > 1 ? CeilLog2(d_abs) : 1;
+
+            // 2^(l - 1) mod |d|
+            const uint64_t r          = d_abs == 1 ? 0 : uint64_t{1} << (l - 1);
+            const uint64_t multiplier = DivideWide(r, d_abs) + 1;
+
+            return make_tuple(int64_t(multiplier),
+                              (l - 1) | (divisor < 0 ? divisor_sign_bit : 0U));
+        }
+        else
+        {
+            return make_tuple(int64_t(0), uint32_t(0));
+        }
+    }
+
+    // high half of the product
+    __device__ static constexpr uint32_t MulHi(uint32_t a, uint32_t b) { return __umulhi(a, b); }
+
+    __host__ static constexpr uint32_t MulHi(uint32_t a, uint32_t b)
+    {
+        return static_cast<uint64_t>(a) * b >> 32;
+    }
+
+    __device__ static constexpr int32_t MulHi(int32_t a, int32_t b) { return __mulhi(a, b); }
+
+    __host__ static constexpr int32_t MulHi(int32_t a, int32_t b)
+    {
+        return static_cast<int64_t>(a) * b >> 32;
+    }
+
+    __device__ static constexpr uint64_t MulHi(uint64_t a, uint64_t b)
+    {
+        return __umul64hi(a, b);
+    }
+
+    __host__ static constexpr uint64_t MulHi(uint64_t a, uint64_t b)
+    {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<unsigned __int128>(a) * b >> 64;
+#else
+        const uint64_t a_lo = a & 0xffffffff;
+        const uint64_t a_hi = a >> 32;
+        const uint64_t b_lo = b & 0xffffffff;
+        const uint64_t b_hi = b >> 32;
+
+        const uint64_t hi_lo = a_hi * b_lo;
+        const uint64_t mid   = (a_lo * b_lo >> 32) + (hi_lo & 0xffffffff) + a_lo * b_hi;
+
+        return a_hi * b_hi + (hi_lo >> 32) + (mid >> 32);
+#endif
+    }
+
+    __device__ static constexpr int64_t MulHi(int64_t a, int64_t b) { return __mul64hi(a, b); }
+
+    __host__ static constexpr int64_t MulHi(int64_t a, int64_t b)
+    {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<__int128>(a) * b >> 64;
+#else
+        const uint64_t hi = MulHi(uint64_t(a), uint64_t(b)) - (a < 0 ? uint64_t(b) : 0) -
+                            (b < 0 ? uint64_t(a) : 0);
+
+        return int64_t(hi);
+#endif
+    }
+
+    // magic division for uint32_t
+    __host__ __device__ static constexpr uint32_t
+    DoMagicDivision(uint32_t dividend, uint32_t multiplier, uint32_t shift)
+    {
+        const uint32_t tmp = MulHi(dividend, multiplier);
+
+        // 33-bit sum, the shift may be 32
+        return (static_cast<uint64_t>(tmp) + dividend) >> shift;
+    }
+
+    // magic division for int32_t
+    __host__ __device__ static constexpr int32_t
+    DoMagicDivision(int32_t dividend, int32_t multiplier, uint32_t shift)
+    {
+        // in unsigned arithmetic, as the intermediate sum of |d| = 1 wraps around
+        const uint32_t sign_n = dividend < 0 ? 0xffffffff : 0;
+        const uint32_t sign_d = (shift & divisor_sign_bit) != 0 ? 0xffffffff : 0;
+
+        const uint32_t tmp = uint32_t(dividend) + uint32_t(MulHi(dividend, multiplier));
+        const uint32_t q = uint32_t(int32_t(tmp) >> (shift & ~divisor_sign_bit)) - sign_n;
+
+        return int32_t((q ^ sign_d) - sign_d);
+    }
+
+    // magic division for uint64_t
+    __host__ __device__ static constexpr uint64_t
+    DoMagicDivision(uint64_t dividend, uint64_t multiplier, uint32_t shift)
+    {
+        const uint64_t tmp = MulHi(dividend, multiplier);
+
+        // (tmp + dividend) >> shift without the 65-bit sum
+        return shift == 0 ? dividend : (tmp + ((dividend - tmp) >> 1)) >> (shift - 1);
+    }
+
+    // magic division for int64_t
+    __host__ __device__ static constexpr int64_t
+    DoMagicDivision(int64_t dividend, int64_t multiplier, uint32_t shift)
+    {
+        const uint64_t sign_n = dividend < 0 ? ~uint64_t{0} : 0;
+        const uint64_t sign_d = (shift & divisor_sign_bit) != 0 ? ~uint64_t{0} : 0;
+
+        const uint64_t tmp = uint64_t(dividend) + uint64_t(MulHi(dividend, multiplier));
+        const uint64_t q = uint64_t(int64_t(tmp) >> (shift & ~divisor_sign_bit)) - sign_n;
+
+        return int64_t((q ^ sign_d) - sign_d);
+    }
+};
+
 } // namespace ck
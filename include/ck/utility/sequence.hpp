@@ -34,6 +34,16 @@ __host__ __device__ constexpr auto sequence_pop_front(Sequence<I, Is...>);
 template <typename Seq>
 __host__ __device__ constexpr auto sequence_pop_back(Seq);
 
+namespace detail {
+// storage of constexpr functions computing the elements of a Sequence, the last dummy element
+// is to prevent compiler complain about empty array, when N = 0
+template <index_t N>
+struct sequence_array
+{
+    index_t data_[N + 1];
+};
+} // namespace detail
+
 template <index_t... Is>
 struct Sequence
 {
@@ -181,28 +191,46 @@ struct Sequence
 };
 
 // merge sequence
-template <typename Seq, typename... Seqs>
-struct sequence_merge
+namespace detail {
+template <typename Seq>
+struct sequence_merge_operand
 {
-    using type = typename sequence_merge<Seq, typename sequence_merge<Seqs...>::type>::type;
+    using type = Seq;
 };
 
+// only used in unevaluated context, by the fold expression of sequence_merge
 template <index_t... Xs, index_t... Ys>
-struct sequence_merge<Sequence<Xs...>, Sequence<Ys...>>
+__host__ __device__ constexpr auto operator|(sequence_merge_operand<Sequence<Xs...>>,
+                                             sequence_merge_operand<Sequence<Ys...>>)
 {
-    using type = Sequence<Xs..., Ys...>;
-};
+    return sequence_merge_operand<Sequence<Xs..., Ys...>>{};
+}
+} // namespace detail
 
-template <typename Seq>
-struct sequence_merge<Seq>
+template <typename Seq, typename... Seqs>
+struct sequence_merge
 {
-    using type = Seq;
+    using type = typename decltype((detail::sequence_merge_operand<Seq>{} | ... |
+                                    detail::sequence_merge_operand<Seqs>{}))::type;
 };
 
 // generate sequence
+namespace detail {
+template <typename T, T... Is>
+struct sequence_gen_from_ids
+{
+    template <typename G>
+    using type = Sequence<G{}(Number<Is>{})...>;
+};
+} // namespace detail
+
 template <index_t NSize, typename F>
 struct sequence_gen
 {
+#if CK_USE_BUILTIN_MAKE_INTEGER_SEQ
+    using type = typename __make_integer_seq<detail::sequence_gen_from_ids, index_t, NSize>::
+        template type<F>;
+#else
     template <index_t IBegin, index_t NRemain, typename G>
     struct sequence_gen_impl
     {
@@ -229,6 +257,7 @@ struct sequence_gen
     };
 
     using type = typename sequence_gen_impl<0, NSize, F>::type;
+#endif
 };
 
 // arithmetic sequence
@@ -243,13 +272,10 @@ struct arithmetic_sequence_gen
         }
     };
 
-    using type0 = typename sequence_gen<(IEnd - IBegin) / Increment, F>::type;
-    using type1 = Sequence<>;
-
     static constexpr bool kHasContent =
         (Increment > 0 && IBegin < IEnd) || (Increment < 0 && IBegin > IEnd);
 
-    using type = typename conditional<kHasContent, type0, type1>::type;
+    using type = typename sequence_gen<kHasContent ? (IEnd - IBegin) / Increment : 0, F>::type;
 };
 
 // uniform sequence
@@ -265,29 +291,37 @@ struct uniform_sequence_gen
 };
 
 // reverse inclusive scan (with init) sequence
-template <typename, typename, index_t>
-struct sequence_reverse_inclusive_scan;
-
-template <index_t I, index_t... Is, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I, Is...>, Reduce, Init>
+template <typename Seq, typename Reduce, index_t Init>
+struct sequence_reverse_inclusive_scan
 {
-    using old_scan = typename sequence_reverse_inclusive_scan<Sequence<Is...>, Reduce, Init>::type;
+    static constexpr index_t NSize = Seq::Size();
 
-    static constexpr index_t new_reduce = Reduce{}(I, old_scan{}.Front());
+    __host__ __device__ static constexpr auto Scan()
+    {
+        detail::sequence_array<NSize> scan{};
 
-    using type = typename sequence_merge<Sequence<new_reduce>, old_scan>::type;
-};
+        index_t reduce = Init;
 
-template <index_t I, typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<I>, Reduce, Init>
-{
-    using type = Sequence<Reduce{}(I, Init)>;
-};
+        for(index_t i = NSize - 1; i >= 0; --i)
+        {
+            reduce        = Reduce{}(Seq::At(i), reduce);
+            scan.data_[i] = reduce;
+        }
 
-template <typename Reduce, index_t Init>
-struct sequence_reverse_inclusive_scan<Sequence<>, Reduce, Init>
-{
-    using type = Sequence<>;
+        return scan;
+    }
+
+    static constexpr auto scan_ = Scan();
+
+    struct F
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return scan_.data_[i];
+        }
+    };
+
+    using type = typename sequence_gen<NSize, F>::type;
 };
 
 // split sequence
@@ -307,24 +341,17 @@ struct sequence_split
 template <typename Seq>
 struct sequence_reverse
 {
-    static constexpr index_t NSize = Seq{}.Size();
-
-    using seq_split = sequence_split<Seq, NSize / 2>;
-    using type      = typename sequence_merge<
-        typename sequence_reverse<typename seq_split::right_type>::type,
-        typename sequence_reverse<typename seq_split::left_type>::type>::type;
-};
+    static constexpr index_t NSize = Seq::Size();
 
-template <index_t I>
-struct sequence_reverse<Sequence<I>>
-{
-    using type = Sequence<I>;
-};
+    struct F
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return Seq::At(NSize - 1 - i);
+        }
+    };
 
-template <index_t I0, index_t I1>
-struct sequence_reverse<Sequence<I0, I1>>
-{
-    using type = Sequence<I1, I0>;
+    using type = typename sequence_gen<NSize, F>::type;
 };
 
 #if 1
@@ -349,151 +376,111 @@ struct sequence_reduce<Reduce, Seq>
 };
 #endif
 
-template <typename Values, typename Ids, typename Compare>
-struct sequence_sort_impl
+namespace detail {
+template <index_t N>
+struct sequence_sort_array
 {
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl
-    {
-        static constexpr bool choose_left = LeftValues::Front() < RightValues::Front();
-
-        static constexpr index_t chosen_value =
-            choose_left ? LeftValues::Front() : RightValues::Front();
-        static constexpr index_t chosen_id = choose_left ? LeftIds::Front() : RightIds::Front();
-
-        using new_merged_values = decltype(MergedValues::PushBack(Number<chosen_value>{}));
-        using new_merged_ids    = decltype(MergedIds::PushBack(Number<chosen_id>{}));
-
-        using new_left_values =
-            typename conditional<choose_left, decltype(LeftValues::PopFront()), LeftValues>::type;
-        using new_left_ids =
-            typename conditional<choose_left, decltype(LeftIds::PopFront()), LeftIds>::type;
-
-        using new_right_values =
-            typename conditional<choose_left, RightValues, decltype(RightValues::PopFront())>::type;
-        using new_right_ids =
-            typename conditional<choose_left, RightIds, decltype(RightIds::PopFront())>::type;
-
-        using merge = sorted_sequence_merge_impl<new_left_values,
-                                                 new_left_ids,
-                                                 new_right_values,
-                                                 new_right_ids,
-                                                 new_merged_values,
-                                                 new_merged_ids,
-                                                 Comp>;
-        // this is output
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+    sequence_array<N> values_;
+    sequence_array<N> ids_;
+};
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<LeftValues,
-                                      LeftIds,
-                                      Sequence<>,
-                                      Sequence<>,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, LeftValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, LeftIds>::type;
-    };
+// merge sort of [begin, begin + n): pairs are ordered by Compare, larger ranges are split into
+// n / 2 and n - n / 2 and merged by taking the left element only if it is less than the right one
+template <typename Compare, index_t N>
+__host__ __device__ constexpr void
+sequence_merge_sort(sequence_sort_array<N>& x, index_t begin, index_t n)
+{
+    if(n < 2)
+    {
+        return;
+    }
 
-    template <typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<Sequence<>,
-                                      Sequence<>,
-                                      RightValues,
-                                      RightIds,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, RightValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, RightIds>::type;
-    };
+    if(n == 2)
+    {
+        if(!Compare{}(x.values_.data_[begin], x.values_.data_[begin + 1]))
+        {
+            const index_t value = x.values_.data_[begin];
+            const index_t id    = x.ids_.data_[begin];
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename Comp>
-    struct sorted_sequence_merge
-    {
-        using merge = sorted_sequence_merge_impl<LeftValues,
-                                                 LeftIds,
-                                                 RightValues,
-                                                 RightIds,
-                                                 Sequence<>,
-                                                 Sequence<>,
-                                                 Comp>;
-
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+            x.values_.data_[begin]     = x.values_.data_[begin + 1];
+            x.ids_.data_[begin]        = x.ids_.data_[begin + 1];
+            x.values_.data_[begin + 1] = value;
+            x.ids_.data_[begin + 1]    = id;
+        }
 
-    static constexpr index_t nsize = Values::Size();
+        return;
+    }
 
-    using split_unsorted_values = sequence_split<Values, nsize / 2>;
-    using split_unsorted_ids    = sequence_split<Ids, nsize / 2>;
-
-    using left_unsorted_values = typename split_unsorted_values::left_type;
-    using left_unsorted_ids    = typename split_unsorted_ids::left_type;
-    using left_sort          = sequence_sort_impl<left_unsorted_values, left_unsorted_ids, Compare>;
-    using left_sorted_values = typename left_sort::sorted_values;
-    using left_sorted_ids    = typename left_sort::sorted_ids;
-
-    using right_unsorted_values = typename split_unsorted_values::right_type;
-    using right_unsorted_ids    = typename split_unsorted_ids::right_type;
-    using right_sort = sequence_sort_impl<right_unsorted_values, right_unsorted_ids, Compare>;
-    using right_sorted_values = typename right_sort::sorted_values;
-    using right_sorted_ids    = typename right_sort::sorted_ids;
-
-    using merged_sorted = sorted_sequence_merge<left_sorted_values,
-                                                left_sorted_ids,
-                                                right_sorted_values,
-                                                right_sorted_ids,
-                                                Compare>;
-
-    using sorted_values = typename merged_sorted::merged_values;
-    using sorted_ids    = typename merged_sorted::merged_ids;
-};
+    const index_t middle = begin + n / 2;
+    const index_t end    = begin + n;
 
-template <index_t ValueX, index_t ValueY, index_t IdX, index_t IdY, typename Compare>
-struct sequence_sort_impl<Sequence<ValueX, ValueY>, Sequence<IdX, IdY>, Compare>
-{
-    static constexpr bool choose_x = Compare{}(ValueX, ValueY);
+    sequence_merge_sort<Compare>(x, begin, n / 2);
+    sequence_merge_sort<Compare>(x, middle, n - n / 2);
 
-    using sorted_values =
-        typename conditional<choose_x, Sequence<ValueX, ValueY>, Sequence<ValueY, ValueX>>::type;
-    using sorted_ids = typename conditional<choose_x, Sequence<IdX, IdY>, Sequence<IdY, IdX>>::type;
-};
+    sequence_sort_array<N> merged{};
 
-template <index_t Value, index_t Id, typename Compare>
-struct sequence_sort_impl<Sequence<Value>, Sequence<Id>, Compare>
-{
-    using sorted_values = Sequence<Value>;
-    using sorted_ids    = Sequence<Id>;
-};
+    index_t left  = begin;
+    index_t right = middle;
+
+    for(index_t i = 0; i < n; ++i)
+    {
+        const bool choose_left =
+            right == end || (left < middle && x.values_.data_[left] < x.values_.data_[right]);
+
+        const index_t chosen = choose_left ? left++ : right++;
 
-template <typename Compare>
-struct sequence_sort_impl<Sequence<>, Sequence<>, Compare>
+        merged.values_.data_[i] = x.values_.data_[chosen];
+        merged.ids_.data_[i]    = x.ids_.data_[chosen];
+    }
+
+    for(index_t i = 0; i < n; ++i)
+    {
+        x.values_.data_[begin + i] = merged.values_.data_[i];
+        x.ids_.data_[begin + i]    = merged.ids_.data_[i];
+    }
+}
+} // namespace detail
+
+template <typename Values, typename Ids, typename Compare>
+struct sequence_sort_impl
 {
-    using sorted_values = Sequence<>;
-    using sorted_ids    = Sequence<>;
+    static constexpr index_t nsize = Values::Size();
+
+    __host__ __device__ static constexpr auto Sort()
+    {
+        detail::sequence_sort_array<nsize> x{};
+
+        for(index_t i = 0; i < nsize; ++i)
+        {
+            x.values_.data_[i] = Values::At(i);
+            x.ids_.data_[i]    = Ids::At(i);
+        }
+
+        detail::sequence_merge_sort<Compare>(x, 0, nsize);
+
+        return x;
+    }
+
+    static constexpr auto sorted_ = Sort();
+
+    struct GetValue
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return sorted_.values_.data_[i];
+        }
+    };
+
+    struct GetId
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return sorted_.ids_.data_[i];
+        }
+    };
+
+    using sorted_values = typename sequence_gen<nsize, GetValue>::type;
+    using sorted_ids    = typename sequence_gen<nsize, GetId>::type;
 };
 
 template <typename Values, typename Compare>
@@ -510,75 +497,68 @@ struct sequence_sort
 template <typename Values, typename Less, typename Equal>
 struct sequence_unique_sort
 {
-    template <typename RemainValues,
-              typename RemainIds,
-              typename UniquifiedValues,
-              typename UniquifiedIds,
-              typename Eq>
-    struct sorted_sequence_uniquify_impl
+    using sort          = sequence_sort<Values, Less>;
+    using sorted_values = typename sort::type;
+    using sorted_ids    = typename sort::sorted2unsorted_map;
+
+    static constexpr index_t nsize = Values::Size();
+
+    // keep the first of each run of equal values
+    __host__ __device__ static constexpr auto Uniquify()
     {
-        static constexpr index_t current_value = RemainValues::Front();
-        static constexpr index_t current_id    = RemainIds::Front();
+        detail::sequence_sort_array<nsize> x{};
 
-        static constexpr bool is_unique_value = (current_value != UniquifiedValues::Back());
+        index_t size = 0;
 
-        using new_remain_values = decltype(RemainValues::PopFront());
-        using new_remain_ids    = decltype(RemainIds::PopFront());
+        for(index_t i = 0; i < nsize; ++i)
+        {
+            if(size == 0 || sorted_values::At(i) != x.values_.data_[size - 1])
+            {
+                x.values_.data_[size] = sorted_values::At(i);
+                x.ids_.data_[size]    = sorted_ids::At(i);
+                ++size;
+            }
+        }
 
-        using new_uniquified_values =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedValues::PushBack(Number<current_value>{})),
-                                 UniquifiedValues>::type;
+        return x;
+    }
 
-        using new_uniquified_ids =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedIds::PushBack(Number<current_id>{})),
-                                 UniquifiedIds>::type;
+    __host__ __device__ static constexpr index_t GetUniqueSize()
+    {
+        index_t size = 0;
 
-        using uniquify = sorted_sequence_uniquify_impl<new_remain_values,
-                                                       new_remain_ids,
-                                                       new_uniquified_values,
-                                                       new_uniquified_ids,
-                                                       Eq>;
+        for(index_t i = 0; i < nsize; ++i)
+        {
+            if(i == 0 || sorted_values::At(i) != sorted_values::At(i - 1))
+            {
+                ++size;
+            }
+        }
 
-        // this is output
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
+        return size;
+    }
 
-    template <typename UniquifiedValues, typename UniquifiedIds, typename Eq>
-    struct sorted_sequence_uniquify_impl<Sequence<>,
-                                         Sequence<>,
-                                         UniquifiedValues,
-                                         UniquifiedIds,
-                                         Eq>
+    static constexpr auto uniquified_ = Uniquify();
+
+    struct GetValue
     {
-        using uniquified_values = UniquifiedValues;
-        using uniquified_ids    = UniquifiedIds;
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return uniquified_.values_.data_[i];
+        }
     };
 
-    template <typename SortedValues, typename SortedIds, typename Eq>
-    struct sorted_sequence_uniquify
+    struct GetId
     {
-        using uniquify = sorted_sequence_uniquify_impl<decltype(SortedValues::PopFront()),
-                                                       decltype(SortedIds::PopFront()),
-                                                       Sequence<SortedValues::Front()>,
-                                                       Sequence<SortedIds::Front()>,
-                                                       Eq>;
-
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return uniquified_.ids_.data_[i];
+        }
     };
 
-    using sort          = sequence_sort<Values, Less>;
-    using sorted_values = typename sort::type;
-    using sorted_ids    = typename sort::sorted2unsorted_map;
-
-    using uniquify = sorted_sequence_uniquify<sorted_values, sorted_ids, Equal>;
-
     // this is output
-    using type                = typename uniquify::uniquified_values;
-    using sorted2unsorted_map = typename uniquify::uniquified_ids;
+    using type                = typename sequence_gen<GetUniqueSize(), GetValue>::type;
+    using sorted2unsorted_map = typename sequence_gen<GetUniqueSize(), GetId>::type;
 };
 
 template <typename SeqMap>
@@ -590,28 +570,28 @@ struct is_valid_sequence_map : is_same<typename arithmetic_sequence_gen<0, SeqMa
 template <typename SeqMap>
 struct sequence_map_inverse
 {
-    template <typename X2Y, typename WorkingY2X, index_t XBegin, index_t XRemain>
-    struct sequence_map_inverse_impl
+    static constexpr index_t NSize = SeqMap::Size();
+
+    // y2x[x2y[x]] = x, the last x wins if x2y is not one-to-one
+    struct F
     {
-        static constexpr auto new_y2x =
-            WorkingY2X::Modify(X2Y::At(Number<XBegin>{}), Number<XBegin>{});
+        __host__ __device__ constexpr index_t operator()(index_t y) const
+        {
+            index_t x_found = 0;
 
-        using type =
-            typename sequence_map_inverse_impl<X2Y, decltype(new_y2x), XBegin + 1, XRemain - 1>::
-                type;
-    };
+            for(index_t x = 0; x < NSize; ++x)
+            {
+                if(SeqMap::At(x) == y)
+                {
+                    x_found = x;
+                }
+            }
 
-    template <typename X2Y, typename WorkingY2X, index_t XBegin>
-    struct sequence_map_inverse_impl<X2Y, WorkingY2X, XBegin, 0>
-    {
-        using type = WorkingY2X;
+            return x_found;
+        }
     };
 
-    using type =
-        typename sequence_map_inverse_impl<SeqMap,
-                                           typename uniform_sequence_gen<SeqMap::Size(), 0>::type,
-                                           0,
-                                           SeqMap::Size()>::type;
+    using type = typename sequence_gen<NSize, F>::type;
 };
 
 template <index_t... Xs, index_t... Ys>
@@ -791,25 +771,52 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_ids(Seq, Sequence<I
 
 #if 1
 namespace detail {
-template <typename WorkSeq, typename RemainSeq, typename RemainMask>
+template <typename Seq, typename Mask>
 struct pick_sequence_elements_by_mask_impl
 {
-    using new_work_seq = typename conditional<RemainMask::Front(),
-                                              decltype(WorkSeq::PushBack(RemainSeq::Front())),
-                                              WorkSeq>::type;
+    static constexpr index_t NSize = Seq::Size();
 
-    using type =
-        typename pick_sequence_elements_by_mask_impl<new_work_seq,
-                                                     decltype(RemainSeq::PopFront()),
-                                                     decltype(RemainMask::PopFront())>::type;
-};
+    __host__ __device__ static constexpr auto Pick()
+    {
+        sequence_array<NSize> picked{};
 
-template <typename WorkSeq>
-struct pick_sequence_elements_by_mask_impl<WorkSeq, Sequence<>, Sequence<>>
-{
-    using type = WorkSeq;
-};
+        index_t size = 0;
+
+        for(index_t i = 0; i < NSize; ++i)
+        {
+            if(Mask::At(i))
+            {
+                picked.data_[size++] = Seq::At(i);
+            }
+        }
 
+        return picked;
+    }
+
+    __host__ __device__ static constexpr index_t GetPickedSize()
+    {
+        index_t size = 0;
+
+        for(index_t i = 0; i < NSize; ++i)
+        {
+            size += Mask::At(i) ? 1 : 0;
+        }
+
+        return size;
+    }
+
+    static constexpr auto picked_ = Pick();
+
+    struct F
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return picked_.data_[i];
+        }
+    };
+
+    using type = typename sequence_gen<GetPickedSize(), F>::type;
+};
 } // namespace detail
 
 template <typename Seq, typename Mask>
@@ -817,25 +824,33 @@ __host__ __device__ constexpr auto pick_sequence_elements_by_mask(Seq, Mask)
 {
     static_assert(Seq::Size() == Mask::Size(), "wrong!");
 
-    return typename detail::pick_sequence_elements_by_mask_impl<Sequence<>, Seq, Mask>::type{};
+    return typename detail::pick_sequence_elements_by_mask_impl<Seq, Mask>::type{};
 }
 
 namespace detail {
-template <typename WorkSeq, typename RemainValues, typename RemainIds>
+// elements are modified in order, the last value wins for a repeated id
+template <typename Seq, typename Values, typename Ids>
 struct modify_sequence_elements_by_ids_impl
 {
-    using new_work_seq = decltype(WorkSeq::Modify(RemainIds::Front(), RemainValues::Front()));
+    struct F
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            index_t value = Seq::At(i);
 
-    using type =
-        typename modify_sequence_elements_by_ids_impl<new_work_seq,
-                                                      decltype(RemainValues::PopFront()),
-                                                      decltype(RemainIds::PopFront())>::type;
-};
+            for(index_t j = 0; j < Ids::Size(); ++j)
+            {
+                if(Ids::At(j) == i)
+                {
+                    value = Values::At(j);
+                }
+            }
 
-template <typename WorkSeq>
-struct modify_sequence_elements_by_ids_impl<WorkSeq, Sequence<>, Sequence<>>
-{
-    using type = WorkSeq;
+            return value;
+        }
+    };
+
+    using type = typename sequence_gen<Seq::Size(), F>::type;
 };
 } // namespace detail
 
@@ -70,6 +70,27 @@ __host__ __device__ constexpr Data get_tuple_element_data(const TupleElementKeyD
     return std::forward(x.mData);
 }
 
+// I-th type of Xs
+#if CK_USE_BUILTIN_TYPE_PACK_ELEMENT
+template <index_t I, typename... Xs>
+using type_pack_element_t = __type_pack_element<I, Xs...>;
+#else
+template <index_t I, typename X, typename... Xs>
+struct type_pack_element
+{
+    using type = typename type_pack_element<I - 1, Xs...>::type;
+};
+
+template <typename X, typename... Xs>
+struct type_pack_element<0, X, Xs...>
+{
+    using type = X;
+};
+
+template <index_t I, typename... Xs>
+using type_pack_element_t = typename type_pack_element<I, Xs...>::type;
+#endif
+
 template <typename Indices, typename... Xs>
 struct TupleImpl;
 
@@ -97,16 +118,21 @@ struct TupleImpl<Sequence<Is...>, Xs...> : TupleElementKeyData<TupleElementKey<I
 
     __host__ __device__ static constexpr index_t Size() { return sizeof...(Xs); }
 
+    // base holding the I-th element, named directly instead of deduced from all the bases
+    template <index_t I>
+    using ElementKeyData =
+        TupleElementKeyData<TupleElementKey<I>, type_pack_element_t<I, Xs...>>;
+
     template <index_t I>
     __host__ __device__ constexpr const auto& GetElementDataByKey(TupleElementKey<I>) const
     {
-        return get_tuple_element_data_reference<TupleElementKey<I>>(*this);
+        return get_tuple_element_data_reference(static_cast<const ElementKeyData<I>&>(*this));
     }
 
     template <index_t I>
     __host__ __device__ constexpr auto& GetElementDataByKey(TupleElementKey<I>)
     {
-        return get_tuple_element_data_reference<TupleElementKey<I>>(*this);
+        return get_tuple_element_data_reference(static_cast<ElementKeyData<I>&>(*this));
     }
 };
 
@@ -202,6 +228,12 @@ struct tuple_element
     using type = decltype(detail::get_tuple_element_data<detail::TupleElementKey<I>>(TTuple{}));
 };
 
+template <index_t I, typename... Xs>
+struct tuple_element<I, Tuple<Xs...>>
+{
+    using type = detail::type_pack_element_t<I, Xs...>;
+};
+
 template <index_t I, typename TTuple>
 using tuple_element_t = typename tuple_element<I, TTuple>::type;
 
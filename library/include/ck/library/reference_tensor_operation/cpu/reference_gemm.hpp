@@ -8,6 +8,7 @@
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/fixed_rank_host_tensor.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -56,8 +57,13 @@ struct ReferenceGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            // offsets computed with the rank known at compile time
+            const FixedRankHostTensorDescriptor<2> a_desc(arg.a_m_k_.mDesc);
+            const FixedRankHostTensorDescriptor<2> b_desc(arg.b_k_n_.mDesc);
+            const FixedRankHostTensorDescriptor<2> c_desc(arg.c_m_n_.mDesc);
+
             auto f_mk_kn_mn = [&](auto m, auto n) {
-                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+                const int K = a_desc.GetLengths()[1];
 
                 AccDataType v_acc = 0;
 
@@ -66,8 +72,8 @@ struct ReferenceGemm : public device::BaseOperator
                     ADataType v_a;
                     BDataType v_b;
 
-                    arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    arg.b_element_op_(v_b, arg.b_k_n_(k, n));
+                    arg.a_element_op_(v_a, arg.a_m_k_.mData[a_desc.GetOffsetFromMultiIndex(m, k)]);
+                    arg.b_element_op_(v_b, arg.b_k_n_.mData[b_desc.GetOffsetFromMultiIndex(k, n)]);
 
                     v_acc +=
                         ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
@@ -77,11 +83,11 @@ struct ReferenceGemm : public device::BaseOperator
 
                 arg.c_element_op_(v_c, v_acc);
 
-                arg.c_m_n_(m, n) = ck::type_convert<CDataType>(v_c);
+                arg.c_m_n_.mData[c_desc.GetOffsetFromMultiIndex(m, n)] =
+                    ck::type_convert<CDataType>(v_c);
             };
 
-            make_ParallelTensorFunctor(
-                f_mk_kn_mn, arg.c_m_n_.mDesc.GetLengths()[0], arg.c_m_n_.mDesc.GetLengths()[1])(
+            make_ParallelTensorFunctor(f_mk_kn_mn, c_desc.GetLengths()[0], c_desc.GetLengths()[1])(
                 std::thread::hardware_concurrency());
 
             return 0;
@@ -63,15 +63,15 @@ struct ReferenceGemmLayernorm : public device::BaseOperator
         }
 
         // normalize
-        acc_layernorm.ForEach([&](auto& self, auto idx) {
-            self(idx[0], idx[1]) =
-                (self(idx[0], idx[1]) - avg_acc(idx[0])) /
+        acc_layernorm.ForEach([&](auto& self, auto idx, std::size_t offset) {
+            self.mData[offset] =
+                (self.mData[offset] - avg_acc(idx[0])) /
                 sqrt(avg_acc_sq(idx[0]) - avg_acc(idx[0]) * avg_acc(idx[0]) + epsilon);
         });
 
         // affine
-        acc_layernorm.ForEach([&](auto& self, auto idx) {
-            self(idx[0], idx[1]) = self(idx[0], idx[1]) * gamma(idx[1]) + beta(idx[1]);
+        acc_layernorm.ForEach([&](auto& self, auto idx, std::size_t offset) {
+            self.mData[offset] = self.mData[offset] * gamma(idx[1]) + beta(idx[1]);
         });
 
         // cast
@@ -147,23 +147,23 @@ struct ReferenceGemmLayernorm : public device::BaseOperator
             ref_invoker.Run(ref_argument);
 
             // activation(acc + bias)
-            acc_m_n.ForEach([&](auto& self, auto idx) {
+            acc_m_n.ForEach([&](auto& self, auto idx, std::size_t offset) {
                 AccDataType out;
-                arg.acc_element_op_(out, acc_m_n(idx[0], idx[1]) + arg.c0_n_bias_(idx[1]));
-                self(idx[0], idx[1]) = out;
+                arg.acc_element_op_(out, self.mData[offset] + arg.c0_n_bias_(idx[1]));
+                self.mData[offset] = out;
             });
 
             // add from other layers
-            acc_m_n.ForEach([&](auto& self, auto idx) {
-                self(idx[0], idx[1]) += arg.c0_m_n_add_(idx[0], idx[1]);
+            acc_m_n.ForEach([&](auto& self, auto idx, std::size_t offset) {
+                self.mData[offset] += arg.c0_m_n_add_(idx[0], idx[1]);
             });
 
             // layernorm
             RunLayernorm(arg.c_m_n_, acc_m_n, arg.c0_n_gamma_, arg.c0_n_beta_);
 
             // elementwise op
-            arg.c_m_n_.ForEach([&](auto& self, auto idx) {
-                arg.c_element_op_(self(idx[0], idx[1]), self(idx[0], idx[1]));
+            arg.c_m_n_.ForEach([&](auto& self, auto, std::size_t offset) {
+                arg.c_element_op_(self.mData[offset], self.mData[offset]);
             });
 
             return 0;
@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/packed_int4_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+namespace detail {
+
+#if CK_HOST_TYPE_CONVERT_X86
+__attribute__((target("avx2"))) inline int32_t
+dot_product_int8_avx2(const int8_t* p_a, const int8_t* p_b, std::size_t n)
+{
+    __m256i acc = _mm256_setzero_si256();
+
+    std::size_t i = 0;
+
+    for(; i + 16 <= n; i += 16)
+    {
+        const __m256i a =
+            _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_a + i)));
+        const __m256i b =
+            _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_b + i)));
+
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+    }
+
+    alignas(32) int32_t lanes[8];
+
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+
+    int32_t sum = 0;
+
+    for(const int32_t lane : lanes)
+    {
+        sum += lane;
+    }
+
+    for(; i < n; ++i)
+    {
+        sum += int32_t{p_a[i]} * int32_t{p_b[i]};
+    }
+
+    return sum;
+}
+#endif // CK_HOST_TYPE_CONVERT_X86
+
+inline int32_t dot_product_int8(const int8_t* p_a, const int8_t* p_b, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(ck::utils::detail::host_supports_avx2())
+    {
+        return dot_product_int8_avx2(p_a, p_b, n);
+    }
+#endif
+    int32_t sum = 0;
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        sum += int32_t{p_a[i]} * int32_t{p_b[i]};
+    }
+
+    return sum;
+}
+
+} // namespace detail
+
+// GEMM on int4 A and B packed two per byte, the same as ReferenceGemm on int4_t or int8_t tensors
+// holding the same values. Rows of A and columns of B are unpacked to int8_t once per tile of
+// MPerTile rows, element-wise operations on A and B see int8_t values.
+template <typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+struct ReferenceGemmPackedInt4 : public device::BaseOperator
+{
+    static constexpr std::size_t MPerTile = 16;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const PackedInt4Tensor& a_m_k,
+                 const PackedInt4Tensor& b_k_n,
+                 Tensor<CDataType>& c_m_n,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              c_m_n_{c_m_n},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        const PackedInt4Tensor& a_m_k_;
+        const PackedInt4Tensor& b_k_n_;
+        Tensor<CDataType>& c_m_n_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmPackedInt4::Argument;
+
+        // an int32_t dot product of the unpacked values, without element-wise operations
+        static constexpr bool UseDotProduct =
+            std::is_same_v<AElementwiseOperation, element_wise::PassThrough> &&
+            std::is_same_v<BElementwiseOperation, element_wise::PassThrough> &&
+            std::is_same_v<AccDataType, int32_t>;
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t M = arg.c_m_n_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            const auto& a_strides = arg.a_m_k_.mDesc.GetStrides();
+            const auto& b_strides = arg.b_k_n_.mDesc.GetStrides();
+
+            auto f_tile = [&](auto m_tile) {
+                const std::size_t m_begin = m_tile * MPerTile;
+                const std::size_t m_end   = std::min(m_begin + MPerTile, M);
+
+                std::vector<int8_t> a_tile((m_end - m_begin) * K);
+                std::vector<int8_t> b_n(K);
+
+                for(std::size_t m = m_begin; m < m_end; ++m)
+                {
+                    arg.a_m_k_.GetElements(arg.a_m_k_.mDesc.GetOffsetFromMultiIndex(m, 0),
+                                           a_strides[1],
+                                           K,
+                                           a_tile.data() + (m - m_begin) * K);
+                }
+
+                for(std::size_t n = 0; n < N; ++n)
+                {
+                    arg.b_k_n_.GetElements(arg.b_k_n_.mDesc.GetOffsetFromMultiIndex(0, n),
+                                           b_strides[0],
+                                           K,
+                                           b_n.data());
+
+                    for(std::size_t m = m_begin; m < m_end; ++m)
+                    {
+                        const int8_t* p_a = a_tile.data() + (m - m_begin) * K;
+
+                        AccDataType v_acc = 0;
+
+                        if constexpr(UseDotProduct)
+                        {
+                            v_acc = detail::dot_product_int8(p_a, b_n.data(), K);
+                        }
+                        else
+                        {
+                            for(std::size_t k = 0; k < K; ++k)
+                            {
+                                int8_t v_a;
+                                int8_t v_b;
+
+                                arg.a_element_op_(v_a, p_a[k]);
+                                arg.b_element_op_(v_b, b_n[k]);
+
+                                v_acc += ck::type_convert<AccDataType>(v_a) *
+                                         ck::type_convert<AccDataType>(v_b);
+                            }
+                        }
+
+                        AccDataType v_c;
+
+                        arg.c_element_op_(v_c, v_acc);
+
+                        arg.c_m_n_(m, n) = ck::type_convert<CDataType>(v_c);
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_tile, (M + MPerTile - 1) / MPerTile)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const PackedInt4Tensor& a_m_k,
+                             const PackedInt4Tensor& b_k_n,
+                             Tensor<CDataType>& c_m_n,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmPackedInt4"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
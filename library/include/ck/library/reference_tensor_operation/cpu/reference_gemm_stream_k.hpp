@@ -0,0 +1,256 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Host model of a Stream-K GEMM using BlockToCTileMap_GemmStreamK. It computes C the way the
+// persistent grid does: every workgroup accumulates its range of main loop iterations, the
+// workgroups not owning a tile write their partial accumulation to their workspace slot, then
+// the owners add the partials of their tiles and write C.
+template <typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AccDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t KPerBlock>
+struct ReferenceGemmStreamK : public device::BaseOperator
+{
+    using Block2CTileMap = BlockToCTileMap_GemmStreamK<MPerBlock, NPerBlock, KPerBlock>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<BDataType>& b_k_n,
+                 Tensor<CDataType>& c_m_n,
+                 index_t grid_size,
+                 AElementwiseOperation a_element_op,
+                 BElementwiseOperation b_element_op,
+                 CElementwiseOperation c_element_op)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              c_m_n_{c_m_n},
+              block_2_ctile_map_{static_cast<index_t>(a_m_k.mDesc.GetLengths()[0]),
+                                 static_cast<index_t>(b_k_n.mDesc.GetLengths()[1]),
+                                 static_cast<index_t>(a_m_k.mDesc.GetLengths()[1]),
+                                 grid_size},
+              grid_size_{grid_size},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        const Tensor<ADataType>& a_m_k_;
+        const Tensor<BDataType>& b_k_n_;
+        Tensor<CDataType>& c_m_n_;
+
+        Block2CTileMap block_2_ctile_map_;
+        index_t grid_size_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmStreamK::Argument;
+
+        float Run(const Argument& arg)
+        {
+            const auto& map = arg.block_2_ctile_map_;
+
+            const index_t M = arg.c_m_n_.mDesc.GetLengths()[0];
+            const index_t N = arg.c_m_n_.mDesc.GetLengths()[1];
+            const index_t K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+            using AccTile = std::vector<AccDataType>;
+
+            // workspace: one partial tile per workgroup
+            std::vector<AccTile> partial_tiles(arg.grid_size_);
+
+            // tiles finished by their owner, indexed by tile id
+            std::vector<AccTile> owned_tiles(map.GetNumTile());
+
+            // accumulates the k iterations [iter_begin, iter_end) of one tile
+            auto run_tile_iters = [&](index_t tile, index_t iter_begin, index_t iter_end) {
+                const auto m0_n0 = map.CalculateBottomIndex(make_multi_index(tile));
+
+                const index_t m_begin = m0_n0[Number<0>{}] * MPerBlock;
+                const index_t n_begin = m0_n0[Number<1>{}] * NPerBlock;
+                const index_t k_begin = (iter_begin - map.GetTileIterBegin(tile)) * KPerBlock;
+                const index_t k_end =
+                    math::min((iter_end - map.GetTileIterBegin(tile)) * KPerBlock, K);
+
+                AccTile acc(MPerBlock * NPerBlock, 0);
+
+                for(index_t m = m_begin; m < math::min(m_begin + MPerBlock, M); ++m)
+                {
+                    for(index_t n = n_begin; n < math::min(n_begin + NPerBlock, N); ++n)
+                    {
+                        AccDataType v_acc = 0;
+
+                        for(index_t k = k_begin; k < k_end; ++k)
+                        {
+                            ADataType v_a;
+                            BDataType v_b;
+
+                            arg.a_element_op_(v_a, arg.a_m_k_(m, k));
+                            arg.b_element_op_(v_b, arg.b_k_n_(k, n));
+
+                            v_acc += ck::type_convert<AccDataType>(v_a) *
+                                     ck::type_convert<AccDataType>(v_b);
+                        }
+
+                        acc[(m - m_begin) * NPerBlock + n - n_begin] = v_acc;
+                    }
+                }
+
+                return acc;
+            };
+
+            // every workgroup runs its range of iterations, one tile at a time
+            auto f_block = [&](auto i) {
+                const index_t block_id = i;
+                const index_t iter_end = map.GetIterEnd(block_id);
+
+                for(index_t iter = map.GetIterBegin(block_id); iter < iter_end;)
+                {
+                    const index_t tile          = map.GetTileOfIter(iter);
+                    const index_t iter_tile_end = math::min(map.GetTileIterEnd(tile), iter_end);
+
+                    if(iter == map.GetTileIterBegin(tile))
+                    {
+                        owned_tiles[tile] = run_tile_iters(tile, iter, iter_tile_end);
+                    }
+                    else
+                    {
+                        partial_tiles[block_id] = run_tile_iters(tile, iter, iter_tile_end);
+                    }
+
+                    iter = iter_tile_end;
+                }
+            };
+
+            make_ParallelTensorFunctor(f_block, arg.grid_size_)(
+                std::thread::hardware_concurrency());
+
+            // fix-up: owners add the partials of their tile and write C
+            auto f_tile = [&](auto i) {
+                const index_t tile = i;
+
+                auto& acc = owned_tiles[tile];
+
+                const auto partial_block_range = map.GetPartialBlockRange(tile);
+
+                for(index_t block_id = partial_block_range[Number<0>{}];
+                    block_id < partial_block_range[Number<1>{}];
+                    ++block_id)
+                {
+                    for(std::size_t i = 0; i < acc.size(); ++i)
+                    {
+                        acc[i] += partial_tiles[block_id][i];
+                    }
+                }
+
+                const auto m0_n0 = map.CalculateBottomIndex(make_multi_index(tile));
+
+                const index_t m_begin = m0_n0[Number<0>{}] * MPerBlock;
+                const index_t n_begin = m0_n0[Number<1>{}] * NPerBlock;
+
+                for(index_t m = m_begin; m < math::min(m_begin + MPerBlock, M); ++m)
+                {
+                    for(index_t n = n_begin; n < math::min(n_begin + NPerBlock, N); ++n)
+                    {
+                        AccDataType v_c;
+
+                        arg.c_element_op_(v_c, acc[(m - m_begin) * NPerBlock + n - n_begin]);
+
+                        arg.c_m_n_(m, n) = ck::type_convert<CDataType>(v_c);
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_tile, map.GetNumTile())(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        return MPerBlock > 0 && NPerBlock > 0 && KPerBlock > 0;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument* p_arg) override
+    {
+        const auto& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        return arg.block_2_ctile_map_.CheckValidity(arg.c_m_n_.mDesc);
+    }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<BDataType>& b_k_n,
+                             Tensor<CDataType>& c_m_n,
+                             index_t grid_size,
+                             AElementwiseOperation a_element_op,
+                             BElementwiseOperation b_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{
+            a_m_k, b_k_n, c_m_n, grid_size, a_element_op, b_element_op, c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmStreamK"
+            << "<"
+            << MPerBlock << ", "
+            << NPerBlock << ", "
+            << KPerBlock
+            << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -76,7 +76,7 @@ struct ReferenceSoftmax : public device::BaseOperator
             // when final reduced values is of dim=0, the index will be transformed into empty
             // std::vector which is actually a valid input for Tensor::operator(std::vector) and
             // internally accesses 0'th element
-            auto to_sm_scalar_idx = [&](auto idx) {
+            auto to_sm_scalar_idx = [&](const auto& idx) {
                 std::vector<size_t> sm_scalar_idx;
                 for(index_t dim : arg.sm_scalar_dims_)
                 {
@@ -85,36 +85,39 @@ struct ReferenceSoftmax : public device::BaseOperator
                 return sm_scalar_idx;
             };
 
-            arg.in_.ForEach([&](auto& self, auto idx) {
-                reduce_max(to_sm_scalar_idx(idx)) = std::max(
-                    reduce_max(to_sm_scalar_idx(idx)), ck::type_convert<AccDataType>(self(idx)));
+            arg.in_.ForEach([&](auto& self, const auto& idx, std::size_t offset) {
+                reduce_max(to_sm_scalar_idx(idx)) =
+                    std::max(reduce_max(to_sm_scalar_idx(idx)),
+                             ck::type_convert<AccDataType>(self.mData[offset]));
             });
 
             // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
             // std::endl;
 
             Tensor<AccDataType> in_stable(arg.in_.mDesc);
-            in_stable.ForEach([&](auto& self, auto idx) {
+            // in_stable has the descriptor of in_, so an offset is valid in both
+            in_stable.ParallelForEach([&](auto& self, const auto& idx, std::size_t offset) {
                 // numerator = exp(x - max(x))
-                self(idx) = std::exp(ck::type_convert<AccDataType>(arg.in_(idx)) -
-                                     reduce_max(to_sm_scalar_idx(idx)));
+                self.mData[offset] =
+                    std::exp(ck::type_convert<AccDataType>(arg.in_.mData[offset]) -
+                             reduce_max(to_sm_scalar_idx(idx)));
             });
 
             // LogRangeAsType<float>(std::cout << "in_stable: ", in_stable.mData, ",") << std::endl;
 
-            in_stable.ForEach([&](auto& self, auto idx) {
+            in_stable.ForEach([&](auto& self, const auto& idx, std::size_t offset) {
                 // denominator = sum(exp(x - max(x)))
-                reduce_sum(to_sm_scalar_idx(idx)) += self(idx);
+                reduce_sum(to_sm_scalar_idx(idx)) += self.mData[offset];
             });
 
             // LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",") <<
             // std::endl;
 
-            arg.out_.ForEach([&](auto& self, auto idx) {
+            arg.out_.ParallelForEach([&](auto& self, const auto& idx, std::size_t offset) {
                 AccDataType temp_result =
                     arg.alpha_ * in_stable(idx) / reduce_sum(to_sm_scalar_idx(idx)) +
-                    arg.beta_ * self(idx);
-                self(idx) = ck::type_convert<OutDataType>(temp_result);
+                    arg.beta_ * self.mData[offset];
+                self.mData[offset] = ck::type_convert<OutDataType>(temp_result);
             });
 
             // LogRangeAsType<float>(std::cout << "out: ", arg.out_.mData, ",") << std::endl;
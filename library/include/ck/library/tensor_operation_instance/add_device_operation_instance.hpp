@@ -3,30 +3,135 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 #include <type_traits>
 
 #include "ck/utility/functional2.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace device {
 namespace instance {
 
-template <typename BaseOp, typename NewOpInstances>
-void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_instances,
-                                    const NewOpInstances& new_op_instances)
+// Whether an instance with this type string is in the type strings of CK_INSTANCE_ALLOW_LIST.
+// Defined by device_operations only when the allow-list has type strings, in which case its
+// sources are built with CK_INSTANCE_TYPE_ALLOW_LIST and only register the instances allowed.
+bool is_device_operation_instance_allowed(const std::string& type_string);
+
+// The sources of the instance library not selected by CK_INSTANCE_ALLOW_LIST are built with
+// CK_INSTANCE_PRUNED, so that their functions adding instances still exist for
+// DeviceOperationInstanceFactory but add none. The instances are given to the functions below as
+// types, so that a pruned source does not even construct them, and no kernel is compiled.
+template <typename NewOpInstance, typename BaseOp>
+void add_device_operation_instance(std::vector<std::unique_ptr<BaseOp>>& op_instances)
+{
+    static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
+                  "wrong! NewOpInstance should be derived from BaseOp");
+
+#ifdef CK_INSTANCE_PRUNED
+    (void)op_instances;
+#else
+    auto op_instance = std::make_unique<NewOpInstance>();
+
+#ifdef CK_INSTANCE_TYPE_ALLOW_LIST
+    if(!is_device_operation_instance_allowed(op_instance->GetTypeString()))
+    {
+        return;
+    }
+#endif
+
+    op_instances.push_back(std::move(op_instance));
+#endif
+}
+
+// adds an instance of each type of the tuple NewOpInstances
+template <typename NewOpInstances, typename BaseOp>
+void add_device_operation_instances(std::vector<std::unique_ptr<BaseOp>>& op_instances)
 {
+#ifdef CK_INSTANCE_PRUNED
+    (void)op_instances;
+#else
     ck::static_for<0, std::tuple_size_v<NewOpInstances>, 1>{}([&](auto i) {
-        const auto new_op_instance = std::get<i>(new_op_instances);
+        using NewOpInstance = remove_cvref_t<std::tuple_element_t<i, NewOpInstances>>;
+
+        add_device_operation_instance<NewOpInstance>(op_instances);
+    });
+#endif
+}
+
+// Lightweight description of one instance. The instance itself is only allocated when
+// MakeInstance() is called.
+template <typename BaseOp>
+struct DeviceOperationInstanceDescriptor
+{
+    using MakeInstanceFunction = std::unique_ptr<BaseOp> (*)();
+
+    std::unique_ptr<BaseOp> MakeInstance() const { return make_instance_(); }
 
-        using NewOpInstance = remove_cvref_t<decltype(new_op_instance)>;
+    // position of the instance in the list returned by GetInstances()
+    std::size_t id_;
+    std::string type_string_;
+    BlockTileDescriptor tile_;
+    MakeInstanceFunction make_instance_;
+};
+
+template <typename Op, typename = void>
+struct has_block_tile_descriptor : std::false_type
+{
+};
+
+template <typename Op>
+struct has_block_tile_descriptor<Op, std::void_t<decltype(Op::GetBlockTileDescriptor())>>
+    : std::true_type
+{
+};
+
+template <typename Op>
+constexpr BlockTileDescriptor get_block_tile_descriptor()
+{
+    if constexpr(has_block_tile_descriptor<Op>::value)
+    {
+        return Op::GetBlockTileDescriptor();
+    }
+    else
+    {
+        return BlockTileDescriptor{};
+    }
+}
+
+// adds a descriptor of each type of the tuple NewOpInstances
+template <typename NewOpInstances, typename BaseOp>
+void add_device_operation_instance_descriptors(
+    std::vector<DeviceOperationInstanceDescriptor<BaseOp>>& op_descriptors)
+{
+#ifdef CK_INSTANCE_PRUNED
+    (void)op_descriptors;
+#else
+    ck::static_for<0, std::tuple_size_v<NewOpInstances>, 1>{}([&](auto i) {
+        using NewOpInstance = remove_cvref_t<std::tuple_element_t<i, NewOpInstances>>;
 
         static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
                       "wrong! NewOpInstance should be derived from BaseOp");
 
-        op_instances.push_back(std::make_unique<NewOpInstance>(new_op_instance));
+        const std::string type_string = NewOpInstance{}.GetTypeString();
+
+#ifdef CK_INSTANCE_TYPE_ALLOW_LIST
+        if(!is_device_operation_instance_allowed(type_string))
+        {
+            return;
+        }
+#endif
+
+        op_descriptors.push_back(DeviceOperationInstanceDescriptor<BaseOp>{
+            op_descriptors.size(),
+            type_string,
+            get_block_tile_descriptor<NewOpInstance>(),
+            []() -> std::unique_ptr<BaseOp> { return std::make_unique<NewOpInstance>(); }});
     });
+#endif
 }
 
 } // namespace instance
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_elementwise_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using Add       = ck::tensor_operation::element_wise::Add;
+using Normalize = ck::tensor_operation::element_wise::Normalize;
+
+void add_device_elementwise_cpu_passthrough_f16_f16_rank2_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16>, Tuple<F16>, PassThrough, 2>>&);
+
+void add_device_elementwise_cpu_passthrough_f16_f16_rank4_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16>, Tuple<F16>, PassThrough, 4>>&);
+
+void add_device_elementwise_cpu_passthrough_f32_f32_rank2_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F32>, Tuple<F32>, PassThrough, 2>>&);
+
+void add_device_elementwise_cpu_passthrough_f32_f32_rank4_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F32>, Tuple<F32>, PassThrough, 4>>&);
+
+void add_device_elementwise_cpu_add_f16_f16_f16_rank2_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16, F16>, Tuple<F16>, Add, 2>>&);
+
+void add_device_elementwise_cpu_add_f16_f16_f16_rank4_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16, F16>, Tuple<F16>, Add, 4>>&);
+
+void add_device_elementwise_cpu_add_f32_f32_f32_rank2_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F32, F32>, Tuple<F32>, Add, 2>>&);
+
+void add_device_elementwise_cpu_add_f32_f32_f32_rank4_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F32, F32>, Tuple<F32>, Add, 4>>&);
+
+void add_device_normalize_from_mean_squaremean_cpu_f16_f32_f32_f16_f16_instances(
+    std::vector<
+        DeviceElementwiseBasePtr<Tuple<F16, F32, F32, F16, F16>, Tuple<F16>, Normalize, 2>>&);
+
+template <typename InDataTypeTuple,
+          typename OutDataTypeTuple,
+          typename ElementwiseOperation,
+          index_t NumDim>
+struct DeviceOperationInstanceFactory<
+    ck::tensor_operation::device::
+        DeviceElementwiseBase<InDataTypeTuple, OutDataTypeTuple, ElementwiseOperation, NumDim>,
+    CpuBackend>
+{
+    using DeviceOp =
+        DeviceElementwiseBase<InDataTypeTuple, OutDataTypeTuple, ElementwiseOperation, NumDim>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        if constexpr(is_same_v<ElementwiseOperation, PassThrough>)
+        {
+            if constexpr(is_same_v<InDataTypeTuple, Tuple<F16>> &&
+                         is_same_v<OutDataTypeTuple, Tuple<F16>>)
+            {
+                if constexpr(NumDim == 2)
+                    add_device_elementwise_cpu_passthrough_f16_f16_rank2_instances(op_ptrs);
+                else if constexpr(NumDim == 4)
+                    add_device_elementwise_cpu_passthrough_f16_f16_rank4_instances(op_ptrs);
+            }
+            else if constexpr(is_same_v<InDataTypeTuple, Tuple<F32>> &&
+                              is_same_v<OutDataTypeTuple, Tuple<F32>>)
+            {
+                if constexpr(NumDim == 2)
+                    add_device_elementwise_cpu_passthrough_f32_f32_rank2_instances(op_ptrs);
+                else if constexpr(NumDim == 4)
+                    add_device_elementwise_cpu_passthrough_f32_f32_rank4_instances(op_ptrs);
+            }
+        }
+        else if constexpr(is_same_v<ElementwiseOperation, Add>)
+        {
+            if constexpr(is_same_v<InDataTypeTuple, Tuple<F16, F16>> &&
+                         is_same_v<OutDataTypeTuple, Tuple<F16>>)
+            {
+                if constexpr(NumDim == 2)
+                    add_device_elementwise_cpu_add_f16_f16_f16_rank2_instances(op_ptrs);
+                else if constexpr(NumDim == 4)
+                    add_device_elementwise_cpu_add_f16_f16_f16_rank4_instances(op_ptrs);
+            }
+            else if constexpr(is_same_v<InDataTypeTuple, Tuple<F32, F32>> &&
+                              is_same_v<OutDataTypeTuple, Tuple<F32>>)
+            {
+                if constexpr(NumDim == 2)
+                    add_device_elementwise_cpu_add_f32_f32_f32_rank2_instances(op_ptrs);
+                else if constexpr(NumDim == 4)
+                    add_device_elementwise_cpu_add_f32_f32_f32_rank4_instances(op_ptrs);
+            }
+        }
+        else if constexpr(is_same_v<ElementwiseOperation, Normalize>)
+        {
+            if constexpr(is_same_v<InDataTypeTuple, Tuple<F16, F32, F32, F16, F16>> &&
+                         is_same_v<OutDataTypeTuple, Tuple<F16>> && NumDim == 2)
+            {
+                add_device_normalize_from_mean_squaremean_cpu_f16_f32_f32_f16_f16_instances(
+                    op_ptrs);
+            }
+        }
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
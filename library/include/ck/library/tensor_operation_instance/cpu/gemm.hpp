@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+void add_device_gemm_cpu_f32_f32_f32_mk_kn_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Row, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f32_f32_f32_mk_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Row, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f32_f32_f32_km_kn_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f32_f32_f32_km_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Col, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f16_f16_f16_mk_kn_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f16_f16_f16_mk_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f16_f16_f16_km_kn_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Col, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f16_f16_f16_km_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Col, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+void add_device_gemm_cpu_f32_f32_f32_mk_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Row, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f32_f32_f32_mk_nk_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Row, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f32_f32_f32_km_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f32_f32_f32_km_nk_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f16_f16_f16_mk_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f16_f16_f16_mk_nk_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f16_f16_f16_km_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+void add_device_gemm_cpu_f16_f16_f16_km_nk_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        descriptors);
+
+template <typename ALayout,
+          typename BLayout,
+          typename CLayout,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType>
+struct DeviceOperationInstanceFactory<
+    ck::tensor_operation::device::DeviceGemm<ALayout,
+                                             BLayout,
+                                             CLayout,
+                                             ADataType,
+                                             BDataType,
+                                             CDataType,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough,
+                                             ck::tensor_operation::element_wise::PassThrough>,
+    CpuBackend>
+{
+    using DeviceOp = DeviceGemm<ALayout,
+                                BLayout,
+                                CLayout,
+                                ADataType,
+                                BDataType,
+                                CDataType,
+                                ck::tensor_operation::element_wise::PassThrough,
+                                ck::tensor_operation::element_wise::PassThrough,
+                                ck::tensor_operation::element_wise::PassThrough>;
+
+    // Adds the instances of the problem to a list of instances, or their descriptors to a list of
+    // descriptors, the adders are overloaded for both lists
+    template <typename OpList>
+    static void AddInstances(OpList& op_list)
+    {
+        if constexpr(is_same_v<ADataType, float> && is_same_v<BDataType, float> &&
+                      is_same_v<CDataType, float>)
+        {
+            if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
+                          is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f32_f32_f32_mk_kn_mn_instances(op_list);
+            }
+            else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
+                               is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f32_f32_f32_mk_nk_mn_instances(op_list);
+            }
+            else if constexpr(is_same_v<ALayout, Col> && is_same_v<BLayout, Row> &&
+                               is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f32_f32_f32_km_kn_mn_instances(op_list);
+            }
+            else if constexpr(is_same_v<ALayout, Col> && is_same_v<BLayout, Col> &&
+                               is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f32_f32_f32_km_nk_mn_instances(op_list);
+            }
+        }
+        else if constexpr(is_same_v<ADataType, half_t> && is_same_v<BDataType, half_t> &&
+                           is_same_v<CDataType, half_t>)
+        {
+            if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
+                          is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f16_f16_f16_mk_kn_mn_instances(op_list);
+            }
+            else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
+                               is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f16_f16_f16_mk_nk_mn_instances(op_list);
+            }
+            else if constexpr(is_same_v<ALayout, Col> && is_same_v<BLayout, Row> &&
+                               is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f16_f16_f16_km_kn_mn_instances(op_list);
+            }
+            else if constexpr(is_same_v<ALayout, Col> && is_same_v<BLayout, Col> &&
+                               is_same_v<CLayout, Row>)
+            {
+                add_device_gemm_cpu_f16_f16_f16_km_nk_mn_instances(op_list);
+            }
+        }
+    }
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        AddInstances(op_ptrs);
+
+        return op_ptrs;
+    }
+
+    static auto GetInstanceDescriptors()
+    {
+        std::vector<DeviceOperationInstanceDescriptor<DeviceOp>> op_descs;
+
+        AddInstances(op_descs);
+
+        return op_descs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
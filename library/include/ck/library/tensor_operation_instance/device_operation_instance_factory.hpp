@@ -105,6 +105,12 @@ template <typename Activation>
 using Add_Activation_Mul2_Clamp =
     ck::tensor_operation::element_wise::Add_Activation_Mul2_Clamp<Activation>;
 
+// Tag of the factories of instances running on the host CPU, e.g.
+// DeviceOperationInstanceFactory<DeviceGemm<...>, CpuBackend>. Their arguments take host pointers.
+struct CpuBackend
+{
+};
+
 template <typename DeviceOp, typename Tag = void>
 struct DeviceOperationInstanceFactory;
 
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Lazy alternative to DeviceOperationInstanceFactory<DeviceOp>::GetInstances().
+//
+// The descriptor list (ID, type string, block tile) is built once per process and cached. Callers
+// filter the descriptors with a predicate and only allocate the instances they actually need.
+// DeviceOperationInstanceFactory<DeviceOp, Tag> has to provide GetInstanceDescriptors().
+template <typename DeviceOp, typename Tag = void>
+struct DeviceOperationInstanceRegistry
+{
+    using Factory    = DeviceOperationInstanceFactory<DeviceOp, Tag>;
+    using Descriptor = DeviceOperationInstanceDescriptor<DeviceOp>;
+
+    static const std::vector<Descriptor>& GetDescriptors()
+    {
+        static const std::vector<Descriptor> op_descs = Factory::GetInstanceDescriptors();
+
+        return op_descs;
+    }
+
+    static std::size_t GetNumInstances() { return GetDescriptors().size(); }
+
+    template <typename Predicate>
+    static std::vector<const Descriptor*> FilterDescriptors(Predicate&& pred)
+    {
+        std::vector<const Descriptor*> selected;
+
+        for(const auto& op_desc : GetDescriptors())
+        {
+            if(pred(op_desc))
+            {
+                selected.push_back(&op_desc);
+            }
+        }
+
+        return selected;
+    }
+
+    static std::unique_ptr<DeviceOp> MakeInstance(std::size_t id)
+    {
+        const auto& op_descs = GetDescriptors();
+
+        if(id >= op_descs.size())
+        {
+            throw std::runtime_error("wrong! instance id out of range");
+        }
+
+        return op_descs[id].MakeInstance();
+    }
+
+    template <typename Predicate>
+    static std::vector<std::unique_ptr<DeviceOp>> MakeInstances(Predicate&& pred)
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        for(const auto& op_desc : GetDescriptors())
+        {
+            if(pred(op_desc))
+            {
+                op_ptrs.push_back(op_desc.MakeInstance());
+            }
+        }
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
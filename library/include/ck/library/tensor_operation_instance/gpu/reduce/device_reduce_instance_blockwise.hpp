@@ -6,6 +6,7 @@
 #include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
 #include "ck/tensor_operation/gpu/device/impl/device_reduce_multiblock.hpp"
 
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
 #include "ck/library/tensor_operation_instance/gpu/reduce/device_reduce_instance_impl_common.hpp"
 
@@ -111,8 +112,7 @@ void add_device_reduce_instance_blockwise(
                                                cfg2::InSrcVectorSize_,
                                                cfg2::OutDstVectorSize_>;
 
-                    device_op_instances.push_back(
-                        std::make_unique<ReduceOpInstance>(ReduceOpInstance{}));
+                    add_device_operation_instance<ReduceOpInstance>(device_op_instances);
                 });
         });
 };
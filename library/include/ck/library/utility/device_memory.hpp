@@ -20,6 +20,9 @@ struct DeviceMem
     DeviceMem(std::size_t mem_size);
     void* GetDeviceBuffer() const;
     std::size_t GetBufferSize() const;
+    // sets the size of the buffer, the device memory is only reallocated when mem_size is larger
+    // than all the sizes so far
+    void Resize(std::size_t mem_size);
     void ToDevice(const void* p) const;
     void FromDevice(void* p) const;
     void SetZero() const;
@@ -29,6 +32,7 @@ struct DeviceMem
 
     void* mpDeviceBuf;
     std::size_t mMemSize;
+    std::size_t mCapacity;
 };
 
 template <typename T>
@@ -11,10 +11,17 @@
 #include <utility>
 
 #include "ck/utility/data_type.hpp"
+#include "ck/library/utility/host_type_convert.hpp"
 
 namespace ck {
 namespace utils {
 
+// the float values generated for a contiguous range of T are converted in bulk, same as one by one
+template <typename T, typename ForwardIter>
+inline constexpr bool is_bulk_convertible_range =
+    !std::is_same_v<T, float> && is_contiguous_iterator<ForwardIter>::value &&
+    std::is_same_v<typename std::iterator_traits<ForwardIter>::value_type, T>;
+
 template <typename T>
 struct FillUniformDistribution
 {
@@ -26,7 +33,15 @@ struct FillUniformDistribution
     {
         std::mt19937 gen(11939);
         std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+
+        if constexpr(is_bulk_convertible_range<T, ForwardIter>)
+        {
+            generate_bulk_type_convert<T>(first, last, [&dis, &gen]() { return dis(gen); });
+        }
+        else
+        {
+            std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+        }
     }
 
     template <typename ForwardRange>
@@ -70,8 +85,17 @@ struct FillUniformDistributionIntegerValue
     {
         std::mt19937 gen(11939);
         std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(
-            first, last, [&dis, &gen]() { return ck::type_convert<T>(std::round(dis(gen))); });
+
+        if constexpr(is_bulk_convertible_range<T, ForwardIter>)
+        {
+            generate_bulk_type_convert<T>(
+                first, last, [&dis, &gen]() { return std::round(dis(gen)); });
+        }
+        else
+        {
+            std::generate(
+                first, last, [&dis, &gen]() { return ck::type_convert<T>(std::round(dis(gen))); });
+        }
     }
 
     template <typename ForwardRange>
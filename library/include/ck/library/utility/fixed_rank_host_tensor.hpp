@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+// HostTensorDescriptor with the rank known at compile time: lengths and strides in std::array and
+// an offset computation unrolled over the dimensions, for per-element access in host code.
+// Converts from (with a check of the rank) and to HostTensorDescriptor.
+template <std::size_t NDim>
+struct FixedRankHostTensorDescriptor
+{
+    using Array = std::array<std::size_t, NDim>;
+
+    FixedRankHostTensorDescriptor() = default;
+
+    FixedRankHostTensorDescriptor(const Array& lens) : mLens(lens) { this->CalculateStrides(); }
+
+    FixedRankHostTensorDescriptor(const Array& lens, const Array& strides)
+        : mLens(lens), mStrides(strides)
+    {
+    }
+
+    // a template so that braced lengths do not convert through HostTensorDescriptor
+    template <typename Desc,
+              typename = std::enable_if_t<std::is_same_v<Desc, HostTensorDescriptor>>>
+    explicit FixedRankHostTensorDescriptor(const Desc& desc)
+    {
+        if(desc.GetNumOfDimension() != NDim)
+        {
+            throw std::runtime_error("wrong! rank of HostTensorDescriptor does not match");
+        }
+
+        std::copy(desc.GetLengths().begin(), desc.GetLengths().end(), mLens.begin());
+        std::copy(desc.GetStrides().begin(), desc.GetStrides().end(), mStrides.begin());
+    }
+
+    operator HostTensorDescriptor() const { return HostTensorDescriptor(mLens, mStrides); }
+
+    void CalculateStrides()
+    {
+        std::size_t stride = 1;
+
+        for(std::size_t i = NDim; i-- > 0;)
+        {
+            mStrides[i] = stride;
+            stride *= mLens[i];
+        }
+    }
+
+    static constexpr std::size_t GetNumOfDimension() { return NDim; }
+
+    std::size_t GetElementSize() const
+    {
+        std::size_t size = 1;
+
+        for(std::size_t i = 0; i < NDim; ++i)
+        {
+            size *= mLens[i];
+        }
+
+        return size;
+    }
+
+    std::size_t GetElementSpaceSize() const
+    {
+        std::size_t space = 1;
+
+        for(std::size_t i = 0; i < NDim; ++i)
+        {
+            if(mLens[i] == 0)
+                continue;
+
+            space += (mLens[i] - 1) * mStrides[i];
+        }
+
+        return space;
+    }
+
+    const Array& GetLengths() const { return mLens; }
+
+    const Array& GetStrides() const { return mStrides; }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        static_assert(sizeof...(Is) == NDim, "wrong! number of indices does not match the rank");
+
+        return GetOffsetFromMultiIndex_impl(std::make_index_sequence<NDim>{},
+                                            static_cast<std::size_t>(is)...);
+    }
+
+    std::size_t GetOffsetFromMultiIndex(const Array& idx) const
+    {
+        return GetOffsetFromArray_impl(idx, std::make_index_sequence<NDim>{});
+    }
+
+    private:
+    template <std::size_t... Ds, typename... Is>
+    std::size_t GetOffsetFromMultiIndex_impl(std::index_sequence<Ds...>, Is... is) const
+    {
+        return (std::size_t{0} + ... + (is * mStrides[Ds]));
+    }
+
+    template <std::size_t... Ds>
+    std::size_t GetOffsetFromArray_impl(const Array& idx, std::index_sequence<Ds...>) const
+    {
+        return (std::size_t{0} + ... + (idx[Ds] * mStrides[Ds]));
+    }
+
+    Array mLens{};
+    Array mStrides{};
+};
+
+// Tensor with the rank known at compile time. Converts from and to Tensor<T> by copying the data.
+template <typename T, std::size_t NDim>
+struct FixedRankTensor
+{
+    using Descriptor = FixedRankHostTensorDescriptor<NDim>;
+    using Data       = std::vector<T>;
+    using Index      = typename Descriptor::Array;
+
+    FixedRankTensor(const Index& lens) : mDesc(lens), mData(mDesc.GetElementSpaceSize()) {}
+
+    FixedRankTensor(const Index& lens, const Index& strides)
+        : mDesc(lens, strides), mData(mDesc.GetElementSpaceSize())
+    {
+    }
+
+    FixedRankTensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
+
+    explicit FixedRankTensor(const Tensor<T>& other) : mDesc(other.mDesc), mData(other.mData) {}
+
+    Tensor<T> ToTensor() const
+    {
+        Tensor<T> ret(HostTensorDescriptor{mDesc});
+
+        ret.mData = mData;
+
+        return ret;
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    static constexpr std::size_t GetNumOfDimension() { return NDim; }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    std::size_t GetElementSpaceSizeInBytes() const { return sizeof(T) * GetElementSpaceSize(); }
+
+    void SetZero() { ck::ranges::fill<T>(mData, 0); }
+
+    // calls f(*this, idx) for each element in row-major order of the lengths, or
+    // f(*this, idx, offset) when f takes the offset of idx in mData as well
+    template <typename F>
+    void ForEach(F&& f)
+    {
+        ForEach_impl(*this, f, 0, GetElementSize());
+    }
+
+    template <typename F>
+    void ForEach(F&& f) const
+    {
+        ForEach_impl(*this, f, 0, GetElementSize());
+    }
+
+    // ForEach with the elements split in contiguous ranges of the row-major order among
+    // num_thread threads
+    template <typename F>
+    void ParallelForEach(F&& f, std::size_t num_thread = std::thread::hardware_concurrency())
+    {
+        ParallelForEach_impl(*this, f, num_thread);
+    }
+
+    template <typename F>
+    void ParallelForEach(F&& f, std::size_t num_thread = std::thread::hardware_concurrency()) const
+    {
+        ParallelForEach_impl(*this, f, num_thread);
+    }
+
+    // sets each element to g(i0, i1, ...)
+    template <typename G>
+    void GenerateTensorValue(G g, std::size_t num_thread = 1)
+    {
+        GenerateTensorValue_impl(g, num_thread, std::make_index_sequence<NDim>{});
+    }
+
+    template <typename... Is>
+    T& operator()(Is... is)
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    T& operator()(const Index& idx) { return mData[mDesc.GetOffsetFromMultiIndex(idx)]; }
+
+    const T& operator()(const Index& idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    typename Data::iterator begin() { return mData.begin(); }
+
+    typename Data::iterator end() { return mData.end(); }
+
+    typename Data::pointer data() { return mData.data(); }
+
+    typename Data::const_iterator begin() const { return mData.begin(); }
+
+    typename Data::const_iterator end() const { return mData.end(); }
+
+    typename Data::const_pointer data() const { return mData.data(); }
+
+    typename Data::size_type size() const { return mData.size(); }
+
+    Descriptor mDesc;
+    Data mData;
+
+    private:
+    template <typename Self, typename F>
+    static void ForEach_impl(Self& self, F& f, std::size_t element_begin, std::size_t element_end)
+    {
+        const HostTensorIndexIterator end(self.mDesc, element_end);
+
+        Index idx{};
+
+        for(HostTensorIndexIterator it(self.mDesc, element_begin); it != end; ++it)
+        {
+            const auto element = *it;
+
+            std::copy(element.index.begin(), element.index.end(), idx.begin());
+
+            if constexpr(std::is_invocable_v<F&, Self&, const Index&, std::size_t>)
+            {
+                f(self, std::as_const(idx), element.offset);
+            }
+            else
+            {
+                f(self, std::as_const(idx));
+            }
+        }
+    }
+
+    template <typename Self, typename F>
+    static void ParallelForEach_impl(Self& self, F& f, std::size_t num_thread)
+    {
+        parallel_for_each_range(
+            self.GetElementSize(), num_thread, [&self, &f](std::size_t begin, std::size_t end) {
+                ForEach_impl(self, f, begin, end);
+            });
+    }
+
+    template <typename G, std::size_t... Ds>
+    void GenerateTensorValue_impl(G& g, std::size_t num_thread, std::index_sequence<Ds...>)
+    {
+        auto f = [&](auto... is) { (*this)(is...) = g(is...); };
+
+        make_ParallelTensorFunctor(f, mDesc.GetLengths()[Ds]...)(num_thread);
+    }
+};
@@ -0,0 +1,586 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <istream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/math.hpp"
+#include "ck/tensor_operation/gpu/device/instance_metadata.hpp"
+
+namespace ck {
+namespace utils {
+
+using tensor_operation::device::GemmInstanceMetadata;
+
+// Throughput of a device, used to turn the work done by a GEMM instance into time
+struct GemmDeviceDescriptor
+{
+    index_t num_cu_                    = 110;
+    index_t num_simd_per_cu_           = 4;
+    index_t max_block_per_cu_          = 2;
+    index_t lds_bytes_per_cu_          = 65536;
+    index_t max_threads_per_cu_        = 2048;
+    double clock_ghz_                  = 1.7;
+    double flop_per_cycle_per_cu_      = 1024; // matrix cores, for the data type of the problem
+    double lds_bytes_per_cycle_per_cu_ = 128;
+    double l2_gb_per_sec_              = 3500;
+    double dram_gb_per_sec_            = 1600;
+};
+
+// Peak numbers of the devices supported by the XDL instances. data_size is the size of the A/B
+// element type in bytes, it selects the matrix core throughput.
+inline GemmDeviceDescriptor get_gemm_device_descriptor(const std::string& device_name,
+                                                       index_t data_size)
+{
+    GemmDeviceDescriptor device;
+
+    if(device_name == "gfx90a")
+    {
+        // one GCD of MI250X
+        device.num_cu_                = 110;
+        device.clock_ghz_             = 1.7;
+        device.flop_per_cycle_per_cu_ = data_size == 8 ? 128 : data_size == 4 ? 256 : 1024;
+        device.l2_gb_per_sec_         = 3500;
+        device.dram_gb_per_sec_       = 1638;
+    }
+    else if(device_name == "gfx908")
+    {
+        // MI100
+        device.num_cu_                = 120;
+        device.clock_ghz_             = 1.502;
+        device.flop_per_cycle_per_cu_ = data_size == 8 ? 64 : data_size == 4 ? 256 : 1024;
+        device.l2_gb_per_sec_         = 3000;
+        device.dram_gb_per_sec_       = 1229;
+    }
+    else
+    {
+        throw std::runtime_error("wrong! no GEMM device descriptor for " + device_name);
+    }
+
+    return device;
+}
+
+struct GemmProblemDescriptor
+{
+    index_t M_ = 0;
+    index_t N_ = 0;
+    index_t K_ = 0;
+
+    // element sizes in bytes
+    index_t a_data_size_ = 2;
+    index_t b_data_size_ = 2;
+    index_t c_data_size_ = 2;
+};
+
+// Terms of the cost model for one instance on one problem. The estimated time is linear in the
+// last three terms, which makes the model calibratable by least squares.
+struct GemmCostFeatures
+{
+    index_t num_tile_          = 0; // C tiles, including the padded ones
+    index_t block_per_cu_      = 0; // resident workgroups per CU
+    index_t num_wave_          = 0; // grid waves over all CUs
+    index_t num_k_loop_        = 0; // main loop iterations of one tile
+    double wave_efficiency_    = 0; // fraction of workgroup slots doing work in all waves
+    double padding_efficiency_ = 0; // useful fraction of the padded problem
+
+    // time in us of the most loaded CU, if it was only limited by one resource
+    double compute_us_ = 0;
+    double lds_us_     = 0;
+    double l2_us_      = 0;
+    double dram_us_    = 0;
+
+    double roofline_us_    = 0; // max of the above
+    double exposed_k_loop_ = 0; // main loop iterations whose latency is not hidden by prefetch
+    double num_tile_wave_  = 0; // waves, each paying prologue and epilogue of a tile
+};
+
+// time_us = launch_us_ + roofline_ * roofline_us + k_loop_us_ * exposed_k_loop
+//         + tile_wave_us_ * num_tile_wave
+struct GemmCostModelCoefficients
+{
+    double launch_us_    = 5.0;
+    double roofline_     = 1.0;
+    double k_loop_us_    = 0.05;
+    double tile_wave_us_ = 1.0;
+};
+
+struct GemmCostEstimate
+{
+    std::size_t id_ = 0; // index of the instance in the list given to Rank()
+    double time_us_ = 0;
+    GemmCostFeatures features_;
+};
+
+// One measurement, e.g. from a ckProfiler log
+struct GemmCostSample
+{
+    GemmInstanceMetadata metadata_;
+    GemmProblemDescriptor problem_;
+    double time_us_ = 0;
+};
+
+// Analytical model ranking GEMM instances from their block tile parameters, so an instance can be
+// picked for a problem without timing all of them.
+//
+// It models the quantization of the tiles over the CUs, the work wasted on padded tiles, the main
+// loop latency not hidden by prefetch and the traffic to LDS, L2 and DRAM. The absolute time is
+// only as good as the coefficients; Calibrate() fits them to measured timings.
+class GemmCostModel
+{
+    public:
+    explicit GemmCostModel(const GemmDeviceDescriptor& device,
+                           const GemmCostModelCoefficients& coefficients = {})
+        : device_{device}, coefficients_{coefficients}
+    {
+    }
+
+    const GemmDeviceDescriptor& GetDeviceDescriptor() const { return device_; }
+
+    const GemmCostModelCoefficients& GetCoefficients() const { return coefficients_; }
+
+    GemmCostFeatures GetFeatures(const GemmInstanceMetadata& metadata,
+                                 const GemmProblemDescriptor& problem) const
+    {
+        const auto& tile = metadata.tile_;
+
+        const index_t m_tile = math::integer_divide_ceil(problem.M_, tile.m_per_block_);
+        const index_t n_tile = math::integer_divide_ceil(problem.N_, tile.n_per_block_);
+        const index_t k_padded =
+            math::integer_divide_ceil(problem.K_, tile.k_per_block_) * tile.k_per_block_;
+
+        GemmCostFeatures features;
+
+        features.num_tile_   = m_tile * n_tile;
+        features.num_k_loop_ = k_padded / tile.k_per_block_;
+
+        // occupancy is bounded by LDS and threads, the A and B block tiles live in LDS
+        const index_t lds_bytes_per_block =
+            (tile.m_per_block_ * problem.a_data_size_ + tile.n_per_block_ * problem.b_data_size_) *
+            tile.k_per_block_;
+
+        features.block_per_cu_ =
+            std::max(index_t{1},
+                     std::min({device_.max_block_per_cu_,
+                               device_.lds_bytes_per_cu_ / lds_bytes_per_block,
+                               device_.max_threads_per_cu_ / tile.block_size_}));
+
+        const index_t num_slot = device_.num_cu_ * features.block_per_cu_;
+
+        features.num_wave_ = math::integer_divide_ceil(features.num_tile_, num_slot);
+
+        features.wave_efficiency_ =
+            static_cast<double>(features.num_tile_) / (features.num_wave_ * num_slot);
+
+        features.padding_efficiency_ =
+            static_cast<double>(problem.M_) * problem.N_ * problem.K_ /
+            (static_cast<double>(m_tile * tile.m_per_block_) * n_tile * tile.n_per_block_ *
+             k_padded);
+
+        // the most loaded CU works on this many tiles, padded or not
+        const double tile_per_cu = math::integer_divide_ceil(features.num_tile_, device_.num_cu_);
+
+        const double cycle_per_us = device_.clock_ghz_ * 1.e3;
+
+        const double flop_per_tile = 2. * tile.m_per_block_ * tile.n_per_block_ * k_padded;
+
+        // a wave runs on one SIMD, a CU with fewer resident waves than SIMDs is not saturated
+        const double num_wave_per_block = std::max(1, tile.block_size_ / 64);
+
+        const double simd_utilization =
+            std::min(1.,
+                     num_wave_per_block * std::min<double>(features.block_per_cu_, tile_per_cu) /
+                         device_.num_simd_per_cu_);
+
+        features.compute_us_ = tile_per_cu * flop_per_tile /
+                               (device_.flop_per_cycle_per_cu_ * simd_utilization * cycle_per_us);
+
+        // each K block is written to LDS once and read by every wave; waves are assumed to be
+        // arranged in a square, so each one reads 1 / sqrt(num_wave) of the tile
+
+        const double lds_bytes_per_tile =
+            lds_bytes_per_block * features.num_k_loop_ * (1. + std::sqrt(num_wave_per_block));
+
+        features.lds_us_ =
+            tile_per_cu * lds_bytes_per_tile / (device_.lds_bytes_per_cycle_per_cu_ * cycle_per_us);
+
+        // every tile streams its A rows and B columns through L2, DRAM sees each byte once
+        const double c_bytes = static_cast<double>(problem.M_) * problem.N_ * problem.c_data_size_;
+
+        const double l2_bytes = static_cast<double>(features.num_tile_) * lds_bytes_per_block *
+                                    features.num_k_loop_ +
+                                c_bytes;
+
+        const double dram_bytes = static_cast<double>(problem.M_) * problem.K_ *
+                                      problem.a_data_size_ +
+                                  static_cast<double>(problem.K_) * problem.N_ *
+                                      problem.b_data_size_ +
+                                  c_bytes;
+
+        features.l2_us_   = l2_bytes / (device_.l2_gb_per_sec_ * 1.e3);
+        features.dram_us_ = dram_bytes / (device_.dram_gb_per_sec_ * 1.e3);
+
+        features.roofline_us_ = std::max(
+            {features.compute_us_, features.lds_us_, features.l2_us_, features.dram_us_});
+
+        // the tiles of a wave run their main loops concurrently, deeper prefetch hides more of the
+        // latency of each iteration
+        features.exposed_k_loop_ = static_cast<double>(features.num_wave_) *
+                                   features.num_k_loop_ / std::max(1, tile.num_prefetch_);
+
+        features.num_tile_wave_ = features.num_wave_;
+
+        return features;
+    }
+
+    double GetTime(const GemmCostFeatures& features) const
+    {
+        return coefficients_.launch_us_ + coefficients_.roofline_ * features.roofline_us_ +
+               coefficients_.k_loop_us_ * features.exposed_k_loop_ +
+               coefficients_.tile_wave_us_ * features.num_tile_wave_;
+    }
+
+    double EstimateTime(const GemmInstanceMetadata& metadata,
+                        const GemmProblemDescriptor& problem) const
+    {
+        return GetTime(GetFeatures(metadata, problem));
+    }
+
+    // Returns at most max_num_candidate instances, fastest first. Instances without metadata
+    // cannot be estimated and are left out, as are the ones not supporting the problem.
+    std::vector<GemmCostEstimate> Rank(const std::vector<GemmInstanceMetadata>& metadatas,
+                                       const GemmProblemDescriptor& problem,
+                                       std::size_t max_num_candidate) const
+    {
+        std::vector<GemmCostEstimate> estimates;
+
+        for(std::size_t i = 0; i < metadatas.size(); ++i)
+        {
+            if(!metadatas[i].is_valid_ ||
+               !metadatas[i].IsSupportedProblem(problem.M_, problem.N_, problem.K_))
+            {
+                continue;
+            }
+
+            const auto features = GetFeatures(metadatas[i], problem);
+
+            estimates.push_back(GemmCostEstimate{i, GetTime(features), features});
+        }
+
+        // stable, so equal estimates keep the order of the instance list
+        std::stable_sort(estimates.begin(), estimates.end(), [](const auto& a, const auto& b) {
+            return a.time_us_ < b.time_us_;
+        });
+
+        if(estimates.size() > max_num_candidate)
+        {
+            estimates.resize(max_num_candidate);
+        }
+
+        return estimates;
+    }
+
+    // Ranks instances returned by DeviceOperationInstanceFactory, id_ indexes op_ptrs
+    template <typename DeviceOpPtr>
+    std::vector<GemmCostEstimate> RankInstances(const std::vector<DeviceOpPtr>& op_ptrs,
+                                                const GemmProblemDescriptor& problem,
+                                                std::size_t max_num_candidate) const
+    {
+        std::vector<GemmInstanceMetadata> metadatas;
+
+        for(const auto& op_ptr : op_ptrs)
+        {
+            metadatas.push_back(op_ptr->GetInstanceMetadata());
+        }
+
+        return Rank(metadatas, problem, max_num_candidate);
+    }
+
+    // Fits the coefficients to measured timings, minimizing the relative error under the
+    // constraint that every coefficient is non-negative. The 4 coefficients are few enough to
+    // solve the constrained problem by trying every set of free coefficients.
+    void Calibrate(const std::vector<GemmCostSample>& samples)
+    {
+        constexpr std::size_t num_coefficient = 4;
+
+        using Vector = std::array<double, num_coefficient>;
+
+        std::vector<Vector> xs;
+        std::vector<double> ys;
+
+        for(const auto& sample : samples)
+        {
+            if(!sample.metadata_.is_valid_ || !(sample.time_us_ > 0))
+            {
+                continue;
+            }
+
+            const auto features = GetFeatures(sample.metadata_, sample.problem_);
+
+            // scaled by 1 / time, so that short kernels weigh as much as long ones
+            const double scale = 1. / sample.time_us_;
+
+            xs.push_back(Vector{scale,
+                                features.roofline_us_ * scale,
+                                features.exposed_k_loop_ * scale,
+                                features.num_tile_wave_ * scale});
+            ys.push_back(1.);
+        }
+
+        if(xs.size() < num_coefficient)
+        {
+            throw std::runtime_error("wrong! not enough samples to calibrate the GEMM cost model");
+        }
+
+        Vector best_c{};
+        double best_error = std::numeric_limits<double>::max();
+
+        for(std::size_t free_mask = 1; free_mask < (1 << num_coefficient); ++free_mask)
+        {
+            Vector c{};
+
+            if(!SolveLeastSquares(xs, ys, free_mask, c))
+            {
+                continue;
+            }
+
+            if(std::any_of(c.begin(), c.end(), [](double v) { return v < 0; }))
+            {
+                continue;
+            }
+
+            double error = 0;
+
+            for(std::size_t i = 0; i < xs.size(); ++i)
+            {
+                double y = 0;
+
+                for(std::size_t j = 0; j < num_coefficient; ++j)
+                {
+                    y += xs[i][j] * c[j];
+                }
+
+                error += (y - ys[i]) * (y - ys[i]);
+            }
+
+            if(error < best_error)
+            {
+                best_error = error;
+                best_c     = c;
+            }
+        }
+
+        if(best_error == std::numeric_limits<double>::max())
+        {
+            throw std::runtime_error(
+                "wrong! no non-negative coefficients of the GEMM cost model fit the samples");
+        }
+
+        coefficients_ = GemmCostModelCoefficients{best_c[0], best_c[1], best_c[2], best_c[3]};
+    }
+
+    private:
+    // least squares over the coefficients selected by free_mask, the others are 0
+    template <std::size_t NumCoefficient>
+    static bool SolveLeastSquares(const std::vector<std::array<double, NumCoefficient>>& xs,
+                                  const std::vector<double>& ys,
+                                  std::size_t free_mask,
+                                  std::array<double, NumCoefficient>& c)
+    {
+        std::vector<std::size_t> free_ids;
+
+        for(std::size_t j = 0; j < NumCoefficient; ++j)
+        {
+            if(free_mask & (std::size_t{1} << j))
+            {
+                free_ids.push_back(j);
+            }
+        }
+
+        const std::size_t n = free_ids.size();
+
+        // normal equations [X^T X | X^T y]
+        std::vector<std::vector<double>> a(n, std::vector<double>(n + 1, 0));
+
+        for(std::size_t i = 0; i < xs.size(); ++i)
+        {
+            for(std::size_t r = 0; r < n; ++r)
+            {
+                for(std::size_t s = 0; s < n; ++s)
+                {
+                    a[r][s] += xs[i][free_ids[r]] * xs[i][free_ids[s]];
+                }
+
+                a[r][n] += xs[i][free_ids[r]] * ys[i];
+            }
+        }
+
+        // Gaussian elimination with partial pivoting
+        for(std::size_t r = 0; r < n; ++r)
+        {
+            std::size_t pivot = r;
+
+            for(std::size_t s = r + 1; s < n; ++s)
+            {
+                if(std::abs(a[s][r]) > std::abs(a[pivot][r]))
+                {
+                    pivot = s;
+                }
+            }
+
+            if(std::abs(a[pivot][r]) <= 1.e-12 * std::max(1., std::abs(a[r][r])))
+            {
+                return false;
+            }
+
+            std::swap(a[r], a[pivot]);
+
+            for(std::size_t s = 0; s < n; ++s)
+            {
+                if(s != r)
+                {
+                    const double f = a[s][r] / a[r][r];
+
+                    for(std::size_t t = r; t <= n; ++t)
+                    {
+                        a[s][t] -= f * a[r][t];
+                    }
+                }
+            }
+        }
+
+        c.fill(0);
+
+        for(std::size_t r = 0; r < n; ++r)
+        {
+            c[free_ids[r]] = a[r][n] / a[r][r];
+        }
+
+        return true;
+    }
+
+    GemmDeviceDescriptor device_;
+    GemmCostModelCoefficients coefficients_;
+};
+
+// One "Perf:" line of a ckProfiler GEMM log
+struct GemmProfilerRecord
+{
+    index_t M_ = 0;
+    index_t N_ = 0;
+    index_t K_ = 0;
+    std::string op_name_;
+    double time_ms_ = 0;
+};
+
+// Reads the per-instance timings printed by profile_gemm_impl:
+//   Perf: <time> ms, <tflops> TFlops, <bandwidth> GB/s, <type string>
+//   ...
+//   Best Perf for datatype = ... M = <M> N = <N> K = <K> ...
+// The problem size is printed after the timings, so records are completed when it is found.
+inline std::vector<GemmProfilerRecord> parse_gemm_profiler_log(std::istream& is)
+{
+    std::vector<GemmProfilerRecord> records;
+    std::size_t num_complete = 0;
+
+    const std::string perf_tag = "Perf: ";
+    const std::string name_tag = " GB/s, ";
+
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        if(line.compare(0, perf_tag.size(), perf_tag) == 0)
+        {
+            const auto name_pos = line.find(name_tag);
+
+            if(name_pos == std::string::npos)
+            {
+                continue;
+            }
+
+            GemmProfilerRecord record;
+
+            std::istringstream(line.substr(perf_tag.size())) >> record.time_ms_;
+            record.op_name_ = line.substr(name_pos + name_tag.size());
+
+            records.push_back(record);
+        }
+        else if(line.compare(0, 9, "Best Perf") == 0)
+        {
+            const auto m_pos = line.find(" M = ");
+            const auto n_pos = line.find(" N = ");
+            const auto k_pos = line.find(" K = ");
+
+            if(m_pos == std::string::npos || n_pos == std::string::npos ||
+               k_pos == std::string::npos)
+            {
+                continue;
+            }
+
+            index_t M = 0, N = 0, K = 0;
+
+            std::istringstream(line.substr(m_pos + 5)) >> M;
+            std::istringstream(line.substr(n_pos + 5)) >> N;
+            std::istringstream(line.substr(k_pos + 5)) >> K;
+
+            for(; num_complete < records.size(); ++num_complete)
+            {
+                records[num_complete].M_ = M;
+                records[num_complete].N_ = N;
+                records[num_complete].K_ = K;
+            }
+        }
+    }
+
+    // drop the timings of an interrupted run
+    records.resize(num_complete);
+
+    return records;
+}
+
+// Matches profiler records with the instances they were measured on. Type strings are not unique
+// (e.g. instances only differing in vector width), so a record goes to the first instance with
+// the same type string that supports the problem. Records without a match are skipped.
+template <typename DeviceOpPtr>
+std::vector<GemmCostSample> make_gemm_cost_samples(const std::vector<GemmProfilerRecord>& records,
+                                                   const std::vector<DeviceOpPtr>& op_ptrs,
+                                                   index_t a_data_size,
+                                                   index_t b_data_size,
+                                                   index_t c_data_size)
+{
+    std::vector<GemmCostSample> samples;
+
+    for(const auto& record : records)
+    {
+        for(const auto& op_ptr : op_ptrs)
+        {
+            const auto metadata = op_ptr->GetInstanceMetadata();
+
+            if(metadata.is_valid_ && op_ptr->GetTypeString() == record.op_name_ &&
+               metadata.IsSupportedProblem(record.M_, record.N_, record.K_))
+            {
+                samples.push_back(GemmCostSample{
+                    metadata,
+                    GemmProblemDescriptor{
+                        record.M_, record.N_, record.K_, a_data_size, b_data_size, c_data_size},
+                    record.time_ms_ * 1.e3});
+                break;
+            }
+        }
+    }
+
+    return samples;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,337 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Runtime-length counterpart of ck::SpaceFillingCurve for host code: the same order of vector
+// accesses, in dimensions of access order, snake curved or not. Iterating over it yields the
+// multi-index and the offset in the tensor of each access, updated incrementally.
+class HostSpaceFillingCurve
+{
+    public:
+    // vector access, the multi-index of its first scalar and the offset of that scalar
+    struct Access
+    {
+        const std::vector<std::size_t>& index;
+        std::size_t offset;
+    };
+
+    class Iterator
+    {
+        public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Access;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = Access;
+
+        Iterator(const HostSpaceFillingCurve& curve, std::size_t access_idx_1d)
+            : curve_{&curve}, access_idx_1d_{access_idx_1d}
+        {
+            if(access_idx_1d_ < curve_->GetNumOfAccess())
+            {
+                index_  = curve_->GetIndex(access_idx_1d_);
+                offset_ = std::inner_product(
+                    index_.begin(), index_.end(), curve_->strides_.begin(), std::size_t{0});
+
+                forward_.resize(curve_->GetNumOfDimension());
+
+                // direction of the next step in each dimension, from the ordered access index
+                const auto ordered_access_idx = curve_->GetOrderedAccessIndex(access_idx_1d_);
+
+                std::size_t tmp = 0;
+
+                for(std::size_t i = 0; i < forward_.size(); ++i)
+                {
+                    const std::size_t idim = curve_->dim_access_order_[i];
+
+                    forward_[idim] = !curve_->snake_curved_ || tmp % 2 == 0;
+
+                    tmp = tmp * curve_->ordered_access_lengths_[i] + ordered_access_idx[i];
+                }
+            }
+        }
+
+        Access operator*() const { return Access{index_, offset_}; }
+
+        Iterator& operator++()
+        {
+            ++access_idx_1d_;
+
+            if(access_idx_1d_ < curve_->GetNumOfAccess())
+            {
+                Step();
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b)
+        {
+            return a.access_idx_1d_ == b.access_idx_1d_;
+        }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return !(a == b); }
+
+        private:
+        // move in the innermost dimension of access order that is not at its end, the ones
+        // inside it turn back on a snake curve and restart otherwise
+        void Step()
+        {
+            for(std::size_t i = curve_->GetNumOfDimension(); i-- > 0;)
+            {
+                const std::size_t idim   = curve_->dim_access_order_[i];
+                const std::size_t scalar = curve_->scalars_per_access_[idim];
+                const std::size_t stride = curve_->strides_[idim] * scalar;
+
+                if(forward_[idim] && index_[idim] + scalar < curve_->lengths_[idim])
+                {
+                    index_[idim] += scalar;
+                    offset_ += stride;
+                    return;
+                }
+                else if(!forward_[idim] && index_[idim] > 0)
+                {
+                    index_[idim] -= scalar;
+                    offset_ -= stride;
+                    return;
+                }
+
+                if(curve_->snake_curved_)
+                {
+                    forward_[idim] = !forward_[idim];
+                }
+                else
+                {
+                    offset_ -= index_[idim] * curve_->strides_[idim];
+                    index_[idim] = 0;
+                }
+            }
+        }
+
+        const HostSpaceFillingCurve* curve_;
+        std::size_t access_idx_1d_;
+        std::vector<std::size_t> index_;
+        std::size_t offset_ = 0;
+        std::vector<bool> forward_;
+    };
+
+    // offsets of a packed tensor of these lengths
+    HostSpaceFillingCurve(std::vector<std::size_t> lengths,
+                          std::vector<std::size_t> dim_access_order,
+                          std::vector<std::size_t> scalars_per_access,
+                          bool snake_curved = true)
+        : HostSpaceFillingCurve(HostTensorDescriptor(lengths),
+                                std::move(dim_access_order),
+                                std::move(scalars_per_access),
+                                snake_curved)
+    {
+    }
+
+    // offsets of a tensor of this descriptor
+    HostSpaceFillingCurve(const HostTensorDescriptor& desc,
+                          std::vector<std::size_t> dim_access_order,
+                          std::vector<std::size_t> scalars_per_access,
+                          bool snake_curved = true)
+        : lengths_{desc.GetLengths()},
+          strides_{desc.GetStrides()},
+          dim_access_order_{std::move(dim_access_order)},
+          scalars_per_access_{std::move(scalars_per_access)},
+          snake_curved_{snake_curved}
+    {
+        const std::size_t ndim = lengths_.size();
+
+        if(dim_access_order_.size() != ndim || scalars_per_access_.size() != ndim)
+        {
+            throw std::runtime_error("wrong! inconsistent number of dimensions");
+        }
+
+        std::vector<std::size_t> sorted_order = dim_access_order_;
+
+        std::sort(sorted_order.begin(), sorted_order.end());
+
+        for(std::size_t i = 0; i < ndim; ++i)
+        {
+            if(sorted_order[i] != i)
+            {
+                throw std::runtime_error("wrong! dim_access_order is not a permutation");
+            }
+
+            if(scalars_per_access_[i] == 0 || lengths_[i] % scalars_per_access_[i] != 0)
+            {
+                throw std::runtime_error("wrong! lengths not divisible by scalars_per_access");
+            }
+        }
+
+        ordered_access_lengths_.resize(ndim);
+
+        for(std::size_t i = 0; i < ndim; ++i)
+        {
+            const std::size_t idim = dim_access_order_[i];
+
+            ordered_access_lengths_[i] = lengths_[idim] / scalars_per_access_[idim];
+        }
+
+        num_access_ = std::accumulate(ordered_access_lengths_.begin(),
+                                      ordered_access_lengths_.end(),
+                                      std::size_t{1},
+                                      std::multiplies<std::size_t>{});
+    }
+
+    // Curve over a tensor along its memory, the dimension of smallest stride moving fastest
+    static HostSpaceFillingCurve MakeMemoryOrdered(const HostTensorDescriptor& desc,
+                                                   std::vector<std::size_t> scalars_per_access,
+                                                   bool snake_curved = true)
+    {
+        return HostSpaceFillingCurve(
+            desc, GetDimAccessOrderByStrides(desc), std::move(scalars_per_access), snake_curved);
+    }
+
+    // dimensions from the largest stride to the smallest, in order of dimension for equal strides
+    static std::vector<std::size_t> GetDimAccessOrderByStrides(const HostTensorDescriptor& desc)
+    {
+        const auto& strides = desc.GetStrides();
+
+        std::vector<std::size_t> order(strides.size());
+
+        std::iota(order.begin(), order.end(), std::size_t{0});
+
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return strides[a] > strides[b];
+        });
+
+        return order;
+    }
+
+    std::size_t GetNumOfDimension() const { return lengths_.size(); }
+
+    std::size_t GetNumOfAccess() const { return num_access_; }
+
+    std::size_t GetScalarPerVector() const
+    {
+        return std::accumulate(scalars_per_access_.begin(),
+                               scalars_per_access_.end(),
+                               std::size_t{1},
+                               std::multiplies<std::size_t>{});
+    }
+
+    // multi-index of the first scalar of an access
+    std::vector<std::size_t> GetIndex(std::size_t access_idx_1d) const
+    {
+        const std::size_t ndim        = GetNumOfDimension();
+        const auto ordered_access_idx = GetOrderedAccessIndex(access_idx_1d);
+
+        std::vector<std::size_t> idx(ndim);
+
+        std::size_t tmp = 0;
+
+        for(std::size_t i = 0; i < ndim; ++i)
+        {
+            const std::size_t idim = dim_access_order_[i];
+
+            const bool forward_sweep = !snake_curved_ || tmp % 2 == 0;
+
+            idx[idim] = (forward_sweep ? ordered_access_idx[i]
+                                       : ordered_access_lengths_[i] - 1 - ordered_access_idx[i]) *
+                        scalars_per_access_[idim];
+
+            tmp = tmp * ordered_access_lengths_[i] + ordered_access_idx[i];
+        }
+
+        return idx;
+    }
+
+    std::size_t GetOffset(std::size_t access_idx_1d) const
+    {
+        const auto idx = GetIndex(access_idx_1d);
+
+        return std::inner_product(idx.begin(), idx.end(), strides_.begin(), std::size_t{0});
+    }
+
+    std::vector<std::ptrdiff_t> GetStepBetween(std::size_t access_idx_1d_begin,
+                                               std::size_t access_idx_1d_end) const
+    {
+        const auto idx_begin = GetIndex(access_idx_1d_begin);
+        const auto idx_end   = GetIndex(access_idx_1d_end);
+
+        std::vector<std::ptrdiff_t> step(GetNumOfDimension());
+
+        for(std::size_t i = 0; i < step.size(); ++i)
+        {
+            step[i] =
+                static_cast<std::ptrdiff_t>(idx_end[i]) - static_cast<std::ptrdiff_t>(idx_begin[i]);
+        }
+
+        return step;
+    }
+
+    std::vector<std::ptrdiff_t> GetForwardStep(std::size_t access_idx_1d) const
+    {
+        return GetStepBetween(access_idx_1d, access_idx_1d + 1);
+    }
+
+    std::vector<std::ptrdiff_t> GetBackwardStep(std::size_t access_idx_1d) const
+    {
+        return GetStepBetween(access_idx_1d, access_idx_1d - 1);
+    }
+
+    Iterator begin() const { return Iterator{*this, 0}; }
+
+    Iterator end() const { return Iterator{*this, num_access_}; }
+
+    // calls f(index, offset) for each access, in order
+    template <typename F>
+    void ForEach(F&& f) const
+    {
+        for(const Access access : *this)
+        {
+            f(access.index, access.offset);
+        }
+    }
+
+    private:
+    // index of an access in ordered_access_lengths_, before turning back on the snake curve
+    std::vector<std::size_t> GetOrderedAccessIndex(std::size_t access_idx_1d) const
+    {
+        std::vector<std::size_t> ordered_access_idx(GetNumOfDimension());
+
+        for(std::size_t i = ordered_access_idx.size(); i-- > 0;)
+        {
+            ordered_access_idx[i] = access_idx_1d % ordered_access_lengths_[i];
+            access_idx_1d /= ordered_access_lengths_[i];
+        }
+
+        return ordered_access_idx;
+    }
+
+    std::vector<std::size_t> lengths_;
+    std::vector<std::size_t> strides_;
+    std::vector<std::size_t> dim_access_order_;
+    std::vector<std::size_t> scalars_per_access_;
+    std::vector<std::size_t> ordered_access_lengths_;
+    std::size_t num_access_;
+    bool snake_curved_;
+};
+
+} // namespace utils
+} // namespace ck
@@ -4,17 +4,23 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <iostream>
+#include <iterator>
 #include <numeric>
+#include <stdexcept>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "ck/host_utility/parallel_for.hpp"
 #include "ck/utility/data_type.hpp"
 #include "ck/utility/span.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/host_type_convert.hpp"
 #include "ck/library/utility/ranges.hpp"
 
 template <typename Range>
@@ -75,6 +81,8 @@ auto construct_f_unpack_args(F, T args)
     return construct_f_unpack_args_impl<F>(args, std::make_index_sequence<N>{});
 }
 
+class HostTensorIndexRange;
+
 struct HostTensorDescriptor
 {
     HostTensorDescriptor() = default;
@@ -130,11 +138,16 @@ struct HostTensorDescriptor
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
 
-    std::size_t GetOffsetFromMultiIndex(std::vector<std::size_t> iss) const
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
     {
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
 
+    // elements in row-major order of the lengths, from the element_begin-th to the one before the
+    // element_end-th
+    HostTensorIndexRange GetIndexRange() const;
+    HostTensorIndexRange GetIndexRange(std::size_t element_begin, std::size_t element_end) const;
+
     friend std::ostream& operator<<(std::ostream& os, const HostTensorDescriptor& desc);
 
     private:
@@ -142,6 +155,128 @@ struct HostTensorDescriptor
     std::vector<std::size_t> mStrides;
 };
 
+// Iterator over the elements of a HostTensorDescriptor in row-major order of its lengths. The
+// multi-index and the offset are stepped incrementally and the multi-index is held in the
+// iterator, so iterating does not allocate. Other descriptors with contiguous lengths and strides,
+// like FixedRankHostTensorDescriptor, can be iterated as well; the descriptor must outlive the
+// iterator.
+class HostTensorIndexIterator
+{
+    public:
+    static constexpr std::size_t MaxNumDim = 16;
+
+    struct Element
+    {
+        ck::span<const std::size_t> index;
+        std::size_t offset;
+    };
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Element;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = Element;
+
+    template <typename Desc>
+    HostTensorIndexIterator(const Desc& desc, std::size_t element)
+        : mLens(desc.GetLengths().data()),
+          mStrides(desc.GetStrides().data()),
+          mNDim(desc.GetNumOfDimension()),
+          mElement(element)
+    {
+        if(mNDim > MaxNumDim)
+        {
+            throw std::runtime_error("wrong! too many dimensions for HostTensorIndexIterator");
+        }
+
+        for(std::size_t i = mNDim; i-- > 0;)
+        {
+            mIndex[i] = mLens[i] == 0 ? 0 : element % mLens[i];
+            element   = mLens[i] == 0 ? 0 : element / mLens[i];
+            mOffset += mIndex[i] * mStrides[i];
+        }
+    }
+
+    Element operator*() const { return Element{{mIndex.data(), mNDim}, mOffset}; }
+
+    HostTensorIndexIterator& operator++()
+    {
+        ++mElement;
+
+        for(std::size_t i = mNDim; i-- > 0;)
+        {
+            if(++mIndex[i] < mLens[i])
+            {
+                mOffset += mStrides[i];
+                return *this;
+            }
+
+            mOffset -= (mIndex[i] - 1) * mStrides[i];
+            mIndex[i] = 0;
+        }
+
+        return *this;
+    }
+
+    HostTensorIndexIterator operator++(int)
+    {
+        HostTensorIndexIterator tmp = *this;
+        ++(*this);
+        return tmp;
+    }
+
+    friend bool operator==(const HostTensorIndexIterator& a, const HostTensorIndexIterator& b)
+    {
+        return a.mElement == b.mElement;
+    }
+
+    friend bool operator!=(const HostTensorIndexIterator& a, const HostTensorIndexIterator& b)
+    {
+        return !(a == b);
+    }
+
+    private:
+    const std::size_t* mLens;
+    const std::size_t* mStrides;
+    std::size_t mNDim;
+    std::size_t mElement;
+    std::array<std::size_t, MaxNumDim> mIndex{};
+    std::size_t mOffset = 0;
+};
+
+class HostTensorIndexRange
+{
+    public:
+    HostTensorIndexRange(const HostTensorDescriptor& desc,
+                         std::size_t element_begin,
+                         std::size_t element_end)
+        : mBegin(desc, element_begin), mEnd(desc, element_end), mSize(element_end - element_begin)
+    {
+    }
+
+    HostTensorIndexIterator begin() const { return mBegin; }
+
+    HostTensorIndexIterator end() const { return mEnd; }
+
+    std::size_t size() const { return mSize; }
+
+    private:
+    HostTensorIndexIterator mBegin;
+    HostTensorIndexIterator mEnd;
+    std::size_t mSize;
+};
+
+inline HostTensorIndexRange HostTensorDescriptor::GetIndexRange() const
+{
+    return GetIndexRange(0, GetElementSize());
+}
+
+inline HostTensorIndexRange HostTensorDescriptor::GetIndexRange(std::size_t element_begin,
+                                                                std::size_t element_end) const
+{
+    return HostTensorIndexRange(*this, element_begin, element_end);
+}
+
 template <typename New2Old>
 HostTensorDescriptor transpose_host_tensor_descriptor_given_new2old(const HostTensorDescriptor& a,
                                                                     const New2Old& new2old)
@@ -158,22 +293,8 @@ HostTensorDescriptor transpose_host_tensor_descriptor_given_new2old(const HostTe
     return HostTensorDescriptor(new_lengths, new_strides);
 }
 
-struct joinable_thread : std::thread
-{
-    template <typename... Xs>
-    joinable_thread(Xs&&... xs) : std::thread(std::forward<Xs>(xs)...)
-    {
-    }
-
-    joinable_thread(joinable_thread&&) = default;
-    joinable_thread& operator=(joinable_thread&&) = default;
-
-    ~joinable_thread()
-    {
-        if(this->joinable())
-            this->join();
-    }
-};
+using ck::joinable_thread;
+using ck::parallel_for_each_range;
 
 template <typename F, typename... Xs>
 struct ParallelTensorFunctor
@@ -270,8 +391,7 @@ struct Tensor
     {
         Tensor<OutT> ret(mDesc);
 
-        ck::ranges::transform(
-            mData, ret.mData.begin(), [](auto value) { return ck::type_convert<OutT>(value); });
+        ck::utils::parallel_bulk_type_convert(mData.data(), ret.mData.data(), mData.size());
 
         return ret;
     }
@@ -304,50 +424,33 @@ struct Tensor
 
     void SetZero() { ck::ranges::fill<T>(mData, 0); }
 
+    // calls f(*this, idx) for each element in row-major order of the lengths, or
+    // f(*this, idx, offset) when f takes the offset of idx in mData as well, which saves the
+    // callback from recomputing it from idx
     template <typename F>
-    void ForEach_impl(F&& f, std::vector<size_t>& idx, size_t rank)
+    void ForEach(F&& f)
     {
-        if(rank == mDesc.GetNumOfDimension())
-        {
-            f(*this, idx);
-            return;
-        }
-        // else
-        for(size_t i = 0; i < mDesc.GetLengths()[rank]; i++)
-        {
-            idx[rank] = i;
-            ForEach_impl(std::forward<F>(f), idx, rank + 1);
-        }
+        ForEach_impl(*this, f, 0, GetElementSize());
     }
 
     template <typename F>
-    void ForEach(F&& f)
+    void ForEach(F&& f) const
     {
-        std::vector<size_t> idx(mDesc.GetNumOfDimension(), 0);
-        ForEach_impl(std::forward<F>(f), idx, size_t(0));
+        ForEach_impl(*this, f, 0, GetElementSize());
     }
 
+    // ForEach with the elements split in contiguous ranges of the row-major order, i.e. over the
+    // outermost dims, among num_thread threads; f is called concurrently for different elements
     template <typename F>
-    void ForEach_impl(const F&& f, std::vector<size_t>& idx, size_t rank) const
+    void ParallelForEach(F&& f, std::size_t num_thread = std::thread::hardware_concurrency())
     {
-        if(rank == mDesc.GetNumOfDimension())
-        {
-            f(*this, idx);
-            return;
-        }
-        // else
-        for(size_t i = 0; i < mDesc.GetLengths()[rank]; i++)
-        {
-            idx[rank] = i;
-            ForEach_impl(std::forward<const F>(f), idx, rank + 1);
-        }
+        ParallelForEach_impl(*this, f, num_thread);
     }
 
     template <typename F>
-    void ForEach(const F&& f) const
+    void ParallelForEach(F&& f, std::size_t num_thread = std::thread::hardware_concurrency()) const
     {
-        std::vector<size_t> idx(mDesc.GetNumOfDimension(), 0);
-        ForEach_impl(std::forward<const F>(f), idx, size_t(0));
+        ParallelForEach_impl(*this, f, num_thread);
     }
 
     template <typename G>
@@ -423,12 +526,12 @@ struct Tensor
         return mData[mDesc.GetOffsetFromMultiIndex(is...)];
     }
 
-    T& operator()(std::vector<std::size_t> idx)
+    T& operator()(const std::vector<std::size_t>& idx)
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
 
-    const T& operator()(std::vector<std::size_t> idx) const
+    const T& operator()(const std::vector<std::size_t>& idx) const
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
@@ -469,4 +572,34 @@ struct Tensor
 
     Descriptor mDesc;
     Data mData;
+
+    private:
+    template <typename Self, typename F>
+    static void ForEach_impl(Self& self, F& f, std::size_t element_begin, std::size_t element_end)
+    {
+        std::vector<std::size_t> idx(self.GetNumOfDimension());
+
+        for(const auto element : self.mDesc.GetIndexRange(element_begin, element_end))
+        {
+            std::copy(element.index.begin(), element.index.end(), idx.begin());
+
+            if constexpr(std::is_invocable_v<F&, Self&, std::vector<std::size_t>&, std::size_t>)
+            {
+                f(self, idx, element.offset);
+            }
+            else
+            {
+                f(self, idx);
+            }
+        }
+    }
+
+    template <typename Self, typename F>
+    static void ParallelForEach_impl(Self& self, F& f, std::size_t num_thread)
+    {
+        parallel_for_each_range(
+            self.GetElementSize(), num_thread, [&self, &f](std::size_t begin, std::size_t end) {
+                ForEach_impl(self, f, begin, end);
+            });
+    }
 };
@@ -0,0 +1,417 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+#define CK_HOST_TYPE_CONVERT_X86 1
+#include <immintrin.h>
+#else
+#define CK_HOST_TYPE_CONVERT_X86 0
+#endif
+
+#include "ck/host_utility/parallel_for.hpp"
+#include "ck/utility/data_type.hpp"
+
+namespace ck {
+namespace utils {
+
+// Bulk conversion of host buffers, producing the same bits as ck::type_convert on each element.
+// float <-> half_t, float <-> bhalf_t and float <-> int8_t are vectorized (F16C for half_t, AVX2
+// otherwise) when the host CPU supports it, float <-> f8_t and float <-> bf8_t go through lookup
+// tables, other conversions go through type_convert.
+namespace detail {
+
+template <typename Y, typename X>
+void bulk_type_convert_scalar(const X* p_src, Y* p_dst, std::size_t n)
+{
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        p_dst[i] = ck::type_convert<Y>(p_src[i]);
+    }
+}
+
+// Conversion of float to 8-bit floats, indexed by the upper 16 bits of the float and whether its
+// lower 16 bits are not all 0. This is exact as the rounding boundaries of 8-bit floats, normal or
+// subnormal, have at most 5 significant bits: their lower 16 bits are 0.
+template <typename Y>
+const std::vector<uint8_t>& f8_from_float_table()
+{
+    static const std::vector<uint8_t> table = [] {
+        std::vector<uint8_t> t(std::size_t{2} << 16);
+
+        for(uint32_t upper = 0; upper < (uint32_t{1} << 16); ++upper)
+        {
+            for(uint32_t sticky = 0; sticky < 2; ++sticky)
+            {
+                const float x = bit_cast<float>(upper << 16 | sticky);
+
+                t[2 * upper + sticky] = bit_cast<uint8_t>(ck::type_convert<Y>(x));
+            }
+        }
+
+        return t;
+    }();
+
+    return table;
+}
+
+template <typename X>
+const std::array<float, 256>& f8_to_float_table()
+{
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> t;
+
+        for(uint32_t bits = 0; bits < 256; ++bits)
+        {
+            t[bits] = ck::type_convert<float>(bit_cast<X>(static_cast<uint8_t>(bits)));
+        }
+
+        return t;
+    }();
+
+    return table;
+}
+
+template <typename Y>
+void bulk_type_convert_f8_table(const float* p_src, Y* p_dst, std::size_t n)
+{
+    const uint8_t* table = f8_from_float_table<Y>().data();
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        const uint32_t bits = bit_cast<uint32_t>(p_src[i]);
+
+        p_dst[i] = bit_cast<Y>(table[(bits >> 15 & ~uint32_t{1}) | ((bits & 0xffff) != 0)]);
+    }
+}
+
+template <typename X>
+void bulk_type_convert_f8_table(const X* p_src, float* p_dst, std::size_t n)
+{
+    const float* table = f8_to_float_table<X>().data();
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        p_dst[i] = table[bit_cast<uint8_t>(p_src[i])];
+    }
+}
+
+#if CK_HOST_TYPE_CONVERT_X86
+inline bool host_supports_f16c()
+{
+    static const bool supported = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+
+    return supported;
+}
+
+inline bool host_supports_avx2()
+{
+    static const bool supported = __builtin_cpu_supports("avx2");
+
+    return supported;
+}
+
+// vcvtps2ph rounds to nearest even and quiets NaN keeping the upper payload bits, as the
+// software conversion of _Float16 does
+__attribute__((target("avx,f16c"))) inline void
+bulk_type_convert_f16c(const float* p_src, half_t* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i y = _mm256_cvtps_ph(_mm256_loadu_ps(p_src + i), _MM_FROUND_TO_NEAREST_INT);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i), y);
+    }
+
+    bulk_type_convert_scalar(p_src + i, p_dst + i, n - i);
+}
+
+__attribute__((target("avx,f16c"))) inline void
+bulk_type_convert_f16c(const half_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i));
+
+        _mm256_storeu_ps(p_dst + i, _mm256_cvtph_ps(x));
+    }
+
+    bulk_type_convert_scalar(p_src + i, p_dst + i, n - i);
+}
+
+// the integer rounding of type_convert<bhalf_t>, 8 lanes at a time. vcvtneps2bf16 of AVX-512 BF16
+// is not used: it flushes subnormals to zero and quiets signaling NaN, type_convert does neither
+__attribute__((target("avx2"))) inline void
+bulk_type_convert_avx2(const float* p_src, bhalf_t* p_dst, std::size_t n)
+{
+    const __m256i exponent_mask = _mm256_set1_epi32(0x7f800000);
+    const __m256i lower_mask    = _mm256_set1_epi32(0xffff);
+    const __m256i one           = _mm256_set1_epi32(1);
+    const __m256i rounding_bias = _mm256_set1_epi32(0x7fff);
+    const __m256i nan_bit       = _mm256_set1_epi32(0x10000);
+
+    std::size_t i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i));
+
+        // zero, subnormal or normal: round to nearest even
+        const __m256i lsb     = _mm256_and_si256(_mm256_srli_epi32(x, 16), one);
+        const __m256i rounded = _mm256_add_epi32(x, _mm256_add_epi32(rounding_bias, lsb));
+
+        // Inf or NaN: set the last bhalf_t mantissa bit when dropping lower bits, a NaN stays NaN
+        const __m256i lower_zero =
+            _mm256_cmpeq_epi32(_mm256_and_si256(x, lower_mask), _mm256_setzero_si256());
+        const __m256i inf_nan = _mm256_or_si256(x, _mm256_andnot_si256(lower_zero, nan_bit));
+
+        const __m256i is_inf_nan =
+            _mm256_cmpeq_epi32(_mm256_and_si256(x, exponent_mask), exponent_mask);
+
+        const __m256i y = _mm256_srli_epi32(_mm256_blendv_epi8(rounded, inf_nan, is_inf_nan), 16);
+
+        const __m128i y16 =
+            _mm_packus_epi32(_mm256_castsi256_si128(y), _mm256_extracti128_si256(y, 1));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_dst + i), y16);
+    }
+
+    bulk_type_convert_scalar(p_src + i, p_dst + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void
+bulk_type_convert_avx2(const bhalf_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_src + i));
+        const __m256i y = _mm256_slli_epi32(_mm256_cvtepu16_epi32(x), 16);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), y);
+    }
+
+    bulk_type_convert_scalar(p_src + i, p_dst + i, n - i);
+}
+
+// truncates toward zero and keeps the low byte, as the scalar conversion does on x86
+__attribute__((target("avx2"))) inline void
+bulk_type_convert_avx2(const float* p_src, int8_t* p_dst, std::size_t n)
+{
+    // byte 0 of each 32-bit lane, within each 128-bit half
+    const __m256i low_bytes = _mm256_setr_epi8(
+        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, // lower half
+        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1); // upper half
+
+    std::size_t i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m256i x = _mm256_cvttps_epi32(_mm256_loadu_ps(p_src + i));
+        const __m256i y = _mm256_shuffle_epi8(x, low_bytes);
+
+        const __m128i y8 =
+            _mm_unpacklo_epi32(_mm256_castsi256_si128(y), _mm256_extracti128_si256(y, 1));
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p_dst + i), y8);
+    }
+
+    bulk_type_convert_scalar(p_src + i, p_dst + i, n - i);
+}
+
+__attribute__((target("avx2"))) inline void
+bulk_type_convert_avx2(const int8_t* p_src, float* p_dst, std::size_t n)
+{
+    std::size_t i = 0;
+
+    for(; i + 8 <= n; i += 8)
+    {
+        const __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p_src + i));
+
+        _mm256_storeu_ps(p_dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(x)));
+    }
+
+    bulk_type_convert_scalar(p_src + i, p_dst + i, n - i);
+}
+#endif // CK_HOST_TYPE_CONVERT_X86
+
+} // namespace detail
+
+template <typename Y, typename X>
+void bulk_type_convert(const X* p_src, Y* p_dst, std::size_t n)
+{
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const float* p_src, half_t* p_dst, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_f16c())
+    {
+        detail::bulk_type_convert_f16c(p_src, p_dst, n);
+        return;
+    }
+#endif
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const half_t* p_src, float* p_dst, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_f16c())
+    {
+        detail::bulk_type_convert_f16c(p_src, p_dst, n);
+        return;
+    }
+#endif
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const float* p_src, bhalf_t* p_dst, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_avx2())
+    {
+        detail::bulk_type_convert_avx2(p_src, p_dst, n);
+        return;
+    }
+#endif
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const bhalf_t* p_src, float* p_dst, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_avx2())
+    {
+        detail::bulk_type_convert_avx2(p_src, p_dst, n);
+        return;
+    }
+#endif
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const float* p_src, int8_t* p_dst, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_avx2())
+    {
+        detail::bulk_type_convert_avx2(p_src, p_dst, n);
+        return;
+    }
+#endif
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const int8_t* p_src, float* p_dst, std::size_t n)
+{
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_avx2())
+    {
+        detail::bulk_type_convert_avx2(p_src, p_dst, n);
+        return;
+    }
+#endif
+    detail::bulk_type_convert_scalar(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const float* p_src, f8_t* p_dst, std::size_t n)
+{
+    detail::bulk_type_convert_f8_table(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const f8_t* p_src, float* p_dst, std::size_t n)
+{
+    detail::bulk_type_convert_f8_table(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const float* p_src, bf8_t* p_dst, std::size_t n)
+{
+    detail::bulk_type_convert_f8_table(p_src, p_dst, n);
+}
+
+inline void bulk_type_convert(const bf8_t* p_src, float* p_dst, std::size_t n)
+{
+    detail::bulk_type_convert_f8_table(p_src, p_dst, n);
+}
+
+// bulk_type_convert split across threads
+template <typename Y, typename X>
+void parallel_bulk_type_convert(const X* p_src,
+                                Y* p_dst,
+                                std::size_t n,
+                                std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    // below this, starting a thread costs more than the conversion
+    constexpr std::size_t min_work_per_thread = std::size_t{1} << 16;
+
+    num_thread = std::max(std::size_t{1}, std::min(num_thread, n / min_work_per_thread));
+
+    ck::parallel_for_each_range(n, num_thread, [=](std::size_t iw_begin, std::size_t iw_end) {
+        bulk_type_convert(p_src + iw_begin, p_dst + iw_begin, iw_end - iw_begin);
+    });
+}
+
+// pointers and std::vector iterators, whose elements can be converted in bulk
+template <typename Iter, typename = void>
+struct is_contiguous_iterator : std::is_pointer<Iter>
+{
+};
+
+template <typename Iter>
+struct is_contiguous_iterator<
+    Iter,
+    std::enable_if_t<std::is_same_v<
+        Iter,
+        typename std::vector<typename std::iterator_traits<Iter>::value_type>::iterator>>>
+    : std::bool_constant<!std::is_same_v<typename std::iterator_traits<Iter>::value_type, bool>>
+{
+};
+
+// Assigns type_convert<T>(gen()) to [first, last), the values of gen being converted in chunks
+template <typename T, typename Iter, typename Generator>
+void generate_bulk_type_convert(Iter first, Iter last, Generator&& gen)
+{
+    static_assert(is_contiguous_iterator<Iter>::value &&
+                      std::is_same_v<typename std::iterator_traits<Iter>::value_type, T>,
+                  "wrong! not a contiguous range of T");
+
+    using X = std::decay_t<decltype(gen())>;
+
+    constexpr std::size_t chunk_size = 1024;
+
+    std::array<X, chunk_size> chunk;
+
+    const std::size_t n = std::distance(first, last);
+
+    for(std::size_t i = 0; i < n; i += chunk_size)
+    {
+        const std::size_t size = std::min(chunk_size, n - i);
+
+        for(std::size_t j = 0; j < size; ++j)
+        {
+            chunk[j] = gen();
+        }
+
+        bulk_type_convert(chunk.data(), std::addressof(*(first + i)), size);
+    }
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,450 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_type_convert.hpp"
+
+namespace ck {
+namespace utils {
+
+// Signed 4-bit integers packed two per byte: element i is in the low nibble of byte i / 2 when i
+// is even, in the high nibble when i is odd. Elements are read as int8_t in [-8, 7], and written
+// keeping their low 4 bits, as a conversion to int4_t does.
+inline int8_t get_packed_int4(const uint8_t* p_data, std::size_t i)
+{
+    const uint8_t nibble = (i % 2 == 0 ? p_data[i / 2] : p_data[i / 2] >> 4) & 0x0f;
+
+    return static_cast<int8_t>((nibble ^ 0x08) - 0x08);
+}
+
+inline void set_packed_int4(uint8_t* p_data, std::size_t i, int8_t value)
+{
+    const uint8_t nibble = static_cast<uint8_t>(value) & 0x0f;
+
+    p_data[i / 2] =
+        i % 2 == 0 ? (p_data[i / 2] & 0xf0) | nibble : (p_data[i / 2] & 0x0f) | (nibble << 4);
+}
+
+namespace detail {
+
+#if CK_HOST_TYPE_CONVERT_X86
+// 64 elements from 32 bytes at a time
+__attribute__((target("avx2"))) inline std::size_t
+unpack_int4_avx2(const uint8_t* p_src, std::size_t num_byte, int8_t* p_dst)
+{
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    const __m256i sign_bit    = _mm256_set1_epi8(0x08);
+
+    std::size_t i = 0;
+
+    for(; i + 32 <= num_byte; i += 32)
+    {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + i));
+
+        // sign extension of a nibble: (v ^ 8) - 8
+        const __m256i lo = _mm256_sub_epi8(
+            _mm256_xor_si256(_mm256_and_si256(x, nibble_mask), sign_bit), sign_bit);
+        const __m256i hi = _mm256_sub_epi8(
+            _mm256_xor_si256(_mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask), sign_bit),
+            sign_bit);
+
+        // interleave within 128-bit halves, then put the halves in order
+        const __m256i a = _mm256_unpacklo_epi8(lo, hi);
+        const __m256i b = _mm256_unpackhi_epi8(lo, hi);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + 2 * i),
+                            _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + 2 * i + 32),
+                            _mm256_permute2x128_si256(a, b, 0x31));
+    }
+
+    return i;
+}
+
+// 32 bytes from 64 elements at a time
+__attribute__((target("avx2"))) inline std::size_t
+pack_int4_avx2(const int8_t* p_src, std::size_t num_byte, uint8_t* p_dst)
+{
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0f);
+    const __m256i low_byte    = _mm256_set1_epi16(0x00ff);
+
+    std::size_t i = 0;
+
+    for(; i + 32 <= num_byte; i += 32)
+    {
+        __m256i w[2];
+
+        for(int j = 0; j < 2; ++j)
+        {
+            const __m256i x = _mm256_and_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_src + 2 * i + 32 * j)),
+                nibble_mask);
+
+            // the odd element of each 16-bit pair moves to the high nibble of the low byte
+            w[j] = _mm256_and_si256(_mm256_or_si256(x, _mm256_srli_epi16(x, 4)), low_byte);
+        }
+
+        const __m256i y = _mm256_permute4x64_epi64(_mm256_packus_epi16(w[0], w[1]), 0xd8);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p_dst + i), y);
+    }
+
+    return i;
+}
+#endif // CK_HOST_TYPE_CONVERT_X86
+
+} // namespace detail
+
+// Unpacks the n elements starting at element first
+inline void unpack_int4(const uint8_t* p_src, std::size_t first, std::size_t n, int8_t* p_dst)
+{
+    std::size_t i = 0;
+
+    if(first % 2 != 0 && n > 0)
+    {
+        p_dst[i++] = get_packed_int4(p_src, first);
+    }
+
+    // whole bytes
+    const uint8_t* p_src_byte  = p_src + (first + i) / 2;
+    const std::size_t num_byte = (n - i) / 2;
+
+    std::size_t num_done_byte = 0;
+
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_avx2())
+    {
+        num_done_byte = detail::unpack_int4_avx2(p_src_byte, num_byte, p_dst + i);
+    }
+#endif
+
+    for(std::size_t j = 2 * num_done_byte; j < 2 * num_byte; ++j)
+    {
+        p_dst[i + j] = get_packed_int4(p_src_byte, j);
+    }
+
+    for(i += 2 * num_byte; i < n; ++i)
+    {
+        p_dst[i] = get_packed_int4(p_src, first + i);
+    }
+}
+
+// Packs n elements starting at element first, the other nibbles of the bytes are kept
+inline void pack_int4(const int8_t* p_src, std::size_t n, uint8_t* p_dst, std::size_t first)
+{
+    std::size_t i = 0;
+
+    if(first % 2 != 0 && n > 0)
+    {
+        set_packed_int4(p_dst, first, p_src[i++]);
+    }
+
+    // whole bytes
+    uint8_t* p_dst_byte        = p_dst + (first + i) / 2;
+    const std::size_t num_byte = (n - i) / 2;
+
+    std::size_t num_done_byte = 0;
+
+#if CK_HOST_TYPE_CONVERT_X86
+    if(detail::host_supports_avx2())
+    {
+        num_done_byte = detail::pack_int4_avx2(p_src + i, num_byte, p_dst_byte);
+    }
+#endif
+
+    for(std::size_t j = num_done_byte; j < num_byte; ++j)
+    {
+        p_dst_byte[j] = (static_cast<uint8_t>(p_src[i + 2 * j]) & 0x0f) |
+                        (static_cast<uint8_t>(p_src[i + 2 * j + 1]) << 4);
+    }
+
+    for(i += 2 * num_byte; i < n; ++i)
+    {
+        set_packed_int4(p_dst, first + i, p_src[i]);
+    }
+}
+
+} // namespace utils
+} // namespace ck
+
+// Host tensor of signed 4-bit integers, two per byte in the element space of its descriptor.
+// Elements are read as int8_t, and written through a proxy reference.
+struct PackedInt4Tensor
+{
+    using Descriptor = HostTensorDescriptor;
+    using Data       = std::vector<uint8_t>;
+
+    // reference to a nibble
+    class Reference
+    {
+        public:
+        Reference(uint8_t* p_data, std::size_t i) : p_data_{p_data}, i_{i} {}
+
+        Reference(const Reference&) = default;
+
+        operator int8_t() const { return ck::utils::get_packed_int4(p_data_, i_); }
+
+        Reference& operator=(int8_t value)
+        {
+            ck::utils::set_packed_int4(p_data_, i_, value);
+
+            return *this;
+        }
+
+        Reference& operator=(const Reference& other) { return *this = static_cast<int8_t>(other); }
+
+        private:
+        uint8_t* p_data_;
+        std::size_t i_;
+    };
+
+    // random access iterator over the element space
+    template <bool IsConst>
+    class Iterator
+    {
+        public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = int8_t;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::conditional_t<IsConst, int8_t, Reference>;
+        using DataPointer       = std::conditional_t<IsConst, const uint8_t*, uint8_t*>;
+
+        Iterator() = default;
+
+        Iterator(DataPointer p_data, std::size_t i) : p_data_{p_data}, i_{i} {}
+
+        reference operator*() const
+        {
+            if constexpr(IsConst)
+            {
+                return ck::utils::get_packed_int4(p_data_, i_);
+            }
+            else
+            {
+                return Reference{p_data_, i_};
+            }
+        }
+
+        reference operator[](difference_type d) const { return *(*this + d); }
+
+        Iterator& operator++()
+        {
+            ++i_;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator tmp = *this;
+            ++i_;
+            return tmp;
+        }
+
+        Iterator& operator--()
+        {
+            --i_;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator tmp = *this;
+            --i_;
+            return tmp;
+        }
+
+        Iterator& operator+=(difference_type d)
+        {
+            i_ += d;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type d)
+        {
+            i_ -= d;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type d) { return it += d; }
+
+        friend Iterator operator+(difference_type d, Iterator it) { return it += d; }
+
+        friend Iterator operator-(Iterator it, difference_type d) { return it -= d; }
+
+        friend difference_type operator-(const Iterator& a, const Iterator& b)
+        {
+            return static_cast<difference_type>(a.i_) - static_cast<difference_type>(b.i_);
+        }
+
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.i_ == b.i_; }
+
+        friend bool operator!=(const Iterator& a, const Iterator& b) { return a.i_ != b.i_; }
+
+        friend bool operator<(const Iterator& a, const Iterator& b) { return a.i_ < b.i_; }
+
+        friend bool operator>(const Iterator& a, const Iterator& b) { return a.i_ > b.i_; }
+
+        friend bool operator<=(const Iterator& a, const Iterator& b) { return a.i_ <= b.i_; }
+
+        friend bool operator>=(const Iterator& a, const Iterator& b) { return a.i_ >= b.i_; }
+
+        private:
+        DataPointer p_data_ = nullptr;
+        std::size_t i_      = 0;
+    };
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    template <typename X>
+    PackedInt4Tensor(std::initializer_list<X> lens)
+        : mDesc(lens), mData(GetPackedSize(mDesc.GetElementSpaceSize()))
+    {
+    }
+
+    template <typename X, typename Y>
+    PackedInt4Tensor(std::initializer_list<X> lens, std::initializer_list<Y> strides)
+        : mDesc(lens, strides), mData(GetPackedSize(mDesc.GetElementSpaceSize()))
+    {
+    }
+
+    template <typename Lengths>
+    PackedInt4Tensor(const Lengths& lens)
+        : mDesc(lens), mData(GetPackedSize(mDesc.GetElementSpaceSize()))
+    {
+    }
+
+    template <typename Lengths, typename Strides>
+    PackedInt4Tensor(const Lengths& lens, const Strides& strides)
+        : mDesc(lens, strides), mData(GetPackedSize(mDesc.GetElementSpaceSize()))
+    {
+    }
+
+    PackedInt4Tensor(const Descriptor& desc)
+        : mDesc(desc), mData(GetPackedSize(mDesc.GetElementSpaceSize()))
+    {
+    }
+
+    // packs the element space of a tensor of int8_t, int4_t or any type converting to int8_t
+    template <typename T>
+    explicit PackedInt4Tensor(const Tensor<T>& other) : PackedInt4Tensor(other.mDesc)
+    {
+        if constexpr(std::is_same_v<T, int8_t>)
+        {
+            ck::utils::pack_int4(other.mData.data(), other.mData.size(), mData.data(), 0);
+        }
+        else
+        {
+            const auto values = other.template CopyAsType<int8_t>();
+
+            ck::utils::pack_int4(values.mData.data(), values.mData.size(), mData.data(), 0);
+        }
+    }
+
+    PackedInt4Tensor()                        = delete;
+    PackedInt4Tensor(const PackedInt4Tensor&) = default;
+    PackedInt4Tensor(PackedInt4Tensor&&)      = default;
+
+    ~PackedInt4Tensor() = default;
+
+    PackedInt4Tensor& operator=(const PackedInt4Tensor&) = default;
+    PackedInt4Tensor& operator=(PackedInt4Tensor&&) = default;
+
+    // unpacks the element space
+    template <typename OutT>
+    Tensor<OutT> CopyAsType() const
+    {
+        Tensor<int8_t> values(mDesc);
+
+        ck::utils::unpack_int4(mData.data(), 0, values.mData.size(), values.mData.data());
+
+        if constexpr(std::is_same_v<OutT, int8_t>)
+        {
+            return values;
+        }
+        else
+        {
+            return values.template CopyAsType<OutT>();
+        }
+    }
+
+    // unpacks the n elements from offset, stride elements apart
+    void GetElements(std::size_t offset, std::size_t stride, std::size_t n, int8_t* p_dst) const
+    {
+        if(stride == 1)
+        {
+            ck::utils::unpack_int4(mData.data(), offset, n, p_dst);
+        }
+        else
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                p_dst[i] = ck::utils::get_packed_int4(mData.data(), offset + i * stride);
+            }
+        }
+    }
+
+    static std::size_t GetPackedSize(std::size_t num_element) { return (num_element + 1) / 2; }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    std::size_t GetElementSpaceSizeInBytes() const { return mData.size(); }
+
+    void SetZero() { std::fill(mData.begin(), mData.end(), uint8_t{0}); }
+
+    template <typename... Is>
+    Reference operator()(Is... is)
+    {
+        return Reference{mData.data(), mDesc.GetOffsetFromMultiIndex(is...)};
+    }
+
+    template <typename... Is>
+    int8_t operator()(Is... is) const
+    {
+        return ck::utils::get_packed_int4(mData.data(), mDesc.GetOffsetFromMultiIndex(is...));
+    }
+
+    Reference operator()(std::vector<std::size_t> idx)
+    {
+        return Reference{mData.data(), mDesc.GetOffsetFromMultiIndex(idx)};
+    }
+
+    int8_t operator()(std::vector<std::size_t> idx) const
+    {
+        return ck::utils::get_packed_int4(mData.data(), mDesc.GetOffsetFromMultiIndex(idx));
+    }
+
+    iterator begin() { return iterator{mData.data(), 0}; }
+
+    iterator end() { return iterator{mData.data(), size()}; }
+
+    const_iterator begin() const { return const_iterator{mData.data(), 0}; }
+
+    const_iterator end() const { return const_iterator{mData.data(), size()}; }
+
+    Data::pointer data() { return mData.data(); }
+
+    Data::const_pointer data() const { return mData.data(); }
+
+    // number of elements of the element space
+    std::size_t size() const { return mDesc.GetElementSpaceSize(); }
+
+    Descriptor mDesc;
+    Data mData;
+};
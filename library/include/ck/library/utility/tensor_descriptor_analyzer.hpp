@@ -0,0 +1,712 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/multi_index_transform.hpp"
+#include "ck/tensor_description/tensor_adaptor.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Host evaluation of the transform chain of a TensorDescriptor or a TensorAdaptor, and analysis of
+// the vector accesses the chain allows along one of its top (visible) dimensions. A descriptor maps
+// its visible index to an offset. An adaptor with a single bottom dimension is handled the same
+// way, its bottom index being the offset.
+
+namespace detail {
+
+template <typename TransformChain>
+struct transform_chain_traits;
+
+template <typename Transforms,
+          typename LowerDimensionIdss,
+          typename UpperDimensionIdss,
+          typename VisibleDimensionIds,
+          typename ElementSpaceSize>
+struct transform_chain_traits<TensorDescriptor<Transforms,
+                                               LowerDimensionIdss,
+                                               UpperDimensionIdss,
+                                               VisibleDimensionIds,
+                                               ElementSpaceSize>>
+{
+    static constexpr bool is_descriptor_ = true;
+
+    using LowerIdss = LowerDimensionIdss;
+    using UpperIdss = UpperDimensionIdss;
+    using TopIds    = VisibleDimensionIds;
+
+    // hidden dimension 0 is the offset
+    using BottomIds = Sequence<0>;
+};
+
+template <typename Transforms,
+          typename LowerDimensionHiddenIdss,
+          typename UpperDimensionHiddenIdss,
+          typename BottomDimensionHiddenIds,
+          typename TopDimensionHiddenIds>
+struct transform_chain_traits<TensorAdaptor<Transforms,
+                                            LowerDimensionHiddenIdss,
+                                            UpperDimensionHiddenIdss,
+                                            BottomDimensionHiddenIds,
+                                            TopDimensionHiddenIds>>
+{
+    static constexpr bool is_descriptor_ = false;
+
+    using LowerIdss = LowerDimensionHiddenIdss;
+    using UpperIdss = UpperDimensionHiddenIdss;
+    using TopIds    = TopDimensionHiddenIds;
+    using BottomIds = BottomDimensionHiddenIds;
+};
+
+template <typename TransformChain>
+using transform_chain_traits_t = transform_chain_traits<remove_cvref_t<TransformChain>>;
+
+// hidden index of one top index, and whether each transform maps it to a valid lower index
+template <index_t NDimHidden, index_t NTransform>
+struct TransformChainEvaluation
+{
+    std::array<index_t, NDimHidden> idx_hidden_;
+    std::array<bool, NTransform> is_valid_;
+
+    bool IsValid() const
+    {
+        for(bool is_valid : is_valid_)
+        {
+            if(!is_valid)
+                return false;
+        }
+
+        return true;
+    }
+};
+
+template <std::size_t NDim>
+MultiIndex<NDim> to_multi_index(const std::array<index_t, NDim>& idx)
+{
+    MultiIndex<NDim> multi_idx;
+
+    static_for<0, NDim, 1>{}([&](auto i) { multi_idx(i) = idx[i]; });
+
+    return multi_idx;
+}
+
+template <typename TransformChain, std::size_t NDimTop>
+auto evaluate_transform_chain(const TransformChain& chain, const std::array<index_t, NDimTop>& idx)
+{
+    using Traits = transform_chain_traits_t<TransformChain>;
+
+    constexpr index_t ntransform  = TransformChain::GetNumOfTransform();
+    constexpr index_t ndim_hidden = TransformChain::GetNumOfHiddenDimension();
+
+    static_assert(static_cast<index_t>(NDimTop) == Traits::TopIds::Size(),
+                  "wrong! # of dimension inconsistent");
+
+    TransformChainEvaluation<ndim_hidden, ntransform> eval;
+
+    MultiIndex<ndim_hidden> idx_hidden;
+
+    set_container_subset(idx_hidden, typename Traits::TopIds{}, to_multi_index(idx));
+
+    static_for<ntransform, 0, -1>{}([&](auto itran_p1) {
+        constexpr auto itran    = itran_p1 - Number<1>{};
+        const auto& tran        = chain.GetTransforms().At(itran);
+        constexpr auto dims_low = typename Traits::LowerIdss{}.At(itran);
+        constexpr auto dims_up  = typename Traits::UpperIdss{}.At(itran);
+
+        const auto idx_up = get_container_subset(idx_hidden, dims_up);
+
+        MultiIndex<dims_low.Size()> idx_low;
+
+        tran.CalculateLowerIndex(idx_low, idx_up);
+
+        set_container_subset(idx_hidden, dims_low, idx_low);
+
+        eval.is_valid_[itran] = tran.IsValidUpperIndexMappedToValidLowerIndex(idx_up);
+    });
+
+    static_for<0, ndim_hidden, 1>{}([&](auto i) { eval.idx_hidden_[i] = idx_hidden[i]; });
+
+    return eval;
+}
+
+} // namespace detail
+
+template <typename LowLength>
+const char* get_transform_name(const PassThrough<LowLength>&)
+{
+    return "PassThrough";
+}
+
+template <typename LowLength,
+          typename LeftPadLength,
+          typename RightPadLength,
+          bool SkipIsValidCheck>
+const char*
+get_transform_name(const Pad<LowLength, LeftPadLength, RightPadLength, SkipIsValidCheck>&)
+{
+    return "Pad";
+}
+
+template <typename LowLength, typename LeftPadLength, bool SkipIsValidCheck>
+const char* get_transform_name(const LeftPad<LowLength, LeftPadLength, SkipIsValidCheck>&)
+{
+    return "LeftPad";
+}
+
+template <typename LowLength, typename RightPadLength, bool SkipIsValidCheck>
+const char* get_transform_name(const RightPad<LowLength, RightPadLength, SkipIsValidCheck>&)
+{
+    return "RightPad";
+}
+
+template <typename UpLengths, typename Coefficients, bool B>
+const char* get_transform_name(const Embed<UpLengths, Coefficients, B>&)
+{
+    return "Embed";
+}
+
+template <typename LowLengths>
+const char* get_transform_name(const Merge_v1_carry_check<LowLengths>&)
+{
+    return "Merge_v1_carry_check";
+}
+
+template <typename LowLengths>
+const char* get_transform_name(const Merge_v2_magic_division<LowLengths>&)
+{
+    return "Merge_v2_magic_division";
+}
+
+template <typename LowLengths>
+const char* get_transform_name(const Merge_v2r2_magic_division<LowLengths>&)
+{
+    return "Merge_v2r2_magic_division";
+}
+
+template <typename LowLengths>
+const char* get_transform_name(const Merge_v3_division_mod<LowLengths>&)
+{
+    return "Merge_v3_division_mod";
+}
+
+template <typename UpLengths, bool Use24BitIntegerCalculation>
+const char* get_transform_name(const UnMerge<UpLengths, Use24BitIntegerCalculation>&)
+{
+    return "UnMerge";
+}
+
+template <typename LowerIndex>
+const char* get_transform_name(const Freeze<LowerIndex>&)
+{
+    return "Freeze";
+}
+
+template <typename UpperLength>
+const char* get_transform_name(const Insert<UpperLength>&)
+{
+    return "Insert";
+}
+
+template <typename VectorSize, typename UpLength>
+const char* get_transform_name(const Vectorize<VectorSize, UpLength>&)
+{
+    return "Vectorize";
+}
+
+template <typename LowLength, typename SliceBegin, typename SliceEnd>
+const char* get_transform_name(const Slice<LowLength, SliceBegin, SliceEnd>&)
+{
+    return "Slice";
+}
+
+template <typename Modulus, typename UpLength>
+const char* get_transform_name(const Modulo<Modulus, UpLength>&)
+{
+    return "Modulo";
+}
+
+template <typename Transform>
+const char* get_transform_name(const Transform&)
+{
+    return "Unknown";
+}
+
+// box [origin_, origin_ + lengths_) of the top index space
+template <index_t NDim>
+struct TransformChainTile
+{
+    std::array<index_t, NDim> origin_;
+    std::array<index_t, NDim> lengths_;
+
+    long_index_t GetElementSize() const
+    {
+        long_index_t size = 1;
+
+        for(index_t length : lengths_)
+        {
+            size *= length;
+        }
+
+        return size;
+    }
+};
+
+// whole visible index space of a descriptor
+template <typename TensorDesc>
+auto make_transform_chain_tile(const TensorDesc& desc)
+{
+    constexpr index_t ndim = TensorDesc::GetNumOfDimension();
+
+    TransformChainTile<ndim> tile{};
+
+    static_for<0, ndim, 1>{}([&](auto i) { tile.lengths_[i] = desc.GetLength(i); });
+
+    return tile;
+}
+
+// Calls f(idx, offset, is_valid) for every top index of the tile, in lexicographic order.
+// is_valid is false when a transform maps idx out of its lower index space (padding). Descriptors
+// are walked by moving a tensor coordinate, the way the threadwise transfers do, so that only the
+// transforms whose upper index changes are re-evaluated.
+template <typename TransformChain, index_t NDim, typename F>
+void for_each_tile_offset(const TransformChain& chain, const TransformChainTile<NDim>& tile, F f)
+{
+    using Traits = detail::transform_chain_traits_t<TransformChain>;
+
+    static_assert(NDim == Traits::TopIds::Size() && NDim > 0,
+                  "wrong! # of dimension inconsistent");
+    static_assert(Traits::BottomIds::Size() == 1, "wrong! offset needs a single bottom dimension");
+
+    if(tile.GetElementSize() == 0)
+    {
+        return;
+    }
+
+    std::array<index_t, NDim> idx = tile.origin_;
+
+    // lexicographic increment, returns the dimension incremented, -1 past the end
+    auto next = [&]() {
+        index_t d = NDim - 1;
+
+        while(d >= 0 && idx[d] == tile.origin_[d] + tile.lengths_[d] - 1)
+        {
+            idx[d] = tile.origin_[d];
+            --d;
+        }
+
+        if(d >= 0)
+        {
+            ++idx[d];
+        }
+
+        return d;
+    };
+
+    if constexpr(Traits::is_descriptor_)
+    {
+        using Step = decltype(make_tensor_coordinate_step(chain, MultiIndex<NDim>{}));
+
+        // incrementing dimension d rewinds the dimensions after it
+        std::array<Step, NDim> steps;
+
+        for(index_t d = 0; d < NDim; ++d)
+        {
+            std::array<index_t, NDim> diff{};
+
+            diff[d] = 1;
+
+            for(index_t j = d + 1; j < NDim; ++j)
+            {
+                diff[j] = 1 - tile.lengths_[j];
+            }
+
+            steps[d] = make_tensor_coordinate_step(chain, detail::to_multi_index(diff));
+        }
+
+        auto coord = make_tensor_coordinate(chain, detail::to_multi_index(idx));
+
+        while(true)
+        {
+            f(static_cast<const std::array<index_t, NDim>&>(idx),
+              static_cast<long_index_t>(coord.GetOffset()),
+              coordinate_has_valid_offset_assuming_visible_index_is_valid(chain, coord));
+
+            const index_t d = next();
+
+            if(d < 0)
+                break;
+
+            move_tensor_coordinate(chain, coord, steps[d]);
+        }
+    }
+    else
+    {
+        constexpr auto bottom_id = Traits::BottomIds::At(Number<0>{});
+
+        while(true)
+        {
+            const auto eval = detail::evaluate_transform_chain(chain, idx);
+
+            f(static_cast<const std::array<index_t, NDim>&>(idx),
+              static_cast<long_index_t>(eval.idx_hidden_[bottom_id]),
+              eval.IsValid());
+
+            if(next() < 0)
+                break;
+        }
+    }
+}
+
+// what stops a vector from being a single access
+enum struct VectorAccessBlocker
+{
+    None,       // the longest vector tried is supported
+    TileLength, // the tile length along the dimension is not a multiple of the vector length
+    Validity,   // part of the vector is padding, or out of a slice
+    NonAffine,  // a transform, e.g. merge or modulo, breaks the index progression along the vector
+    Stride,     // the offsets along the vector are not contiguous
+    Alignment,  // the first offset of the vector is not a multiple of the vector length
+};
+
+inline const char* get_vector_access_blocker_name(VectorAccessBlocker blocker)
+{
+    switch(blocker)
+    {
+    case VectorAccessBlocker::None: return "None";
+    case VectorAccessBlocker::TileLength: return "TileLength";
+    case VectorAccessBlocker::Validity: return "Validity";
+    case VectorAccessBlocker::NonAffine: return "NonAffine";
+    case VectorAccessBlocker::Stride: return "Stride";
+    case VectorAccessBlocker::Alignment: return "Alignment";
+    }
+
+    return "Unknown";
+}
+
+struct VectorAccessAnalyzerConfig
+{
+    index_t max_vector_length_ = 16;
+
+    // require the first offset of a vector to be a multiple of the vector length
+    bool check_alignment_ = true;
+};
+
+struct VectorAccessAnalysis
+{
+    index_t dim_ = 0;
+
+    // longest power-of-2 vector along dim_ that is a single access everywhere in the tile
+    index_t max_vector_length_ = 1;
+
+    // why a vector of twice max_vector_length_ is not, for the first such vector of the tile
+    VectorAccessBlocker blocker_ = VectorAccessBlocker::None;
+    std::vector<index_t> blocked_vector_origin_;
+
+    // for Validity and NonAffine: the transform it happens in, counted from the first transform of
+    // the chain
+    index_t blocking_transform_ = -1;
+    std::string blocking_transform_name_;
+
+    // transforms dim_ goes through, from the top
+    std::vector<std::string> transform_path_;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const VectorAccessAnalysis& analysis)
+{
+    os << "dim " << analysis.dim_ << ": max vector length " << analysis.max_vector_length_;
+
+    if(analysis.blocker_ != VectorAccessBlocker::None)
+    {
+        os << ", " << 2 * analysis.max_vector_length_ << " blocked by "
+           << get_vector_access_blocker_name(analysis.blocker_);
+
+        if(analysis.blocking_transform_ >= 0)
+        {
+            os << " in " << analysis.blocking_transform_name_ << " (transform "
+               << analysis.blocking_transform_ << ")";
+        }
+
+        if(!analysis.blocked_vector_origin_.empty())
+        {
+            os << " at {";
+
+            for(std::size_t i = 0; i < analysis.blocked_vector_origin_.size(); ++i)
+            {
+                os << (i == 0 ? "" : ", ") << analysis.blocked_vector_origin_[i];
+            }
+
+            os << "}";
+        }
+    }
+
+    os << ", path:";
+
+    for(const auto& name : analysis.transform_path_)
+    {
+        os << " " << name;
+    }
+
+    return os;
+}
+
+namespace detail {
+
+template <typename TransformChain>
+std::vector<std::string> get_transform_path(const TransformChain& chain, index_t dim)
+{
+    using Traits = transform_chain_traits_t<TransformChain>;
+
+    constexpr index_t ntransform  = TransformChain::GetNumOfTransform();
+    constexpr index_t ndim_hidden = TransformChain::GetNumOfHiddenDimension();
+
+    std::vector<std::string> path;
+
+    std::array<bool, ndim_hidden> depends{};
+
+    depends[Traits::TopIds::At(dim)] = true;
+
+    static_for<ntransform, 0, -1>{}([&](auto itran_p1) {
+        constexpr auto itran    = itran_p1 - Number<1>{};
+        constexpr auto dims_low = typename Traits::LowerIdss{}.At(itran);
+        constexpr auto dims_up  = typename Traits::UpperIdss{}.At(itran);
+
+        bool on_path = false;
+
+        static_for<0, dims_up.Size(), 1>{}([&](auto i) { on_path |= depends[dims_up[i]]; });
+
+        if(on_path)
+        {
+            path.push_back(get_transform_name(chain.GetTransforms().At(itran)));
+
+            static_for<0, dims_low.Size(), 1>{}([&](auto i) { depends[dims_low[i]] = true; });
+        }
+    });
+
+    return path;
+}
+
+// Walks the transforms from the top with the hidden indices of the elements of a blocked vector.
+// For a Validity blocker, finds the first transform whose validity is not uniform along the vector.
+// For a Stride blocker, finds the first transform whose lower index is not an arithmetic
+// progression along the vector, which makes it a NonAffine blocker. A transform not on the path of
+// the vector has a constant upper index along it, so it is never reported.
+template <typename TransformChain, typename Evaluation>
+void diagnose_vector_access(const TransformChain& chain,
+                            const std::vector<Evaluation>& evals,
+                            VectorAccessAnalysis& analysis)
+{
+    using Traits = transform_chain_traits_t<TransformChain>;
+
+    constexpr index_t ntransform = TransformChain::GetNumOfTransform();
+
+    auto is_progression = [&](index_t id) {
+        const index_t step = evals[1].idx_hidden_[id] - evals[0].idx_hidden_[id];
+
+        for(std::size_t k = 2; k < evals.size(); ++k)
+        {
+            const index_t diff = evals[k].idx_hidden_[id] - evals[0].idx_hidden_[id];
+
+            if(diff != static_cast<index_t>(k) * step)
+                return false;
+        }
+
+        return true;
+    };
+
+    static_for<ntransform, 0, -1>{}([&](auto itran_p1) {
+        constexpr auto itran    = itran_p1 - Number<1>{};
+        constexpr auto dims_low = typename Traits::LowerIdss{}.At(itran);
+
+        if(analysis.blocking_transform_ >= 0)
+            return;
+
+        bool is_blocking = false;
+
+        if(analysis.blocker_ == VectorAccessBlocker::Validity)
+        {
+            for(const auto& eval : evals)
+            {
+                is_blocking |= eval.is_valid_[itran] != evals[0].is_valid_[itran];
+            }
+        }
+        else
+        {
+            static_for<0, dims_low.Size(), 1>{}(
+                [&](auto i) { is_blocking |= !is_progression(dims_low[i]); });
+        }
+
+        if(is_blocking)
+        {
+            if(analysis.blocker_ == VectorAccessBlocker::Stride)
+            {
+                analysis.blocker_ = VectorAccessBlocker::NonAffine;
+            }
+
+            analysis.blocking_transform_      = itran;
+            analysis.blocking_transform_name_ = get_transform_name(chain.GetTransforms().At(itran));
+        }
+    });
+}
+
+} // namespace detail
+
+// Proves on the host the longest power-of-2 vector along top dimension dim that is a single
+// access for every vector of the tile: the tile is cut along dim into vectors starting at
+// tile.origin_[dim], and each vector must be either all padding, or all valid with contiguous
+// offsets (aligned to the vector length if config.check_alignment_). When a longer vector is
+// blocked, reports the first blocked vector, and for padding, merge or modulo chains the transform
+// responsible.
+template <typename TransformChain, index_t NDim>
+VectorAccessAnalysis analyze_vector_access(const TransformChain& chain,
+                                           index_t dim,
+                                           const TransformChainTile<NDim>& tile,
+                                           const VectorAccessAnalyzerConfig& config = {})
+{
+    if(dim < 0 || dim >= NDim)
+    {
+        throw std::runtime_error("wrong! dim out of range");
+    }
+
+    VectorAccessAnalysis analysis;
+
+    analysis.dim_            = dim;
+    analysis.transform_path_ = detail::get_transform_path(chain, dim);
+
+    // offsets of the tile, in lexicographic order
+    const auto size = static_cast<std::size_t>(tile.GetElementSize());
+
+    std::vector<long_index_t> offsets;
+    std::vector<bool> is_valid;
+
+    offsets.reserve(size);
+    is_valid.reserve(size);
+
+    for_each_tile_offset(chain, tile, [&](const auto&, long_index_t offset, bool valid) {
+        offsets.push_back(offset);
+        is_valid.push_back(valid);
+    });
+
+    std::size_t inner_size = 1;
+
+    for(index_t d = dim + 1; d < NDim; ++d)
+    {
+        inner_size *= static_cast<std::size_t>(tile.lengths_[d]);
+    }
+
+    const index_t length = tile.lengths_[dim];
+
+    // first vector of vector_length elements that is not a single access, size if none
+    auto find_blocked_vector = [&](index_t vector_length, VectorAccessBlocker& blocker) {
+        const auto n = static_cast<std::size_t>(vector_length);
+
+        for(std::size_t p = 0; p < size; ++p)
+        {
+            if((p / inner_size) % static_cast<std::size_t>(length) % n != 0)
+                continue;
+
+            for(std::size_t k = 1; k < n; ++k)
+            {
+                const std::size_t q = p + k * inner_size;
+
+                if(is_valid[q] != is_valid[p])
+                {
+                    blocker = VectorAccessBlocker::Validity;
+                    return p;
+                }
+
+                if(is_valid[p] && offsets[q] != offsets[p] + static_cast<long_index_t>(k))
+                {
+                    blocker = VectorAccessBlocker::Stride;
+                    return p;
+                }
+            }
+
+            if(is_valid[p] && config.check_alignment_ && offsets[p] % vector_length != 0)
+            {
+                blocker = VectorAccessBlocker::Alignment;
+                return p;
+            }
+        }
+
+        return size;
+    };
+
+    for(index_t vector_length = 2; vector_length <= config.max_vector_length_; vector_length *= 2)
+    {
+        if(length % vector_length != 0)
+        {
+            analysis.blocker_ = VectorAccessBlocker::TileLength;
+            break;
+        }
+
+        const std::size_t p = find_blocked_vector(vector_length, analysis.blocker_);
+
+        if(p == size)
+        {
+            analysis.max_vector_length_ = vector_length;
+            continue;
+        }
+
+        // top index of the blocked vector
+        std::array<index_t, NDim> idx;
+
+        std::size_t rest = p;
+
+        for(index_t d = NDim - 1; d >= 0; --d)
+        {
+            const auto d_length = static_cast<std::size_t>(tile.lengths_[d]);
+
+            idx[d] = tile.origin_[d] + static_cast<index_t>(rest % d_length);
+            rest /= d_length;
+        }
+
+        analysis.blocked_vector_origin_.assign(idx.begin(), idx.end());
+
+        if(analysis.blocker_ != VectorAccessBlocker::Alignment)
+        {
+            std::vector<decltype(detail::evaluate_transform_chain(chain, idx))> evals;
+
+            for(index_t k = 0; k < vector_length; ++k)
+            {
+                evals.push_back(detail::evaluate_transform_chain(chain, idx));
+                ++idx[dim];
+            }
+
+            detail::diagnose_vector_access(chain, evals, analysis);
+        }
+
+        break;
+    }
+
+    return analysis;
+}
+
+// whether vectors of vector_length elements along dim are single accesses over the whole tile
+template <typename TransformChain, index_t NDim>
+bool is_vector_access_supported(const TransformChain& chain,
+                                index_t dim,
+                                index_t vector_length,
+                                const TransformChainTile<NDim>& tile,
+                                bool check_alignment = true)
+{
+    VectorAccessAnalyzerConfig config;
+
+    config.max_vector_length_ = vector_length;
+    config.check_alignment_   = check_alignment;
+
+    return analyze_vector_access(chain, dim, tile, config).max_vector_length_ >= vector_length;
+}
+
+} // namespace utils
+} // namespace ck
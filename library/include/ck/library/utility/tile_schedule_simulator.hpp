@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+namespace utils {
+
+// GEMM tiled the same way as the gridwise GEMM using the block-to-C-tile map
+struct TileScheduleProblem
+{
+    index_t M_ = 0;
+    index_t N_ = 0;
+    index_t K_ = 0;
+
+    index_t m_per_block_ = 0;
+    index_t n_per_block_ = 0;
+    index_t k_per_block_ = 0;
+
+    // element sizes in bytes
+    index_t a_data_size_ = 2;
+    index_t b_data_size_ = 2;
+
+    // number of K splits, for the KSplit maps
+    index_t k_batch_ = 1;
+};
+
+struct TileScheduleSimulatorConfig
+{
+    index_t num_cu_        = 110;
+    index_t block_per_cu_  = 2; // concurrently resident workgroups per CU
+    long_index_t l2_bytes_ = 8 * 1024 * 1024;
+};
+
+struct TileScheduleStatistics
+{
+    index_t grid_size_          = 0;
+    index_t num_wave_           = 0;
+    index_t num_idle_block_     = 0; // workgroups mapped outside of the C tiles
+    double average_m0_per_wave_ = 0; // distinct A row panels touched by a wave
+    double average_n0_per_wave_ = 0; // distinct B column panels touched by a wave
+
+    // one access is one workgroup loading one KPerBlock slice of its A or B panel
+    long_index_t num_a_access_ = 0;
+    long_index_t num_b_access_ = 0;
+    long_index_t num_a_miss_   = 0;
+    long_index_t num_b_miss_   = 0;
+
+    long_index_t dram_bytes_     = 0;
+    long_index_t min_dram_bytes_ = 0; // every slice loaded once
+
+    // workgroups served by each load from DRAM
+    double GetAReuse() const
+    {
+        return num_a_miss_ == 0 ? 0 : static_cast<double>(num_a_access_) / num_a_miss_;
+    }
+
+    double GetBReuse() const
+    {
+        return num_b_miss_ == 0 ? 0 : static_cast<double>(num_b_access_) / num_b_miss_;
+    }
+
+    double GetL2HitRate() const
+    {
+        const long_index_t num_access = num_a_access_ + num_b_access_;
+
+        return num_access == 0
+                   ? 0
+                   : 1. - static_cast<double>(num_a_miss_ + num_b_miss_) / num_access;
+    }
+};
+
+// C tile computed by one workgroup
+struct CTileScheduleEntry
+{
+    index_t k_batch_id_ = 0;
+    index_t m0_         = 0;
+    index_t n0_         = 0;
+};
+
+// Replays a block-to-C-tile map on the host, in the order of the workgroup ids. Maps with a K split
+// return [k_batch_id, m0, n0], the others [m0, n0]. block_begin is the first workgroup id, as for
+// OffsettedBlockToCTileMap.
+template <typename BlockToCTileMap>
+std::vector<CTileScheduleEntry> make_tile_schedule(const BlockToCTileMap& block_2_ctile_map,
+                                                   index_t grid_size,
+                                                   index_t block_begin = 0)
+{
+    std::vector<CTileScheduleEntry> schedule;
+
+    schedule.reserve(grid_size);
+
+    for(index_t block_id = block_begin; block_id < block_begin + grid_size; ++block_id)
+    {
+        const auto idx = block_2_ctile_map.CalculateBottomIndex(make_multi_index(block_id));
+
+        using Idx = remove_cvref_t<decltype(idx)>;
+
+        if constexpr(Idx::Size() == 3)
+        {
+            schedule.push_back(
+                CTileScheduleEntry{idx[Number<0>{}], idx[Number<1>{}], idx[Number<2>{}]});
+        }
+        else
+        {
+            schedule.push_back(CTileScheduleEntry{0, idx[Number<0>{}], idx[Number<1>{}]});
+        }
+    }
+
+    return schedule;
+}
+
+// Estimates the L2 reuse of the A and B tiles for a tile schedule.
+//
+// Workgroups are dispatched in schedule order to num_cu * block_per_cu slots. Workgroups of a
+// wave run in lockstep: at each main loop iteration every one of them loads the next KPerBlock
+// slice of its A and B panels through an LRU L2, a miss is a load from DRAM. Workgroups all take
+// the same time, so a wave starts when the previous one is done.
+inline TileScheduleStatistics
+simulate_tile_schedule(const std::vector<CTileScheduleEntry>& schedule,
+                       const TileScheduleProblem& problem,
+                       const TileScheduleSimulatorConfig& config)
+{
+    const index_t M0 = math::integer_divide_ceil(problem.M_, problem.m_per_block_);
+    const index_t N0 = math::integer_divide_ceil(problem.N_, problem.n_per_block_);
+    const index_t K0 = math::integer_divide_ceil(problem.K_, problem.k_per_block_);
+
+    const index_t k0_per_batch = math::integer_divide_ceil(K0, problem.k_batch_);
+
+    const long_index_t a_slice_bytes = static_cast<long_index_t>(problem.m_per_block_) *
+                                       problem.k_per_block_ * problem.a_data_size_;
+    const long_index_t b_slice_bytes = static_cast<long_index_t>(problem.n_per_block_) *
+                                       problem.k_per_block_ * problem.b_data_size_;
+
+    const index_t num_slot = config.num_cu_ * config.block_per_cu_;
+
+    TileScheduleStatistics stat;
+
+    stat.grid_size_ = static_cast<index_t>(schedule.size());
+    stat.num_wave_  = math::integer_divide_ceil(stat.grid_size_, num_slot);
+
+    // LRU of slices, most recently used first. A slice is keyed by tensor, panel and K index
+    std::list<std::pair<long_index_t, long_index_t>> lru;
+    std::unordered_map<long_index_t, decltype(lru)::iterator> lru_pos;
+    long_index_t l2_used_bytes = 0;
+
+    std::set<long_index_t> touched_slices;
+
+    // returns true on a hit
+    auto access = [&](bool is_b, index_t panel, index_t k0) {
+        const long_index_t key   = ((is_b ? M0 : 0) + static_cast<long_index_t>(panel)) * K0 + k0;
+        const long_index_t bytes = is_b ? b_slice_bytes : a_slice_bytes;
+
+        touched_slices.insert(key);
+
+        const auto it = lru_pos.find(key);
+
+        if(it != lru_pos.end())
+        {
+            lru.splice(lru.begin(), lru, it->second);
+
+            return true;
+        }
+
+        if(bytes > config.l2_bytes_)
+        {
+            return false;
+        }
+
+        while(l2_used_bytes + bytes > config.l2_bytes_)
+        {
+            l2_used_bytes -= lru.back().second;
+            lru_pos.erase(lru.back().first);
+            lru.pop_back();
+        }
+
+        lru.emplace_front(key, bytes);
+        lru_pos[key] = lru.begin();
+        l2_used_bytes += bytes;
+
+        return false;
+    };
+
+    long_index_t sum_m0_per_wave = 0;
+    long_index_t sum_n0_per_wave = 0;
+
+    for(std::size_t wave_begin = 0; wave_begin < schedule.size(); wave_begin += num_slot)
+    {
+        const std::size_t wave_end = std::min(schedule.size(), wave_begin + num_slot);
+
+        std::vector<CTileScheduleEntry> wave;
+        std::set<index_t> wave_m0s;
+        std::set<index_t> wave_n0s;
+
+        for(std::size_t i = wave_begin; i < wave_end; ++i)
+        {
+            const auto& entry = schedule[i];
+
+            if(entry.m0_ < 0 || entry.m0_ >= M0 || entry.n0_ < 0 || entry.n0_ >= N0 ||
+               entry.k_batch_id_ * k0_per_batch >= K0)
+            {
+                ++stat.num_idle_block_;
+                continue;
+            }
+
+            wave.push_back(entry);
+            wave_m0s.insert(entry.m0_);
+            wave_n0s.insert(entry.n0_);
+        }
+
+        sum_m0_per_wave += wave_m0s.size();
+        sum_n0_per_wave += wave_n0s.size();
+
+        for(index_t k_step = 0; k_step < k0_per_batch; ++k_step)
+        {
+            for(const auto& entry : wave)
+            {
+                const index_t k0 = entry.k_batch_id_ * k0_per_batch + k_step;
+
+                if(k0 >= K0)
+                {
+                    continue;
+                }
+
+                ++stat.num_a_access_;
+                ++stat.num_b_access_;
+
+                if(!access(false, entry.m0_, k0))
+                {
+                    ++stat.num_a_miss_;
+                }
+
+                if(!access(true, entry.n0_, k0))
+                {
+                    ++stat.num_b_miss_;
+                }
+            }
+        }
+    }
+
+    if(stat.num_wave_ > 0)
+    {
+        stat.average_m0_per_wave_ = static_cast<double>(sum_m0_per_wave) / stat.num_wave_;
+        stat.average_n0_per_wave_ = static_cast<double>(sum_n0_per_wave) / stat.num_wave_;
+    }
+
+    stat.dram_bytes_ = stat.num_a_miss_ * a_slice_bytes + stat.num_b_miss_ * b_slice_bytes;
+
+    for(const auto key : touched_slices)
+    {
+        stat.min_dram_bytes_ +=
+            key < static_cast<long_index_t>(M0) * K0 ? a_slice_bytes : b_slice_bytes;
+    }
+
+    return stat;
+}
+
+template <typename BlockToCTileMap>
+TileScheduleStatistics simulate_tile_schedule(const BlockToCTileMap& block_2_ctile_map,
+                                              index_t grid_size,
+                                              const TileScheduleProblem& problem,
+                                              const TileScheduleSimulatorConfig& config)
+{
+    return simulate_tile_schedule(
+        make_tile_schedule(block_2_ctile_map, grid_size), problem, config);
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/cpu/device/impl/device_batched_gemm_cpu.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+static constexpr auto Generic = ck::tensor_operation::cpu::CpuGemmMicroKernelType::Generic;
+static constexpr auto Avx2    = ck::tensor_operation::cpu::CpuGemmMicroKernelType::Avx2;
+static constexpr auto Avx512  = ck::tensor_operation::cpu::CpuGemmMicroKernelType::Avx512;
+
+// Compilation parameters for c = a * b on the host, a and b in any layout
+template <typename ALayout, typename BLayout>
+using device_batched_gemm_cpu_f16_f16_f16_instances = std::tuple<
+    // clang-format off
+    //##################| ALayout| BLayout| CLayout| AData| BData| CData| AccData|           A|           B|           C| MPer| NPer| KPer| MicroKernel|
+    //##################|        |        |        |  Type|  Type|  Type|    Type| Elementwise| Elementwise| Elementwise| Block| Block| Block|            |
+    //##################|        |        |        |      |      |      |        |   Operation|   Operation|   Operation|      |      |      |            |
+    DeviceBatchedGemmCpu< ALayout, BLayout,     Row,   F16,   F16,   F16,     F32, PassThrough, PassThrough, PassThrough,   64,   64,  256,     Generic>,
+    DeviceBatchedGemmCpu< ALayout, BLayout,     Row,   F16,   F16,   F16,     F32, PassThrough, PassThrough, PassThrough,   96,  128,  256,        Avx2>,
+    DeviceBatchedGemmCpu< ALayout, BLayout,     Row,   F16,   F16,   F16,     F32, PassThrough, PassThrough, PassThrough,   48,   64,  128,        Avx2>,
+    DeviceBatchedGemmCpu< ALayout, BLayout,     Row,   F16,   F16,   F16,     F32, PassThrough, PassThrough, PassThrough,  128,  128,  256,      Avx512>,
+    DeviceBatchedGemmCpu< ALayout, BLayout,     Row,   F16,   F16,   F16,     F32, PassThrough, PassThrough, PassThrough,   64,   64,  128,      Avx512>
+    // clang-format on
+    >;
+
+void add_device_batched_gemm_cpu_f16_f16_f16_gmk_gkn_gmn_instances(
+    std::vector<std::unique_ptr<
+        DeviceBatchedGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances)
+{
+    add_device_operation_instances<device_batched_gemm_cpu_f16_f16_f16_instances<Row, Row>>(
+        instances);
+}
+
+void add_device_batched_gemm_cpu_f16_f16_f16_gmk_gnk_gmn_instances(
+    std::vector<std::unique_ptr<
+        DeviceBatchedGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances)
+{
+    add_device_operation_instances<device_batched_gemm_cpu_f16_f16_f16_instances<Row, Col>>(
+        instances);
+}
+
+void add_device_batched_gemm_cpu_f16_f16_f16_gkm_gkn_gmn_instances(
+    std::vector<std::unique_ptr<
+        DeviceBatchedGemm<Col, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances)
+{
+    add_device_operation_instances<device_batched_gemm_cpu_f16_f16_f16_instances<Col, Row>>(
+        instances);
+}
+
+void add_device_batched_gemm_cpu_f16_f16_f16_gkm_gnk_gmn_instances(
+    std::vector<std::unique_ptr<
+        DeviceBatchedGemm<Col, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances)
+{
+    add_device_operation_instances<device_batched_gemm_cpu_f16_f16_f16_instances<Col, Col>>(
+        instances);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
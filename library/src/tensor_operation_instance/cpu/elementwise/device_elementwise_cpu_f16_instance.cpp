@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/cpu/device/impl/device_elementwise_cpu.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Add         = ck::tensor_operation::element_wise::Add;
+
+// Compilation parameters for an elementwise operation on the host, tensors with any strides
+template <typename InDataTypeTuple, typename OutDataTypeTuple, typename Op, index_t NumDim>
+using device_elementwise_cpu_instances = std::tuple<
+    // clang-format off
+    //##################|              In|              Out| Elementwise|    Num| VectorSize| MinWorkPerThread|
+    //##################|        DataType|         DataType|   Operation|    Dim|           |                 |
+    DeviceElementwiseCpu< InDataTypeTuple, OutDataTypeTuple,          Op, NumDim,         16,            65536>,
+    DeviceElementwiseCpu< InDataTypeTuple, OutDataTypeTuple,          Op, NumDim,          8,            65536>,
+    DeviceElementwiseCpu< InDataTypeTuple, OutDataTypeTuple,          Op, NumDim,          8,            16384>,
+    DeviceElementwiseCpu< InDataTypeTuple, OutDataTypeTuple,          Op, NumDim,          1,            16384>
+    // clang-format on
+    >;
+
+void add_device_elementwise_cpu_passthrough_f16_f16_rank2_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16>, Tuple<F16>, PassThrough, 2>>& instances)
+{
+    add_device_operation_instances<
+        device_elementwise_cpu_instances<Tuple<F16>, Tuple<F16>, PassThrough, 2>>(instances);
+}
+
+void add_device_elementwise_cpu_passthrough_f16_f16_rank4_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16>, Tuple<F16>, PassThrough, 4>>& instances)
+{
+    add_device_operation_instances<
+        device_elementwise_cpu_instances<Tuple<F16>, Tuple<F16>, PassThrough, 4>>(instances);
+}
+
+void add_device_elementwise_cpu_add_f16_f16_f16_rank2_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16, F16>, Tuple<F16>, Add, 2>>& instances)
+{
+    add_device_operation_instances<
+        device_elementwise_cpu_instances<Tuple<F16, F16>, Tuple<F16>, Add, 2>>(instances);
+}
+
+void add_device_elementwise_cpu_add_f16_f16_f16_rank4_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16, F16>, Tuple<F16>, Add, 4>>& instances)
+{
+    add_device_operation_instances<
+        device_elementwise_cpu_instances<Tuple<F16, F16>, Tuple<F16>, Add, 4>>(instances);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
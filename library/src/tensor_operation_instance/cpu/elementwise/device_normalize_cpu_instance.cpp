@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/cpu/device/impl/device_elementwise_cpu.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using Normalize = ck::tensor_operation::element_wise::Normalize;
+
+using device_normalize_from_mean_squaremean_cpu_f16_f32_f32_f16_f16_instances = std::tuple<
+    // clang-format off
+    //##################| <in, mean, square_mean, gamma, beta>|      <out>|   functor| NDim| VectorSize| MinWorkPerThread|
+    DeviceElementwiseCpu<       Tuple<F16, F32, F32, F16, F16>, Tuple<F16>, Normalize,    2,         16,            65536>,
+    DeviceElementwiseCpu<       Tuple<F16, F32, F32, F16, F16>, Tuple<F16>, Normalize,    2,          8,            16384>,
+    DeviceElementwiseCpu<       Tuple<F16, F32, F32, F16, F16>, Tuple<F16>, Normalize,    2,          1,            16384>
+    // clang-format on
+    >;
+
+void add_device_normalize_from_mean_squaremean_cpu_f16_f32_f32_f16_f16_instances(
+    std::vector<DeviceElementwiseBasePtr<Tuple<F16, F32, F32, F16, F16>, Tuple<F16>, Normalize, 2>>&
+        instances)
+{
+    add_device_operation_instances<
+        device_normalize_from_mean_squaremean_cpu_f16_f32_f32_f16_f16_instances>(instances);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
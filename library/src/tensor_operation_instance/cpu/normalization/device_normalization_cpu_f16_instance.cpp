@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/cpu/device/impl/device_normalization_cpu.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// Compilation parameters for a normalization over NumReduceDim of the Rank dimensions on the host
+template <typename OutElementwise, index_t Rank, index_t Reduce>
+using device_normalization_cpu_f16_instances = std::tuple<
+    // clang-format off
+    //####################| XData| GammaData| BetaData| AccData| YData|    Elementwise| Rank| Reduce| VectorSize| MinWorkPerThread|
+    //####################|  Type|      Type|     Type|    Type|  Type|      Operation|     |    Dim|           |                 |
+    DeviceNormalizationCpu<   F16,       F16,      F16,     F32,   F16, OutElementwise, Rank, Reduce,         16,            65536>,
+    DeviceNormalizationCpu<   F16,       F16,      F16,     F32,   F16, OutElementwise, Rank, Reduce,         16,            16384>,
+    DeviceNormalizationCpu<   F16,       F16,      F16,     F32,   F16, OutElementwise, Rank, Reduce,          8,            16384>,
+    DeviceNormalizationCpu<   F16,       F16,      F16,     F32,   F16, OutElementwise, Rank, Reduce,          8,             4096>
+    // clang-format on
+    >;
+
+void add_device_normalization_cpu_rank_2_1_f16_instances(
+    std::vector<std::unique_ptr<DeviceNormalization<F16, F16, F16, F32, F16, PassThrough, 2, 1>>>&
+        instances)
+{
+    add_device_operation_instances<device_normalization_cpu_f16_instances<PassThrough, 2, 1>>(
+        instances);
+}
+
+void add_device_normalization_cpu_rank_4_3_f16_instances(
+    std::vector<std::unique_ptr<DeviceNormalization<F16, F16, F16, F32, F16, PassThrough, 4, 3>>>&
+        instances)
+{
+    add_device_operation_instances<device_normalization_cpu_f16_instances<PassThrough, 4, 3>>(
+        instances);
+}
+
+void add_device_normalization_cpu_rank_5_3_f16_instances(
+    std::vector<std::unique_ptr<DeviceNormalization<F16, F16, F16, F32, F16, PassThrough, 5, 3>>>&
+        instances)
+{
+    add_device_operation_instances<device_normalization_cpu_f16_instances<PassThrough, 5, 3>>(
+        instances);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/cpu/device/impl/device_softmax_cpu.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// Compilation parameters for a softmax over NumReduceDim of the Rank dimensions on the host
+template <index_t Rank, index_t NumReduceDim>
+using device_softmax_cpu_f16_f16_instances = std::tuple<
+    // clang-format off
+    //##############| InData| AccData| OutData| InElementwise| AccElementwise| Rank| NumReduceDim| VectorSize| MinWorkPerThread|
+    //##############|   Type|    Type|    Type|     Operation|      Operation|     |             |           |                 |
+    DeviceSoftmaxCpu<    F16,     F32,     F16,   PassThrough,    PassThrough, Rank, NumReduceDim,         16,            65536>,
+    DeviceSoftmaxCpu<    F16,     F32,     F16,   PassThrough,    PassThrough, Rank, NumReduceDim,         16,            16384>,
+    DeviceSoftmaxCpu<    F16,     F32,     F16,   PassThrough,    PassThrough, Rank, NumReduceDim,          8,            16384>,
+    DeviceSoftmaxCpu<    F16,     F32,     F16,   PassThrough,    PassThrough, Rank, NumReduceDim,          8,             4096>
+    // clang-format on
+    >;
+
+void add_device_softmax_cpu_f16_f16_rank3_instances(
+    std::vector<DeviceSoftmaxPtr<F16, F32, F16, PassThrough, PassThrough, 3>>& instances)
+{
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<3, 1>>(instances);
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<3, 2>>(instances);
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<3, 3>>(instances);
+}
+
+void add_device_softmax_cpu_f16_f16_rank4_instances(
+    std::vector<DeviceSoftmaxPtr<F16, F32, F16, PassThrough, PassThrough, 4>>& instances)
+{
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<4, 1>>(instances);
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<4, 2>>(instances);
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<4, 3>>(instances);
+    add_device_operation_instances<device_softmax_cpu_f16_f16_instances<4, 4>>(instances);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -52,8 +52,8 @@ void add_device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gkn_gmn_instances(
         DeviceBatchedGemm<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gkn_gmn_instances{});
+    add_device_operation_instances<device_batched_gemm_xdl_bf16_bf16_bf16_gmk_gkn_gmn_instances>(
+        instances);
 }
 
 } // namespace instance
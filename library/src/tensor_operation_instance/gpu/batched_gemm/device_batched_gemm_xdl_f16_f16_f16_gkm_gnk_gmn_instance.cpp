@@ -73,8 +73,8 @@ void add_device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_instances(
         DeviceBatchedGemm<Col, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_instances{});
+    add_device_operation_instances<device_batched_gemm_xdl_f16_f16_f16_gkm_gnk_gmn_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -100,8 +100,8 @@ void add_device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_instances(
         DeviceBatchedGemm<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_instances{});
+    add_device_operation_instances<device_batched_gemm_xdl_f16_f16_f16_gmk_gkn_gmn_instances>(
+        instances);
 }
 
 } // namespace instance
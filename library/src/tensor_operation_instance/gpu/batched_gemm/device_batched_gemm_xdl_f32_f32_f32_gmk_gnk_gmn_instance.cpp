@@ -53,8 +53,8 @@ void add_device_batched_gemm_xdl_f32_f32_f32_gmk_gnk_gmn_instances(
         DeviceBatchedGemm<Row, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_batched_gemm_xdl_f32_f32_f32_gmk_gnk_gmn_instances{});
+    add_device_operation_instances<device_batched_gemm_xdl_f32_f32_f32_gmk_gnk_gmn_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -61,8 +61,8 @@ void add_device_batched_gemm_xdl_int8_int8_int8_gmk_gnk_gmn_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_batched_gemm_xdl_int8_int8_int8_gmk_gnk_gmn_instances{});
+    add_device_operation_instances<device_batched_gemm_xdl_int8_int8_int8_gmk_gnk_gmn_instances>(
+        instances);
 }
 
 } // namespace instance
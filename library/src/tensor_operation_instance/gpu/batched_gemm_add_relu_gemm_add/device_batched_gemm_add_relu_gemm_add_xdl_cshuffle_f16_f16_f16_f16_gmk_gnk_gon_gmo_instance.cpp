@@ -70,9 +70,8 @@ void add_device_batched_gemm_add_relu_gemm_add_xdl_cshuffle_f16_f16_f16_f16_gmk_
                                                                         PassThrough,
                                                                         CDE1ElementOp>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_batched_gemm_add_relu_gemm_add_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gon_gmo_instances{});
+    add_device_operation_instances<
+        device_batched_gemm_add_relu_gemm_add_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gon_gmo_instances>(instances);
 }
 
 } // namespace instance
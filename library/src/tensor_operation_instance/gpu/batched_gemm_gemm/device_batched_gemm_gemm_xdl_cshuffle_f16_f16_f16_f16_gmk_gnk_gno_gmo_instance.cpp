@@ -69,9 +69,8 @@ void add_device_batched_gemm_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_i
                                                       PassThrough,
                                                       PassThrough>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_batched_gemm_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances{});
+    add_device_operation_instances<
+        device_batched_gemm_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances>(instances);
 }
 
 } // namespace instance
@@ -69,9 +69,9 @@ using device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gkn_gmn_in
 void add_device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gkn_gmn_instances(
     std::vector<DeviceGemmReducePtr<0, ReducePtrsGlobal::Size()>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gkn_gmn_instances{});
+    add_device_operation_instances<
+        device_batched_gemm_reduce_xdl_cshuffle_f16_f16_f16_f32_f32_gkm_gkn_gmn_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -89,14 +89,12 @@ void add_device_batched_gemm_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_g
                                                              PassThrough,
                                                              false>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
+    add_device_operation_instances<
         device_batched_gemm_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances<
-            false>{});
-    add_device_operation_instances(
-        instances,
+            false>>(instances);
+    add_device_operation_instances<
         device_batched_gemm_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_irregular_k_instances<
-            false>{});
+            false>>(instances);
 }
 
 void add_device_batched_gemm_masking_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instance(
@@ -115,14 +113,12 @@ void add_device_batched_gemm_masking_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_g
                                                              PassThrough,
                                                              true>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
+    add_device_operation_instances<
         device_batched_gemm_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances<
-            true>{});
-    add_device_operation_instances(
-        instances,
+            true>>(instances);
+    add_device_operation_instances<
         device_batched_gemm_softmax_gemm_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_irregular_k_instances<
-            true>{});
+            true>>(instances);
 }
 
 } // namespace instance
@@ -84,15 +84,14 @@ void add_device_batched_gemm_masking_softmax_gemm_permute_xdl_cshuffle_f16_f16_f
                                             MaskingSpecialization::MaskOutUpperTriangle>>>&
         instances)
 {
-    add_device_operation_instances(
-        instances,
+    add_device_operation_instances<
         device_batched_gemm_softmax_gemm_permute_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances<
             2,
             1,
             1,
             1,
             1,
-            MaskingSpecialization::MaskOutUpperTriangle>{});
+            MaskingSpecialization::MaskOutUpperTriangle>>(instances);
 }
 
 void add_device_batched_gemm_softmax_gemm_permute_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances(
@@ -116,15 +115,14 @@ void add_device_batched_gemm_softmax_gemm_permute_xdl_cshuffle_f16_f16_f16_f16_g
                                                             MaskingSpecialization::MaskDisabled>>>&
         instances)
 {
-    add_device_operation_instances(
-        instances,
+    add_device_operation_instances<
         device_batched_gemm_softmax_gemm_permute_xdl_cshuffle_f16_f16_f16_f16_gmk_gnk_gno_gmo_instances<
             2,
             1,
             1,
             1,
             1,
-            MaskingSpecialization::MaskDisabled>{});
+            MaskingSpecialization::MaskDisabled>>(instances);
 }
 
 } // namespace instance
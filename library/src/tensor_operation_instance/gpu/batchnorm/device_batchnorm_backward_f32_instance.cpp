@@ -133,10 +133,10 @@ void add_device_batchnorm_backward_rank_4_3_f32_instances(
         std::unique_ptr<DeviceBatchNormBwd<F32, F32, F32, F32, F32, F32, F32, PassThrough, 4, 3>>>&
         instances)
 {
-    add_device_operation_instances(
-        instances, device_batchnorm_backward_f32_blockwise_instances<4, 3, PassThrough>{});
-    add_device_operation_instances(
-        instances, device_batchnorm_backward_f32_multiblock_instances<4, 3, PassThrough>{});
+    add_device_operation_instances<
+        device_batchnorm_backward_f32_blockwise_instances<4, 3, PassThrough>>(instances);
+    add_device_operation_instances<
+        device_batchnorm_backward_f32_multiblock_instances<4, 3, PassThrough>>(instances);
 }
 
 } // namespace instance
@@ -135,10 +135,10 @@ void add_device_batchnorm_forward_rank_4_3_f16_instances(
         std::unique_ptr<DeviceBatchNormFwd<F16, F16, F32, F16, F16, F32, PassThrough, 4, 3>>>&
         instances)
 {
-    add_device_operation_instances(
-        instances, device_batchnorm_forward_f16_blockwise_instances<4, 3, PassThrough>{});
-    add_device_operation_instances(
-        instances, device_batchnorm_forward_f16_multiblock_instances<4, 3, PassThrough>{});
+    add_device_operation_instances<
+        device_batchnorm_forward_f16_blockwise_instances<4, 3, PassThrough>>(instances);
+    add_device_operation_instances<
+        device_batchnorm_forward_f16_multiblock_instances<4, 3, PassThrough>>(instances);
 }
 
 } // namespace instance
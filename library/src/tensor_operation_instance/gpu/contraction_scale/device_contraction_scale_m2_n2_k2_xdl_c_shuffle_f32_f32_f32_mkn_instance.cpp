@@ -71,8 +71,8 @@ void add_device_contraction_scale_m2_n2_k2_xdl_c_shuffle_f32_f32_f32_mkn_instanc
                                                            PassThrough,
                                                            Scale>>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_contraction_scale_m2_n2_k2_xdl_c_shuffle_f32_f32_f32_mkn_instance{});
+    add_device_operation_instances<
+        device_contraction_scale_m2_n2_k2_xdl_c_shuffle_f32_f32_f32_mkn_instance>(instances);
 }
 
 } // namespace instance
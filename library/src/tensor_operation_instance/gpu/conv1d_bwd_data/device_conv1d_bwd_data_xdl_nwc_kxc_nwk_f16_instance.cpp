@@ -83,10 +83,9 @@ void add_device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f16_instances(
         DeviceConvBwdData<1, NWC, KXC, NWK, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f16_instances{});
-    add_device_operation_instances(
-        instances, device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_f16_instances{});
+    add_device_operation_instances<device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f16_instances>(instances);
+    add_device_operation_instances<device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_f16_instances>(
+        instances);
 }
 
 } // namespace instance
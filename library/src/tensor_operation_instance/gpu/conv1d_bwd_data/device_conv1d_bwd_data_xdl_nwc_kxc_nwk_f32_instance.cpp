@@ -82,10 +82,9 @@ void add_device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f32_instances(
         DeviceConvBwdData<1, NWC, KXC, NWK, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f32_instances{});
-    add_device_operation_instances(
-        instances, device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_f32_instances{});
+    add_device_operation_instances<device_conv1d_bwd_data_xdl_nwc_kxc_nwk_f32_instances>(instances);
+    add_device_operation_instances<device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_f32_instances>(
+        instances);
 }
 
 } // namespace instance
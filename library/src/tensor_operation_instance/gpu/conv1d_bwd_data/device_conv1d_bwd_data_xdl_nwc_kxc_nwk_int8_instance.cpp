@@ -87,10 +87,10 @@ void add_device_conv1d_bwd_data_xdl_nwc_kxc_nwk_int8_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv1d_bwd_data_xdl_nwc_kxc_nwk_int8_instances{});
-    add_device_operation_instances(
-        instances, device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_int8_instances{});
+    add_device_operation_instances<device_conv1d_bwd_data_xdl_nwc_kxc_nwk_int8_instances>(
+        instances);
+    add_device_operation_instances<device_conv1d_bwd_data_xdl_nwc_kxc_nwk_1x1_s1_p0_int8_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -71,10 +71,10 @@ void add_device_conv2d_bwd_data_dl_nhwc_kyxc_nhwk_f16_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_bwd_data_dl_nhwc_kyxc_nhwk_f16_instances{});
-    add_device_operation_instances(
-        instances, device_conv2d_bwd_data_dl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances{});
+    add_device_operation_instances<device_conv2d_bwd_data_dl_nhwc_kyxc_nhwk_f16_instances>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_bwd_data_dl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances>(instances);
 }
 
 } // namespace instance
@@ -140,15 +140,14 @@ void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances{});
-    add_device_operation_instances(
-        instances, device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances{});
-    add_device_operation_instances(
-        instances, device_conv_dedicated_2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances{});
-    add_device_operation_instances(
-        instances,
-        device_conv_dedidecate_2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances{});
+    add_device_operation_instances<device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances>(instances);
+    add_device_operation_instances<
+        device_conv_dedicated_2d_bwd_data_xdl_nhwc_kyxc_nhwk_bf16_instances>(instances);
+    add_device_operation_instances<
+        device_conv_dedidecate_2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_bf16_instances>(instances);
 }
 
 } // namespace instance
@@ -139,14 +139,14 @@ void add_device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances{});
-    add_device_operation_instances(
-        instances, device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f32_instances{});
-    add_device_operation_instances(
-        instances, device_conv_dedicated_2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances{});
-    add_device_operation_instances(
-        instances, device_conv_dedicated_2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f32_instances{});
+    add_device_operation_instances<device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f32_instances>(instances);
+    add_device_operation_instances<
+        device_conv_dedicated_2d_bwd_data_xdl_nhwc_kyxc_nhwk_f32_instances>(instances);
+    add_device_operation_instances<
+        device_conv_dedicated_2d_bwd_data_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f32_instances>(instances);
 }
 
 } // namespace instance
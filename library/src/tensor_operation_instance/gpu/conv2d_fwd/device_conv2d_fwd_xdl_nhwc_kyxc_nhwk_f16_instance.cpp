@@ -107,11 +107,11 @@ void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances(
         DeviceConvFwd<2, NHWC, KYXC, NHWK, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_f16_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances{});
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f16_instances>(instances);
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_f16_instances>(
+        instances);
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f16_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -106,11 +106,11 @@ void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances(
         DeviceConvFwd<2, NHWC, KYXC, NHWK, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_f32_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f32_instances{});
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_f32_instances>(instances);
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_f32_instances>(
+        instances);
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_f32_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -111,12 +111,11 @@ void add_device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances(
                                               PassThrough,
                                               PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_int8_instances{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_int8_instances{});
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_int8_instances>(instances);
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_p0_int8_instances>(
+        instances);
+    add_device_operation_instances<device_conv2d_fwd_xdl_nhwc_kyxc_nhwk_1x1_s1_p0_int8_instances>(
+        instances);
 }
 
 } // namespace instance
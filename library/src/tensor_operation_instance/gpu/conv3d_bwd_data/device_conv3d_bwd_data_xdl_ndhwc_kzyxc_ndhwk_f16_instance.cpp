@@ -90,10 +90,10 @@ void add_device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_f16_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_f16_instances{});
-    add_device_operation_instances(
-        instances, device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_f16_instances{});
+    add_device_operation_instances<device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_f16_instances>(
+        instances);
+    add_device_operation_instances<
+        device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_f16_instances>(instances);
 }
 
 } // namespace instance
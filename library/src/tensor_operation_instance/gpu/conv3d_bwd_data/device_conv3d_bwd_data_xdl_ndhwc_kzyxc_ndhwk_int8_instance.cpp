@@ -87,10 +87,10 @@ void add_device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_int8_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_int8_instances{});
-    add_device_operation_instances(
-        instances, device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_int8_instances{});
+    add_device_operation_instances<device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_int8_instances>(
+        instances);
+    add_device_operation_instances<
+        device_conv3d_bwd_data_xdl_ndhwc_kzyxc_ndhwk_1x1_s1_p0_int8_instances>(instances);
 }
 
 } // namespace instance
@@ -39,8 +39,8 @@ void add_device_normalize_from_mean_squaremean_f16_f32_f32_f16_f16_instances(
     std::vector<DeviceElementwiseBasePtr<Tuple<F16, F32, F32, F16, F16>, Tuple<F16>, Normalize, 2>>&
         instances)
 {
-    add_device_operation_instances(
-        instances, device_normalize_from_mean_squaremean_f16_f32_f32_f16_f16_instances{});
+    add_device_operation_instances<
+        device_normalize_from_mean_squaremean_f16_f32_f32_f16_f16_instances>(instances);
 }
 
 } // namespace instance
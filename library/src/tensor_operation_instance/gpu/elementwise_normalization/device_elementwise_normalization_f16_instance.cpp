@@ -44,8 +44,8 @@ void add_device_elementwise_normalization_rank_2_1_f16_instances(
         DeviceElementwiseNormalization<ck::Tuple<F16, F16>, F16, F16, F32, F16, Add, Pass, 2, 1>>>&
         instances)
 {
-    add_device_operation_instances(
-        instances, device_elementwise_normalization_f16_instances<Add, Pass, 2, 1>{});
+    add_device_operation_instances<device_elementwise_normalization_f16_instances<Add, Pass, 2, 1>>(
+        instances);
 }
 
 } // namespace instance
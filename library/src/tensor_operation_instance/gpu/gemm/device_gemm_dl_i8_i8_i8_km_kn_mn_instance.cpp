@@ -40,7 +40,16 @@ void add_device_gemm_dl_i8_i8_i8_km_kn_mn_instances(
         DeviceGemm<Col, Row, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_dl_i8_i8_i8_km_kn_mn_instances{});
+    add_device_operation_instances<device_gemm_dl_i8_i8_i8_km_kn_mn_instances>(instances);
+}
+
+void add_device_gemm_dl_i8_i8_i8_km_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Row, Row, int8_t, int8_t, int8_t, PassThrough, PassThrough, PassThrough>>>&
+        descriptors)
+{
+    add_device_operation_instance_descriptors<device_gemm_dl_i8_i8_i8_km_kn_mn_instances>(
+        descriptors);
 }
 
 } // namespace instance
@@ -58,8 +58,17 @@ void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances(
         DeviceGemm<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances{});
+    add_device_operation_instances<device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances>(
+        instances);
+}
+
+void add_device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
+        descriptors)
+{
+    add_device_operation_instance_descriptors<
+        device_gemm_xdl_c_shuffle_bf16_bf16_bf16_km_kn_mn_instances>(descriptors);
 }
 
 } // namespace instance
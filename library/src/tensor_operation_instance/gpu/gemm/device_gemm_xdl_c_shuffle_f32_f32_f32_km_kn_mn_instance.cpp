@@ -57,8 +57,17 @@ void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances(
         DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances{});
+    add_device_operation_instances<device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances>(
+        instances);
+}
+
+void add_device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        descriptors)
+{
+    add_device_operation_instance_descriptors<
+        device_gemm_xdl_c_shuffle_f32_f32_f32_km_kn_mn_instances>(descriptors);
 }
 
 } // namespace instance
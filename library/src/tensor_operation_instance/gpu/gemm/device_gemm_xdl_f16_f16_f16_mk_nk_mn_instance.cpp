@@ -119,9 +119,20 @@ void add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(
         DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances{});
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances{});
+    add_device_operation_instances<device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances>(instances);
+    add_device_operation_instances<device_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances>(
+        instances);
+}
+
+void add_device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        descriptors)
+{
+    add_device_operation_instance_descriptors<device_gemm_xdl_f16_f16_f16_mk_nk_mn_instances>(
+        descriptors);
+    add_device_operation_instance_descriptors<
+        device_gemm_xdl_f16_f16_f16_mk_nk_mn_irregular_tile_instances>(descriptors);
 }
 
 } // namespace instance
@@ -56,7 +56,16 @@ void add_device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances(
         DeviceGemm<Row, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances{});
+    add_device_operation_instances<device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances>(instances);
+}
+
+void add_device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Row, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        descriptors)
+{
+    add_device_operation_instance_descriptors<device_gemm_xdl_f32_f32_f32_mk_nk_mn_instances>(
+        descriptors);
 }
 
 } // namespace instance
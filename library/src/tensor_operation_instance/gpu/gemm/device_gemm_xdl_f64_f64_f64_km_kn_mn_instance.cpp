@@ -47,7 +47,16 @@ void add_device_gemm_xdl_f64_f64_f64_km_kn_mn_instances(
         DeviceGemm<Col, Row, Row, F64, F64, F64, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_gemm_xdl_f64_f64_f64_km_kn_mn_instances{});
+    add_device_operation_instances<device_gemm_xdl_f64_f64_f64_km_kn_mn_instances>(instances);
+}
+
+void add_device_gemm_xdl_f64_f64_f64_km_kn_mn_instances(
+    std::vector<DeviceOperationInstanceDescriptor<
+        DeviceGemm<Col, Row, Row, F64, F64, F64, PassThrough, PassThrough, PassThrough>>>&
+        descriptors)
+{
+    add_device_operation_instance_descriptors<device_gemm_xdl_f64_f64_f64_km_kn_mn_instances>(
+        descriptors);
 }
 
 } // namespace instance
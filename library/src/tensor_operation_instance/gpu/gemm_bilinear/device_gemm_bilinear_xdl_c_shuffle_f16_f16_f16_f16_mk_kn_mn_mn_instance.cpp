@@ -95,8 +95,8 @@ void add_device_gemm_bilinear_xdl_c_shuffle_f16_f16_f16_f16_mk_kn_mn_mn_instance
                                                     PassThrough,
                                                     Bilinear>>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_gemm_bilinear_xdl_c_shuffle_f16_f16_f16_f16_mk_kn_mn_mn_instances{});
+    add_device_operation_instances<
+        device_gemm_bilinear_xdl_c_shuffle_f16_f16_f16_f16_mk_kn_mn_mn_instances>(instances);
 }
 
 } // namespace instance
@@ -122,11 +122,11 @@ void add_device_gemm_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances(
                                                     PassThrough,
                                                     FastGelu>>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_gemm_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances{});
-    add_device_operation_instances(
-        instances,
-        device_gemm_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_irregular_tile_instances{});
+    add_device_operation_instances<
+        device_gemm_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_instances>(instances);
+    add_device_operation_instances<
+        device_gemm_fastgelu_xdl_c_shuffle_f16_f16_f16_mk_kn_mn_irregular_tile_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -51,8 +51,8 @@ void add_device_gemm_xdl_splitk_f16_f16_f16_km_kn_mn_instances(
         DeviceGemmSplitK<Col, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_splitk_f16_f16_f16_km_kn_mn_instances{});
+    add_device_operation_instances<device_gemm_xdl_splitk_f16_f16_f16_km_kn_mn_instances>(
+        instances);
 }
 
 } // namespace instance
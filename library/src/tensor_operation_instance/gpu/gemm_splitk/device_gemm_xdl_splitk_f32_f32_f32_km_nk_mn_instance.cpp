@@ -51,8 +51,8 @@ void add_device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_instances(
         DeviceGemmSplitK<Col, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
         instances)
 {
-    add_device_operation_instances(instances,
-                                   device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_instances{});
+    add_device_operation_instances<device_gemm_xdl_splitk_f32_f32_f32_km_nk_mn_instances>(
+        instances);
 }
 
 } // namespace instance
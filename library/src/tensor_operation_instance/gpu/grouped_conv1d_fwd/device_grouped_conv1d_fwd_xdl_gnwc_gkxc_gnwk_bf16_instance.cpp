@@ -119,8 +119,8 @@ void add_device_grouped_conv1d_fwd_xdl_gnwc_gkxc_gnwk_bf16_instances(
                                                               PassThrough,
                                                               PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_grouped_conv1d_fwd_xdl_gnwc_gkxc_gnwk_bf16_instances{});
+    add_device_operation_instances<device_grouped_conv1d_fwd_xdl_gnwc_gkxc_gnwk_bf16_instances>(
+        instances);
 }
 
 } // namespace instance
@@ -115,8 +115,8 @@ void add_device_grouped_conv2d_fwd_xdl_gnhwc_gkyxc_gnhwk_int8_instances(
                                                               PassThrough,
                                                               PassThrough>>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_grouped_conv2d_fwd_xdl_gnhwc_gkyxc_gnhwk_int8_instances{});
+    add_device_operation_instances<device_grouped_conv2d_fwd_xdl_gnhwc_gkyxc_gnhwk_int8_instances>(
+        instances);
 }
 
 } // namespace instance
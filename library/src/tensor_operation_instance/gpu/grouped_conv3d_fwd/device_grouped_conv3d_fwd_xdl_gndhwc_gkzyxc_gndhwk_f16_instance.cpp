@@ -119,8 +119,8 @@ void add_device_grouped_conv3d_fwd_xdl_gndhwc_gkzyxc_gndhwk_f16_instances(
                                                               PassThrough,
                                                               PassThrough>>>& instances)
 {
-    add_device_operation_instances(
-        instances, device_grouped_conv3d_fwd_xdl_gndhwc_gkzyxc_gndhwk_f16_instances{});
+    add_device_operation_instances<
+        device_grouped_conv3d_fwd_xdl_gndhwc_gkzyxc_gndhwk_f16_instances>(instances);
 }
 
 } // namespace instance
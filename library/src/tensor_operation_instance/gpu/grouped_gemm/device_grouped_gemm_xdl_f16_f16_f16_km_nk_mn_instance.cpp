@@ -82,10 +82,10 @@ void add_device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_instances(
                                                   PassThrough,
                                                   PassThrough>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_instances{});
-    add_device_operation_instances(
-        instances, device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_irregular_tile_instances{});
+    add_device_operation_instances<device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_instances>(
+        instances);
+    add_device_operation_instances<
+        device_grouped_gemm_xdl_f16_f16_f16_km_nk_mn_irregular_tile_instances>(instances);
 }
 
 } // namespace instance
@@ -37,21 +37,21 @@ void add_device_normalization_rank_2_1_f32_instances(
     std::vector<std::unique_ptr<DeviceNormalization<F32, F32, F32, F32, F32, Pass, 2, 1>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_layernorm_f32_instances<Pass, 2, 1>{});
+    add_device_operation_instances<device_layernorm_f32_instances<Pass, 2, 1>>(instances);
 }
 
 void add_device_normalization_rank_4_3_f32_instances(
     std::vector<std::unique_ptr<DeviceNormalization<F32, F32, F32, F32, F32, Pass, 4, 3>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_layernorm_f32_instances<Pass, 4, 3>{});
+    add_device_operation_instances<device_layernorm_f32_instances<Pass, 4, 3>>(instances);
 }
 
 void add_device_normalization_rank_5_3_f32_instances(
     std::vector<std::unique_ptr<DeviceNormalization<F32, F32, F32, F32, F32, Pass, 5, 3>>>&
         instances)
 {
-    add_device_operation_instances(instances, device_layernorm_f32_instances<Pass, 5, 3>{});
+    add_device_operation_instances<device_layernorm_f32_instances<Pass, 5, 3>>(instances);
 }
 
 } // namespace instance
@@ -21,21 +21,24 @@ void add_device_conv2d_bias_perchannel_quantization_int8_instances(
                                                               PassThrough,
                                                               Add_Mul2_Clamp>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_GK_Tuple,
-                                                                     I32_F32_Tuple,
-                                                                     Add_Mul2_Clamp,
-                                                                     ConvFwdDefault>{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_GK_Tuple,
-                                                                     I32_F32_Tuple,
-                                                                     Add_Mul2_Clamp,
-                                                                     ConvFwd1x1P0>{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_GK_Tuple,
-                                                                     I32_F32_Tuple,
-                                                                     Add_Mul2_Clamp,
-                                                                     ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<
+            GK_GK_Tuple,
+            I32_F32_Tuple,
+            Add_Mul2_Clamp,
+            ConvFwdDefault>>(instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<
+            GK_GK_Tuple,
+            I32_F32_Tuple,
+            Add_Mul2_Clamp,
+            ConvFwd1x1P0>>(instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<
+            GK_GK_Tuple,
+            I32_F32_Tuple,
+            Add_Mul2_Clamp,
+            ConvFwd1x1S1P0>>(instances);
 }
 
 void add_device_conv2d_bias_relu_perchannel_quantization_int8_instances(
@@ -52,21 +55,24 @@ void add_device_conv2d_bias_relu_perchannel_quantization_int8_instances(
                                                               PassThrough,
                                                               Add_Relu_Mul2_Clamp>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_GK_Tuple,
-                                                                     I32_F32_Tuple,
-                                                                     Add_Relu_Mul2_Clamp,
-                                                                     ConvFwdDefault>{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_GK_Tuple,
-                                                                     I32_F32_Tuple,
-                                                                     Add_Relu_Mul2_Clamp,
-                                                                     ConvFwd1x1P0>{});
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_GK_Tuple,
-                                                                     I32_F32_Tuple,
-                                                                     Add_Relu_Mul2_Clamp,
-                                                                     ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<
+            GK_GK_Tuple,
+            I32_F32_Tuple,
+            Add_Relu_Mul2_Clamp,
+            ConvFwdDefault>>(instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<
+            GK_GK_Tuple,
+            I32_F32_Tuple,
+            Add_Relu_Mul2_Clamp,
+            ConvFwd1x1P0>>(instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<
+            GK_GK_Tuple,
+            I32_F32_Tuple,
+            Add_Relu_Mul2_Clamp,
+            ConvFwd1x1S1P0>>(instances);
 }
 } // namespace instance
 } // namespace device
@@ -21,15 +21,15 @@ void add_device_conv2d_bias_perlayer_quantization_int8_instances(
                                                               PassThrough,
                                                               Add_Mul_Clamp>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Mul_Clamp, ConvFwdDefault>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Mul_Clamp, ConvFwd1x1P0>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Mul_Clamp, ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Mul_Clamp, ConvFwdDefault>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Mul_Clamp, ConvFwd1x1P0>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Mul_Clamp, ConvFwd1x1S1P0>>(
+        instances);
 }
 
 void add_device_conv2d_bias_relu_perlayer_quantization_int8_instances(
@@ -46,21 +46,17 @@ void add_device_conv2d_bias_relu_perlayer_quantization_int8_instances(
                                                               PassThrough,
                                                               Add_Relu_Mul_Clamp>>>& instances)
 {
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_Tuple,
-                                                                     I32_Tuple,
-                                                                     Add_Relu_Mul_Clamp,
-                                                                     ConvFwdDefault>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Relu_Mul_Clamp, ConvFwdDefault>>(
+        instances);
 
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Relu_Mul_Clamp, ConvFwd1x1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Relu_Mul_Clamp, ConvFwd1x1P0>>(
+        instances);
 
-    add_device_operation_instances(instances,
-                                   device_conv2d_int8_32Ds_instances<GK_Tuple,
-                                                                     I32_Tuple,
-                                                                     Add_Relu_Mul_Clamp,
-                                                                     ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, I32_Tuple, Add_Relu_Mul_Clamp, ConvFwd1x1S1P0>>(
+        instances);
 }
 } // namespace instance
 } // namespace device
@@ -21,15 +21,15 @@ void add_device_conv2d_perchannel_quantization_int8_instances(
                                                               PassThrough,
                                                               Mul2_Clamp>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Mul2_Clamp, ConvFwdDefault>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Mul2_Clamp, ConvFwd1x1P0>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Mul2_Clamp, ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Mul2_Clamp, ConvFwdDefault>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Mul2_Clamp, ConvFwd1x1P0>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Mul2_Clamp, ConvFwd1x1S1P0>>(
+        instances);
 }
 
 void add_device_conv2d_relu_perchannel_quantization_int8_instances(
@@ -46,15 +46,15 @@ void add_device_conv2d_relu_perchannel_quantization_int8_instances(
                                                               PassThrough,
                                                               Relu_Mul2_Clamp>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Relu_Mul2_Clamp, ConvFwdDefault>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Relu_Mul2_Clamp, ConvFwd1x1P0>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Relu_Mul2_Clamp, ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Relu_Mul2_Clamp, ConvFwdDefault>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Relu_Mul2_Clamp, ConvFwd1x1P0>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_32Ds_instances<GK_Tuple, F32_Tuple, Relu_Mul2_Clamp, ConvFwd1x1S1P0>>(
+        instances);
 }
 } // namespace instance
 } // namespace device
@@ -21,15 +21,14 @@ void add_device_conv2d_perlayer_quantization_int8_instances(
                                                               PassThrough,
                                                               Mul_Clamp>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Mul_Clamp, ConvFwdDefault>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Mul_Clamp, ConvFwd1x1P0>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Mul_Clamp, ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Mul_Clamp, ConvFwdDefault>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Mul_Clamp, ConvFwd1x1P0>>(instances);
+    add_device_operation_instances<
+        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Mul_Clamp, ConvFwd1x1S1P0>>(
+        instances);
 }
 
 void add_device_conv2d_relu_perlayer_quantization_int8_instances(
@@ -46,15 +45,15 @@ void add_device_conv2d_relu_perlayer_quantization_int8_instances(
                                                               PassThrough,
                                                               Relu_Mul_Clamp>>>& instances)
 {
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Relu_Mul_Clamp, ConvFwdDefault>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Relu_Mul_Clamp, ConvFwd1x1P0>{});
-    add_device_operation_instances(
-        instances,
-        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Relu_Mul_Clamp, ConvFwd1x1S1P0>{});
+    add_device_operation_instances<
+        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Relu_Mul_Clamp, ConvFwdDefault>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Relu_Mul_Clamp, ConvFwd1x1P0>>(
+        instances);
+    add_device_operation_instances<
+        device_conv2d_int8_instances<Empty_Tuple, Empty_Tuple, Relu_Mul_Clamp, ConvFwd1x1S1P0>>(
+        instances);
 }
 } // namespace instance
 } // namespace device
@@ -18,7 +18,7 @@ static constexpr index_t RANK = 3;
 void add_device_softmax_f16_f16_rank3_reduce2_instances(
     std::vector<DeviceSoftmaxPtr<F16, F32, F16, PassThrough, PassThrough, RANK>>& instances)
 {
-    add_device_operation_instances(instances, device_softmax_f16_f16_instances<RANK, 2>{});
+    add_device_operation_instances<device_softmax_f16_f16_instances<RANK, 2>>(instances);
 }
 
 } // namespace instance
@@ -18,7 +18,7 @@ static constexpr index_t RANK = 4;
 void add_device_softmax_f16_f16_rank4_reduce1_instances(
     std::vector<DeviceSoftmaxPtr<F16, F32, F16, PassThrough, PassThrough, RANK>>& instances)
 {
-    add_device_operation_instances(instances, device_softmax_f16_f16_instances<RANK, 1>{});
+    add_device_operation_instances<device_softmax_f16_f16_instances<RANK, 1>>(instances);
 }
 
 } // namespace instance
@@ -18,7 +18,7 @@ static constexpr index_t RANK = 4;
 void add_device_softmax_f32_f32_rank4_reduce4_instances(
     std::vector<DeviceSoftmaxPtr<F32, F32, F32, PassThrough, PassThrough, RANK>>& instances)
 {
-    add_device_operation_instances(instances, device_softmax_f32_f32_instances<RANK, 4>{});
+    add_device_operation_instances<device_softmax_f32_f32_instances<RANK, 4>>(instances);
 }
 
 } // namespace instance
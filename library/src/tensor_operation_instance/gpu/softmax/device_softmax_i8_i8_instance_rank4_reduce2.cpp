@@ -18,7 +18,7 @@ static constexpr index_t RANK = 4;
 void add_device_softmax_i8_i8_rank4_reduce2_instances(
     std::vector<DeviceSoftmaxPtr<I8, F32, I8, PassThrough, PassThrough, RANK>>& instances)
 {
-    add_device_operation_instances(instances, device_softmax_i8_i8_instances<RANK, 2>{});
+    add_device_operation_instances<device_softmax_i8_i8_instances<RANK, 2>>(instances);
 }
 
 } // namespace instance
@@ -5,7 +5,7 @@
 
 #include "ck/library/utility/device_memory.hpp"
 
-DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size)
+DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size), mCapacity(mem_size)
 {
     hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
 }
@@ -14,6 +14,19 @@ void* DeviceMem::GetDeviceBuffer() const { return mpDeviceBuf; }
 
 std::size_t DeviceMem::GetBufferSize() const { return mMemSize; }
 
+void DeviceMem::Resize(std::size_t mem_size)
+{
+    if(mem_size > mCapacity)
+    {
+        hip_check_error(hipFree(mpDeviceBuf));
+        hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mem_size));
+
+        mCapacity = mem_size;
+    }
+
+    mMemSize = mem_size;
+}
+
 void DeviceMem::ToDevice(const void* p) const
 {
     hip_check_error(hipMemcpy(mpDeviceBuf, const_cast<void*>(p), mMemSize, hipMemcpyHostToDevice));
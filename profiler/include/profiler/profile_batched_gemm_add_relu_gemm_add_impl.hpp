@@ -17,6 +17,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -55,6 +60,8 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
                                                  int BatchStrideE1 = -1)
 
 {
+    ProfilerCacheScope cache_scope;
+
     using Row = tensor_layout::gemm::RowMajor;
     using Col = tensor_layout::gemm::ColumnMajor;
 
@@ -152,6 +159,36 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
     std::cout << "d1_g_m_o: " << d1_g_m_o.mDesc << std::endl;
     std::cout << "e1_g_m_o: " << e1_g_m_o_host_result.mDesc << std::endl;
 
+    set_problem_parameters({{"A0DataType", type_to_string<A0DataType>()},
+                            {"B0DataType", type_to_string<B0DataType>()},
+                            {"D0DataType", type_to_string<D0DataType>()},
+                            {"B1DataType", type_to_string<B1DataType>()},
+                            {"D1DataType", type_to_string<D1DataType>()},
+                            {"E1DataType", type_to_string<E1DataType>()},
+                            {"A0Layout", A0Layout::name},
+                            {"B0Layout", B0Layout::name},
+                            {"D0Layout", D0Layout::name},
+                            {"B1Layout", B1Layout::name},
+                            {"D1Layout", D1Layout::name},
+                            {"E1Layout", E1Layout::name},
+                            {"M", std::to_string(M)},
+                            {"N", std::to_string(N)},
+                            {"K", std::to_string(K)},
+                            {"O", std::to_string(O)},
+                            {"BatchCount", std::to_string(BatchCount)},
+                            {"StrideA0", std::to_string(StrideA0)},
+                            {"StrideB0", std::to_string(StrideB0)},
+                            {"StrideD0", std::to_string(StrideD0)},
+                            {"StrideB1", std::to_string(StrideB1)},
+                            {"StrideD1", std::to_string(StrideD1)},
+                            {"StrideE1", std::to_string(StrideE1)},
+                            {"BatchStrideA0", std::to_string(BatchStrideA0)},
+                            {"BatchStrideB0", std::to_string(BatchStrideB0)},
+                            {"BatchStrideD0", std::to_string(BatchStrideD0)},
+                            {"BatchStrideB1", std::to_string(BatchStrideB1)},
+                            {"BatchStrideD1", std::to_string(BatchStrideD1)},
+                            {"BatchStrideE1", std::to_string(BatchStrideE1)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -170,13 +207,18 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
         d1_g_m_o.GenerateTensorValue(GeneratorTensor_3<D1DataType>{0.0, 1.0});
     }
 
-    DeviceMem a0_g_m_k_device_buf(sizeof(A0DataType) * a0_g_m_k.mDesc.GetElementSize());
-    DeviceMem b0_g_k_n_device_buf(sizeof(B0DataType) * b0_g_k_n.mDesc.GetElementSize());
-    DeviceMem d0_g_m_n_device_buf(sizeof(D0DataType) * d0_g_m_n.mDesc.GetElementSpaceSize());
-    DeviceMem b1_g_n_o_device_buf(sizeof(B1DataType) * b1_g_n_o.mDesc.GetElementSize());
-    DeviceMem d1_g_m_o_device_buf(sizeof(D1DataType) * d1_g_m_o.mDesc.GetElementSpaceSize());
-    DeviceMem e1_g_m_o_device_buf(sizeof(E1DataType) *
-                                  e1_g_m_o_device_result.mDesc.GetElementSize());
+    DeviceMem& a0_g_m_k_device_buf = get_device_buffer(
+        "a0_g_m_k_device_buf", sizeof(A0DataType) * a0_g_m_k.mDesc.GetElementSize());
+    DeviceMem& b0_g_k_n_device_buf = get_device_buffer(
+        "b0_g_k_n_device_buf", sizeof(B0DataType) * b0_g_k_n.mDesc.GetElementSize());
+    DeviceMem& d0_g_m_n_device_buf = get_device_buffer(
+        "d0_g_m_n_device_buf", sizeof(D0DataType) * d0_g_m_n.mDesc.GetElementSpaceSize());
+    DeviceMem& b1_g_n_o_device_buf = get_device_buffer(
+        "b1_g_n_o_device_buf", sizeof(B1DataType) * b1_g_n_o.mDesc.GetElementSize());
+    DeviceMem& d1_g_m_o_device_buf = get_device_buffer(
+        "d1_g_m_o_device_buf", sizeof(D1DataType) * d1_g_m_o.mDesc.GetElementSpaceSize());
+    DeviceMem& e1_g_m_o_device_buf = get_device_buffer(
+        "e1_g_m_o_device_buf", sizeof(E1DataType) * e1_g_m_o_device_result.mDesc.GetElementSize());
 
     a0_g_m_k_device_buf.ToDevice(a0_g_m_k.mData.data());
     b0_g_k_n_device_buf.ToDevice(b0_g_k_n.mData.data());
@@ -210,11 +252,12 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
                                                                           CDE1ElementOp>;
 
     // get device op instances
-    const auto op_ptrs = tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         // Ref Gemm0
@@ -235,27 +278,30 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
                                                                                     B1ElementOp,
                                                                                     PassThrough>;
 
-        auto ref_gemm0          = ReferenceGemm0Instance{};
-        auto ref_gemm0_invoker  = ref_gemm0.MakeInvoker();
-        auto ref_gemm0_argument = ref_gemm0.MakeArgument(
-            a0_g_m_k, b0_g_k_n, c0_g_m_n, a0_element_op, b0_element_op, PassThrough{});
+        verifier.RunReference([&] {
+            auto ref_gemm0          = ReferenceGemm0Instance{};
+            auto ref_gemm0_invoker  = ref_gemm0.MakeInvoker();
+            auto ref_gemm0_argument = ref_gemm0.MakeArgument(
+                a0_g_m_k, b0_g_k_n, c0_g_m_n, a0_element_op, b0_element_op, PassThrough{});
 
-        ref_gemm0_invoker.Run(ref_gemm0_argument);
+            ref_gemm0_invoker.Run(ref_gemm0_argument);
 
-        // cde0_elementwise
-        e0_g_m_n.ForEach(
-            [&](auto&, auto idx) { cde0_element_op(e0_g_m_n(idx), c0_g_m_n(idx), d0_g_m_n(idx)); });
+            // cde0_elementwise
+            e0_g_m_n.ForEach([&](auto&, auto idx) {
+                cde0_element_op(e0_g_m_n(idx), c0_g_m_n(idx), d0_g_m_n(idx));
+            });
 
-        auto ref_gemm1          = ReferenceGemm1Instance{};
-        auto ref_gemm1_invoker  = ref_gemm1.MakeInvoker();
-        auto ref_gemm1_argument = ref_gemm1.MakeArgument(
-            e0_g_m_n, b1_g_n_o, c1_g_m_o, PassThrough{}, b1_element_op, PassThrough{});
+            auto ref_gemm1          = ReferenceGemm1Instance{};
+            auto ref_gemm1_invoker  = ref_gemm1.MakeInvoker();
+            auto ref_gemm1_argument = ref_gemm1.MakeArgument(
+                e0_g_m_n, b1_g_n_o, c1_g_m_o, PassThrough{}, b1_element_op, PassThrough{});
 
-        ref_gemm1_invoker.Run(ref_gemm1_argument);
+            ref_gemm1_invoker.Run(ref_gemm1_argument);
 
-        // cde1_elementwise
-        e1_g_m_o_host_result.ForEach([&](auto&, auto idx) {
-            cde1_element_op(e1_g_m_o_host_result(idx), c1_g_m_o(idx), d1_g_m_o(idx));
+            // cde1_elementwise
+            e1_g_m_o_host_result.ForEach([&](auto&, auto idx) {
+                cde1_element_op(e1_g_m_o_host_result(idx), c1_g_m_o(idx), d1_g_m_o(idx));
+            });
         });
     }
 
@@ -303,8 +349,10 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
         {
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop = (size_t(M) * N * K * 2 + size_t(M) * N * O * 2) * BatchCount;
             std::size_t num_btype =
@@ -327,29 +375,48 @@ bool profile_batched_gemm_add_relu_gemm_add_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{op_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 e1_g_m_o_device_buf.FromDevice(e1_g_m_o_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(e1_g_m_o_device_result, e1_g_m_o_host_result);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(
-                        std::cout << "e1_g_m_o_host_result : ", e1_g_m_o_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "e1_g_m_o_device_result : ", e1_g_m_o_device_result.mData, ",")
-                        << std::endl;
-                }
+                verifier.Add(result, [&, e1_g_m_o_device_result](InstanceResult& instance_result) {
+                    const bool instance_pass =
+                        ck::utils::check_err(e1_g_m_o_device_result, e1_g_m_o_host_result);
+
+                    instance_result.AddVerification(
+                        instance_pass, e1_g_m_o_device_result, e1_g_m_o_host_result);
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(
+                            std::cout << "e1_g_m_o_host_result : ", e1_g_m_o_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "e1_g_m_o_device_result : ",
+                                              e1_g_m_o_device_result.mData,
+                                              ",")
+                            << std::endl;
+                    }
+
+                    return instance_pass;
+                });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            verifier.Add(InstanceResult{op_ptr->GetTypeString()});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
 
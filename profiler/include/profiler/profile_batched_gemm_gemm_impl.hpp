@@ -19,6 +19,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -49,6 +54,8 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
                                     int BatchStrideC  = -1)
 
 {
+    ProfilerCacheScope cache_scope;
+
 
     using Row           = tensor_layout::gemm::RowMajor;
     using Col           = tensor_layout::gemm::ColumnMajor;
@@ -137,6 +144,28 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
     std::cout << "b1_g_n_o: " << b1_g_n_o.mDesc << std::endl;
     std::cout << "c_g_m_o: " << c_g_m_o_host_result.mDesc << std::endl;
 
+    set_problem_parameters({{"ADataType", type_to_string<ADataType>()},
+                            {"B0DataType", type_to_string<B0DataType>()},
+                            {"B1DataType", type_to_string<B1DataType>()},
+                            {"CDataType", type_to_string<CDataType>()},
+                            {"ALayout", ALayout::name},
+                            {"B0Layout", B0Layout::name},
+                            {"B1Layout", B1Layout::name},
+                            {"CLayout", CLayout::name},
+                            {"M", std::to_string(M)},
+                            {"N", std::to_string(N)},
+                            {"K", std::to_string(K)},
+                            {"O", std::to_string(O)},
+                            {"BatchCount", std::to_string(BatchCount)},
+                            {"StrideA", std::to_string(StrideA)},
+                            {"StrideB0", std::to_string(StrideB0)},
+                            {"StrideB1", std::to_string(StrideB1)},
+                            {"StrideC", std::to_string(StrideC)},
+                            {"BatchStrideA", std::to_string(BatchStrideA)},
+                            {"BatchStrideB0", std::to_string(BatchStrideB0)},
+                            {"BatchStrideB1", std::to_string(BatchStrideB1)},
+                            {"BatchStrideC", std::to_string(BatchStrideC)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -161,10 +190,14 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
         b1_g_n_o.GenerateTensorValue(GeneratorTensor_Diagonal<B1DataType>{});
     }
 
-    DeviceMem a_g_m_k_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSize());
-    DeviceMem b0_g_k_n_device_buf(sizeof(B0DataType) * b0_g_k_n.mDesc.GetElementSize());
-    DeviceMem b1_g_n_o_device_buf(sizeof(B1DataType) * b1_g_n_o.mDesc.GetElementSize());
-    DeviceMem c_g_m_o_device_buf(sizeof(CDataType) * c_g_m_o_device_result.mDesc.GetElementSize());
+    DeviceMem& a_g_m_k_device_buf =
+        get_device_buffer("a_g_m_k_device_buf", sizeof(ADataType) * a_g_m_k.mDesc.GetElementSize());
+    DeviceMem& b0_g_k_n_device_buf = get_device_buffer(
+        "b0_g_k_n_device_buf", sizeof(B0DataType) * b0_g_k_n.mDesc.GetElementSize());
+    DeviceMem& b1_g_n_o_device_buf = get_device_buffer(
+        "b1_g_n_o_device_buf", sizeof(B1DataType) * b1_g_n_o.mDesc.GetElementSize());
+    DeviceMem& c_g_m_o_device_buf = get_device_buffer(
+        "c_g_m_o_device_buf", sizeof(CDataType) * c_g_m_o_device_result.mDesc.GetElementSize());
 
     a_g_m_k_device_buf.ToDevice(a_g_m_k.mData.data());
     b0_g_k_n_device_buf.ToDevice(b0_g_k_n.mData.data());
@@ -191,8 +224,7 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
                                                                      CElementOp>;
 
     // get device op instances
-    const auto op_ptrs = tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
@@ -202,21 +234,29 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
         return false;
     }
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
-        auto ref_gemm0          = ReferenceGemm0Instance{};
-        auto ref_gemm0_invoker  = ref_gemm0.MakeInvoker();
-        auto ref_gemm0_argument = ref_gemm0.MakeArgument(
-            a_g_m_k, b0_g_k_n, acc0_g_m_n, a_element_op, b0_element_op, PassThrough{});
-
-        ref_gemm0_invoker.Run(ref_gemm0_argument);
-
-        auto ref_gemm1          = ReferenceGemm1Instance{};
-        auto ref_gemm1_invoker  = ref_gemm1.MakeInvoker();
-        auto ref_gemm1_argument = ref_gemm1.MakeArgument(
-            acc0_g_m_n, b1_g_n_o, c_g_m_o_host_result, PassThrough{}, b1_element_op, c_element_op);
-
-        ref_gemm1_invoker.Run(ref_gemm1_argument);
+        verifier.RunReference([&] {
+            auto ref_gemm0          = ReferenceGemm0Instance{};
+            auto ref_gemm0_invoker  = ref_gemm0.MakeInvoker();
+            auto ref_gemm0_argument = ref_gemm0.MakeArgument(
+                a_g_m_k, b0_g_k_n, acc0_g_m_n, a_element_op, b0_element_op, PassThrough{});
+
+            ref_gemm0_invoker.Run(ref_gemm0_argument);
+
+            auto ref_gemm1          = ReferenceGemm1Instance{};
+            auto ref_gemm1_invoker  = ref_gemm1.MakeInvoker();
+            auto ref_gemm1_argument = ref_gemm1.MakeArgument(acc0_g_m_n,
+                                                             b1_g_n_o,
+                                                             c_g_m_o_host_result,
+                                                             PassThrough{},
+                                                             b1_element_op,
+                                                             c_element_op);
+
+            ref_gemm1_invoker.Run(ref_gemm1_argument);
+        });
     }
 
     std::string best_op_name;
@@ -257,8 +297,10 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
         {
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop      = (size_t(M) * N * K * 2 + size_t(M) * N * O * 2) * BatchCount;
             std::size_t num_btype = (sizeof(ADataType) * M * K + sizeof(B0DataType) * K * N +
@@ -280,35 +322,54 @@ bool profile_batched_gemm_gemm_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{op_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 c_g_m_o_device_buf.FromDevice(c_g_m_o_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_g_m_o_device_result, c_g_m_o_host_result);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a_g_m_k: ", a_g_m_k.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "b0_g_k_n : ", b0_g_k_n.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "b1_g_n_o : ", b1_g_n_o.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "c_g_m_o_host_result : ", c_g_m_o_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "c_g_m_o_device_result : ", c_g_m_o_device_result.mData, ",")
-                        << std::endl;
-                }
+                verifier.Add(result, [&, c_g_m_o_device_result](InstanceResult& instance_result) {
+                    const bool instance_pass =
+                        ck::utils::check_err(c_g_m_o_device_result, c_g_m_o_host_result);
+
+                    instance_result.AddVerification(
+                        instance_pass, c_g_m_o_device_result, c_g_m_o_host_result);
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "a_g_m_k: ", a_g_m_k.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "b0_g_k_n : ", b0_g_k_n.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "b1_g_n_o : ", b1_g_n_o.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "c_g_m_o_host_result : ", c_g_m_o_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "c_g_m_o_device_result : ",
+                                              c_g_m_o_device_result.mData,
+                                              ",")
+                            << std::endl;
+                    }
+
+                    return instance_pass;
+                });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            verifier.Add(InstanceResult{op_ptr->GetTypeString()});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
 
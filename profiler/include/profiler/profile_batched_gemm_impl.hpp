@@ -19,6 +19,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -43,6 +48,8 @@ bool profile_batched_gemm_impl(int do_verification,
                                int StrideC,
                                int BatchCount)
 {
+    ProfilerCacheScope cache_scope;
+
     bool pass = true;
 
     auto f_host_tensor_descriptor = [](std::size_t batch_count,
@@ -76,6 +83,23 @@ bool profile_batched_gemm_impl(int do_verification,
     std::cout << "b_g_k_n: " << b_g_k_n.mDesc << std::endl;
     std::cout << "c_g_m_n: " << c_g_m_n_host_result.mDesc << std::endl;
 
+    set_problem_parameters({{"ADataType", type_to_string<ADataType>()},
+                            {"BDataType", type_to_string<BDataType>()},
+                            {"CDataType", type_to_string<CDataType>()},
+                            {"ALayout", ALayout::name},
+                            {"BLayout", BLayout::name},
+                            {"CLayout", CLayout::name},
+                            {"M", std::to_string(M)},
+                            {"N", std::to_string(N)},
+                            {"K", std::to_string(K)},
+                            {"BatchStrideA", std::to_string(BatchStrideA)},
+                            {"BatchStrideB", std::to_string(BatchStrideB)},
+                            {"BatchStrideC", std::to_string(BatchStrideC)},
+                            {"StrideA", std::to_string(StrideA)},
+                            {"StrideB", std::to_string(StrideB)},
+                            {"StrideC", std::to_string(StrideC)},
+                            {"BatchCount", std::to_string(BatchCount)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -96,6 +120,8 @@ bool profile_batched_gemm_impl(int do_verification,
     const auto b_element_op = BElementOp{};
     const auto c_element_op = CElementOp{};
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         using ReferenceBatchedGemmInstance =
@@ -107,18 +133,23 @@ bool profile_batched_gemm_impl(int do_verification,
                                                              BElementOp,
                                                              CElementOp>;
 
-        auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
-        auto ref_invoker      = ref_batched_gemm.MakeInvoker();
+        verifier.RunReference([&] {
+            auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
+            auto ref_invoker      = ref_batched_gemm.MakeInvoker();
 
-        auto ref_argument = ref_batched_gemm.MakeArgument(
-            a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
+            auto ref_argument = ref_batched_gemm.MakeArgument(
+                a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+            ref_invoker.Run(ref_argument);
+        });
     }
 
-    DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
-    DeviceMem b_device_buf(sizeof(BDataType) * b_g_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_g_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& a_device_buf =
+        get_device_buffer("a_device_buf", sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem& b_device_buf =
+        get_device_buffer("b_device_buf", sizeof(BDataType) * b_g_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem& c_device_buf = get_device_buffer(
+        "c_device_buf", sizeof(CDataType) * c_g_m_n_device_result.mDesc.GetElementSpaceSize());
 
     a_device_buf.ToDevice(a_g_m_k.mData.data());
     b_device_buf.ToDevice(b_g_k_n.mData.data());
@@ -135,8 +166,7 @@ bool profile_batched_gemm_impl(int do_verification,
                                                                      CElementOp>;
 
     // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
@@ -175,8 +205,10 @@ bool profile_batched_gemm_impl(int do_verification,
 
             std::string op_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop = std::size_t(2) * BatchCount * M * N * K;
 
@@ -199,30 +231,49 @@ bool profile_batched_gemm_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{op_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "b: ", b_g_k_n.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_host: ", c_g_m_n_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "c_device: ", c_g_m_n_device_result.mData, ",")
-                        << std::endl;
-                }
+                verifier.Add(result, [&, c_g_m_n_device_result](InstanceResult& instance_result) {
+                    const bool instance_pass =
+                        ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+
+                    instance_result.AddVerification(
+                        instance_pass, c_g_m_n_device_result, c_g_m_n_host_result);
+
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",") << std::endl;
+                        LogRangeAsType<float>(std::cout << "b: ", b_g_k_n.mData, ",") << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "c_host: ", c_g_m_n_host_result.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(
+                            std::cout << "c_device: ", c_g_m_n_device_result.mData, ",")
+                            << std::endl;
+                    }
+
+                    return instance_pass;
+                });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            verifier.Add(InstanceResult{op_ptr->GetTypeString()});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
 
@@ -17,6 +17,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -72,6 +77,8 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
                                       int StrideC,
                                       int BatchCount)
 {
+    ProfilerCacheScope cache_scope;
+
     bool pass = true;
 
     auto f_host_tensor_descriptor = [](std::size_t batch_count,
@@ -111,6 +118,21 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
     std::cout << "d1_g_m: " << d1_g_m_host_result.mDesc << std::endl;
 
     std::size_t num_thread = std::thread::hardware_concurrency();
+    set_problem_parameters({{"ADataType", type_to_string<ADataType>()},
+                            {"BDataType", type_to_string<BDataType>()},
+                            {"CDataType", type_to_string<CDataType>()},
+                            {"ReduceDataType", type_to_string<ReduceDataType>()},
+                            {"ALayout", ALayout::name},
+                            {"BLayout", BLayout::name},
+                            {"CLayout", CLayout::name},
+                            {"M", std::to_string(M)},
+                            {"N", std::to_string(N)},
+                            {"K", std::to_string(K)},
+                            {"StrideA", std::to_string(StrideA)},
+                            {"StrideB", std::to_string(StrideB)},
+                            {"StrideC", std::to_string(StrideC)},
+                            {"BatchCount", std::to_string(BatchCount)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -146,6 +168,8 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
     std::array<void*, 2> reduce_in_element_ops  = {&passthrough, &square};
     std::array<void*, 2> reduce_out_element_ops = {&passthrough, &passthrough};
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         using ReferenceBatchedGemmInstance =
@@ -159,45 +183,54 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
 
         using ReduceAccDataType = ReduceDataType;
 
-        auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
-        auto ref_invoker      = ref_batched_gemm.MakeInvoker();
+        verifier.RunReference([&] {
+            auto ref_batched_gemm = ReferenceBatchedGemmInstance{};
+            auto ref_invoker      = ref_batched_gemm.MakeInvoker();
 
-        auto ref_argument = ref_batched_gemm.MakeArgument(
-            a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
+            auto ref_argument = ref_batched_gemm.MakeArgument(
+                a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+            ref_invoker.Run(ref_argument);
 
-        for(int batch = 0; batch < BatchCount; ++batch)
-        {
-            for(int m = 0; m < M; ++m)
+            for(int batch = 0; batch < BatchCount; ++batch)
             {
-                auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
-                auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
-
-                for(int n = 0; n < N; ++n)
+                for(int m = 0; m < M; ++m)
                 {
-                    ReduceAccDataType d0_val =
-                        ck::type_convert<ReduceAccDataType>(c_g_m_n_host_result(batch, m, n));
-                    ReduceAccDataType d1_val;
-
-                    square(d1_val, d0_val);
-                    reduce0_op(reduce0_acc, d0_val);
-                    reduce1_op(reduce1_acc, d1_val);
+                    auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
+                    auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
+
+                    for(int n = 0; n < N; ++n)
+                    {
+                        ReduceAccDataType d0_val =
+                            ck::type_convert<ReduceAccDataType>(c_g_m_n_host_result(batch, m, n));
+                        ReduceAccDataType d1_val;
+
+                        square(d1_val, d0_val);
+                        reduce0_op(reduce0_acc, d0_val);
+                        reduce1_op(reduce1_acc, d1_val);
+                    }
+
+                    d0_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce0_acc);
+                    d1_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce1_acc);
                 }
-
-                d0_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce0_acc);
-                d1_g_m_host_result(batch, m) = ck::type_convert<ReduceDataType>(reduce1_acc);
             }
-        }
+        });
     }
 
-    DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
-    DeviceMem b_device_buf(sizeof(BDataType) * b_g_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_g_m_n_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem reduce0_device_buf(sizeof(ReduceDataType) *
-                                 d0_g_m_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem reduce1_device_buf(sizeof(ReduceDataType) *
-                                 d1_g_m_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& a_device_buf =
+        get_device_buffer("a_device_buf", sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem& b_device_buf =
+        get_device_buffer("b_device_buf", sizeof(BDataType) * b_g_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem& c_device_buf = get_device_buffer(
+        "c_device_buf", sizeof(CDataType) * c_g_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& reduce0_device_buf =
+        get_device_buffer("reduce0_device_buf",
+                          sizeof(ReduceDataType) *
+                              d0_g_m_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& reduce1_device_buf =
+        get_device_buffer("reduce1_device_buf",
+                          sizeof(ReduceDataType) *
+                              d1_g_m_device_result.mDesc.GetElementSpaceSize());
 
     std::array<void*, 2> p_reduces = {reduce0_device_buf.GetDeviceBuffer(),
                                       reduce1_device_buf.GetDeviceBuffer()};
@@ -285,8 +318,10 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
             reduce0_device_buf.SetZero();
             reduce1_device_buf.SetZero();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::string gemm_name = gemm_ptr->GetTypeString();
 
@@ -310,48 +345,76 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{gemm_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
                 reduce0_device_buf.FromDevice(d0_g_m_device_result.mData.data());
                 reduce1_device_buf.FromDevice(d1_g_m_device_result.mData.data());
 
-                bool c_error  = ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
-                bool d0_error = ck::utils::check_err(d0_g_m_device_result, d0_g_m_host_result);
-                bool d1_error = ck::utils::check_err(d1_g_m_device_result, d1_g_m_host_result);
-
-                pass = pass && (c_error == true);
-                pass = pass && (d0_error == true);
-                pass = pass && (d1_error == true);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "b: ", b_g_k_n.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_host: ", c_g_m_n_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "c_device: ", c_g_m_n_device_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "d0_host: ", d0_g_m_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "d0_device: ", d0_g_m_device_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "d1_host: ", d1_g_m_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "d1_device: ", d1_g_m_device_result.mData, ",")
-                        << std::endl;
-                }
+                verifier.Add(
+                    result,
+                    [&, c_g_m_n_device_result, d0_g_m_device_result, d1_g_m_device_result](
+                        InstanceResult& instance_result) {
+                        bool c_error =
+                            ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+                        bool d0_error =
+                            ck::utils::check_err(d0_g_m_device_result, d0_g_m_host_result);
+                        bool d1_error =
+                            ck::utils::check_err(d1_g_m_device_result, d1_g_m_host_result);
+
+                        instance_result.AddVerification(
+                            c_error, c_g_m_n_device_result, c_g_m_n_host_result);
+                        instance_result.AddVerification(
+                            d0_error, d0_g_m_device_result, d0_g_m_host_result);
+                        instance_result.AddVerification(
+                            d1_error, d1_g_m_device_result, d1_g_m_host_result);
+
+                        if(do_log)
+                        {
+                            LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(std::cout << "b: ", b_g_k_n.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "c_host: ", c_g_m_n_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "c_device: ", c_g_m_n_device_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d0_host: ", d0_g_m_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d0_device: ", d0_g_m_device_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d1_host: ", d1_g_m_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d1_device: ", d1_g_m_device_result.mData, ",")
+                                << std::endl;
+                        }
+
+                        return c_error && d0_error && d1_error;
+                    });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << "does not support this GEMM problem" << std::endl;
+
+            verifier.Add(InstanceResult{gemm_ptr->GetTypeString()});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_gemm_name << std::endl;
 
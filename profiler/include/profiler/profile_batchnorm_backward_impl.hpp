@@ -15,6 +15,11 @@
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_backward.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_backward.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -36,6 +41,8 @@ bool profile_batchnorm_backward_impl(bool do_verification,
                                      bool haveSavedMeanInvVar,
                                      double epsilon)
 {
+    ProfilerCacheScope cache_scope;
+
     if(inOutLengths.size() != Rank || reduceDims.size() != NumBatchNormReduceDim)
     {
         throw std::runtime_error("Invalid tensor lengths or number of reduce dimensions!");
@@ -126,6 +133,18 @@ bool profile_batchnorm_backward_impl(bool do_verification,
         x.GenerateTensorValue(GeneratorTensor_4<XDataType>{x_mean, x_stddev}, num_thread);
     };
 
+    set_problem_parameters({{"XDataType", type_to_string<XDataType>()},
+                            {"DxDataType", type_to_string<DxDataType>()},
+                            {"DyDataType", type_to_string<DyDataType>()},
+                            {"AccDataType", type_to_string<AccDataType>()},
+                            {"ScaleDataType", type_to_string<ScaleDataType>()},
+                            {"DscaleDbiasDataType", type_to_string<DscaleDbiasDataType>()},
+                            {"MeanVarDataType", type_to_string<MeanVarDataType>()},
+                            {"InOutLengths", get_parameter_string(inOutLengths)},
+                            {"ReduceDims", get_parameter_string(reduceDims)},
+                            {"HaveSavedMeanInvVar", std::to_string(haveSavedMeanInvVar)},
+                            {"Epsilon", get_parameter_string(epsilon)}});
+
     if(do_verification)
     {
         switch(init_method)
@@ -149,19 +168,27 @@ bool profile_batchnorm_backward_impl(bool do_verification,
     };
 
     // input data of the batchnorm backward algorithm
-    DeviceMem x_dev(sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
-    DeviceMem dy_dev(sizeof(DyDataType) * dy.mDesc.GetElementSpaceSize());
+    DeviceMem& x_dev =
+        get_device_buffer("x_dev", sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
+    DeviceMem& dy_dev =
+        get_device_buffer("dy_dev", sizeof(DyDataType) * dy.mDesc.GetElementSpaceSize());
 
-    DeviceMem bnScale_dev(sizeof(ScaleDataType) * bnScale.mDesc.GetElementSpaceSize());
+    DeviceMem& bnScale_dev = get_device_buffer(
+        "bnScale_dev", sizeof(ScaleDataType) * bnScale.mDesc.GetElementSpaceSize());
 
-    DeviceMem savedMean_dev(sizeof(MeanVarDataType) * savedMean.mDesc.GetElementSpaceSize());
-    DeviceMem savedInvVar_dev(sizeof(MeanVarDataType) * savedInvVar.mDesc.GetElementSpaceSize());
+    DeviceMem& savedMean_dev = get_device_buffer(
+        "savedMean_dev", sizeof(MeanVarDataType) * savedMean.mDesc.GetElementSpaceSize());
+    DeviceMem& savedInvVar_dev = get_device_buffer(
+        "savedInvVar_dev", sizeof(MeanVarDataType) * savedInvVar.mDesc.GetElementSpaceSize());
 
     // output data of the batchnorm backward algorithm
-    DeviceMem dx_dev(sizeof(DxDataType) * dx.mDesc.GetElementSpaceSize());
+    DeviceMem& dx_dev =
+        get_device_buffer("dx_dev", sizeof(DxDataType) * dx.mDesc.GetElementSpaceSize());
 
-    DeviceMem dscale_dev(sizeof(DscaleDbiasDataType) * dscale.mDesc.GetElementSpaceSize());
-    DeviceMem dbias_dev(sizeof(DscaleDbiasDataType) * dbias.mDesc.GetElementSpaceSize());
+    DeviceMem& dscale_dev = get_device_buffer(
+        "dscale_dev", sizeof(DscaleDbiasDataType) * dscale.mDesc.GetElementSpaceSize());
+    DeviceMem& dbias_dev = get_device_buffer(
+        "dbias_dev", sizeof(DscaleDbiasDataType) * dbias.mDesc.GetElementSpaceSize());
 
     x_dev.ToDevice(x.mData.data());
     dy_dev.ToDevice(dy.mData.data());
@@ -205,9 +232,7 @@ bool profile_batchnorm_backward_impl(bool do_verification,
                                                                       NumBatchNormReduceDim>;
 
     // get device op instances
-    const auto instance_ptrs =
-        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-            DeviceOp>::GetInstances();
+    const auto& instance_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
@@ -215,6 +240,9 @@ bool profile_batchnorm_backward_impl(bool do_verification,
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
 
+    // the dumps of the outputs need the reference outputs of the host
+    ProfilerVerifier verifier(do_dumpout);
+
     if(do_verification)
     {
         using ReferenceBatchNormBwdInstance =
@@ -259,9 +287,10 @@ bool profile_batchnorm_backward_impl(bool do_verification,
             return (false);
         };
 
-        auto invoker_ptr_ref = batchNormBwd_ref.MakeInvokerPointer();
-
-        (void)invoker_ptr_ref->Run(argument_ptr_ref.get());
+        verifier.RunReference([argument_ptr_ref = std::move(argument_ptr_ref),
+                               invoker_ptr_ref  = batchNormBwd_ref.MakeInvokerPointer()] {
+            (void)invoker_ptr_ref->Run(argument_ptr_ref.get());
+        });
     }
 
     int num_kernel = 0;
@@ -302,18 +331,23 @@ bool profile_batchnorm_backward_impl(bool do_verification,
                           << " skipped due to unsupported argument: " << std::endl;
             }
 
+            verifier.Add(InstanceResult{inst_ptr->GetTypeString()});
+
             continue;
         };
 
         size_t workspace_sz = inst_ptr->GetWorkSpaceSize(argument_ptr.get());
 
-        DeviceMem workspace_dev(workspace_sz);
+        DeviceMem& workspace_dev = get_device_buffer("workspace_dev", workspace_sz);
 
         inst_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace_dev.GetDeviceBuffer());
 
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
 
-        float avg_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+        ck::TimingStatistics timing;
+
+        float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                          get_profiler_stream_config(time_kernel, &timing));
 
         size_t num_bytes = 0;
 
@@ -338,22 +372,34 @@ bool profile_batchnorm_backward_impl(bool do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        InstanceResult result{inst_ptr->GetTypeString(), timing, avg_time, 0, gb_per_sec};
+
         if(do_verification)
         {
-            using ck::utils::check_err;
-            bool single_pass = true;
-
             dx_dev.FromDevice(dx.mData.data());
             dscale_dev.FromDevice(dscale.data());
             dbias_dev.FromDevice(dbias.data());
 
-            // clang-format off
-            single_pass = single_pass && ck::utils::check_err(dx.mData, dx_ref.mData, "dx result:", 5e-4, 5e-4);
-            single_pass = single_pass && ck::utils::check_err(dscale.mData, dscale_ref.mData, "dScale result:", 3e-3, 3e-3);
-            single_pass = single_pass && ck::utils::check_err(dbias.mData, dbias_ref.mData, "dBias result:", 3e-3, 3e-3);
-            // clang-format on
+            verifier.Add(result, [&, dx, dscale, dbias](InstanceResult& instance_result) {
+                using ck::utils::check_err;
+                bool single_pass = true;
+
+                // clang-format off
+                single_pass = single_pass && ck::utils::check_err(dx.mData, dx_ref.mData, "dx result:", 5e-4, 5e-4);
+                single_pass = single_pass && ck::utils::check_err(dscale.mData, dscale_ref.mData, "dScale result:", 3e-3, 3e-3);
+                single_pass = single_pass && ck::utils::check_err(dbias.mData, dbias_ref.mData, "dBias result:", 3e-3, 3e-3);
+                // clang-format on
+
+                instance_result.AddVerification(single_pass, dx.mData, dx_ref.mData);
+                instance_result.AddVerification(single_pass, dscale.mData, dscale_ref.mData);
+                instance_result.AddVerification(single_pass, dbias.mData, dbias_ref.mData);
 
-            pass = pass && single_pass;
+                return single_pass;
+            });
+        }
+        else
+        {
+            verifier.Add(result);
         };
 
         if(do_dumpout)
@@ -371,6 +417,8 @@ bool profile_batchnorm_backward_impl(bool do_verification,
         };
     }
 
+    pass = verifier.Wait() && pass;
+
     if(time_kernel)
     {
         std::cout << "best perf = " << best_avg_time << " ms, " << best_gb_per_sec << " GB/s, "
@@ -15,6 +15,11 @@
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_forward.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_forward.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -37,6 +42,8 @@ bool profile_batchnorm_forward_impl(int do_verification,
                                     double averageFactor,
                                     double epsilon)
 {
+    ProfilerCacheScope cache_scope;
+
     if(inOutLengths.size() != Rank || reduceDims.size() != NumBatchNormReduceDim)
     {
         throw std::runtime_error("Invalid tensor lengths or number of reduce dimensions!");
@@ -110,6 +117,19 @@ bool profile_batchnorm_forward_impl(int do_verification,
             x.GenerateTensorValue(GeneratorTensor_3<XDataType>{-1.0f, 1.0f}, num_thread);
     };
 
+    set_problem_parameters({{"XDataType", type_to_string<XDataType>()},
+                            {"YDataType", type_to_string<YDataType>()},
+                            {"AccDataType", type_to_string<AccDataType>()},
+                            {"ScaleDataType", type_to_string<ScaleDataType>()},
+                            {"BiasDataType", type_to_string<BiasDataType>()},
+                            {"MeanVarDataType", type_to_string<MeanVarDataType>()},
+                            {"InOutLengths", get_parameter_string(inOutLengths)},
+                            {"ReduceDims", get_parameter_string(reduceDims)},
+                            {"UpdateMovingAverage", std::to_string(updateMovingAverage)},
+                            {"SaveMeanAndInvVariance", std::to_string(saveMeanAndInvVariance)},
+                            {"AverageFactor", get_parameter_string(averageFactor)},
+                            {"Epsilon", get_parameter_string(epsilon)}});
+
     if(do_verification)
     {
         switch(init_method)
@@ -133,23 +153,35 @@ bool profile_batchnorm_forward_impl(int do_verification,
     };
 
     // these buffers are usually provided by the user application
-    DeviceMem x_dev(sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
-    DeviceMem y_dev(sizeof(XDataType) * y.mDesc.GetElementSpaceSize());
-    DeviceMem bnScale_dev(sizeof(ScaleDataType) * bnScale.mDesc.GetElementSpaceSize());
-    DeviceMem bnBias_dev(sizeof(BiasDataType) * bnBias.mDesc.GetElementSpaceSize());
+    DeviceMem& x_dev =
+        get_device_buffer("x_dev", sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
+    DeviceMem& y_dev =
+        get_device_buffer("y_dev", sizeof(XDataType) * y.mDesc.GetElementSpaceSize());
+    DeviceMem& bnScale_dev = get_device_buffer(
+        "bnScale_dev", sizeof(ScaleDataType) * bnScale.mDesc.GetElementSpaceSize());
+    DeviceMem& bnBias_dev =
+        get_device_buffer("bnBias_dev", sizeof(BiasDataType) * bnBias.mDesc.GetElementSpaceSize());
 
     // mean_dev or resultSaveMean_dev
-    DeviceMem resultSaveMean_dev(sizeof(MeanVarDataType) *
-                                 resultSaveMean_ref.mDesc.GetElementSpaceSize());
+    DeviceMem& resultSaveMean_dev =
+        get_device_buffer("resultSaveMean_dev",
+                          sizeof(MeanVarDataType) *
+                              resultSaveMean_ref.mDesc.GetElementSpaceSize());
     // meansquare_dev or resultSaveInvVariance_dev
-    DeviceMem resultSaveInvVariance_dev(sizeof(MeanVarDataType) *
-                                        resultSaveInvVariance_ref.mDesc.GetElementSpaceSize());
+    DeviceMem& resultSaveInvVariance_dev =
+        get_device_buffer("resultSaveInvVariance_dev",
+                          sizeof(MeanVarDataType) *
+                              resultSaveInvVariance_ref.mDesc.GetElementSpaceSize());
     // resultRunningMean_dev
-    DeviceMem resultRunningMean_dev(sizeof(MeanVarDataType) *
-                                    resultRunningMean_ref.mDesc.GetElementSpaceSize());
+    DeviceMem& resultRunningMean_dev =
+        get_device_buffer("resultRunningMean_dev",
+                          sizeof(MeanVarDataType) *
+                              resultRunningMean_ref.mDesc.GetElementSpaceSize());
     // resultRunningVariance_dev
-    DeviceMem resultRunningVariance_dev(sizeof(MeanVarDataType) *
-                                        resultRunningVariance_ref.mDesc.GetElementSpaceSize());
+    DeviceMem& resultRunningVariance_dev =
+        get_device_buffer("resultRunningVariance_dev",
+                          sizeof(MeanVarDataType) *
+                              resultRunningVariance_ref.mDesc.GetElementSpaceSize());
 
     x_dev.ToDevice(x.mData.data());
     bnScale_dev.ToDevice(bnScale.mData.data());
@@ -200,9 +232,7 @@ bool profile_batchnorm_forward_impl(int do_verification,
                                                                       NumBatchNormReduceDim>;
 
     // get device op instances
-    const auto instance_ptrs =
-        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-            DeviceOp>::GetInstances();
+    const auto& instance_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
@@ -210,6 +240,9 @@ bool profile_batchnorm_forward_impl(int do_verification,
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
 
+    // the dumps of the outputs need the reference outputs of the host
+    ProfilerVerifier verifier(do_dumpout);
+
     if(do_verification)
     {
         using ReferenceBatchNormFwdInstance =
@@ -253,9 +286,10 @@ bool profile_batchnorm_forward_impl(int do_verification,
             return (false);
         };
 
-        auto invoker_ptr_ref = batchNormFwd_ref.MakeInvokerPointer();
-
-        (void)invoker_ptr_ref->Run(argument_ptr_ref.get());
+        verifier.RunReference([argument_ptr_ref = std::move(argument_ptr_ref),
+                               invoker_ptr_ref  = batchNormFwd_ref.MakeInvokerPointer()] {
+            (void)invoker_ptr_ref->Run(argument_ptr_ref.get());
+        });
     }
 
     int num_kernel = 0;
@@ -296,18 +330,23 @@ bool profile_batchnorm_forward_impl(int do_verification,
                           << " skipped due to unsupported argument: " << std::endl;
             }
 
+            verifier.Add(InstanceResult{inst_ptr->GetTypeString()});
+
             continue;
         };
 
         size_t workspace_sz = inst_ptr->GetWorkSpaceSize(argument_ptr.get());
 
-        DeviceMem workspace_dev(workspace_sz);
+        DeviceMem& workspace_dev = get_device_buffer("workspace_dev", workspace_sz);
 
         inst_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace_dev.GetDeviceBuffer());
 
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
 
-        float avg_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+        ck::TimingStatistics timing;
+
+        float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                          get_profiler_stream_config(time_kernel, &timing));
 
         size_t num_bytes = 0;
 
@@ -334,41 +373,84 @@ bool profile_batchnorm_forward_impl(int do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        InstanceResult result{inst_ptr->GetTypeString(), timing, avg_time, 0, gb_per_sec};
+
         if(do_verification)
         {
-            using ck::utils::check_err;
-            bool single_pass;
-
             y_dev.FromDevice(y.mData.data());
 
-            if constexpr(ck::is_same_v<YDataType, ck::bhalf_t>)
-                single_pass = check_err(y.mData, y_ref.mData, "y results", 1e-2, 1e-2);
-            else
-                single_pass = check_err(y.mData, y_ref.mData, "y results", 4e-3, 4e-3);
-
             if(updateMovingAverage)
             {
                 resultRunningMean_dev.FromDevice(resultRunningMean.mData.data());
                 resultRunningVariance_dev.FromDevice(resultRunningVariance.mData.data());
-
-                // clang-format off
-                single_pass = single_pass && check_err(resultRunningMean.mData, resultRunningMean_ref.mData, "average mean results", 1.5e-5, 1.5e-5);
-                single_pass = single_pass && check_err(resultRunningVariance.mData, resultRunningVariance_ref.mData, "average variance results", 1e-5, 1e-5);
-                // clang-format on
             };
 
             if(saveMeanAndInvVariance)
             {
                 resultSaveMean_dev.FromDevice(resultSaveMean.mData.data());
                 resultSaveInvVariance_dev.FromDevice(resultSaveInvVariance.mData.data());
-
-                // clang-format off
-                single_pass = single_pass && check_err(resultSaveMean.mData, resultSaveMean_ref.mData, "mean results", 3e-5, 3e-5);
-                single_pass = single_pass && check_err(resultSaveInvVariance.mData, resultSaveInvVariance_ref.mData, "inv-variance results", 7e-5, 7e-5);
-                // clang-format on
             };
 
-            pass = pass && single_pass;
+            verifier.Add(result,
+                         [&,
+                          y,
+                          resultRunningMean,
+                          resultRunningVariance,
+                          resultSaveMean,
+                          resultSaveInvVariance](InstanceResult& instance_result) {
+                             using ck::utils::check_err;
+                             bool single_pass;
+
+                             if constexpr(ck::is_same_v<YDataType, ck::bhalf_t>)
+                                 single_pass =
+                                     check_err(y.mData, y_ref.mData, "y results", 1e-2, 1e-2);
+                             else
+                                 single_pass =
+                                     check_err(y.mData, y_ref.mData, "y results", 4e-3, 4e-3);
+
+                             if(updateMovingAverage)
+                             {
+                                 // clang-format off
+                                 single_pass = single_pass && check_err(resultRunningMean.mData, resultRunningMean_ref.mData, "average mean results", 1.5e-5, 1.5e-5);
+                                 single_pass = single_pass && check_err(resultRunningVariance.mData, resultRunningVariance_ref.mData, "average variance results", 1e-5, 1e-5);
+                                 // clang-format on
+                             };
+
+                             if(saveMeanAndInvVariance)
+                             {
+                                 // clang-format off
+                                 single_pass = single_pass && check_err(resultSaveMean.mData, resultSaveMean_ref.mData, "mean results", 3e-5, 3e-5);
+                                 single_pass = single_pass && check_err(resultSaveInvVariance.mData, resultSaveInvVariance_ref.mData, "inv-variance results", 7e-5, 7e-5);
+                                 // clang-format on
+                             };
+
+                             instance_result.AddVerification(single_pass, y.mData, y_ref.mData);
+
+                             if(updateMovingAverage)
+                             {
+                                 instance_result.AddVerification(single_pass,
+                                                                 resultRunningMean.mData,
+                                                                 resultRunningMean_ref.mData);
+                                 instance_result.AddVerification(single_pass,
+                                                                 resultRunningVariance.mData,
+                                                                 resultRunningVariance_ref.mData);
+                             }
+
+                             if(saveMeanAndInvVariance)
+                             {
+                                 instance_result.AddVerification(
+                                     single_pass, resultSaveMean.mData, resultSaveMean_ref.mData);
+                                 instance_result.AddVerification(single_pass,
+                                                                 resultSaveInvVariance.mData,
+                                                                 resultSaveInvVariance_ref.mData);
+                             }
+
+                             return single_pass;
+                         });
+        }
+        else
+        {
+            verifier.Add(result);
         };
 
         if(do_dumpout)
@@ -393,6 +475,8 @@ bool profile_batchnorm_forward_impl(int do_verification,
         };
     }
 
+    pass = verifier.Wait() && pass;
+
     if(time_kernel)
     {
         std::cout << "best perf = " << best_avg_time << " ms, " << best_gb_per_sec << " GB/s, "
@@ -18,11 +18,16 @@
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
 template <typename DataType>
-void show_data_nhwc_layout(Tensor<DataType>& nhwc)
+void show_data_nhwc_layout(const Tensor<DataType>& nhwc)
 {
     std::cout << "[";
     for(int n = 0; n < ck::type_convert<int>(nhwc.mDesc.GetLengths()[0]); n++)
@@ -60,6 +65,8 @@ bool profile_conv_bwd_data_impl(int do_verification,
                                 bool time_kernel,
                                 const ck::utils::conv::ConvParam& conv_param)
 {
+    ProfilerCacheScope cache_scope;
+
     using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
     using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
     using OutElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -86,6 +93,13 @@ bool profile_conv_bwd_data_impl(int do_verification,
     std::cout << "weight: " << weight.mDesc << std::endl;
     std::cout << "output: " << output.mDesc << std::endl;
 
+    set_problem_parameters(get_conv_problem_parameters<InLayout,
+                                                       WeiLayout,
+                                                       OutLayout,
+                                                       InDataType,
+                                                       WeiDataType,
+                                                       OutDataType>(conv_param));
+
     switch(init_method)
     {
     case 0: break;
@@ -98,36 +112,43 @@ bool profile_conv_bwd_data_impl(int do_verification,
         weight.GenerateTensorValue(GeneratorTensor_3<WeiDataType>{-0.5, 0.5});
     }
 
-    DeviceMem in_device_buf(sizeof(InDataType) * input_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem wei_device_buf(sizeof(WeiDataType) * weight.mDesc.GetElementSpaceSize());
-    DeviceMem out_device_buf(sizeof(OutDataType) * output.mDesc.GetElementSpaceSize());
+    DeviceMem& in_device_buf = get_device_buffer(
+        "in_device_buf", sizeof(InDataType) * input_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& wei_device_buf = get_device_buffer(
+        "wei_device_buf", sizeof(WeiDataType) * weight.mDesc.GetElementSpaceSize());
+    DeviceMem& out_device_buf = get_device_buffer(
+        "out_device_buf", sizeof(OutDataType) * output.mDesc.GetElementSpaceSize());
 
     out_device_buf.ToDevice(output.mData.data());
     wei_device_buf.ToDevice(weight.mData.data());
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
-        auto ref_conv = ck::tensor_operation::host::ReferenceConvBwdData<NDimSpatial,
-                                                                         InDataType,
-                                                                         WeiDataType,
-                                                                         OutDataType,
-                                                                         InElementOp,
-                                                                         WeiElementOp,
-                                                                         OutElementOp>{};
-
-        auto ref_invoker = ref_conv.MakeInvoker();
-
-        auto ref_argument = ref_conv.MakeArgument(input_host_result,
-                                                  weight,
-                                                  output,
-                                                  conv_param.conv_filter_strides_,
-                                                  conv_param.conv_filter_dilations_,
-                                                  conv_param.input_left_pads_,
-                                                  conv_param.input_right_pads_,
-                                                  InElementOp{},
-                                                  WeiElementOp{},
-                                                  OutElementOp{});
-        ref_invoker.Run(ref_argument);
+        verifier.RunReference([&] {
+            auto ref_conv = ck::tensor_operation::host::ReferenceConvBwdData<NDimSpatial,
+                                                                             InDataType,
+                                                                             WeiDataType,
+                                                                             OutDataType,
+                                                                             InElementOp,
+                                                                             WeiElementOp,
+                                                                             OutElementOp>{};
+
+            auto ref_invoker = ref_conv.MakeInvoker();
+
+            auto ref_argument = ref_conv.MakeArgument(input_host_result,
+                                                      weight,
+                                                      output,
+                                                      conv_param.conv_filter_strides_,
+                                                      conv_param.conv_filter_dilations_,
+                                                      conv_param.input_left_pads_,
+                                                      conv_param.input_right_pads_,
+                                                      InElementOp{},
+                                                      WeiElementOp{},
+                                                      OutElementOp{});
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceConvBwdData<NDimSpatial,
@@ -142,8 +163,7 @@ bool profile_conv_bwd_data_impl(int do_verification,
                                                                      OutElementOp>;
 
     // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
@@ -185,8 +205,10 @@ bool profile_conv_bwd_data_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -205,38 +227,56 @@ bool profile_conv_bwd_data_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{op_name, timing, avg_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 in_device_buf.FromDevice(input_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(input_device_result, input_host_result);
+                verifier.Add(result, [&, input_device_result](InstanceResult& instance_result) {
+                    const bool instance_pass =
+                        ck::utils::check_err(input_device_result, input_host_result);
 
-                if(do_log)
-                {
-                    std::cout << "in : ";
-                    show_data_nhwc_layout(output);
-                    std::cout << std::endl;
+                    instance_result.AddVerification(
+                        instance_pass, input_device_result, input_host_result);
 
-                    std::cout << "wei: ";
-                    show_data_nhwc_layout(weight);
-                    std::cout << std::endl;
+                    if(do_log)
+                    {
+                        std::cout << "in : ";
+                        show_data_nhwc_layout(output);
+                        std::cout << std::endl;
 
-                    std::cout << "out_host  : ";
-                    show_data_nhwc_layout(input_host_result);
-                    std::cout << std::endl;
+                        std::cout << "wei: ";
+                        show_data_nhwc_layout(weight);
+                        std::cout << std::endl;
 
-                    std::cout << "out_device: ";
-                    show_data_nhwc_layout(input_device_result);
-                    std::cout << std::endl;
-                }
+                        std::cout << "out_host  : ";
+                        show_data_nhwc_layout(input_host_result);
+                        std::cout << std::endl;
+
+                        std::cout << "out_device: ";
+                        show_data_nhwc_layout(input_device_result);
+                        std::cout << std::endl;
+                    }
+
+                    return instance_pass;
+                });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            verifier.Add(InstanceResult{op_ptr->GetTypeString()});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best configuration parameters:"
               << "\nname: " << best_op_name << "\navg_time: " << best_avg_time
               << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << std::endl;
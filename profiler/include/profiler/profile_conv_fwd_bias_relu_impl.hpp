@@ -15,6 +15,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_bias_activation.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -58,6 +63,8 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                                      std::vector<ck::index_t> input_left_pads,
                                      std::vector<ck::index_t> input_right_pads)
 {
+    ProfilerCacheScope cache_scope;
+
     const ck::index_t Y = filter_spatial_lengths[0];
     const ck::index_t X = filter_spatial_lengths[1];
 
@@ -100,6 +107,24 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
     std::cout << "out_n_k_ho_wo: " << out_n_k_ho_wo_host_result.mDesc << std::endl;
     std::cout << "bias_k: " << bias_k.mDesc << std::endl;
 
+    set_problem_parameters({{"InDataType", type_to_string<InDataType>()},
+                            {"WeiDataType", type_to_string<WeiDataType>()},
+                            {"OutDataType", type_to_string<OutDataType>()},
+                            {"InLayout", InLayout::name},
+                            {"WeiLayout", WeiLayout::name},
+                            {"OutLayout", OutLayout::name},
+                            {"NDimSpatial", get_parameter_string(NDimSpatial)},
+                            {"N", get_parameter_string(N)},
+                            {"K", get_parameter_string(K)},
+                            {"C", get_parameter_string(C)},
+                            {"Filter", get_parameter_string(filter_spatial_lengths)},
+                            {"Input", get_parameter_string(input_spatial_lengths)},
+                            {"Output", get_parameter_string(output_spatial_lengths)},
+                            {"Strides", get_parameter_string(conv_filter_strides)},
+                            {"Dilations", get_parameter_string(conv_filter_dilations)},
+                            {"LeftPads", get_parameter_string(input_left_pads)},
+                            {"RightPads", get_parameter_string(input_right_pads)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -122,6 +147,8 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
     const auto wei_element_op = WeiElementOp{};
     const auto out_element_op = OutElementOp{};
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         using ReferenceConvFwdInstance =
@@ -132,28 +159,35 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                                                                          WeiElementOp,
                                                                          OutElementOp>;
 
-        auto ref_conv    = ReferenceConvFwdInstance{};
-        auto ref_invoker = ref_conv.MakeInvoker();
-
-        auto ref_argument = ref_conv.MakeArgument(in_n_c_hi_wi,
-                                                  wei_k_c_y_x,
-                                                  out_n_k_ho_wo_host_result,
-                                                  bias_k,
-                                                  conv_filter_strides,
-                                                  conv_filter_dilations,
-                                                  input_left_pads,
-                                                  input_right_pads,
-                                                  in_element_op,
-                                                  wei_element_op,
-                                                  out_element_op);
-        ref_invoker.Run(ref_argument);
+        verifier.RunReference([&] {
+            auto ref_conv    = ReferenceConvFwdInstance{};
+            auto ref_invoker = ref_conv.MakeInvoker();
+
+            auto ref_argument = ref_conv.MakeArgument(in_n_c_hi_wi,
+                                                      wei_k_c_y_x,
+                                                      out_n_k_ho_wo_host_result,
+                                                      bias_k,
+                                                      conv_filter_strides,
+                                                      conv_filter_dilations,
+                                                      input_left_pads,
+                                                      input_right_pads,
+                                                      in_element_op,
+                                                      wei_element_op,
+                                                      out_element_op);
+            ref_invoker.Run(ref_argument);
+        });
     }
 
-    DeviceMem in_device_buf(sizeof(InDataType) * in_n_c_hi_wi.mDesc.GetElementSpaceSize());
-    DeviceMem wei_device_buf(sizeof(WeiDataType) * wei_k_c_y_x.mDesc.GetElementSpaceSize());
-    DeviceMem out_device_buf(sizeof(OutDataType) *
-                             out_n_k_ho_wo_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem bias_device_buf(sizeof(OutDataType) * bias_k.mDesc.GetElementSpaceSize());
+    DeviceMem& in_device_buf = get_device_buffer(
+        "in_device_buf", sizeof(InDataType) * in_n_c_hi_wi.mDesc.GetElementSpaceSize());
+    DeviceMem& wei_device_buf = get_device_buffer(
+        "wei_device_buf", sizeof(WeiDataType) * wei_k_c_y_x.mDesc.GetElementSpaceSize());
+    DeviceMem& out_device_buf =
+        get_device_buffer("out_device_buf",
+                          sizeof(OutDataType) *
+                              out_n_k_ho_wo_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& bias_device_buf = get_device_buffer(
+        "bias_device_buf", sizeof(OutDataType) * bias_k.mDesc.GetElementSpaceSize());
 
     in_device_buf.ToDevice(in_n_c_hi_wi.mData.data());
     wei_device_buf.ToDevice(wei_k_c_y_x.mData.data());
@@ -211,8 +245,10 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
         {
             std::string conv_name = op_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop = std::size_t(2) * N * K * Ho * Wo * C * Y * X;
 
@@ -235,29 +271,50 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{conv_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 out_device_buf.FromDevice(out_n_k_ho_wo_device_result.mData.data());
 
-                ck::utils::check_err(out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "wei: ", wei_k_c_y_x.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "out_host  : ", out_n_k_ho_wo_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "out_device: ", out_n_k_ho_wo_device_result.mData, ",")
-                        << std::endl;
-                }
+                verifier.Add(
+                    result, [&, out_n_k_ho_wo_device_result](InstanceResult& instance_result) {
+                        const bool instance_pass = ck::utils::check_err(
+                            out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result);
+
+                        instance_result.AddVerification(
+                            instance_pass, out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result);
+
+                        if(do_log)
+                        {
+                            LogRangeAsType<float>(std::cout << "in : ", in_n_c_hi_wi.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(std::cout << "wei: ", wei_k_c_y_x.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "out_host  : ", out_n_k_ho_wo_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "out_device: ", out_n_k_ho_wo_device_result.mData, ",")
+                                << std::endl;
+                        }
+
+                        return instance_pass;
+                    });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
+        else
+        {
+            verifier.Add(InstanceResult{op_ptr->GetTypeString()});
+        }
     }
 
+    verifier.Wait();
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_conv_name << std::endl;
 }
@@ -17,6 +17,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -75,6 +80,8 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
                                        int StrideC,
                                        int StrideD0)
 {
+    ProfilerCacheScope cache_scope;
+
     auto f_host_tensor_descriptor1d = [](std::size_t len, std::size_t stride) {
         return HostTensorDescriptor({len}, {stride});
     };
@@ -113,6 +120,23 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
     std::cout << "reduce1_m: " << reduce1_m_host_result.mDesc << std::endl;
 
     std::size_t num_thread = 1;
+    set_problem_parameters({{"ADataType", type_to_string<ADataType>()},
+                            {"BDataType", type_to_string<BDataType>()},
+                            {"CDataType", type_to_string<CDataType>()},
+                            {"BiasDataType", type_to_string<BiasDataType>()},
+                            {"D0DataType", type_to_string<D0DataType>()},
+                            {"ReduceDataType", type_to_string<ReduceDataType>()},
+                            {"ALayout", ALayout::name},
+                            {"BLayout", BLayout::name},
+                            {"CLayout", CLayout::name},
+                            {"M", std::to_string(M)},
+                            {"N", std::to_string(N)},
+                            {"K", std::to_string(K)},
+                            {"StrideA", std::to_string(StrideA)},
+                            {"StrideB", std::to_string(StrideB)},
+                            {"StrideC", std::to_string(StrideC)},
+                            {"StrideD0", std::to_string(StrideD0)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -157,6 +181,8 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
     std::array<void*, 2> reduce_in_element_ops  = {&passthrough, &square};
     std::array<void*, 2> reduce_out_element_ops = {&div, &div};
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
@@ -169,59 +195,71 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
 
         using ReduceAccDataType = ReduceDataType;
 
-        auto ref_gemm    = ReferenceGemmInstance{};
-        auto ref_invoker = ref_gemm.MakeInvoker();
+        verifier.RunReference([&] {
+            auto ref_gemm    = ReferenceGemmInstance{};
+            auto ref_invoker = ref_gemm.MakeInvoker();
+
+            auto ref_argument = ref_gemm.MakeArgument(
+                a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, PassThrough{});
 
-        auto ref_argument = ref_gemm.MakeArgument(
-            a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, PassThrough{});
+            ref_invoker.Run(ref_argument);
 
-        ref_invoker.Run(ref_argument);
+            for(int m = 0; m < M; ++m)
+                for(int n = 0; n < N; ++n)
+                {
+                    ReduceAccDataType acc =
+                        static_cast<ReduceAccDataType>(c_m_n_host_result(m, n)) +
+                        static_cast<ReduceAccDataType>(bias_n(n));
+
+                    ReduceAccDataType d0 = static_cast<ReduceAccDataType>(d0_m_n(m, n));
+                    c_element_op(acc, acc);
+                    d0_element_op(d0, d0);
+                    acc += d0;
+                    c_m_n_host_result(m, n) = static_cast<CDataType>(acc);
+                }
 
-        for(int m = 0; m < M; ++m)
-            for(int n = 0; n < N; ++n)
+            for(int m = 0; m < M; ++m)
             {
-                ReduceAccDataType acc = static_cast<ReduceAccDataType>(c_m_n_host_result(m, n)) +
-                                        static_cast<ReduceAccDataType>(bias_n(n));
-
-                ReduceAccDataType d0 = static_cast<ReduceAccDataType>(d0_m_n(m, n));
-                c_element_op(acc, acc);
-                d0_element_op(d0, d0);
-                acc += d0;
-                c_m_n_host_result(m, n) = static_cast<CDataType>(acc);
-            }
+                auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
+                auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
 
-        for(int m = 0; m < M; ++m)
-        {
-            auto reduce0_acc = reduce0_op.GetIdentityValue<ReduceAccDataType>();
-            auto reduce1_acc = reduce1_op.GetIdentityValue<ReduceAccDataType>();
+                for(int n = 0; n < N; ++n)
+                {
+                    ReduceAccDataType d0_val =
+                        ck::type_convert<ReduceAccDataType>(c_m_n_host_result(m, n));
+                    ReduceAccDataType d1_val;
 
-            for(int n = 0; n < N; ++n)
-            {
-                ReduceAccDataType d0_val =
-                    ck::type_convert<ReduceAccDataType>(c_m_n_host_result(m, n));
-                ReduceAccDataType d1_val;
+                    square(d1_val, d0_val);
+                    reduce0_op(reduce0_acc, d0_val);
+                    reduce1_op(reduce1_acc, d1_val);
+                }
 
-                square(d1_val, d0_val);
-                reduce0_op(reduce0_acc, d0_val);
-                reduce1_op(reduce1_acc, d1_val);
+                div(reduce0_acc, reduce0_acc);
+                div(reduce1_acc, reduce1_acc);
+                reduce0_m_host_result(m) = ck::type_convert<ReduceDataType>(reduce0_acc);
+                reduce1_m_host_result(m) = ck::type_convert<ReduceDataType>(reduce1_acc);
             }
-
-            div(reduce0_acc, reduce0_acc);
-            div(reduce1_acc, reduce1_acc);
-            reduce0_m_host_result(m) = ck::type_convert<ReduceDataType>(reduce0_acc);
-            reduce1_m_host_result(m) = ck::type_convert<ReduceDataType>(reduce1_acc);
-        }
+        });
     }
 
-    DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
-    DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem bias_device_buf(sizeof(BiasDataType) * bias_n.mDesc.GetElementSpaceSize());
-    DeviceMem d0_device_buf(sizeof(D0DataType) * d0_m_n.mDesc.GetElementSpaceSize());
-    DeviceMem reduce0_device_buf(sizeof(ReduceDataType) *
-                                 reduce0_m_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem reduce1_device_buf(sizeof(ReduceDataType) *
-                                 reduce1_m_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& a_device_buf =
+        get_device_buffer("a_device_buf", sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem& b_device_buf =
+        get_device_buffer("b_device_buf", sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem& c_device_buf = get_device_buffer(
+        "c_device_buf", sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& bias_device_buf = get_device_buffer(
+        "bias_device_buf", sizeof(BiasDataType) * bias_n.mDesc.GetElementSpaceSize());
+    DeviceMem& d0_device_buf =
+        get_device_buffer("d0_device_buf", sizeof(D0DataType) * d0_m_n.mDesc.GetElementSpaceSize());
+    DeviceMem& reduce0_device_buf =
+        get_device_buffer("reduce0_device_buf",
+                          sizeof(ReduceDataType) *
+                              reduce0_m_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& reduce1_device_buf =
+        get_device_buffer("reduce1_device_buf",
+                          sizeof(ReduceDataType) *
+                              reduce1_m_device_result.mDesc.GetElementSpaceSize());
 
     std::array<void*, 2> p_reduces = {reduce0_device_buf.GetDeviceBuffer(),
                                       reduce1_device_buf.GetDeviceBuffer()};
@@ -310,8 +348,10 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
             reduce0_device_buf.SetZero();
             reduce1_device_buf.SetZero();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::string gemm_name = gemm_ptr->GetTypeString();
 
@@ -337,45 +377,75 @@ void profile_gemm_bias_add_reduce_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{gemm_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
                 reduce0_device_buf.FromDevice(reduce0_m_device_result.mData.data());
                 reduce1_device_buf.FromDevice(reduce1_m_device_result.mData.data());
 
-                ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
-                ck::utils::check_err(reduce0_m_device_result, reduce0_m_host_result);
-                ck::utils::check_err(reduce1_m_device_result, reduce1_m_host_result);
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "a : ", a_m_k.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "b: ", b_k_n.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_host: ", c_m_n_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "c_device: ", c_m_n_device_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "d0_host: ", reduce0_m_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "d0_device: ", reduce0_m_device_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "d1_host: ", reduce1_m_host_result.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(
-                        std::cout << "d1_device: ", reduce1_m_device_result.mData, ",")
-                        << std::endl;
-                }
+                verifier.Add(
+                    result,
+                    [&, c_m_n_device_result, reduce0_m_device_result, reduce1_m_device_result](
+                        InstanceResult& instance_result) {
+                        instance_result.AddVerification(
+                            ck::utils::check_err(c_m_n_device_result, c_m_n_host_result),
+                            c_m_n_device_result,
+                            c_m_n_host_result);
+                        instance_result.AddVerification(
+                            ck::utils::check_err(reduce0_m_device_result, reduce0_m_host_result),
+                            reduce0_m_device_result,
+                            reduce0_m_host_result);
+                        instance_result.AddVerification(
+                            ck::utils::check_err(reduce1_m_device_result, reduce1_m_host_result),
+                            reduce1_m_device_result,
+                            reduce1_m_host_result);
+
+                        if(do_log)
+                        {
+                            LogRangeAsType<float>(std::cout << "a : ", a_m_k.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(std::cout << "b: ", b_k_n.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "c_host: ", c_m_n_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "c_device: ", c_m_n_device_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d0_host: ", reduce0_m_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d0_device: ", reduce0_m_device_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d1_host: ", reduce1_m_host_result.mData, ",")
+                                << std::endl;
+                            LogRangeAsType<float>(
+                                std::cout << "d1_device: ", reduce1_m_device_result.mData, ",")
+                                << std::endl;
+                        }
+
+                        return instance_result.verification_ == VerificationStatus::Pass;
+                    });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << "does not support this GEMM problem" << std::endl;
+
+            verifier.Add(InstanceResult{gemm_ptr->GetTypeString()});
         }
     }
 
+    verifier.Wait();
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_gemm_name << std::endl;
 }
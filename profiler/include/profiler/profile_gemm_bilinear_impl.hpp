@@ -19,6 +19,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -45,6 +50,8 @@ bool profile_gemm_bilinear_impl(int do_verification,
                                 float alpha,
                                 float beta)
 {
+    ProfilerCacheScope cache_scope;
+
     auto f_host_tensor_descriptor =
         [](std::size_t row, std::size_t col, std::size_t stride, auto layout) {
             using namespace ck::literals;
@@ -70,6 +77,24 @@ bool profile_gemm_bilinear_impl(int do_verification,
     std::cout << "d_m_n: " << d_m_n.mDesc << std::endl;
     std::cout << "e_m_n: " << e_m_n_device_result.mDesc << std::endl;
 
+    set_problem_parameters({{"ADataType", type_to_string<ADataType>()},
+                            {"BDataType", type_to_string<BDataType>()},
+                            {"DDataType", type_to_string<DDataType>()},
+                            {"EDataType", type_to_string<EDataType>()},
+                            {"ALayout", ALayout::name},
+                            {"BLayout", BLayout::name},
+                            {"DLayout", DLayout::name},
+                            {"ELayout", ELayout::name},
+                            {"M", std::to_string(M)},
+                            {"N", std::to_string(N)},
+                            {"K", std::to_string(K)},
+                            {"StrideA", std::to_string(StrideA)},
+                            {"StrideB", std::to_string(StrideB)},
+                            {"StrideD", std::to_string(StrideD)},
+                            {"StrideE", std::to_string(StrideE)},
+                            {"alpha", get_parameter_string(alpha)},
+                            {"beta", get_parameter_string(beta)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -109,11 +134,12 @@ bool profile_gemm_bilinear_impl(int do_verification,
         ck::tensor_operation::element_wise::Bilinear>;
 
     // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    ProfilerVerifier verifier;
+
     // run reference
     if(do_verification)
     {
@@ -127,27 +153,33 @@ bool profile_gemm_bilinear_impl(int do_verification,
                                                                                 BElementOp,
                                                                                 PassThrough>;
 
-        auto ref_gemm    = ReferenceGemmInstance{};
-        auto ref_invoker = ref_gemm.MakeInvoker();
+        verifier.RunReference([&] {
+            auto ref_gemm    = ReferenceGemmInstance{};
+            auto ref_invoker = ref_gemm.MakeInvoker();
 
-        auto ref_argument =
-            ref_gemm.MakeArgument(a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, PassThrough{});
+            auto ref_argument = ref_gemm.MakeArgument(
+                a_m_k, b_k_n, c_m_n, a_element_op, b_element_op, PassThrough{});
 
-        ref_invoker.Run(ref_argument);
+            ref_invoker.Run(ref_argument);
 
-        for(int m = 0; m < M; ++m)
-        {
-            for(int n = 0; n < N; ++n)
+            for(int m = 0; m < M; ++m)
             {
-                cde_element_op(e_m_n_host_result(m, n), c_m_n(m, n), d_m_n(m, n));
+                for(int n = 0; n < N; ++n)
+                {
+                    cde_element_op(e_m_n_host_result(m, n), c_m_n(m, n), d_m_n(m, n));
+                }
             }
-        }
+        });
     }
 
-    DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
-    DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem d_m_n_device_buf(sizeof(DDataType) * d_m_n.mDesc.GetElementSpaceSize());
-    DeviceMem e_device_buf(sizeof(EDataType) * e_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& a_device_buf =
+        get_device_buffer("a_device_buf", sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem& b_device_buf =
+        get_device_buffer("b_device_buf", sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem& d_m_n_device_buf = get_device_buffer(
+        "d_m_n_device_buf", sizeof(DDataType) * d_m_n.mDesc.GetElementSpaceSize());
+    DeviceMem& e_device_buf = get_device_buffer(
+        "e_device_buf", sizeof(EDataType) * e_m_n_device_result.mDesc.GetElementSpaceSize());
 
     a_device_buf.ToDevice(a_m_k.mData.data());
     b_device_buf.ToDevice(b_k_n.mData.data());
@@ -188,8 +220,10 @@ bool profile_gemm_bilinear_impl(int do_verification,
             // re-init E to zero before profiling a kernel
             e_device_buf.SetZero();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop = std::size_t(2) * M * N * K;
 
@@ -211,19 +245,37 @@ bool profile_gemm_bilinear_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{op_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 e_device_buf.FromDevice(e_m_n_device_result.mData.data());
 
-                pass = pass && ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                verifier.Add(result, [&, e_m_n_device_result](InstanceResult& instance_result) {
+                    const bool instance_pass =
+                        ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+
+                    instance_result.AddVerification(
+                        instance_pass, e_m_n_device_result, e_m_n_host_result);
+
+                    return instance_pass;
+                });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << op_name << " does not support this problem" << std::endl;
+
+            verifier.Add(InstanceResult{op_name});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
 
@@ -24,6 +24,11 @@
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -41,6 +46,8 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                                           const ck::utils::conv::ConvParam& conv_param,
                                           ck::index_t split_k)
 {
+    ProfilerCacheScope cache_scope;
+
     using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
     using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
     using OutElementOp = ck::tensor_operation::element_wise::PassThrough;
@@ -67,6 +74,17 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
     std::cout << "weight: " << weight_host_result.mDesc << std::endl;
     std::cout << "output: " << output.mDesc << std::endl;
 
+    auto parameters = get_conv_problem_parameters<InLayout,
+                                                  WeiLayout,
+                                                  OutLayout,
+                                                  InDataType,
+                                                  WeiDataType,
+                                                  OutDataType>(conv_param);
+
+    parameters.emplace_back("SplitK", std::to_string(split_k));
+
+    set_problem_parameters(parameters);
+
     switch(init_method)
     {
     case 0: break;
@@ -79,36 +97,42 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
         output.GenerateTensorValue(GeneratorTensor_3<OutDataType>{-0.5, 0.5});
     }
 
-    DeviceMem in_device_buf(sizeof(InDataType) * input.mDesc.GetElementSpaceSize());
-    DeviceMem wei_device_buf(sizeof(WeiDataType) *
-                             weight_device_result.mDesc.GetElementSpaceSize());
-    DeviceMem out_device_buf(sizeof(OutDataType) * output.mDesc.GetElementSpaceSize());
+    DeviceMem& in_device_buf =
+        get_device_buffer("in_device_buf", sizeof(InDataType) * input.mDesc.GetElementSpaceSize());
+    DeviceMem& wei_device_buf = get_device_buffer(
+        "wei_device_buf", sizeof(WeiDataType) * weight_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem& out_device_buf = get_device_buffer(
+        "out_device_buf", sizeof(OutDataType) * output.mDesc.GetElementSpaceSize());
 
     in_device_buf.ToDevice(input.mData.data());
     out_device_buf.ToDevice(output.mData.data());
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
-        auto ref_conv     = ck::tensor_operation::host::ReferenceConvBwdWeight<NDimSpatial,
-                                                                           InDataType,
-                                                                           WeiDataType,
-                                                                           OutDataType,
-                                                                           InElementOp,
-                                                                           WeiElementOp,
-                                                                           OutElementOp>{};
-        auto ref_invoker  = ref_conv.MakeInvoker();
-        auto ref_argument = ref_conv.MakeArgument(input,
-                                                  weight_host_result,
-                                                  output,
-                                                  conv_param.conv_filter_strides_,
-                                                  conv_param.conv_filter_dilations_,
-                                                  conv_param.input_left_pads_,
-                                                  conv_param.input_right_pads_,
-                                                  in_element_op,
-                                                  wei_element_op,
-                                                  out_element_op);
-
-        ref_invoker.Run(ref_argument);
+        verifier.RunReference([&] {
+            auto ref_conv     = ck::tensor_operation::host::ReferenceConvBwdWeight<NDimSpatial,
+                                                                               InDataType,
+                                                                               WeiDataType,
+                                                                               OutDataType,
+                                                                               InElementOp,
+                                                                               WeiElementOp,
+                                                                               OutElementOp>{};
+            auto ref_invoker  = ref_conv.MakeInvoker();
+            auto ref_argument = ref_conv.MakeArgument(input,
+                                                      weight_host_result,
+                                                      output,
+                                                      conv_param.conv_filter_strides_,
+                                                      conv_param.conv_filter_dilations_,
+                                                      conv_param.input_left_pads_,
+                                                      conv_param.input_right_pads_,
+                                                      in_element_op,
+                                                      wei_element_op,
+                                                      out_element_op);
+
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvBwdWeight<NDimSpatial,
@@ -123,8 +147,7 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                                                                               OutElementOp>;
 
     // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
@@ -185,8 +208,10 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop      = conv_param.GetFlops();
             std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
@@ -205,42 +230,60 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{op_name, timing, avg_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 wei_device_buf.FromDevice(weight_device_result.mData.data());
 
-                bool pass = ck::utils::check_err(weight_device_result, weight_host_result);
-
-                if(!pass)
-                {
-                    std::cout << "Fail info: " << op_ptr->GetTypeString() << std::endl;
-                }
-
-                all_pass &= pass;
-
-                if(do_log)
-                {
-                    LogRangeAsType<float>(std::cout << "output : ", output.mData, ",") << std::endl;
-                    ;
-                    LogRangeAsType<float>(
-                        std::cout << "weight (device): ", weight_device_result.mData, ",")
-                        << std::endl;
-                    ;
-                    LogRangeAsType<float>(
-                        std::cout << "weight (host): ", weight_host_result.mData, ",")
-                        << std::endl;
-                    ;
-                    LogRangeAsType<float>(std::cout << "input: ", input.mData, ",") << std::endl;
-                    ;
-                }
+                verifier.Add(
+                    result, [&, op_name, weight_device_result](InstanceResult& instance_result) {
+                        bool pass = ck::utils::check_err(weight_device_result, weight_host_result);
+
+                        instance_result.AddVerification(
+                            pass, weight_device_result, weight_host_result);
+
+                        if(!pass)
+                        {
+                            std::cout << "Fail info: " << op_name << std::endl;
+                        }
+
+                        if(do_log)
+                        {
+                            LogRangeAsType<float>(std::cout << "output : ", output.mData, ",")
+                                << std::endl;
+                            ;
+                            LogRangeAsType<float>(
+                                std::cout << "weight (device): ", weight_device_result.mData, ",")
+                                << std::endl;
+                            ;
+                            LogRangeAsType<float>(
+                                std::cout << "weight (host): ", weight_host_result.mData, ",")
+                                << std::endl;
+                            ;
+                            LogRangeAsType<float>(std::cout << "input: ", input.mData, ",")
+                                << std::endl;
+                            ;
+                        }
+
+                        return pass;
+                    });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            verifier.Add(InstanceResult{op_ptr->GetTypeString()});
         }
     }
 
+    all_pass = verifier.Wait() && all_pass;
+
     std::cout << "Best configuration parameters:"
               << "\nname: " << best_op_name << "\navg_time: " << best_avg_time
               << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << std::endl;
@@ -20,6 +20,11 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -41,6 +46,8 @@ bool profile_grouped_gemm_impl(int do_verification,
                                const std::vector<int>& StrideBs,
                                const std::vector<int>& StrideCs)
 {
+    ProfilerCacheScope cache_scope;
+
 
     bool pass = true;
 
@@ -66,6 +73,19 @@ bool profile_grouped_gemm_impl(int do_verification,
         throw std::runtime_error("wrong! inconsistent M/N/Ks, StrideA/B/Cs size\n");
     }
 
+    set_problem_parameters({{"ADataType", type_to_string<ADataType>()},
+                            {"BDataType", type_to_string<BDataType>()},
+                            {"CDataType", type_to_string<CDataType>()},
+                            {"ALayout", ALayout::name},
+                            {"BLayout", BLayout::name},
+                            {"CLayout", CLayout::name},
+                            {"Ms", get_parameter_string(Ms)},
+                            {"Ns", get_parameter_string(Ns)},
+                            {"Ks", get_parameter_string(Ks)},
+                            {"StrideAs", get_parameter_string(StrideAs)},
+                            {"StrideBs", get_parameter_string(StrideBs)},
+                            {"StrideCs", get_parameter_string(StrideCs)}});
+
     std::vector<Tensor<ADataType>> a_m_k;
     std::vector<Tensor<BDataType>> b_k_n;
     std::vector<Tensor<CDataType>> c_m_n_device_results;
@@ -108,10 +128,44 @@ bool profile_grouped_gemm_impl(int do_verification,
     const auto b_element_op = BElementOp{};
     const auto c_element_op = CElementOp{};
 
-    // if(do_verification)
-    // {
+    std::vector<Tensor<CDataType>> c_m_n_host_results;
 
-    // }
+    for(std::size_t i = 0; i < group_count; i++)
+    {
+        c_m_n_host_results.push_back(
+            Tensor<CDataType>(f_host_tensor_descriptor(Ms[i], Ns[i], StrideCs[i], CLayout{})));
+    }
+
+    ProfilerVerifier verifier(do_log);
+
+    if(do_verification)
+    {
+        verifier.RunReference([&] {
+            using ReferenceGemmInstance =
+                ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                          BDataType,
+                                                          CDataType,
+                                                          AccDataType,
+                                                          AElementOp,
+                                                          BElementOp,
+                                                          CElementOp>;
+
+            for(std::size_t i = 0; i < group_count; i++)
+            {
+                auto ref_gemm    = ReferenceGemmInstance{};
+                auto ref_invoker = ref_gemm.MakeInvoker();
+
+                auto ref_argument = ref_gemm.MakeArgument(a_m_k[i],
+                                                          b_k_n[i],
+                                                          c_m_n_host_results[i],
+                                                          a_element_op,
+                                                          b_element_op,
+                                                          c_element_op);
+
+                ref_invoker.Run(ref_argument);
+            }
+        });
+    }
 
     using DeviceMemPtr = std::unique_ptr<DeviceMem>;
     std::vector<DeviceMemPtr> a_device_buf, b_device_buf, c_device_buf;
@@ -164,8 +218,7 @@ bool profile_grouped_gemm_impl(int do_verification,
                                                                      BElementOp,
                                                                      CElementOp>;
 
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& op_ptrs = get_instances<DeviceOp>();
 
     if(op_ptrs.size() <= 0)
     {
@@ -194,7 +247,8 @@ bool profile_grouped_gemm_impl(int do_verification,
 
         auto invoker_ptr = gemm_ptr->MakeInvokerPointer();
 
-        DeviceMem gemm_desc_workspace(gemm_ptr->GetWorkSpaceSize(argument_ptr.get()));
+        DeviceMem& gemm_desc_workspace = get_device_buffer(
+            "gemm_desc_workspace", gemm_ptr->GetWorkSpaceSize(argument_ptr.get()));
 
         gemm_ptr->SetWorkSpacePointer(argument_ptr.get(), gemm_desc_workspace.GetDeviceBuffer());
 
@@ -202,8 +256,10 @@ bool profile_grouped_gemm_impl(int do_verification,
         {
             std::string gemm_name = gemm_ptr->GetTypeString();
 
-            float ave_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float ave_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t flop = 0, num_btype = 0;
             for(std::size_t i = 0; i < gemm_descs.size(); i++)
@@ -228,59 +284,63 @@ bool profile_grouped_gemm_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{gemm_name, timing, ave_time, tflops, gb_per_sec};
+
             if(do_verification)
             {
                 for(std::size_t i = 0; i < gemm_descs.size(); i++)
                 {
-
                     c_device_buf[i]->FromDevice(c_m_n_device_results[i].mData.data());
-
-                    Tensor<CDataType> c_m_n_host_result(
-                        f_host_tensor_descriptor(Ms[i], Ns[i], StrideCs[i], CLayout{}));
-
-                    using ReferenceGemmInstance =
-                        ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                  BDataType,
-                                                                  CDataType,
-                                                                  AccDataType,
-                                                                  AElementOp,
-                                                                  BElementOp,
-                                                                  CElementOp>;
-
-                    auto ref_gemm    = ReferenceGemmInstance{};
-                    auto ref_invoker = ref_gemm.MakeInvoker();
-
-                    auto ref_argument = ref_gemm.MakeArgument(a_m_k[i],
-                                                              b_k_n[i],
-                                                              c_m_n_host_result,
-                                                              a_element_op,
-                                                              b_element_op,
-                                                              c_element_op);
-
-                    ref_invoker.Run(ref_argument);
-                    pass = pass && ck::utils::check_err(c_m_n_device_results[i], c_m_n_host_result);
-
-                    if(do_log)
-                    {
-                        LogRangeAsType<float>(std::cout << "a : ", a_m_k[i].mData, ",")
-                            << std::endl;
-                        LogRangeAsType<float>(std::cout << "b: ", b_k_n[i].mData, ",") << std::endl;
-                        LogRangeAsType<float>(
-                            std::cout << "c_device: ", c_m_n_device_results[i].mData, ",")
-                            << std::endl;
-                        LogRangeAsType<float>(
-                            std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
-                            << std::endl;
-                    }
                 }
+
+                verifier.Add(
+                    result,
+                    [&, c_m_n_device_results](InstanceResult& instance_result) {
+                        bool instance_pass = true;
+
+                        for(std::size_t i = 0; i < gemm_descs.size(); i++)
+                        {
+                            const bool group_pass = ck::utils::check_err(
+                                c_m_n_device_results[i], c_m_n_host_results[i]);
+
+                            instance_pass = instance_pass && group_pass;
+
+                            instance_result.AddVerification(
+                                group_pass, c_m_n_device_results[i], c_m_n_host_results[i]);
+
+                            if(do_log)
+                            {
+                                LogRangeAsType<float>(std::cout << "a : ", a_m_k[i].mData, ",")
+                                    << std::endl;
+                                LogRangeAsType<float>(std::cout << "b: ", b_k_n[i].mData, ",")
+                                    << std::endl;
+                                LogRangeAsType<float>(
+                                    std::cout << "c_device: ", c_m_n_device_results[i].mData, ",")
+                                    << std::endl;
+                                LogRangeAsType<float>(
+                                    std::cout << "c_host  : ", c_m_n_host_results[i].mData, ",")
+                                    << std::endl;
+                            }
+                        }
+
+                        return instance_pass;
+                    });
+            }
+            else
+            {
+                verifier.Add(result);
             }
         }
         else
         {
             std::cout << "does not support this GEMM problem" << std::endl;
+
+            verifier.Add(InstanceResult{gemm_ptr->GetTypeString()});
         }
     }
 
+    pass = verifier.Wait() && pass;
+
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_gemm_name << std::endl;
 
@@ -15,6 +15,11 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_groupnorm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -29,6 +34,8 @@ bool profile_groupnorm_impl(int do_verification,
                             bool time_kernel,
                             std::vector<index_t> length)
 {
+    ProfilerCacheScope cache_scope;
+
     using PassThrough = ck::tensor_operation::element_wise::PassThrough;
 
     if(length.size() != 5)
@@ -47,6 +54,13 @@ bool profile_groupnorm_impl(int do_verification,
     Tensor<YDataType> y(length);
     Tensor<YDataType> host_y(length);
 
+    set_problem_parameters({{"XDataType", type_to_string<XDataType>()},
+                            {"GammaDataType", type_to_string<GammaDataType>()},
+                            {"BetaDataType", type_to_string<BetaDataType>()},
+                            {"AccDataType", type_to_string<AccDataType>()},
+                            {"YDataType", type_to_string<YDataType>()},
+                            {"Length", get_parameter_string(length)}});
+
     switch(init_method)
     {
     case 0:
@@ -65,10 +79,14 @@ bool profile_groupnorm_impl(int do_verification,
         beta.GenerateTensorValue(GeneratorTensor_3<BetaDataType>{-0.5, 0.5});
     }
 
-    DeviceMem x_dev(sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
-    DeviceMem gamma_dev(sizeof(GammaDataType) * gamma.mDesc.GetElementSpaceSize());
-    DeviceMem beta_dev(sizeof(BetaDataType) * beta.mDesc.GetElementSpaceSize());
-    DeviceMem y_dev(sizeof(YDataType) * y.mDesc.GetElementSpaceSize());
+    DeviceMem& x_dev =
+        get_device_buffer("x_dev", sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
+    DeviceMem& gamma_dev =
+        get_device_buffer("gamma_dev", sizeof(GammaDataType) * gamma.mDesc.GetElementSpaceSize());
+    DeviceMem& beta_dev =
+        get_device_buffer("beta_dev", sizeof(BetaDataType) * beta.mDesc.GetElementSpaceSize());
+    DeviceMem& y_dev =
+        get_device_buffer("y_dev", sizeof(YDataType) * y.mDesc.GetElementSpaceSize());
 
     x_dev.ToDevice(x.mData.data());
     gamma_dev.ToDevice(gamma.mData.data());
@@ -85,9 +103,7 @@ bool profile_groupnorm_impl(int do_verification,
                                                                        3>;
 
     // get device op instances
-    const auto instance_ptrs =
-        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-            DeviceOp>::GetInstances();
+    const auto& instance_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
@@ -95,6 +111,8 @@ bool profile_groupnorm_impl(int do_verification,
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         using ReferenceInstance = ck::tensor_operation::host::ReferenceGroupnorm<XDataType,
@@ -104,10 +122,13 @@ bool profile_groupnorm_impl(int do_verification,
                                                                                  AccDataType,
                                                                                  PassThrough>;
 
-        ReferenceInstance ref;
-        auto ref_argument = ref.MakeArgument(x, gamma, beta, host_y, PassThrough{}, length, 1e-6);
-        auto ref_invoker  = ref.MakeInvoker();
-        ref_invoker.Run(ref_argument);
+        verifier.RunReference([&] {
+            ReferenceInstance ref;
+            auto ref_argument =
+                ref.MakeArgument(x, gamma, beta, host_y, PassThrough{}, length, 1e-6);
+            auto ref_invoker = ref.MakeInvoker();
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     int num_kernel = 0;
@@ -136,12 +157,17 @@ bool profile_groupnorm_impl(int do_verification,
         }
         else
         {
+            verifier.Add(InstanceResult{inst_ptr->GetTypeString()});
+
             continue;
         }
 
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
 
-        float avg_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+        ck::TimingStatistics timing;
+
+        float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                          get_profiler_stream_config(time_kernel, &timing));
 
         std::size_t num_bytes = x.mDesc.GetElementSize() * sizeof(XDataType) +
                                 gamma.mDesc.GetElementSize() * sizeof(GammaDataType) +
@@ -161,33 +187,48 @@ bool profile_groupnorm_impl(int do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        InstanceResult result{inst_ptr->GetTypeString(), timing, avg_time, 0, gb_per_sec};
+
         if(do_verification)
         {
             y_dev.FromDevice(y.mData.data());
 
-            bool pass = ck::utils::check_err(y, host_y, "Error: Incorrect results", 1e-3, 1e-3);
-
-            if(do_log)
-            {
-                LogRangeAsType<float>(std::cout << "x  : ", x.mData, ",") << std::endl;
-                LogRangeAsType<float>(std::cout << "host_y  : ", host_y.mData, ",") << std::endl;
-                LogRangeAsType<float>(std::cout << "y  : ", y.mData, ",") << std::endl;
-            }
-
-            if(!pass)
-            {
-                std::cout << inst_ptr->GetTypeString() << " failed verification: ";
-                LogRange(std::cout << "lengths = [", length, ", ") << "]." << std::endl;
-                return false;
-            }
-            else
-            {
-                if(time_kernel)
-                    std::cout << "pass" << std::endl;
-            }
+            verifier.Add(result, [&, y](InstanceResult& instance_result) {
+                bool pass =
+                    ck::utils::check_err(y, host_y, "Error: Incorrect results", 1e-3, 1e-3);
+
+                instance_result.AddVerification(pass, y, host_y);
+
+                if(do_log)
+                {
+                    LogRangeAsType<float>(std::cout << "x  : ", x.mData, ",") << std::endl;
+                    LogRangeAsType<float>(std::cout << "host_y  : ", host_y.mData, ",")
+                        << std::endl;
+                    LogRangeAsType<float>(std::cout << "y  : ", y.mData, ",") << std::endl;
+                }
+
+                if(!pass)
+                {
+                    std::cout << instance_result.instance_ << " failed verification: ";
+                    LogRange(std::cout << "lengths = [", length, ", ") << "]." << std::endl;
+                }
+                else
+                {
+                    if(time_kernel)
+                        std::cout << "pass" << std::endl;
+                }
+
+                return pass;
+            });
+        }
+        else
+        {
+            verifier.Add(result);
         }
     }
 
+    const bool pass = verifier.Wait();
+
     if(time_kernel)
     {
         LogRange(std::cout << "length = ", length, ",") << ", ";
@@ -201,7 +242,7 @@ bool profile_groupnorm_impl(int do_verification,
         return false;
     }
 
-    return true;
+    return pass;
 }
 
 } // namespace profiler
@@ -13,6 +13,11 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -28,6 +33,8 @@ bool profile_layernorm_impl(int do_verification,
                             bool time_kernel,
                             std::vector<index_t> length)
 {
+    ProfilerCacheScope cache_scope;
+
     using PassThrough = ck::tensor_operation::element_wise::PassThrough;
 
     if(length.size() < 2)
@@ -50,6 +57,13 @@ bool profile_layernorm_impl(int do_verification,
     std::vector<index_t> strideGammaBeta = strideXY;
     strideGammaBeta[0]                   = 0;
 
+    set_problem_parameters({{"XDataType", type_to_string<XDataType>()},
+                            {"GammaDataType", type_to_string<GammaDataType>()},
+                            {"BetaDataType", type_to_string<BetaDataType>()},
+                            {"AccDataType", type_to_string<AccDataType>()},
+                            {"YDataType", type_to_string<YDataType>()},
+                            {"Length", get_parameter_string(length)}});
+
     switch(init_method)
     {
     case 0:
@@ -71,10 +85,14 @@ bool profile_layernorm_impl(int do_verification,
         y.GenerateTensorValue(GeneratorTensor_3<YDataType>{-0.5, 0.5});
     }
 
-    DeviceMem x_dev(sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
-    DeviceMem gamma_dev(sizeof(GammaDataType) * gamma.mDesc.GetElementSpaceSize());
-    DeviceMem beta_dev(sizeof(BetaDataType) * beta.mDesc.GetElementSpaceSize());
-    DeviceMem y_dev(sizeof(YDataType) * y.mDesc.GetElementSpaceSize());
+    DeviceMem& x_dev =
+        get_device_buffer("x_dev", sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
+    DeviceMem& gamma_dev =
+        get_device_buffer("gamma_dev", sizeof(GammaDataType) * gamma.mDesc.GetElementSpaceSize());
+    DeviceMem& beta_dev =
+        get_device_buffer("beta_dev", sizeof(BetaDataType) * beta.mDesc.GetElementSpaceSize());
+    DeviceMem& y_dev =
+        get_device_buffer("y_dev", sizeof(YDataType) * y.mDesc.GetElementSpaceSize());
 
     x_dev.ToDevice(x.mData.data());
     gamma_dev.ToDevice(gamma.mData.data());
@@ -93,9 +111,7 @@ bool profile_layernorm_impl(int do_verification,
                                                                        NumReduceDim>;
 
     // get device op instances
-    const auto instance_ptrs =
-        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-            DeviceOp>::GetInstances();
+    const auto& instance_ptrs = get_instances<DeviceOp>();
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
@@ -103,6 +119,8 @@ bool profile_layernorm_impl(int do_verification,
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
         using ReferenceInstance = ck::tensor_operation::host::ReferenceLayernorm<XDataType,
@@ -114,11 +132,13 @@ bool profile_layernorm_impl(int do_verification,
                                                                                  Rank,
                                                                                  NumReduceDim>;
 
-        ReferenceInstance ref;
-        auto ref_argument =
-            ref.MakeArgument(x, gamma, beta, host_y, PassThrough{}, length, reduce_dim, 1e-4);
-        auto ref_invoker = ref.MakeInvoker();
-        ref_invoker.Run(ref_argument);
+        verifier.RunReference([&] {
+            ReferenceInstance ref;
+            auto ref_argument =
+                ref.MakeArgument(x, gamma, beta, host_y, PassThrough{}, length, reduce_dim, 1e-4);
+            auto ref_invoker = ref.MakeInvoker();
+            ref_invoker.Run(ref_argument);
+        });
     }
 
     int num_kernel = 0;
@@ -146,6 +166,8 @@ bool profile_layernorm_impl(int do_verification,
         }
         else
         {
+            verifier.Add(InstanceResult{inst_ptr->GetTypeString()});
+
             if(time_kernel)
             {
                 std::cout << inst_ptr->GetTypeString() << " skipped due to unsupported argument: ";
@@ -157,7 +179,10 @@ bool profile_layernorm_impl(int do_verification,
 
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
 
-        float avg_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+        ck::TimingStatistics timing;
+
+        float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                          get_profiler_stream_config(time_kernel, &timing));
 
         std::size_t num_bytes = x.mDesc.GetElementSize() * sizeof(XDataType) +
                                 gamma.mDesc.GetElementSize() * sizeof(GammaDataType) +
@@ -177,34 +202,48 @@ bool profile_layernorm_impl(int do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        InstanceResult result{inst_ptr->GetTypeString(), timing, avg_time, 0, gb_per_sec};
+
         if(do_verification)
         {
             y_dev.FromDevice(y.mData.data());
 
-            bool pass = ck::utils::check_err(
-                y.mData, host_y.mData, "Error: Incorrect results d1", 1e-3, 1e-3);
-
-            if(do_log)
-            {
-                LogRangeAsType<float>(std::cout << "x  : ", x.mData, ",") << std::endl;
-                LogRangeAsType<float>(std::cout << "host_y  : ", host_y.mData, ",") << std::endl;
-                LogRangeAsType<float>(std::cout << "y  : ", y.mData, ",") << std::endl;
-            }
-
-            if(!pass)
-            {
-                std::cout << inst_ptr->GetTypeString() << " failed verification: ";
-                LogRange(std::cout << "lengths = [", length, ", ") << "]." << std::endl;
-                return false;
-            }
-            else
-            {
-                if(time_kernel)
-                    std::cout << "pass" << std::endl;
-            }
+            verifier.Add(result, [&, y](InstanceResult& instance_result) {
+                bool pass = ck::utils::check_err(
+                    y.mData, host_y.mData, "Error: Incorrect results d1", 1e-3, 1e-3);
+
+                instance_result.AddVerification(pass, y.mData, host_y.mData);
+
+                if(do_log)
+                {
+                    LogRangeAsType<float>(std::cout << "x  : ", x.mData, ",") << std::endl;
+                    LogRangeAsType<float>(std::cout << "host_y  : ", host_y.mData, ",")
+                        << std::endl;
+                    LogRangeAsType<float>(std::cout << "y  : ", y.mData, ",") << std::endl;
+                }
+
+                if(!pass)
+                {
+                    std::cout << instance_result.instance_ << " failed verification: ";
+                    LogRange(std::cout << "lengths = [", length, ", ") << "]." << std::endl;
+                }
+                else
+                {
+                    if(time_kernel)
+                        std::cout << "pass" << std::endl;
+                }
+
+                return pass;
+            });
+        }
+        else
+        {
+            verifier.Add(result);
         }
     }
 
+    const bool pass = verifier.Wait();
+
     if(time_kernel)
     {
         LogRange(std::cout << "length = ", length, ",") << ", ";
@@ -220,7 +259,7 @@ bool profile_layernorm_impl(int do_verification,
         return false;
     }
 
-    return true;
+    return pass;
 }
 
 } // namespace profiler
@@ -14,6 +14,11 @@
 #include "ck/library/utility/host_common_util.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -146,6 +151,8 @@ bool profile_reduce_impl_impl(bool do_verification,
                               float alpha,
                               float beta)
 {
+    ProfilerCacheScope cache_scope;
+
     using namespace ck::tensor_operation::device;
     using namespace ck::tensor_operation::device::instance;
     using ck::host_common::dumpBufferToFile;
@@ -204,6 +211,19 @@ bool profile_reduce_impl_impl(bool do_verification,
 
     if constexpr(!invalid_reduce)
     {
+        set_problem_parameters(
+            {{"InDataType", type_to_string<InDataType>()},
+             {"AccDataType", type_to_string<AccDataType>()},
+             {"OutDataType", type_to_string<OutDataType>()},
+             {"ReduceOp", std::to_string(static_cast<int>(ReduceOpId))},
+             {"PropagateNan", std::to_string(PropagateNan)},
+             {"UseIndex", std::to_string(UseIndex)},
+             {"InLengths", get_parameter_string(inLengths)},
+             {"ReduceDims",
+              get_parameter_string(std::vector<int>(reduceDims.begin(), reduceDims.end()))},
+             {"alpha", get_parameter_string(alpha)},
+             {"beta", get_parameter_string(beta)}});
+
         Tensor<InDataType> in(inLengths);
 
         std::vector<size_t> outLengths;
@@ -257,8 +277,10 @@ bool profile_reduce_impl_impl(bool do_verification,
         };
 
         // these buffers are usually provided by the user application
-        DeviceMem in_dev(sizeof(InDataType) * in.mDesc.GetElementSpaceSize());
-        DeviceMem out_dev(sizeof(OutDataType) * out.mDesc.GetElementSpaceSize());
+        DeviceMem& in_dev =
+            get_device_buffer("in_dev", sizeof(InDataType) * in.mDesc.GetElementSpaceSize());
+        DeviceMem& out_dev =
+            get_device_buffer("out_dev", sizeof(OutDataType) * out.mDesc.GetElementSpaceSize());
 
         in_dev.ToDevice(in.mData.data());
 
@@ -267,7 +289,7 @@ bool profile_reduce_impl_impl(bool do_verification,
 
         size_t indicesSizeInBytes = OutputIndex ? out.mDesc.GetElementSize() * sizeof(int) : 0;
 
-        DeviceMem out_indices_dev(indicesSizeInBytes);
+        DeviceMem& out_indices_dev = get_device_buffer("out_indices_dev", indicesSizeInBytes);
 
         float best_avg_time   = 0;
         float best_gb_per_sec = 0;
@@ -332,27 +354,32 @@ bool profile_reduce_impl_impl(bool do_verification,
             throw std::runtime_error("Wrong! No device REDUCE instance found");
         };
 
+        // the dumps of the outputs need the reference output of the host
+        ProfilerVerifier verifier(do_dumpout);
+
         if(do_verification)
         {
-            ReductionHost<InDataType,
-                          AccDataType,
-                          OutDataType,
-                          ReduceOperation,
-                          InElementwiseOperation,
-                          AccElementwiseOperation,
-                          Rank,
-                          NumReduceDim,
-                          PropagateNan,
-                          OutputIndex>
-                hostReduce(in.mDesc, out_ref.mDesc, invariantDims, reduceDims);
-
-            hostReduce.Run(alpha,
-                           in.mData.data(),
-                           beta,
-                           out_ref.mData.data(),
-                           out_indices_ref.mData.data(),
-                           in_elementwise_op,
-                           acc_elementwise_op);
+            verifier.RunReference([&] {
+                ReductionHost<InDataType,
+                              AccDataType,
+                              OutDataType,
+                              ReduceOperation,
+                              InElementwiseOperation,
+                              AccElementwiseOperation,
+                              Rank,
+                              NumReduceDim,
+                              PropagateNan,
+                              OutputIndex>
+                    hostReduce(in.mDesc, out_ref.mDesc, invariantDims, reduceDims);
+
+                hostReduce.Run(alpha,
+                               in.mData.data(),
+                               beta,
+                               out_ref.mData.data(),
+                               out_indices_ref.mData.data(),
+                               in_elementwise_op,
+                               acc_elementwise_op);
+            });
         };
 
         std::array<index_t, Rank> arrInLengths;
@@ -382,14 +409,19 @@ bool profile_reduce_impl_impl(bool do_verification,
                                                                 acc_elementwise_op);
 
             if(!reduce_ptr->IsSupportedArgument(argument_ptr.get()))
+            {
+                verifier.Add(InstanceResult{reduce_ptr->GetTypeString()});
                 continue;
+            }
 
             std::string reduce_name = reduce_ptr->GetTypeString();
 
             auto invoker_ptr = reduce_ptr->MakeInvokerPointer();
 
-            float avg_time =
-                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+            ck::TimingStatistics timing;
+
+            float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                              get_profiler_stream_config(time_kernel, &timing));
 
             std::size_t num_bytes =
                 invariant_total_length * reduce_total_length * sizeof(InDataType) +
@@ -407,25 +439,43 @@ bool profile_reduce_impl_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            InstanceResult result{reduce_name, timing, avg_time, 0, gb_per_sec};
+
             if(do_verification)
             {
-                bool single_pass;
-
                 out_dev.FromDevice(out.mData.data());
-                single_pass = ck::utils::check_err(out, out_ref);
 
                 if(OutputIndex)
                 {
                     out_indices_dev.FromDevice(out_indices.mData.data());
-                    single_pass = single_pass && ck::utils::check_err(out_indices, out_indices_ref);
                 };
 
-                if(!single_pass)
-                {
-                    std::cout << "Fail Info: " << reduce_ptr->GetTypeString() << std::endl;
-                }
+                verifier.Add(result, [&, out, out_indices](InstanceResult& instance_result) {
+                    bool single_pass = ck::utils::check_err(out, out_ref);
+
+                    instance_result.AddVerification(single_pass, out, out_ref);
+
+                    if(OutputIndex)
+                    {
+                        const bool indices_pass =
+                            ck::utils::check_err(out_indices, out_indices_ref);
+
+                        single_pass = single_pass && indices_pass;
+
+                        instance_result.AddVerification(indices_pass, out_indices, out_indices_ref);
+                    };
 
-                pass = pass && single_pass;
+                    if(!single_pass)
+                    {
+                        std::cout << "Fail Info: " << instance_result.instance_ << std::endl;
+                    }
+
+                    return single_pass;
+                });
+            }
+            else
+            {
+                verifier.Add(result);
             };
 
             if(do_dumpout)
@@ -446,6 +496,8 @@ bool profile_reduce_impl_impl(bool do_verification,
             };
         };
 
+        pass = verifier.Wait() && pass;
+
         if(time_kernel)
             std::cout << "Best Perf: " << best_avg_time << " ms, " << best_gb_per_sec << " GB/s"
                       << std::endl;
@@ -20,6 +20,11 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 #include "ck/utility/data_type.hpp"
 
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -31,15 +36,6 @@ enum struct SoftmaxDataType
     INT8_INT8,
 };
 
-// clang-format off
-template <typename SoftmaxDataType> std::string type_to_string();
-template <> std::string type_to_string<float>()   { return "f32"; }
-template <> std::string type_to_string<half_t>()  { return "f16"; }
-template <> std::string type_to_string<bhalf_t>() { return "bf16"; }
-template <> std::string type_to_string<int8_t>()  { return "int8"; }
-template <> std::string type_to_string<int32_t>() { return "int32"; }
-// clang-format on
-
 template <typename InDataType, typename AccDataType, typename OutDataType, index_t Rank>
 bool profile_softmax_impl(int do_verification,
                           int init_method,
@@ -51,6 +47,8 @@ bool profile_softmax_impl(int do_verification,
                           AccDataType alpha,
                           AccDataType beta)
 {
+    ProfilerCacheScope cache_scope;
+
     if(Rank != in_length.size())
     {
         throw std::runtime_error("Input tensor rank is different from template argument Rank!");
@@ -61,6 +59,15 @@ bool profile_softmax_impl(int do_verification,
     Tensor<OutDataType> out(in.mDesc);
     Tensor<OutDataType> prior_out(in.mDesc);
 
+    set_problem_parameters({{"InDataType", type_to_string<InDataType>()},
+                            {"AccDataType", type_to_string<AccDataType>()},
+                            {"OutDataType", type_to_string<OutDataType>()},
+                            {"InLength", get_parameter_string(in_length)},
+                            {"InStrides", get_parameter_string(in_strides)},
+                            {"ReduceDims", get_parameter_string(reduce_dims)},
+                            {"alpha", get_parameter_string(alpha)},
+                            {"beta", get_parameter_string(beta)}});
+
     switch(init_method)
     {
     case 0: break;
@@ -76,15 +83,19 @@ bool profile_softmax_impl(int do_verification,
 
     Tensor<OutDataType> out_ref(prior_out);
 
+    ProfilerVerifier verifier(do_log);
+
     if(do_verification)
     {
-        using ReferenceSoftmax =
-            tensor_operation::host::ReferenceSoftmax<InDataType, OutDataType, AccDataType>;
-        ReferenceSoftmax{}.MakeInvoker().Run({in, out_ref, alpha, beta, reduce_dims});
+        verifier.RunReference([&] {
+            using ReferenceSoftmax =
+                tensor_operation::host::ReferenceSoftmax<InDataType, OutDataType, AccDataType>;
+            ReferenceSoftmax{}.MakeInvoker().Run({in, out_ref, alpha, beta, reduce_dims});
+        });
     }
 
-    DeviceMem in_dev(in.GetElementSpaceSizeInBytes());
-    DeviceMem out_dev(out.GetElementSpaceSizeInBytes());
+    DeviceMem& in_dev = get_device_buffer("in_dev", in.GetElementSpaceSizeInBytes());
+    DeviceMem& out_dev = get_device_buffer("out_dev", out.GetElementSpaceSizeInBytes());
     in_dev.ToDevice(in.data());
 
     std::vector<index_t> in_tensor_lengths(in.GetLengths().begin(), in.GetLengths().end());
@@ -96,8 +107,7 @@ bool profile_softmax_impl(int do_verification,
         DeviceSoftmax<InDataType, AccDataType, OutDataType, PassThrough, PassThrough, Rank>;
 
     // get device op instances
-    const auto instances = tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const auto& instances = get_instances<DeviceOp>();
     std::cout << "found " << instances.size() << " instances" << std::endl;
 
     if(instances.size() <= 0)
@@ -108,7 +118,6 @@ bool profile_softmax_impl(int do_verification,
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
-    std::vector<bool> instance_pass;
 
     for(auto& inst_ptr : instances)
     {
@@ -136,13 +145,18 @@ bool profile_softmax_impl(int do_verification,
                 << "], "
                 << "scaler = [" << alpha << ", " << beta << "]";
             LogRange(std::cout << ", reduce dims = [", reduce_dims, ", ") << "]." << std::endl;
-            instance_pass.push_back(true);
+            verifier.Add(InstanceResult{inst_ptr->GetTypeString()});
             continue;
         }
 
         out_dev.ToDevice(prior_out.data());
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
-        float avg_time   = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+        ck::TimingStatistics timing;
+
+        float avg_time = invoker_ptr->Run(argument_ptr.get(),
+                                          get_profiler_stream_config(time_kernel, &timing));
+
+        InstanceResult result{inst_ptr->GetTypeString(), timing, avg_time, 0, 0};
 
         if(time_kernel)
         {
@@ -151,6 +165,8 @@ bool profile_softmax_impl(int do_verification,
                 (beta == 0.0f ? 1 : 2) * out.GetElementSize() * sizeof(OutDataType);
             float gb_per_sec = num_bytes / 1.E6 / avg_time;
 
+            result.gb_per_sec_ = gb_per_sec;
+
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << gb_per_sec << " GB/s, "
                       << inst_ptr->GetTypeString() << std::endl;
 
@@ -165,41 +181,54 @@ bool profile_softmax_impl(int do_verification,
         if(do_verification)
         {
             out_dev.FromDevice(out.data());
-            bool pass = true;
-            if(std::is_same<InDataType, int8_t>::value)
-            {
-                pass = pass && ck::utils::check_err(
-                                   out.mData, out_ref.mData, "Error: Incorrect results!", 0, 1);
-                if(do_log)
+
+            verifier.Add(result, [&, out](InstanceResult& instance_result) {
+                bool pass = true;
+                if(std::is_same<InDataType, int8_t>::value)
                 {
-                    LogRangeAsType<int>(std::cout << "in  : ", in.mData, ",") << std::endl;
-                    LogRangeAsType<int>(std::cout << "out_ref  : ", out_ref.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<int>(std::cout << "out  : ", out.mData, ",") << std::endl;
+                    pass = pass && ck::utils::check_err(
+                                       out.mData, out_ref.mData, "Error: Incorrect results!", 0, 1);
+                    if(do_log)
+                    {
+                        LogRangeAsType<int>(std::cout << "in  : ", in.mData, ",") << std::endl;
+                        LogRangeAsType<int>(std::cout << "out_ref  : ", out_ref.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<int>(std::cout << "out  : ", out.mData, ",") << std::endl;
+                    }
                 }
-            }
-            else
-            {
-                pass = pass && ck::utils::check_err(out.mData, out_ref.mData);
-                if(do_log)
+                else
                 {
-                    LogRangeAsType<float>(std::cout << "in  : ", in.mData, ",") << std::endl;
-                    LogRangeAsType<float>(std::cout << "out_ref  : ", out_ref.mData, ",")
-                        << std::endl;
-                    LogRangeAsType<float>(std::cout << "out  : ", out.mData, ",") << std::endl;
+                    pass = pass && ck::utils::check_err(out.mData, out_ref.mData);
+                    if(do_log)
+                    {
+                        LogRangeAsType<float>(std::cout << "in  : ", in.mData, ",") << std::endl;
+                        LogRangeAsType<float>(std::cout << "out_ref  : ", out_ref.mData, ",")
+                            << std::endl;
+                        LogRangeAsType<float>(std::cout << "out  : ", out.mData, ",")
+                            << std::endl;
+                    }
                 }
-            }
 
-            if(!pass)
-            {
-                std::cout << inst_ptr->GetTypeString() << " failed verification: ";
-                LogRange(std::cout << "input lengths = [", in_length, ", ")
-                    << "], "
-                    << "scaler = [" << alpha << ", " << beta << "]." << std::endl;
-            }
-            instance_pass.push_back(pass);
+                if(!pass)
+                {
+                    std::cout << instance_result.instance_ << " failed verification: ";
+                    LogRange(std::cout << "input lengths = [", in_length, ", ")
+                        << "], "
+                        << "scaler = [" << alpha << ", " << beta << "]." << std::endl;
+                }
+                instance_result.AddVerification(pass, out.mData, out_ref.mData);
+
+                return pass;
+            });
+        }
+        else
+        {
+            verifier.Add(result);
         }
     }
+
+    const bool pass = verifier.Wait();
+
     if(time_kernel)
     {
         std::cout << "Best Perf for datatype = " << type_to_string<InDataType>() << "_"
@@ -211,8 +240,7 @@ bool profile_softmax_impl(int do_verification,
                   << "beta = " << beta << ", " << best_avg_time << " ms, " << best_gb_per_sec
                   << " GB/s, " << best_instance_name << std::endl;
     }
-    return std::all_of(
-        std::begin(instance_pass), std::end(instance_pass), [](bool p) { return p; });
+    return pass;
 }
 
 } // namespace profiler
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Reads the problems of a problem file, one problem on each line given as the arguments of
+// ckProfiler without the common options, e.g. "gemm 1 1 1 1 0 1 3840 4096 4096 4096 4096 4096".
+// Empty lines and lines starting with '#' are skipped, and a problem given more than once is only
+// kept the first time.
+inline std::vector<std::vector<std::string>> read_problem_file(std::istream& is)
+{
+    std::vector<std::vector<std::string>> problems;
+
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        std::istringstream line_stream(line);
+
+        std::vector<std::string> problem{std::istream_iterator<std::string>(line_stream),
+                                         std::istream_iterator<std::string>()};
+
+        if(problem.empty() || problem[0][0] == '#')
+        {
+            continue;
+        }
+
+        for(const auto& arg : problem)
+        {
+            if(ProfilerOptions::IsOption(arg))
+            {
+                throw std::runtime_error("wrong! option " + arg +
+                                         " in problem file, common options apply to all problems");
+            }
+        }
+
+        if(std::find(problems.begin(), problems.end(), problem) == problems.end())
+        {
+            problems.push_back(problem);
+        }
+    }
+
+    return problems;
+}
+
+inline std::vector<std::vector<std::string>> read_problem_file(const std::string& path)
+{
+    std::ifstream file(path);
+
+    if(!file)
+    {
+        throw std::runtime_error("wrong! cannot open problem file " + path);
+    }
+
+    return read_problem_file(file);
+}
+
+// prints one line for each problem with its number of instances and its best instance, with
+// its place on the roofline when it is known
+inline void print_problem_summaries(std::ostream& os, const std::vector<ProblemSummary>& summaries)
+{
+    int num_incomplete = 0;
+    int num_failed     = 0;
+
+    os << "problems: " << summaries.size() << std::endl;
+
+    for(std::size_t i = 0; i < summaries.size(); ++i)
+    {
+        const auto& summary = summaries[i];
+
+        os << "[" << i << "] " << summary.operation_;
+
+        for(const auto& argument : summary.arguments_)
+        {
+            os << " " << argument;
+        }
+
+        os << ": ";
+
+        if(!summary.completed_)
+        {
+            os << "error, ";
+        }
+
+        os << summary.num_supported_ << "/" << summary.num_instance_ << " instances supported, "
+           << summary.num_failed_ << " failed verification";
+
+        if(summary.best_.supported_)
+        {
+            const auto& best = summary.best_;
+
+            os << ", best: " << best.ave_time_ << " ms, " << best.tflops_ << " TFlops, "
+               << best.gb_per_sec_ << " GB/s, ";
+
+            if(best.roofline_.bound_ != RooflineBound::Unknown)
+            {
+                os << best.roofline_.percent_of_peak_ << "% of roofline ("
+                   << get_roofline_bound_string(best.roofline_.bound_) << " bound), ";
+            }
+
+            os << best.instance_;
+        }
+
+        os << std::endl;
+
+        num_incomplete += summary.completed_ ? 0 : 1;
+        num_failed += summary.num_failed_ > 0 ? 1 : 0;
+    }
+
+    os << "problems with an error: " << num_incomplete
+       << ", problems with failed verification: " << num_failed << std::endl;
+}
+
+} // namespace profiler
+} // namespace ck
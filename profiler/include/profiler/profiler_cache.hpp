@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <vector>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/utility/device_memory.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Instances and device buffers kept across the problems profiled within the outermost
+// ProfilerCacheScope, e.g. the problems of a problem file. The instances of a device operation are
+// made once, and a device buffer is only reallocated when a problem needs more memory than the
+// problems before it.
+class ProfilerCache final
+{
+    ProfilerCache()  = default;
+    ~ProfilerCache() = default;
+
+    friend class ProfilerCacheScope;
+
+    public:
+    static ProfilerCache& GetInstance()
+    {
+        static ProfilerCache cache;
+        return cache;
+    }
+
+    template <typename DeviceOp>
+    const std::vector<std::unique_ptr<DeviceOp>>& GetInstances()
+    {
+        if(num_scopes_ == 0)
+        {
+            throw std::runtime_error("wrong! instances are used outside of a ProfilerCacheScope");
+        }
+
+        using Instances = std::vector<std::unique_ptr<DeviceOp>>;
+        using Factory =
+            ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>;
+
+        auto found = instances_.find(std::type_index(typeid(DeviceOp)));
+
+        if(found == instances_.end())
+        {
+            found = instances_
+                        .emplace(std::type_index(typeid(DeviceOp)),
+                                 std::make_shared<Instances>(Factory::GetInstances()))
+                        .first;
+        }
+
+        return *std::static_pointer_cast<Instances>(found->second);
+    }
+
+    // the buffers are told apart by name, a profiler must not use the same name for two buffers
+    // in use at the same time
+    DeviceMem& GetDeviceBuffer(const std::string& name, std::size_t size)
+    {
+        if(num_scopes_ == 0)
+        {
+            throw std::runtime_error("wrong! device buffer " + name +
+                                     " is used outside of a ProfilerCacheScope");
+        }
+
+        auto& buffer = device_buffers_[name];
+
+        if(buffer == nullptr)
+        {
+            buffer = std::make_unique<DeviceMem>(size);
+        }
+        else
+        {
+            buffer->Resize(size);
+        }
+
+        return *buffer;
+    }
+
+    bool IsEmpty() const { return instances_.empty() && device_buffers_.empty(); }
+
+    private:
+    void Clear()
+    {
+        instances_.clear();
+        device_buffers_.clear();
+    }
+
+    int num_scopes_ = 0;
+    std::map<std::type_index, std::shared_ptr<void>> instances_;
+    std::map<std::string, std::unique_ptr<DeviceMem>> device_buffers_;
+};
+
+// Scope in which the instances and device buffers of ProfilerCache may be used. The scopes nest,
+// and the cache is cleared when the outermost one ends, so the device buffers are freed on return
+// of a profiler called on its own, e.g. by a test, and not at the static destruction of the cache
+// after the HIP runtime is torn down. ckProfiler opens a scope around all of its problems.
+class ProfilerCacheScope final
+{
+    public:
+    ProfilerCacheScope() { ++ProfilerCache::GetInstance().num_scopes_; }
+
+    ~ProfilerCacheScope()
+    {
+        auto& cache = ProfilerCache::GetInstance();
+
+        if(--cache.num_scopes_ == 0)
+        {
+            cache.Clear();
+        }
+    }
+
+    ProfilerCacheScope(const ProfilerCacheScope&) = delete;
+    ProfilerCacheScope& operator=(const ProfilerCacheScope&) = delete;
+};
+
+// instances of DeviceOperationInstanceFactory<DeviceOp>, made on the first call in the outermost
+// ProfilerCacheScope only
+template <typename DeviceOp>
+const std::vector<std::unique_ptr<DeviceOp>>& get_instances()
+{
+    return ProfilerCache::GetInstance().GetInstances<DeviceOp>();
+}
+
+// device buffer of size bytes that is reused by the next problems of the outermost
+// ProfilerCacheScope
+inline DeviceMem& get_device_buffer(const std::string& name, std::size_t size)
+{
+    return ProfilerCache::GetInstance().GetDeviceBuffer(name, size);
+}
+
+} // namespace profiler
+} // namespace ck
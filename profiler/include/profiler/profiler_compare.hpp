@@ -0,0 +1,794 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace profiler {
+
+// Value of a JSON document, numbers are kept as their text so that the parameters of a problem
+// read from JSON lines match the ones read from CSV
+struct JsonValue
+{
+    enum struct Type
+    {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object,
+    };
+
+    Type type_ = Type::Null;
+    bool bool_ = false;
+    std::string string_; // of a string or a number
+
+    std::vector<JsonValue> array_;
+    std::vector<std::pair<std::string, JsonValue>> object_;
+
+    // the member name of an object, nullptr when there is none
+    const JsonValue* Find(const std::string& name) const
+    {
+        for(const auto& [member_name, value] : object_)
+        {
+            if(member_name == name)
+            {
+                return &value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // of a number
+    double GetNumber() const { return std::stod(string_); }
+};
+
+// Parses one JSON document, e.g. a line of a result file of ckProfiler. Throws on invalid JSON.
+class JsonParser
+{
+    public:
+    static JsonValue Parse(const std::string& str)
+    {
+        JsonParser parser(str);
+
+        JsonValue value = parser.ParseValue();
+
+        parser.SkipSpace();
+
+        if(parser.pos_ != str.size())
+        {
+            parser.Fail();
+        }
+
+        return value;
+    }
+
+    private:
+    explicit JsonParser(const std::string& str) : str_(str) {}
+
+    [[noreturn]] void Fail() const
+    {
+        throw std::runtime_error("wrong! invalid JSON at " + std::to_string(pos_) + ": " + str_);
+    }
+
+    void SkipSpace()
+    {
+        while(pos_ < str_.size() && std::isspace(static_cast<unsigned char>(str_[pos_])))
+        {
+            ++pos_;
+        }
+    }
+
+    char Peek()
+    {
+        SkipSpace();
+
+        return pos_ < str_.size() ? str_[pos_] : '\0';
+    }
+
+    void Expect(char c)
+    {
+        if(Peek() != c)
+        {
+            Fail();
+        }
+
+        ++pos_;
+    }
+
+    void ExpectWord(const std::string& word)
+    {
+        if(str_.compare(pos_, word.size(), word) != 0)
+        {
+            Fail();
+        }
+
+        pos_ += word.size();
+    }
+
+    JsonValue ParseValue()
+    {
+        JsonValue value;
+
+        const char c = Peek();
+
+        if(c == '{')
+        {
+            value.type_ = JsonValue::Type::Object;
+
+            ++pos_;
+
+            while(Peek() != '}')
+            {
+                if(!value.object_.empty())
+                {
+                    Expect(',');
+                }
+
+                std::string name = ParseString();
+
+                Expect(':');
+
+                value.object_.emplace_back(std::move(name), ParseValue());
+            }
+
+            ++pos_;
+        }
+        else if(c == '[')
+        {
+            value.type_ = JsonValue::Type::Array;
+
+            ++pos_;
+
+            while(Peek() != ']')
+            {
+                if(!value.array_.empty())
+                {
+                    Expect(',');
+                }
+
+                value.array_.push_back(ParseValue());
+            }
+
+            ++pos_;
+        }
+        else if(c == '"')
+        {
+            value.type_   = JsonValue::Type::String;
+            value.string_ = ParseString();
+        }
+        else if(c == 't' || c == 'f')
+        {
+            value.type_ = JsonValue::Type::Bool;
+            value.bool_ = c == 't';
+
+            ExpectWord(value.bool_ ? "true" : "false");
+        }
+        else if(c == 'n')
+        {
+            ExpectWord("null");
+        }
+        else
+        {
+            const std::size_t begin = pos_;
+
+            pos_ = std::min(str_.find_first_not_of("+-.0123456789eE", pos_), str_.size());
+
+            if(pos_ == begin)
+            {
+                Fail();
+            }
+
+            value.type_   = JsonValue::Type::Number;
+            value.string_ = str_.substr(begin, pos_ - begin);
+        }
+
+        return value;
+    }
+
+    // only the \u escapes of ASCII characters are decoded, as written by ckProfiler
+    std::string ParseString()
+    {
+        Expect('"');
+
+        std::string str;
+
+        while(pos_ < str_.size() && str_[pos_] != '"')
+        {
+            char c = str_[pos_++];
+
+            if(c == '\\' && pos_ < str_.size())
+            {
+                c = str_[pos_++];
+
+                switch(c)
+                {
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'u':
+                    if(pos_ + 4 > str_.size())
+                    {
+                        Fail();
+                    }
+
+                    c = static_cast<char>(std::stoi(str_.substr(pos_, 4), nullptr, 16) & 0x7f);
+                    pos_ += 4;
+                    break;
+                default: break;
+                }
+            }
+
+            str += c;
+        }
+
+        Expect('"');
+
+        return str;
+    }
+
+    const std::string& str_;
+    std::size_t pos_ = 0;
+};
+
+// splits a CSV line into its fields, with the quoting of ckProfiler
+inline std::vector<std::string> split_csv_line(const std::string& line)
+{
+    std::vector<std::string> fields(1);
+
+    bool quoted = false;
+
+    for(std::size_t i = 0; i < line.size(); ++i)
+    {
+        const char c = line[i];
+
+        if(quoted && c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+        {
+            fields.back() += '"';
+            ++i;
+        }
+        else if(c == '"')
+        {
+            quoted = !quoted;
+        }
+        else if(c == ',' && !quoted)
+        {
+            fields.emplace_back();
+        }
+        else if(c != '\r')
+        {
+            fields.back() += c;
+        }
+    }
+
+    return fields;
+}
+
+// Times in ms of the instances of the problems of one or more result files of ckProfiler. A
+// problem is its operation and its named parameters, or its arguments when the operation sets no
+// parameters, so that problems match across runs with other verification or logging arguments.
+struct ResultSet
+{
+    using Problem = std::pair<std::string, std::string>; // operation, parameters
+
+    // times of each instance of each problem, the times of all the runs of an instance when the
+    // result has them, or else its mean time, from every result of the instance
+    std::map<Problem, std::map<std::string, std::vector<double>>> times_;
+
+    void Add(const Problem& problem, const std::string& instance, const std::vector<double>& times)
+    {
+        if(times.empty())
+        {
+            return;
+        }
+
+        auto& instance_times = times_[problem][instance];
+
+        instance_times.insert(instance_times.end(), times.begin(), times.end());
+    }
+
+    // Adds the results of JSON lines or CSV, a file may mix them, e.g. when several runs are
+    // appended to it. The instances that do not support their problem are left out.
+    void Read(std::istream& is)
+    {
+        std::string line;
+
+        while(std::getline(is, line))
+        {
+            if(line.empty() || line.compare(0, 10, "operation,") == 0)
+            {
+                continue;
+            }
+
+            if(line[0] == '{')
+            {
+                ReadJson(JsonParser::Parse(line));
+            }
+            else
+            {
+                ReadCsv(split_csv_line(line));
+            }
+        }
+    }
+
+    void Read(const std::string& path)
+    {
+        std::ifstream file(path);
+
+        if(!file)
+        {
+            throw std::runtime_error("wrong! cannot open result file " + path);
+        }
+
+        Read(file);
+    }
+
+    private:
+    void ReadJson(const JsonValue& result)
+    {
+        const auto* operation = result.Find("operation");
+        const auto* arguments = result.Find("arguments");
+        const auto* problem   = result.Find("problem");
+        const auto* instance  = result.Find("instance");
+        const auto* supported = result.Find("supported");
+
+        if(operation == nullptr || instance == nullptr || supported == nullptr)
+        {
+            throw std::runtime_error("wrong! not a result of ckProfiler");
+        }
+
+        if(!supported->bool_)
+        {
+            return;
+        }
+
+        std::string parameters;
+
+        if(problem != nullptr)
+        {
+            for(const auto& [name, value] : problem->object_)
+            {
+                parameters += (parameters.empty() ? "" : ";") + name + "=" + value.string_;
+            }
+        }
+
+        if(parameters.empty() && arguments != nullptr)
+        {
+            parameters = arguments->string_;
+        }
+
+        std::vector<double> times;
+
+        if(const auto* timing = result.Find("timing"))
+        {
+            if(const auto* times_ms = timing->Find("times_ms"))
+            {
+                for(const auto& time : times_ms->array_)
+                {
+                    if(time.type_ == JsonValue::Type::Number)
+                    {
+                        times.push_back(time.GetNumber());
+                    }
+                }
+            }
+        }
+
+        if(times.empty())
+        {
+            const auto* ave_time = result.Find("ave_time_ms");
+
+            if(ave_time != nullptr && ave_time->type_ == JsonValue::Type::Number)
+            {
+                times.push_back(ave_time->GetNumber());
+            }
+        }
+
+        Add({operation->string_, parameters}, instance->string_, times);
+    }
+
+    // operation,arguments,problem,instance,supported,ave_time_ms,...
+    void ReadCsv(const std::vector<std::string>& fields)
+    {
+        if(fields.size() < 6)
+        {
+            throw std::runtime_error("wrong! not a result of ckProfiler");
+        }
+
+        if(fields[4] != "true" || fields[5].empty())
+        {
+            return;
+        }
+
+        Add({fields[0], fields[2].empty() ? fields[1] : fields[2]},
+            fields[3],
+            {std::stod(fields[5])});
+    }
+};
+
+// Two-sided p-value of the Mann-Whitney U test of the times x and y, with the normal approximation
+// of U corrected for ties and continuity. 1 when either has no times.
+inline double mann_whitney_p_value(const std::vector<double>& x, const std::vector<double>& y)
+{
+    const double n1 = static_cast<double>(x.size());
+    const double n2 = static_cast<double>(y.size());
+    const double n  = n1 + n2;
+
+    if(x.empty() || y.empty())
+    {
+        return 1;
+    }
+
+    // the times with the sample they belong to, 0 for x
+    std::vector<std::pair<double, int>> times;
+
+    for(double t : x)
+    {
+        times.emplace_back(t, 0);
+    }
+
+    for(double t : y)
+    {
+        times.emplace_back(t, 1);
+    }
+
+    std::sort(times.begin(), times.end());
+
+    double rank_sum = 0;
+    double tie_sum  = 0;
+
+    for(std::size_t i = 0; i < times.size();)
+    {
+        std::size_t j = i;
+
+        while(j < times.size() && times[j].first == times[i].first)
+        {
+            ++j;
+        }
+
+        // the ties share the mean of the ranks i + 1 to j
+        const double rank = static_cast<double>(i + 1 + j) / 2;
+        const double tie  = static_cast<double>(j - i);
+
+        tie_sum += tie * tie * tie - tie;
+
+        for(std::size_t k = i; k < j; ++k)
+        {
+            rank_sum += times[k].second == 0 ? rank : 0;
+        }
+
+        i = j;
+    }
+
+    const double u        = rank_sum - n1 * (n1 + 1) / 2;
+    const double mean     = n1 * n2 / 2;
+    const double variance = n1 * n2 / 12 * ((n + 1) - tie_sum / (n * (n - 1)));
+
+    if(variance <= 0)
+    {
+        return 1;
+    }
+
+    const double z = std::max(std::abs(u - mean) - 0.5, 0.0) / std::sqrt(variance);
+
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+enum struct PerformanceChange
+{
+    Unchanged,
+    Improvement,
+    Regression,
+    Untested, // beyond the threshold, but with too few times on either side to be tested
+};
+
+inline const char* get_performance_change_string(PerformanceChange change)
+{
+    switch(change)
+    {
+    case PerformanceChange::Improvement: return "improvement";
+    case PerformanceChange::Regression: return "regression";
+    case PerformanceChange::Untested: return "untested change";
+    default: return "unchanged";
+    }
+}
+
+struct CompareOptions
+{
+    // significance level of the Mann-Whitney U test
+    double alpha_ = 0.05;
+
+    // smallest relative change of the median time that is reported
+    double threshold_ = 0.02;
+
+    // with fewer times on either side, e.g. the mean time of each result in CSV, a change beyond
+    // the threshold is reported untested and is neither a regression nor an improvement
+    std::size_t min_num_time_ = 3;
+};
+
+// times of an instance in the baseline and in the candidate
+struct InstanceComparison
+{
+    std::string operation_;
+    std::string problem_;
+    std::string instance_;
+
+    std::size_t num_baseline_  = 0;
+    std::size_t num_candidate_ = 0;
+
+    // median times in ms
+    double baseline_ms_  = 0;
+    double candidate_ms_ = 0;
+
+    double p_value_ = 1;
+
+    PerformanceChange change_ = PerformanceChange::Unchanged;
+
+    double GetRatio() const { return candidate_ms_ / baseline_ms_; }
+};
+
+inline double get_median(std::vector<double> times)
+{
+    if(times.empty())
+    {
+        return 0;
+    }
+
+    std::sort(times.begin(), times.end());
+
+    const std::size_t half = times.size() / 2;
+
+    return times.size() % 2 == 1 ? times[half] : (times[half - 1] + times[half]) / 2;
+}
+
+inline InstanceComparison compare_times(const std::vector<double>& baseline,
+                                        const std::vector<double>& candidate,
+                                        const CompareOptions& options)
+{
+    InstanceComparison comparison;
+
+    comparison.num_baseline_  = baseline.size();
+    comparison.num_candidate_ = candidate.size();
+    comparison.baseline_ms_   = get_median(baseline);
+    comparison.candidate_ms_  = get_median(candidate);
+    comparison.p_value_       = mann_whitney_p_value(baseline, candidate);
+
+    if(!(comparison.baseline_ms_ > 0))
+    {
+        return comparison;
+    }
+
+    const bool tested = baseline.size() >= options.min_num_time_ &&
+                        candidate.size() >= options.min_num_time_;
+    const bool significant = comparison.p_value_ < options.alpha_;
+    const double change    = comparison.GetRatio() - 1;
+
+    if(!tested && std::abs(change) > options.threshold_)
+    {
+        comparison.change_ = PerformanceChange::Untested;
+    }
+    else if(significant && change > options.threshold_)
+    {
+        comparison.change_ = PerformanceChange::Regression;
+    }
+    else if(significant && change < -options.threshold_)
+    {
+        comparison.change_ = PerformanceChange::Improvement;
+    }
+
+    return comparison;
+}
+
+struct ComparisonReport
+{
+    // each instance of each problem in both the baseline and the candidate
+    std::vector<InstanceComparison> instances_;
+
+    // the fastest instance of each problem in both, by median time, which may be another instance
+    // in the candidate, given as "baseline instance -> candidate instance"
+    std::vector<InstanceComparison> best_;
+
+    int num_baseline_only_  = 0; // instances of the baseline missing from the candidate
+    int num_candidate_only_ = 0; // instances of the candidate missing from the baseline
+
+    // number of the changes of the best instances, or of all the instances
+    int GetNumChange(PerformanceChange change, bool best) const
+    {
+        const auto& comparisons = best ? best_ : instances_;
+
+        return static_cast<int>(
+            std::count_if(comparisons.begin(), comparisons.end(), [&](const auto& comparison) {
+                return comparison.change_ == change;
+            }));
+    }
+
+    // untested changes are not regressions, they do not fail the gate
+    int GetNumRegression(bool best) const
+    {
+        return GetNumChange(PerformanceChange::Regression, best);
+    }
+};
+
+inline ComparisonReport compare_result_sets(const ResultSet& baseline,
+                                            const ResultSet& candidate,
+                                            const CompareOptions& options = {})
+{
+    ComparisonReport report;
+
+    // fastest instance by median time, and its times
+    auto get_best = [](const std::map<std::string, std::vector<double>>& instances) {
+        auto best = instances.begin();
+
+        for(auto it = instances.begin(); it != instances.end(); ++it)
+        {
+            if(get_median(it->second) < get_median(best->second))
+            {
+                best = it;
+            }
+        }
+
+        return best;
+    };
+
+    for(const auto& [problem, baseline_instances] : baseline.times_)
+    {
+        const auto found = candidate.times_.find(problem);
+
+        if(found == candidate.times_.end())
+        {
+            report.num_baseline_only_ += static_cast<int>(baseline_instances.size());
+            continue;
+        }
+
+        const auto& candidate_instances = found->second;
+
+        for(const auto& [instance, times] : baseline_instances)
+        {
+            const auto candidate_times = candidate_instances.find(instance);
+
+            if(candidate_times == candidate_instances.end())
+            {
+                ++report.num_baseline_only_;
+                continue;
+            }
+
+            auto comparison       = compare_times(times, candidate_times->second, options);
+            comparison.operation_ = problem.first;
+            comparison.problem_   = problem.second;
+            comparison.instance_  = instance;
+
+            report.instances_.push_back(comparison);
+        }
+
+        for(const auto& [instance, times] : candidate_instances)
+        {
+            report.num_candidate_only_ += baseline_instances.count(instance) == 0 ? 1 : 0;
+        }
+
+        const auto baseline_best  = get_best(baseline_instances);
+        const auto candidate_best = get_best(candidate_instances);
+
+        auto comparison = compare_times(baseline_best->second, candidate_best->second, options);
+        comparison.operation_ = problem.first;
+        comparison.problem_   = problem.second;
+        comparison.instance_  = baseline_best->first == candidate_best->first
+                                    ? baseline_best->first
+                                    : baseline_best->first + " -> " + candidate_best->first;
+
+        report.best_.push_back(comparison);
+    }
+
+    for(const auto& [problem, candidate_instances] : candidate.times_)
+    {
+        if(baseline.times_.count(problem) == 0)
+        {
+            report.num_candidate_only_ += static_cast<int>(candidate_instances.size());
+        }
+    }
+
+    return report;
+}
+
+// Prints, for each operation, the number of regressions and improvements of its instances and of
+// the best instance of its problems, with the geometric mean of the ratios of candidate over
+// baseline times, then each regression and improvement of the best instances and of the instances
+inline void print_comparison_report(std::ostream& os, const ComparisonReport& report)
+{
+    struct Family
+    {
+        int num_regression_   = 0;
+        int num_improvement_  = 0;
+        int num_untested_     = 0;
+        int num_comparison_   = 0;
+        double log_ratio_sum_ = 0;
+
+        void Add(const InstanceComparison& comparison)
+        {
+            num_regression_ += comparison.change_ == PerformanceChange::Regression ? 1 : 0;
+            num_improvement_ += comparison.change_ == PerformanceChange::Improvement ? 1 : 0;
+            num_untested_ += comparison.change_ == PerformanceChange::Untested ? 1 : 0;
+
+            if(comparison.baseline_ms_ > 0 && comparison.candidate_ms_ > 0)
+            {
+                ++num_comparison_;
+                log_ratio_sum_ += std::log(comparison.GetRatio());
+            }
+        }
+
+        double GetGeometricMean() const
+        {
+            return num_comparison_ > 0 ? std::exp(log_ratio_sum_ / num_comparison_) : 1;
+        }
+    };
+
+    std::map<std::string, std::pair<Family, Family>> families; // of instances, of best
+
+    for(const auto& comparison : report.instances_)
+    {
+        families[comparison.operation_].first.Add(comparison);
+    }
+
+    for(const auto& comparison : report.best_)
+    {
+        families[comparison.operation_].second.Add(comparison);
+    }
+
+    os << std::setprecision(4);
+
+    for(const auto& [operation, family] : families)
+    {
+        const auto& [instances, best] = family;
+
+        os << operation << ": " << best.num_regression_ << " regressions, "
+           << best.num_improvement_ << " improvements, " << best.num_untested_
+           << " untested changes of the best instance, time ratio " << best.GetGeometricMean()
+           << "; " << instances.num_regression_ << " regressions, " << instances.num_improvement_
+           << " improvements, " << instances.num_untested_ << " untested changes of "
+           << instances.num_comparison_ << " instances, time ratio "
+           << instances.GetGeometricMean() << std::endl;
+    }
+
+    os << "instances only in the baseline: " << report.num_baseline_only_
+       << ", only in the candidate: " << report.num_candidate_only_ << std::endl;
+
+    auto print_changes = [&](const std::vector<InstanceComparison>& comparisons,
+                             const std::string& kind) {
+        for(const auto& comparison : comparisons)
+        {
+            if(comparison.change_ == PerformanceChange::Unchanged)
+            {
+                continue;
+            }
+
+            os << get_performance_change_string(comparison.change_) << " of " << kind << ": "
+               << comparison.operation_ << " " << comparison.problem_ << ", "
+               << comparison.instance_ << ": " << comparison.baseline_ms_ << " ms -> "
+               << comparison.candidate_ms_ << " ms (" << std::showpos
+               << (comparison.GetRatio() - 1) * 100 << std::noshowpos << "%, p "
+               << comparison.p_value_ << ", " << comparison.num_baseline_ << " / "
+               << comparison.num_candidate_ << " times)" << std::endl;
+        }
+    };
+
+    print_changes(report.best_, "best");
+    print_changes(report.instances_, "instance");
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ck/stream_config.hpp"
+#include "ck/host_utility/timer.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Options common to all the operations of ckProfiler, given as --name=value anywhere on the
+// command line, see GetHelpMessage()
+struct ProfilerOptions
+{
+    int cold_niters_ = 1;
+    int nrepeat_     = 10;
+    float target_ci_ = 0;
+    int max_nrepeat_ = 1000;
+
+    bool reject_outliers_ = false;
+
+    std::size_t verify_threads_ = 4;
+
+    std::string result_file_;
+    std::string result_format_;
+    std::string problem_file_;
+    std::string device_file_;
+
+    // NAME=VALUES of each --sweep, see parse_sweep_parameter()
+    std::vector<std::string> sweep_;
+    float sweep_min_roofline_ = 50;
+
+    static ProfilerOptions& GetInstance()
+    {
+        static ProfilerOptions options;
+        return options;
+    }
+
+    static const char* GetHelpMessage()
+    {
+        return "common options:\n"
+               "  --warmup=N          untimed runs of each instance before timing (default: 1)\n"
+               "  --repeat=N          timed runs of each instance (default: 10)\n"
+               "  --target-ci=X       add timed runs until the 95% confidence interval of the\n"
+               "                      mean is within X of the mean, e.g. 0.01 (default: 0, off)\n"
+               "  --max-repeat=N      most timed runs with --target-ci (default: 1000)\n"
+               "  --reject-outliers=B leave the runs outside of Tukey's fences out of the mean\n"
+               "                      time, 0 or 1 (default: 0)\n"
+               "  --result-file=PATH  append the result of each instance to PATH, '-' for the\n"
+               "                      standard output\n"
+               "  --result-format=F   json (JSON lines) or csv, by default csv for .csv files and\n"
+               "                      json otherwise\n"
+               "  --problem-file=PATH profile the problems of PATH, one on each line given as the\n"
+               "                      arguments of ckProfiler, instead of the command line\n"
+               "  --verify-threads=N  threads checking the outputs of instances while the next\n"
+               "                      ones are timed, 0 to check each one right after it runs\n"
+               "                      (default: 4)\n"
+               "  --device-file=PATH  capability of the device for the roofline of the results,\n"
+               "                      one name=value on each line, e.g. peak_tflops.f16=191.5,\n"
+               "                      overriding the values queried from the device\n"
+               "  --sweep=NAME=VALUES profile the problem, or the problems of --problem-file, for\n"
+               "                      each value of NAME, replacing {NAME} in their arguments,\n"
+               "                      and report the best instance of each point and the\n"
+               "                      instances that never win; VALUES is a list a,b,c, or\n"
+               "                      first:last:xF for log-spaced values, or first:last:+S;\n"
+               "                      repeat it to sweep the grid of several parameters\n"
+               "  --sweep-min-roofline=X\n"
+               "                      report the sweep points where the best instance is below\n"
+               "                      X% of the roofline (default: 50)\n";
+    }
+
+    // whether arg is one of the common options, the other arguments starting with "--" belong to
+    // the operation, e.g. --length of layernorm
+    static bool IsOption(const std::string& arg)
+    {
+        static const char* const names[] = {"warmup",
+                                            "repeat",
+                                            "target-ci",
+                                            "max-repeat",
+                                            "reject-outliers",
+                                            "result-file",
+                                            "result-format",
+                                            "problem-file",
+                                            "verify-threads",
+                                            "device-file",
+                                            "sweep",
+                                            "sweep-min-roofline"};
+
+        if(arg.compare(0, 2, "--") != 0)
+        {
+            return false;
+        }
+
+        const std::string option = arg.substr(2);
+        const std::string name   = option.substr(0, option.find('='));
+
+        return std::find(std::begin(names), std::end(names), name) != std::end(names);
+    }
+
+    // Removes the common options from argv, and returns the number of remaining arguments. Throws
+    // on an invalid value.
+    int Parse(int argc, char* argv[])
+    {
+        int num_arg = 0;
+
+        for(int i = 0; i < argc; ++i)
+        {
+            if(!IsOption(argv[i]))
+            {
+                argv[num_arg++] = argv[i];
+                continue;
+            }
+
+            const std::string arg   = argv[i] + 2;
+            const auto equal        = arg.find('=');
+            const std::string name  = arg.substr(0, equal);
+            const std::string value = equal == std::string::npos ? "" : arg.substr(equal + 1);
+
+            if(value.empty())
+            {
+                throw std::runtime_error("wrong! option --" + name + " needs a value");
+            }
+
+            if(name == "warmup")
+            {
+                cold_niters_ = std::stoi(value);
+            }
+            else if(name == "repeat")
+            {
+                nrepeat_ = std::stoi(value);
+            }
+            else if(name == "target-ci")
+            {
+                target_ci_ = std::stof(value);
+            }
+            else if(name == "max-repeat")
+            {
+                max_nrepeat_ = std::stoi(value);
+            }
+            else if(name == "reject-outliers")
+            {
+                reject_outliers_ = std::stoi(value) != 0;
+            }
+            else if(name == "result-file")
+            {
+                result_file_ = value;
+            }
+            else if(name == "result-format")
+            {
+                result_format_ = value;
+            }
+            else if(name == "problem-file")
+            {
+                problem_file_ = value;
+            }
+            else if(name == "verify-threads")
+            {
+                verify_threads_ = std::stoul(value);
+            }
+            else if(name == "device-file")
+            {
+                device_file_ = value;
+            }
+            else if(name == "sweep")
+            {
+                sweep_.push_back(value);
+            }
+            else
+            {
+                sweep_min_roofline_ = std::stof(value);
+            }
+        }
+
+        return num_arg;
+    }
+
+    // stream configuration for timing instances with these options, the timing statistics are
+    // written to timing when it is set
+    StreamConfig GetStreamConfig(bool time_kernel, ck::TimingStatistics* timing = nullptr) const
+    {
+        StreamConfig stream_config{nullptr, time_kernel};
+
+        stream_config.cold_niters_       = cold_niters_;
+        stream_config.nrepeat_           = nrepeat_;
+        stream_config.target_ci_         = target_ci_;
+        stream_config.max_nrepeat_       = max_nrepeat_;
+        stream_config.reject_outliers_   = reject_outliers_;
+        stream_config.timing_statistics_ = timing;
+
+        return stream_config;
+    }
+};
+
+// stream configuration for timing an instance with the common options of ckProfiler
+inline StreamConfig get_profiler_stream_config(bool time_kernel,
+                                               ck::TimingStatistics* timing = nullptr)
+{
+    return ProfilerOptions::GetInstance().GetStreamConfig(time_kernel, timing);
+}
+
+} // namespace profiler
+} // namespace ck
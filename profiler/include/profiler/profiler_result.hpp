@@ -0,0 +1,662 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/host_utility/timer.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+
+#include "profiler/profiler_roofline.hpp"
+
+namespace ck {
+namespace profiler {
+
+// clang-format off
+template <typename DataType> std::string type_to_string();
+template <> inline std::string type_to_string<double>()  { return "f64"; }
+template <> inline std::string type_to_string<float>()   { return "f32"; }
+template <> inline std::string type_to_string<half_t>()  { return "f16"; }
+template <> inline std::string type_to_string<bhalf_t>() { return "bf16"; }
+template <> inline std::string type_to_string<int8_t>()  { return "int8"; }
+template <> inline std::string type_to_string<int32_t>() { return "int32"; }
+// clang-format on
+
+enum struct VerificationStatus
+{
+    NotRun,
+    Pass,
+    Fail,
+};
+
+inline const char* get_verification_status_string(VerificationStatus status)
+{
+    switch(status)
+    {
+    case VerificationStatus::Pass: return "pass";
+    case VerificationStatus::Fail: return "fail";
+    default: return "none";
+    }
+}
+
+// Result of one instance on the current problem of the ProfilerResultSink
+struct InstanceResult
+{
+    // an instance that does not support the problem
+    explicit InstanceResult(const std::string& instance) : instance_(instance) {}
+
+    InstanceResult(const std::string& instance,
+                   const ck::TimingStatistics& timing,
+                   float ave_time,
+                   float tflops,
+                   float gb_per_sec)
+        : instance_(instance),
+          supported_(true),
+          timing_(timing),
+          ave_time_(ave_time),
+          tflops_(tflops),
+          gb_per_sec_(gb_per_sec)
+    {
+    }
+
+    std::string instance_;
+    bool supported_ = false;
+
+    ck::TimingStatistics timing_;
+    float ave_time_   = 0;
+    float tflops_     = 0;
+    float gb_per_sec_ = 0;
+
+    VerificationStatus verification_ = VerificationStatus::NotRun;
+    double max_abs_error_            = 0;
+    double max_rel_error_            = 0;
+
+    // set by the ProfilerResultSink from the capability of the device
+    Roofline roofline_;
+
+    // Adds the check of one output of the instance, an instance with several outputs passes when
+    // all of them pass. The relative error leaves out the zeros of ref.
+    template <typename Range, typename RefRange>
+    void AddVerification(bool pass, const Range& out, const RefRange& ref)
+    {
+        verification_ = pass && verification_ != VerificationStatus::Fail
+                            ? VerificationStatus::Pass
+                            : VerificationStatus::Fail;
+
+        if(out.size() != ref.size())
+        {
+            return;
+        }
+
+        auto o_it = std::begin(out);
+        auto r_it = std::begin(ref);
+
+        for(; r_it != std::end(ref); ++o_it, ++r_it)
+        {
+            const double o   = ToDouble(*o_it);
+            const double r   = ToDouble(*r_it);
+            const double err = std::abs(o - r);
+
+            max_abs_error_ = std::max(max_abs_error_, err);
+
+            if(r != 0)
+            {
+                max_rel_error_ = std::max(max_rel_error_, err / std::abs(r));
+            }
+        }
+    }
+
+    private:
+    template <typename T>
+    static double ToDouble(T x)
+    {
+        if constexpr(std::is_same_v<T, double>)
+        {
+            return x;
+        }
+        else
+        {
+            return type_convert<float>(x);
+        }
+    }
+};
+
+// summary of the instances of one problem, for the report of a problem file
+struct ProblemSummary
+{
+    ProblemSummary(const std::string& operation, const std::vector<std::string>& arguments)
+        : operation_(operation), arguments_(arguments)
+    {
+    }
+
+    // the best instance is the fastest one that does not fail verification
+    void Add(const InstanceResult& result)
+    {
+        ++num_instance_;
+
+        instances_.emplace_back(result.instance_, result.supported_);
+
+        if(!result.supported_)
+        {
+            return;
+        }
+
+        ++num_supported_;
+
+        if(result.verification_ == VerificationStatus::Fail)
+        {
+            ++num_failed_;
+        }
+        else if(!best_.supported_ || result.ave_time_ < best_.ave_time_)
+        {
+            best_ = result;
+        }
+    }
+
+    std::string operation_;
+    std::vector<std::string> arguments_;
+
+    int num_instance_  = 0;
+    int num_supported_ = 0;
+    int num_failed_    = 0;
+
+    // not supported when no instance supports the problem and passes
+    InstanceResult best_{""};
+
+    // each instance run on the problem, and whether it supports it
+    std::vector<std::pair<std::string, bool>> instances_;
+
+    // false when the operation returned an error or threw
+    bool completed_ = true;
+};
+
+// Writes InstanceResult, with the problem they were run on, as JSON lines or CSV. The problem is
+// the operation and its command line arguments, plus named parameters set by the profiler of the
+// operation. Nothing is written until Open() is called.
+class ProfilerResultSink final
+{
+    ProfilerResultSink()  = default;
+    ~ProfilerResultSink() = default;
+
+    public:
+    enum struct Format
+    {
+        Json,
+        Csv,
+    };
+
+    using Parameters = std::vector<std::pair<std::string, std::string>>;
+
+    static ProfilerResultSink& GetInstance()
+    {
+        static ProfilerResultSink sink;
+        return sink;
+    }
+
+    // .csv files are written as CSV and any other file as JSON lines, unless format is given.
+    // The results are appended to an existing file, "-" is the standard output.
+    void Open(const std::string& path, const std::string& format = "")
+    {
+        const bool csv = format.empty()
+                             ? path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0
+                             : format == "csv";
+
+        if(!format.empty() && format != "csv" && format != "json")
+        {
+            throw std::runtime_error("wrong! unknown result format " + format);
+        }
+
+        if(path == "-")
+        {
+            Open(std::cout, csv ? Format::Csv : Format::Json);
+            return;
+        }
+
+        file_.close();
+        file_.open(path, std::ios::out | std::ios::app);
+
+        if(!file_)
+        {
+            throw std::runtime_error("wrong! cannot open result file " + path);
+        }
+
+        Open(file_, csv ? Format::Csv : Format::Json);
+    }
+
+    // the header of CSV is written when os is at its beginning
+    void Open(std::ostream& os, Format format)
+    {
+        os_     = &os;
+        format_ = format;
+
+        if(format_ == Format::Csv && os_->tellp() <= 0)
+        {
+            *os_ << "operation,arguments,problem,instance,supported,ave_time_ms,num_run,"
+                    "num_outlier,mean_ms,min_ms,median_ms,p90_ms,max_ms,stddev_ms,ci95_ms,tflops,"
+                    "gb_per_sec,verification,max_abs_error,max_rel_error,device,bound,"
+                    "arithmetic_intensity,roofline_tflops,percent_of_peak\n";
+        }
+    }
+
+    void Close()
+    {
+        if(os_ != nullptr)
+        {
+            os_->flush();
+        }
+
+        os_ = nullptr;
+        file_.close();
+    }
+
+    bool IsOpen() const { return os_ != nullptr; }
+
+    void SetProblem(const std::string& operation, const std::vector<std::string>& arguments)
+    {
+        operation_  = operation;
+        arguments_  = arguments;
+        parameters_ = {};
+
+        summaries_.emplace_back(operation, arguments);
+    }
+
+    void SetProblemParameters(const Parameters& parameters) { parameters_ = parameters; }
+
+    // the device the results are placed on the roofline of, see get_roofline()
+    void SetDeviceCapability(const DeviceCapability& device) { device_ = device; }
+
+    const DeviceCapability& GetDeviceCapability() const { return device_; }
+
+    // The roofline of the result is set, and the result is added to the summary of the current
+    // problem even when the sink is not open.
+    void Write(const InstanceResult& instance_result)
+    {
+        InstanceResult result = instance_result;
+
+        if(result.supported_)
+        {
+            result.roofline_ =
+                get_roofline(device_, GetDataType(), result.tflops_, result.gb_per_sec_);
+        }
+
+        if(!summaries_.empty())
+        {
+            summaries_.back().Add(result);
+        }
+
+        if(os_ == nullptr)
+        {
+            return;
+        }
+
+        if(format_ == Format::Json)
+        {
+            WriteJson(result);
+        }
+        else
+        {
+            WriteCsv(result);
+        }
+
+        os_->flush();
+    }
+
+    // one summary for each call of SetProblem()
+    std::vector<ProblemSummary>& GetProblemSummaries() { return summaries_; }
+
+    private:
+    std::string GetArgumentString() const
+    {
+        std::string str;
+
+        for(const auto& argument : arguments_)
+        {
+            str += (str.empty() ? "" : " ") + argument;
+        }
+
+        return str;
+    }
+
+    // the data type of the flops of the problem, the first of its data type parameters, e.g.
+    // ADataType of a GEMM or InDataType of a convolution
+    std::string GetDataType() const
+    {
+        for(const auto& [name, value] : parameters_)
+        {
+            if(name.size() >= 8 && name.compare(name.size() - 8, 8, "DataType") == 0)
+            {
+                return value;
+            }
+        }
+
+        return "";
+    }
+
+    // whether str is a decimal number in the JSON grammar, so that it can be written unquoted:
+    // -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    static bool IsNumber(const std::string& str)
+    {
+        std::size_t i = 0;
+
+        const auto skip_digits = [&]() {
+            const std::size_t begin = i;
+
+            while(i < str.size() && str[i] >= '0' && str[i] <= '9')
+            {
+                ++i;
+            }
+
+            return i - begin;
+        };
+
+        if(i < str.size() && str[i] == '-')
+        {
+            ++i;
+        }
+
+        const std::size_t int_begin = i;
+        const std::size_t num_digit = skip_digits();
+
+        if(num_digit == 0 || (num_digit > 1 && str[int_begin] == '0'))
+        {
+            return false;
+        }
+
+        if(i < str.size() && str[i] == '.')
+        {
+            ++i;
+
+            if(skip_digits() == 0)
+            {
+                return false;
+            }
+        }
+
+        if(i < str.size() && (str[i] == 'e' || str[i] == 'E'))
+        {
+            ++i;
+
+            if(i < str.size() && (str[i] == '+' || str[i] == '-'))
+            {
+                ++i;
+            }
+
+            if(skip_digits() == 0)
+            {
+                return false;
+            }
+        }
+
+        return i == str.size();
+    }
+
+    static std::string JsonString(const std::string& str)
+    {
+        std::ostringstream os;
+
+        os << '"';
+
+        for(char c : str)
+        {
+            switch(c)
+            {
+            case '"': os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if(static_cast<unsigned char>(c) < 0x20)
+                {
+                    os << "\\u00" << "0123456789abcdef"[(c >> 4) & 0xf]
+                       << "0123456789abcdef"[c & 0xf];
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+        }
+
+        os << '"';
+
+        return os.str();
+    }
+
+    // JSON has no inf or nan, e.g. the TFlops of an instance that was not timed
+    template <typename T>
+    static std::string JsonNumber(T value)
+    {
+        if(!std::isfinite(value))
+        {
+            return "null";
+        }
+
+        std::ostringstream os;
+
+        os << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+
+        return os.str();
+    }
+
+    static std::string CsvField(const std::string& str)
+    {
+        if(str.find_first_of(",\"\n") == std::string::npos)
+        {
+            return str;
+        }
+
+        std::string quoted = "\"";
+
+        for(char c : str)
+        {
+            quoted += c == '"' ? "\"\"" : std::string(1, c);
+        }
+
+        return quoted + "\"";
+    }
+
+    template <typename T>
+    static std::string CsvNumber(T value)
+    {
+        return std::isfinite(value) ? JsonNumber(value) : "";
+    }
+
+    void WriteJson(const InstanceResult& result)
+    {
+        const auto& timing = result.timing_;
+
+        *os_ << "{\"operation\":" << JsonString(operation_)
+             << ",\"arguments\":" << JsonString(GetArgumentString()) << ",\"problem\":{";
+
+        for(std::size_t i = 0; i < parameters_.size(); ++i)
+        {
+            const auto& [name, value] = parameters_[i];
+
+            *os_ << (i == 0 ? "" : ",") << JsonString(name) << ":"
+                 << (IsNumber(value) ? value : JsonString(value));
+        }
+
+        *os_ << "},\"instance\":" << JsonString(result.instance_)
+             << ",\"supported\":" << (result.supported_ ? "true" : "false");
+
+        if(result.supported_)
+        {
+            *os_ << ",\"ave_time_ms\":" << JsonNumber(result.ave_time_)
+                 << ",\"timing\":{\"num_run\":" << timing.num_run_
+                 << ",\"num_outlier\":" << timing.num_outlier_
+                 << ",\"mean_ms\":" << JsonNumber(timing.mean_)
+                 << ",\"min_ms\":" << JsonNumber(timing.min_)
+                 << ",\"median_ms\":" << JsonNumber(timing.median_)
+                 << ",\"p90_ms\":" << JsonNumber(timing.p90_)
+                 << ",\"max_ms\":" << JsonNumber(timing.max_)
+                 << ",\"stddev_ms\":" << JsonNumber(timing.stddev_)
+                 << ",\"ci95_ms\":" << JsonNumber(timing.ci95_) << ",\"times_ms\":[";
+
+            for(std::size_t i = 0; i < timing.times_.size(); ++i)
+            {
+                *os_ << (i == 0 ? "" : ",") << JsonNumber(timing.times_[i]);
+            }
+
+            *os_ << "]}"
+                 << ",\"tflops\":" << JsonNumber(result.tflops_)
+                 << ",\"gb_per_sec\":" << JsonNumber(result.gb_per_sec_) << ",\"verification\":\""
+                 << get_verification_status_string(result.verification_) << "\""
+                 << ",\"max_abs_error\":" << JsonNumber(result.max_abs_error_)
+                 << ",\"max_rel_error\":" << JsonNumber(result.max_rel_error_);
+
+            const auto& roofline = result.roofline_;
+            const bool known     = roofline.bound_ != RooflineBound::Unknown;
+            const bool has_flops = known && roofline.roofline_tflops_ > 0;
+
+            *os_ << ",\"roofline\":{\"device\":" << JsonString(device_.name_) << ",\"bound\":\""
+                 << get_roofline_bound_string(roofline.bound_) << "\",\"arithmetic_intensity\":"
+                 << (has_flops ? JsonNumber(roofline.arithmetic_intensity_) : "null")
+                 << ",\"roofline_tflops\":"
+                 << (has_flops ? JsonNumber(roofline.roofline_tflops_) : "null")
+                 << ",\"percent_of_peak\":"
+                 << (known ? JsonNumber(roofline.percent_of_peak_) : "null") << "}";
+        }
+
+        *os_ << "}\n";
+    }
+
+    void WriteCsv(const InstanceResult& result)
+    {
+        const auto& timing = result.timing_;
+
+        std::string problem;
+
+        for(const auto& [name, value] : parameters_)
+        {
+            problem += (problem.empty() ? "" : ";") + name + "=" + value;
+        }
+
+        *os_ << CsvField(operation_) << "," << CsvField(GetArgumentString()) << ","
+             << CsvField(problem) << "," << CsvField(result.instance_) << ","
+             << (result.supported_ ? "true" : "false");
+
+        if(result.supported_)
+        {
+            *os_ << "," << CsvNumber(result.ave_time_) << "," << timing.num_run_ << ","
+                 << timing.num_outlier_ << "," << CsvNumber(timing.mean_) << ","
+                 << CsvNumber(timing.min_) << "," << CsvNumber(timing.median_) << ","
+                 << CsvNumber(timing.p90_) << "," << CsvNumber(timing.max_) << ","
+                 << CsvNumber(timing.stddev_) << "," << CsvNumber(timing.ci95_) << ","
+                 << CsvNumber(result.tflops_) << "," << CsvNumber(result.gb_per_sec_) << ","
+                 << get_verification_status_string(result.verification_) << ","
+                 << CsvNumber(result.max_abs_error_) << "," << CsvNumber(result.max_rel_error_);
+
+            const auto& roofline = result.roofline_;
+            const bool known     = roofline.bound_ != RooflineBound::Unknown;
+            const bool has_flops = known && roofline.roofline_tflops_ > 0;
+
+            *os_ << "," << CsvField(device_.name_) << ","
+                 << get_roofline_bound_string(roofline.bound_) << ","
+                 << (has_flops ? CsvNumber(roofline.arithmetic_intensity_) : "") << ","
+                 << (has_flops ? CsvNumber(roofline.roofline_tflops_) : "") << ","
+                 << (known ? CsvNumber(roofline.percent_of_peak_) : "");
+        }
+        else
+        {
+            *os_ << ",,,,,,,,,,,,,,,,,,,,";
+        }
+
+        *os_ << "\n";
+    }
+
+    std::ofstream file_;
+    std::ostream* os_ = nullptr;
+    Format format_    = Format::Json;
+
+    std::string operation_;
+    std::vector<std::string> arguments_;
+    Parameters parameters_;
+
+    DeviceCapability device_;
+
+    std::vector<ProblemSummary> summaries_;
+};
+
+// writes result to the ProfilerResultSink, when it is open
+inline void report_result(const InstanceResult& result)
+{
+    ProfilerResultSink::GetInstance().Write(result);
+}
+
+// sets the named parameters of the current problem of the ProfilerResultSink
+inline void set_problem_parameters(const ProfilerResultSink::Parameters& parameters)
+{
+    ProfilerResultSink::GetInstance().SetProblemParameters(parameters);
+}
+
+template <typename T>
+std::string get_parameter_string(const T& value)
+{
+    std::ostringstream os;
+
+    os << value;
+
+    return os.str();
+}
+
+template <typename T>
+std::string get_parameter_string(const std::vector<T>& values)
+{
+    std::string str;
+
+    for(const auto& value : values)
+    {
+        str += (str.empty() ? "" : "x") + get_parameter_string(value);
+    }
+
+    return str;
+}
+
+// named parameters of a convolution problem, see set_problem_parameters()
+template <typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType>
+ProfilerResultSink::Parameters
+get_conv_problem_parameters(const ck::utils::conv::ConvParam& conv_param)
+{
+    return {{"InDataType", type_to_string<InDataType>()},
+            {"WeiDataType", type_to_string<WeiDataType>()},
+            {"OutDataType", type_to_string<OutDataType>()},
+            {"InLayout", InLayout::name},
+            {"WeiLayout", WeiLayout::name},
+            {"OutLayout", OutLayout::name},
+            {"NDimSpatial", get_parameter_string(conv_param.num_dim_spatial_)},
+            {"G", get_parameter_string(conv_param.G_)},
+            {"N", get_parameter_string(conv_param.N_)},
+            {"K", get_parameter_string(conv_param.K_)},
+            {"C", get_parameter_string(conv_param.C_)},
+            {"Filter", get_parameter_string(conv_param.filter_spatial_lengths_)},
+            {"Input", get_parameter_string(conv_param.input_spatial_lengths_)},
+            {"Output", get_parameter_string(conv_param.output_spatial_lengths_)},
+            {"Strides", get_parameter_string(conv_param.conv_filter_strides_)},
+            {"Dilations", get_parameter_string(conv_param.conv_filter_dilations_)},
+            {"LeftPads", get_parameter_string(conv_param.input_left_pads_)},
+            {"RightPads", get_parameter_string(conv_param.input_right_pads_)}};
+}
+
+} // namespace profiler
+} // namespace ck
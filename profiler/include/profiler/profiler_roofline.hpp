@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "ck/host_utility/device_prop.hpp"
+
+namespace ck {
+namespace profiler {
+
+enum struct RooflineBound
+{
+    Unknown,
+    Memory,
+    Compute,
+};
+
+inline const char* get_roofline_bound_string(RooflineBound bound)
+{
+    switch(bound)
+    {
+    case RooflineBound::Memory: return "memory";
+    case RooflineBound::Compute: return "compute";
+    default: return "unknown";
+    }
+}
+
+// Place of an instance on the roofline of the device, unknown when the device capability misses
+// the peak bandwidth, or the peak TFlops of the data type of an operation that counts its flops
+struct Roofline
+{
+    RooflineBound bound_ = RooflineBound::Unknown;
+
+    float arithmetic_intensity_ = 0; // flops per byte
+    float roofline_tflops_      = 0; // attainable TFlops at the arithmetic intensity
+    float percent_of_peak_      = 0; // of the roofline, or of the bandwidth without flops
+};
+
+// An operation without flops, e.g. a reduction, is memory bound and compared to the peak
+// bandwidth. Otherwise the instance is memory bound when its arithmetic intensity is below the
+// ridge point of the roofline, the peak TFlops over the peak bandwidth.
+inline Roofline get_roofline(const DeviceCapability& capability,
+                             const std::string& data_type,
+                             float tflops,
+                             float gb_per_sec)
+{
+    Roofline roofline;
+
+    const float bandwidth = capability.bandwidth_gb_per_sec_;
+
+    if(bandwidth <= 0 || !(gb_per_sec > 0) || !std::isfinite(gb_per_sec))
+    {
+        return roofline;
+    }
+
+    if(tflops == 0)
+    {
+        roofline.bound_           = RooflineBound::Memory;
+        roofline.percent_of_peak_ = gb_per_sec / bandwidth * 100;
+
+        return roofline;
+    }
+
+    const auto peak = capability.peak_tflops_.find(data_type);
+
+    if(peak == capability.peak_tflops_.end() || peak->second <= 0 || !std::isfinite(tflops))
+    {
+        return roofline;
+    }
+
+    // TFlops over GB/s, in flops per byte
+    roofline.arithmetic_intensity_ = tflops / gb_per_sec * 1.E3f;
+    roofline.roofline_tflops_ =
+        std::min(peak->second, roofline.arithmetic_intensity_ * bandwidth / 1.E3f);
+    roofline.bound_ = roofline.roofline_tflops_ < peak->second ? RooflineBound::Memory
+                                                                : RooflineBound::Compute;
+    roofline.percent_of_peak_ = tflops / roofline.roofline_tflops_ * 100;
+
+    return roofline;
+}
+
+// Reads a device file, which sets or overrides the values of capability, one "name=value" on each
+// line, e.g. for one GCD of a MI250X
+//   name=gfx90a
+//   num_cu=110
+//   lds_size=65536
+//   clock_mhz=1700
+//   bandwidth_gb_per_sec=1638.4
+//   peak_tflops.f16=191.5
+// Empty lines and lines starting with '#' are skipped.
+inline void read_device_file(std::istream& is, DeviceCapability& capability)
+{
+    std::string line;
+
+    while(std::getline(is, line))
+    {
+        line.erase(0, line.find_first_not_of(" \t"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+
+        if(line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        const auto equal        = line.find('=');
+        const std::string name  = line.substr(0, equal);
+        const std::string value = equal == std::string::npos ? "" : line.substr(equal + 1);
+
+        if(value.empty())
+        {
+            throw std::runtime_error("wrong! no value in device file line " + line);
+        }
+
+        if(name == "name")
+        {
+            capability.name_ = value;
+        }
+        else if(name == "num_cu")
+        {
+            capability.num_cu_ = std::stoi(value);
+        }
+        else if(name == "lds_size")
+        {
+            capability.lds_size_ = std::stoul(value);
+        }
+        else if(name == "clock_mhz")
+        {
+            capability.clock_mhz_ = std::stof(value);
+        }
+        else if(name == "bandwidth_gb_per_sec")
+        {
+            capability.bandwidth_gb_per_sec_ = std::stof(value);
+        }
+        else if(name.compare(0, 12, "peak_tflops.") == 0 && name.size() > 12)
+        {
+            capability.peak_tflops_[name.substr(12)] = std::stof(value);
+        }
+        else
+        {
+            throw std::runtime_error("wrong! unknown name " + name + " in device file");
+        }
+    }
+}
+
+inline void read_device_file(const std::string& path, DeviceCapability& capability)
+{
+    std::ifstream file(path);
+
+    if(!file)
+    {
+        throw std::runtime_error("wrong! cannot open device file " + path);
+    }
+
+    read_device_file(file, capability);
+}
+
+// capability of the current device, with the values of the device file when it is given
+inline DeviceCapability get_profiler_device_capability(const std::string& device_file)
+{
+    DeviceCapability capability = get_device_capability();
+
+    if(!device_file.empty())
+    {
+        read_device_file(device_file, capability);
+    }
+
+    return capability;
+}
+
+// prints the capability on one line
+inline void print_device_capability(std::ostream& os, const DeviceCapability& capability)
+{
+    os << "device: " << (capability.name_.empty() ? "unknown" : capability.name_) << ", "
+       << capability.num_cu_ << " CUs, " << capability.lds_size_ / 1024 << " KiB LDS, "
+       << capability.clock_mhz_ << " MHz, " << capability.bandwidth_gb_per_sec_ << " GB/s";
+
+    for(const auto& [data_type, tflops] : capability.peak_tflops_)
+    {
+        os << ", " << data_type << " " << tflops << " TFlops";
+    }
+
+    os << std::endl;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "profiler/profiler_result.hpp"
+
+namespace ck {
+namespace profiler {
+
+// parameter of a sweep, replacing {name_} in the arguments of the problems by each of its values
+struct SweepParameter
+{
+    std::string name_;
+    std::vector<std::string> values_;
+};
+
+// Parses "NAME=VALUES", where VALUES is a list "a,b,c", log-spaced integers "first:last:xF" with
+// a factor F, e.g. "64:8192:x2", or integers "first:last:+S" with a step S, or "first:last" with a
+// step of 1
+inline SweepParameter parse_sweep_parameter(const std::string& spec)
+{
+    const auto equal = spec.find('=');
+
+    if(equal == std::string::npos || equal == 0 || equal + 1 == spec.size())
+    {
+        throw std::runtime_error("wrong! sweep parameter " + spec + " is not NAME=VALUES");
+    }
+
+    SweepParameter parameter{spec.substr(0, equal), {}};
+
+    const std::string values = spec.substr(equal + 1);
+
+    if(values.find(':') == std::string::npos)
+    {
+        std::size_t begin = 0;
+
+        while(begin <= values.size())
+        {
+            const auto end = std::min(values.find(',', begin), values.size());
+
+            if(end > begin)
+            {
+                parameter.values_.push_back(values.substr(begin, end - begin));
+            }
+
+            begin = end + 1;
+        }
+
+        return parameter;
+    }
+
+    const auto colon   = values.find(':');
+    const auto colon_2 = values.find(':', colon + 1);
+
+    const double first = std::stod(values.substr(0, colon));
+    const double last  = std::stod(values.substr(colon + 1, colon_2 - colon - 1));
+    const std::string step = colon_2 == std::string::npos ? "+1" : values.substr(colon_2 + 1);
+
+    const bool log_spaced = !step.empty() && step[0] == 'x';
+    const double factor   = std::stod(step[0] == 'x' || step[0] == '+' ? step.substr(1) : step);
+
+    if(log_spaced ? !(factor > 1) || !(first > 0) : !(factor > 0))
+    {
+        throw std::runtime_error("wrong! sweep parameter " + spec + " has no values");
+    }
+
+    for(double value = first; value <= last * (1 + 1e-9);
+        value        = log_spaced ? value * factor : value + factor)
+    {
+        const std::string str = std::to_string(std::llround(value));
+
+        if(parameter.values_.empty() || parameter.values_.back() != str)
+        {
+            parameter.values_.push_back(str);
+        }
+    }
+
+    if(parameter.values_.empty())
+    {
+        throw std::runtime_error("wrong! sweep parameter " + spec + " has no values");
+    }
+
+    return parameter;
+}
+
+// one problem of a sweep, with the values of the parameters it was made with
+struct SweepPoint
+{
+    std::vector<std::string> problem_;
+    std::vector<std::pair<std::string, std::string>> values_;
+};
+
+// Makes a point of each problem for each combination of the values of the parameters the problem
+// uses, with the values of the first parameters changing the slowest. Throws when a problem uses a
+// parameter that is not given, or when a parameter is used by no problem.
+inline std::vector<SweepPoint> expand_sweep(const std::vector<std::vector<std::string>>& problems,
+                                            const std::vector<SweepParameter>& parameters)
+{
+    std::vector<SweepPoint> points;
+    std::vector<bool> used(parameters.size(), false);
+
+    for(const auto& problem : problems)
+    {
+        // the parameters used by the problem
+        std::vector<std::size_t> indices;
+
+        for(const auto& arg : problem)
+        {
+            for(auto open = arg.find('{'); open != std::string::npos;
+                open      = arg.find('{', open + 1))
+            {
+                const auto close = arg.find('}', open);
+
+                if(close == std::string::npos)
+                {
+                    break;
+                }
+
+                const std::string name = arg.substr(open + 1, close - open - 1);
+
+                const auto found =
+                    std::find_if(parameters.begin(), parameters.end(), [&](const auto& parameter) {
+                        return parameter.name_ == name;
+                    });
+
+                if(found == parameters.end())
+                {
+                    throw std::runtime_error("wrong! no sweep parameter " + name + " for " + arg);
+                }
+
+                const auto index = static_cast<std::size_t>(found - parameters.begin());
+
+                if(std::find(indices.begin(), indices.end(), index) == indices.end())
+                {
+                    indices.push_back(index);
+                }
+            }
+        }
+
+        std::sort(indices.begin(), indices.end());
+
+        // index of the value of each used parameter, counting with the last one changing fastest
+        std::vector<std::size_t> counter(indices.size(), 0);
+
+        while(true)
+        {
+            SweepPoint point{problem, {}};
+
+            for(std::size_t i = 0; i < indices.size(); ++i)
+            {
+                const auto& parameter = parameters[indices[i]];
+                const auto& value     = parameter.values_[counter[i]];
+                const std::string key = "{" + parameter.name_ + "}";
+
+                point.values_.emplace_back(parameter.name_, value);
+                used[indices[i]] = true;
+
+                for(auto& arg : point.problem_)
+                {
+                    for(auto pos = arg.find(key); pos != std::string::npos;
+                        pos      = arg.find(key, pos + value.size()))
+                    {
+                        arg.replace(pos, key.size(), value);
+                    }
+                }
+            }
+
+            points.push_back(point);
+
+            std::size_t i = indices.size();
+
+            while(i > 0 && ++counter[i - 1] == parameters[indices[i - 1]].values_.size())
+            {
+                counter[--i] = 0;
+            }
+
+            if(i == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < parameters.size(); ++i)
+    {
+        if(!used[i])
+        {
+            throw std::runtime_error("wrong! sweep parameter " + parameters[i].name_ +
+                                     " is not used by any problem");
+        }
+    }
+
+    return points;
+}
+
+// Prints the best instance of each point of a sweep, from the summary of its problem, and the
+// coverage of the instances: how many points each instance wins, the instances that never win,
+// which are candidates for pruning from the library, and the points where the best instance is
+// below min_roofline percent of its roofline, with their share for each value of a parameter.
+inline void print_sweep_report(std::ostream& os,
+                               const std::vector<SweepPoint>& points,
+                               const std::vector<ProblemSummary>& summaries,
+                               float min_roofline)
+{
+    if(points.size() != summaries.size())
+    {
+        throw std::runtime_error("wrong! a sweep point has no problem summary");
+    }
+
+    // points won and supported by each instance
+    std::map<std::string, std::pair<int, int>> coverage;
+
+    std::vector<std::size_t> far_points;
+    int num_on_roofline = 0;
+
+    os << "sweep points: " << points.size() << std::endl;
+
+    for(std::size_t i = 0; i < points.size(); ++i)
+    {
+        const auto& summary = summaries[i];
+        const auto& best    = summary.best_;
+
+        os << "[" << i << "]";
+
+        for(const auto& [name, value] : points[i].values_)
+        {
+            os << " " << name << "=" << value;
+        }
+
+        os << ": ";
+
+        for(const auto& [instance, supported] : summary.instances_)
+        {
+            coverage[instance].second += supported ? 1 : 0;
+        }
+
+        if(!summary.completed_ || !best.supported_)
+        {
+            os << (summary.completed_ ? "no instance" : "error") << std::endl;
+            continue;
+        }
+
+        ++coverage[best.instance_].first;
+
+        os << best.ave_time_ << " ms, " << best.tflops_ << " TFlops, " << best.gb_per_sec_
+           << " GB/s, ";
+
+        if(best.roofline_.bound_ != RooflineBound::Unknown)
+        {
+            os << best.roofline_.percent_of_peak_ << "% of roofline ("
+               << get_roofline_bound_string(best.roofline_.bound_) << " bound), ";
+
+            ++num_on_roofline;
+
+            if(best.roofline_.percent_of_peak_ < min_roofline)
+            {
+                far_points.push_back(i);
+            }
+        }
+
+        os << best.instance_ << std::endl;
+    }
+
+    std::vector<std::pair<int, std::string>> winners;
+    std::vector<std::string> never_winning;
+    std::vector<std::string> never_supporting;
+
+    for(const auto& [instance, counts] : coverage)
+    {
+        if(counts.first > 0)
+        {
+            winners.emplace_back(counts.first, instance);
+        }
+        else if(counts.second > 0)
+        {
+            never_winning.push_back(instance);
+        }
+        else
+        {
+            never_supporting.push_back(instance);
+        }
+    }
+
+    std::sort(winners.begin(), winners.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    os << "instances: " << coverage.size() << ", winning at least one point: " << winners.size()
+       << std::endl;
+
+    for(const auto& [num_win, instance] : winners)
+    {
+        os << "  " << num_win << " wins: " << instance << std::endl;
+    }
+
+    os << "instances supporting points but never winning: " << never_winning.size() << std::endl;
+
+    for(const auto& instance : never_winning)
+    {
+        os << "  " << coverage[instance].second << " supported: " << instance << std::endl;
+    }
+
+    os << "instances supporting no point: " << never_supporting.size() << std::endl;
+
+    for(const auto& instance : never_supporting)
+    {
+        os << "  " << instance << std::endl;
+    }
+
+    if(num_on_roofline == 0)
+    {
+        os << "no point has a known roofline, see --device-file" << std::endl;
+        return;
+    }
+
+    os << "points with the best instance below " << min_roofline
+       << "% of roofline: " << far_points.size() << "/" << num_on_roofline << std::endl;
+
+    // far points and points with a roofline of each value of each parameter
+    std::map<std::pair<std::string, std::string>, std::pair<int, int>> regions;
+
+    for(std::size_t i = 0; i < points.size(); ++i)
+    {
+        const bool far = std::find(far_points.begin(), far_points.end(), i) != far_points.end();
+        const bool on_roofline = summaries[i].best_.supported_ && summaries[i].completed_ &&
+                                 summaries[i].best_.roofline_.bound_ != RooflineBound::Unknown;
+
+        for(const auto& value : points[i].values_)
+        {
+            regions[value].first += far ? 1 : 0;
+            regions[value].second += on_roofline ? 1 : 0;
+        }
+    }
+
+    for(const auto& [value, counts] : regions)
+    {
+        if(counts.first > 0)
+        {
+            os << "  " << value.first << "=" << value.second << ": " << counts.first << "/"
+               << counts.second << " points" << std::endl;
+        }
+    }
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <utility>
+
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Verifies the instances of a problem on background threads while the next instances are timed.
+//
+// The host reference is run on its own thread by RunReference(), and the check of each instance,
+// given to Add() after its output has been read back to a host copy, waits for the reference and
+// runs on one of at most num_thread threads. Wait() joins all of them and reports the results of
+// the instances in the order they were added. The checks are run on the calling thread when
+// num_thread is 0, e.g. to keep the log of the tensors in order.
+//
+// The reference and the checks may use the tensors of the profiler, which must outlive the
+// verifier, and must not use anything that is changed by the profiler while they run.
+class ProfilerVerifier
+{
+    public:
+    // by default with the number of threads of --verify-threads, or with none when serial
+    explicit ProfilerVerifier(bool serial = false,
+                              std::size_t num_thread =
+                                  ProfilerOptions::GetInstance().verify_threads_)
+        : num_thread_(serial ? 0 : num_thread)
+    {
+    }
+
+    ProfilerVerifier(const ProfilerVerifier&) = delete;
+    ProfilerVerifier& operator=(const ProfilerVerifier&) = delete;
+
+    template <typename Reference>
+    void RunReference(Reference reference)
+    {
+        if(num_thread_ == 0)
+        {
+            reference();
+        }
+        else
+        {
+            reference_ = std::async(std::launch::async, std::move(reference)).share();
+        }
+    }
+
+    // an instance without verification, or that does not support the problem
+    void Add(const InstanceResult& result) { results_.push_back(result); }
+
+    // check(InstanceResult&) checks the output of the instance, adds the verification to the
+    // result and returns whether the instance passes
+    template <typename Check>
+    void Add(const InstanceResult& result, Check check)
+    {
+        results_.push_back(result);
+
+        InstanceResult& instance_result = results_.back();
+
+        if(num_thread_ == 0)
+        {
+            pass_ = check(instance_result) && pass_;
+            return;
+        }
+
+        // the oldest check is waited for first, which bounds the host copies of outputs in flight
+        if(checks_.size() >= num_thread_)
+        {
+            WaitCheck();
+        }
+
+        checks_.push_back(std::async(
+            std::launch::async,
+            [reference = reference_, &instance_result, check = std::move(check)]() {
+                if(reference.valid())
+                {
+                    reference.wait();
+                }
+
+                return check(instance_result);
+            }));
+    }
+
+    // waits for the reference and the checks, reports the results and returns whether all the
+    // checked instances pass, rethrows the exception of the reference or of a check
+    bool Wait()
+    {
+        while(!checks_.empty())
+        {
+            WaitCheck();
+        }
+
+        if(reference_.valid())
+        {
+            reference_.get();
+        }
+
+        for(const auto& result : results_)
+        {
+            report_result(result);
+        }
+
+        results_.clear();
+
+        return pass_;
+    }
+
+    private:
+    void WaitCheck()
+    {
+        auto check = std::move(checks_.front());
+
+        checks_.pop_front();
+
+        pass_ = check.get() && pass_;
+    }
+
+    std::size_t num_thread_;
+    bool pass_ = true;
+
+    // declared before the checks, which use them and are joined first on destruction
+    std::shared_future<void> reference_;
+    std::deque<InstanceResult> results_;
+    std::deque<std::future<bool>> checks_;
+};
+
+} // namespace profiler
+} // namespace ck
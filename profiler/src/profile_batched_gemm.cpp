@@ -46,7 +46,7 @@ int profile_batched_gemm(int argc, char* argv[])
         printf("arg7: time kernel (0=n0, 1=yes)\n");
         printf("arg8 to 17: M, N, K, StrideA, StrideB, StrideC, BatchStrideA, BatchStrideB, BatchStrideC, BatchCount\n");
         // clang-format on
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmDataType>(std::stoi(argv[2]));
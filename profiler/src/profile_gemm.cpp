@@ -49,7 +49,7 @@ int profile_gemm(int argc, char* argv[])
     if(argc != 14)
     {
         print_helper_msg();
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmDataType>(std::stoi(argv[2]));
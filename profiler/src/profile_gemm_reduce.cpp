@@ -42,7 +42,7 @@ int profile_gemm_reduce(int argc, char* argv[])
         printf("arg7: time kernel (0=n0, 1=yes)\n");
         printf("arg8 to 13: M, N, K, StrideA, StrideB, StrideC\n");
         printf("arg14: split k into  mulitiple batch\n");
-        exit(1);
+        return 1;
     }
 
     const auto data_type       = static_cast<GemmReduceDataType>(std::stoi(argv[2]));
@@ -2,29 +2,200 @@
 // Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
 
 #include <cstdlib>
+#include <exception>
 #include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
 
+#include "profiler/profiler_batch.hpp"
+#include "profiler/profiler_cache.hpp"
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_roofline.hpp"
+#include "profiler/profiler_sweep.hpp"
 #include "profiler_operation_registry.hpp"
 
 static void print_helper_message()
 {
     std::cout << "arg1: tensor operation " << ProfilerOperationRegistry::GetInstance() << std::endl;
+    std::cout << ck::profiler::ProfilerOptions::GetHelpMessage() << std::endl;
+}
+
+// profiles the problems one after the other, each one given as the arguments of ckProfiler, and
+// returns whether all of them ran and passed verification
+static bool profile_problems(const std::vector<std::vector<std::string>>& problems)
+{
+    auto& result_sink = ck::profiler::ProfilerResultSink::GetInstance();
+
+    bool pass = true;
+
+    for(const auto& problem : problems)
+    {
+        std::vector<std::string> args{"ckProfiler"};
+        args.insert(args.end(), problem.begin(), problem.end());
+
+        std::vector<char*> argv;
+
+        for(auto& arg : args)
+        {
+            argv.push_back(arg.data());
+        }
+
+        argv.push_back(nullptr);
+
+        const int argc = static_cast<int>(args.size());
+
+        result_sink.SetProblem(argv[1], std::vector<std::string>(args.begin() + 2, args.end()));
+
+        int result = EXIT_FAILURE;
+
+        if(const auto operation = ProfilerOperationRegistry::GetInstance().Get(argv[1]);
+           operation.has_value())
+        {
+            try
+            {
+                result = (*operation)(argc, argv.data());
+            }
+            catch(const std::exception& e)
+            {
+                std::cerr << e.what() << std::endl;
+            }
+        }
+        else
+        {
+            std::cerr << "cannot find operation: " << argv[1] << std::endl;
+        }
+
+        result_sink.GetProblemSummaries().back().completed_ = result == 0;
+
+        pass = pass && result == 0 && result_sink.GetProblemSummaries().back().num_failed_ == 0;
+    }
+
+    return pass;
+}
+
+// profiles the problems of the problem file one after the other, and prints a summary of them
+static int profile_problem_file(const std::string& path)
+{
+    const bool pass = profile_problems(ck::profiler::read_problem_file(path));
+
+    ck::profiler::print_problem_summaries(
+        std::cout, ck::profiler::ProfilerResultSink::GetInstance().GetProblemSummaries());
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// profiles each point of the sweep of the problems over the parameters of --sweep, and prints the
+// summary of each point and the coverage of the instances
+static int profile_sweep(const std::vector<std::vector<std::string>>& problems)
+{
+    const auto& options = ck::profiler::ProfilerOptions::GetInstance();
+
+    std::vector<ck::profiler::SweepParameter> parameters;
+
+    for(const auto& spec : options.sweep_)
+    {
+        parameters.push_back(ck::profiler::parse_sweep_parameter(spec));
+    }
+
+    const auto points = ck::profiler::expand_sweep(problems, parameters);
+
+    std::vector<std::vector<std::string>> point_problems;
+
+    for(const auto& point : points)
+    {
+        point_problems.push_back(point.problem_);
+    }
+
+    const bool pass = profile_problems(point_problems);
+
+    const auto& summaries = ck::profiler::ProfilerResultSink::GetInstance().GetProblemSummaries();
+
+    ck::profiler::print_problem_summaries(std::cout, summaries);
+    ck::profiler::print_sweep_report(std::cout, points, summaries, options.sweep_min_roofline_);
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 int main(int argc, char* argv[])
 {
-    if(argc == 1)
+    auto& options = ck::profiler::ProfilerOptions::GetInstance();
+
+    try
+    {
+        argc = options.Parse(argc, argv);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto operation =
+        argc == 1 ? std::nullopt : ProfilerOperationRegistry::GetInstance().Get(argv[1]);
+
+    if(argc == 1 && options.problem_file_.empty())
     {
         print_helper_message();
+        return EXIT_SUCCESS;
     }
-    else if(const auto operation = ProfilerOperationRegistry::GetInstance().Get(argv[1]);
-            operation.has_value())
+    else if(argc > 1 && !options.problem_file_.empty())
     {
-        return (*operation)(argc, argv);
+        std::cerr << "a problem file and an operation cannot both be given" << std::endl;
+        return EXIT_FAILURE;
     }
-    else
+    else if(argc > 1 && !operation.has_value())
     {
         std::cerr << "cannot find operation: " << argv[1] << std::endl;
         return EXIT_FAILURE;
     }
+
+    auto& result_sink = ck::profiler::ProfilerResultSink::GetInstance();
+
+    int result = EXIT_FAILURE;
+
+    try
+    {
+        // the instances and device buffers are kept across the problems, and freed at the end
+        ck::profiler::ProfilerCacheScope cache_scope;
+
+        if(!options.result_file_.empty())
+        {
+            result_sink.Open(options.result_file_, options.result_format_);
+        }
+
+        result_sink.SetDeviceCapability(
+            ck::profiler::get_profiler_device_capability(options.device_file_));
+
+        ck::profiler::print_device_capability(std::cout, result_sink.GetDeviceCapability());
+
+        if(!options.sweep_.empty())
+        {
+            const auto problems =
+                options.problem_file_.empty()
+                    ? std::vector<std::vector<std::string>>{{argv + 1, argv + argc}}
+                    : ck::profiler::read_problem_file(options.problem_file_);
+
+            result = profile_sweep(problems);
+        }
+        else if(!options.problem_file_.empty())
+        {
+            result = profile_problem_file(options.problem_file_);
+        }
+        else
+        {
+            result_sink.SetProblem(argv[1], std::vector<std::string>(argv + 2, argv + argc));
+
+            result = (*operation)(argc, argv);
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+    }
+
+    result_sink.Close();
+
+    return result;
 }
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "profiler/profiler_compare.hpp"
+
+static void print_helper_message()
+{
+    std::cout << "usage: ckProfilerCompare [options] BASELINE CANDIDATE\n"
+                 "compares the result files of ckProfiler, JSON lines or CSV, of a baseline and a\n"
+                 "candidate, and fails when the candidate regresses\n"
+                 "options:\n"
+                 "  --alpha=X      significance level of the Mann-Whitney U test (default: 0.05)\n"
+                 "  --threshold=X  smallest relative change of the median time (default: 0.02)\n"
+                 "  --gate=G       fail on the regressions of the best instance of a problem, of\n"
+                 "                 any instance, or never: best, instance or none (default: best)"
+              << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    ck::profiler::CompareOptions options;
+
+    std::string gate = "best";
+    std::vector<std::string> paths;
+
+    try
+    {
+        for(int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+
+            if(arg.compare(0, 8, "--alpha=") == 0)
+            {
+                options.alpha_ = std::stod(arg.substr(8));
+            }
+            else if(arg.compare(0, 12, "--threshold=") == 0)
+            {
+                options.threshold_ = std::stod(arg.substr(12));
+            }
+            else if(arg.compare(0, 7, "--gate=") == 0)
+            {
+                gate = arg.substr(7);
+            }
+            else
+            {
+                paths.push_back(arg);
+            }
+        }
+
+        if(paths.size() != 2 || (gate != "best" && gate != "instance" && gate != "none"))
+        {
+            print_helper_message();
+            return EXIT_FAILURE;
+        }
+
+        ck::profiler::ResultSet baseline;
+        ck::profiler::ResultSet candidate;
+
+        baseline.Read(paths[0]);
+        candidate.Read(paths[1]);
+
+        const auto report = ck::profiler::compare_result_sets(baseline, candidate, options);
+
+        ck::profiler::print_comparison_report(std::cout, report);
+
+        const int num_regression = gate == "none" ? 0 : report.GetNumRegression(gate == "best");
+
+        if(const int num_untested = report.GetNumChange(ck::profiler::PerformanceChange::Untested,
+                                                        gate != "instance");
+           num_untested > 0)
+        {
+            std::cout << num_untested << " untested changes are not gated, they need at least "
+                      << options.min_num_time_
+                      << " times on each side, e.g. from results in JSON lines" << std::endl;
+        }
+
+        return num_regression == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
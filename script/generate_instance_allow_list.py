@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT
+# Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+# Generates an allow-list for CK_INSTANCE_ALLOW_LIST from the result files of ckProfiler, JSON
+# lines or CSV, e.g. of the problem file of a service: the type string of the best instance of
+# each problem, and of the instances within --tolerance of it, and the instance sources they are
+# built from, so that the other sources are pruned from the build.
+
+import argparse, csv, json, os, re, sys
+
+SOURCE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'library', 'src',
+                          'tensor_operation_instance', 'gpu')
+
+# names of the layouts of A, B and a GEMM output in the names of the instance sources
+GEMM_LAYOUTS = {
+    'ALayout': {'RowMajor': 'mk', 'ColumnMajor': 'km'},
+    'BLayout': {'RowMajor': 'kn', 'ColumnMajor': 'nk'},
+}
+
+
+def read_results(path):
+    with open(path, newline='') as f:
+        text = f.read()
+
+    if text.lstrip().startswith('{'):
+        for line in text.splitlines():
+            if line.strip():
+                yield json.loads(line)
+    else:
+        for row in csv.DictReader(text.splitlines()):
+            yield row
+
+
+def get_parameters(result):
+    problem = result.get('problem')
+
+    if isinstance(problem, dict):
+        return dict((k, str(v)) for k, v in problem.items())
+
+    return dict(p.split('=', 1) for p in (problem or '').split(';') if '=' in p)
+
+
+def get_problem(result):
+    parameters = get_parameters(result)
+    problem = ';'.join('{}={}'.format(k, v) for k, v in parameters.items())
+
+    return (result['operation'], problem or result['arguments'])
+
+
+def read_sources(source_dir):
+    sources = {}
+
+    for root, _, files in os.walk(source_dir):
+        for name in files:
+            if name.endswith('.cpp'):
+                with open(os.path.join(root, name)) as f:
+                    sources[os.path.splitext(name)[0]] = f.read()
+
+    return sources
+
+
+def match_sources(sources, instance, parameters):
+    """Names of the sources that may build an instance of a problem: the sources using the device
+    operation of its type string, with the data types of the problem, and for a GEMM, with its
+    layouts of A and B, in their names."""
+    device_op = re.compile(r'\b' + re.escape(instance.split('<', 1)[0].strip()) + r'\s*<')
+    names = [name for name, text in sources.items() if device_op.search(text)]
+
+    data_types = set(v for k, v in parameters.items() if k.endswith('DataType'))
+    names = [n for n in names if all(re.search('_' + t + '(_|$)', n) for t in data_types)]
+
+    a = GEMM_LAYOUTS['ALayout'].get(parameters.get('ALayout'))
+    b = GEMM_LAYOUTS['BLayout'].get(parameters.get('BLayout'))
+
+    if a and b:
+        layouts = re.compile('_g?{}_g?{}_'.format(a, b))
+        names = [n for n in names if layouts.search(n)]
+
+    return names
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Generate an instance allow-list from the '
+                                     'results of ckProfiler')
+    parser.add_argument('results', nargs='+', help='result files of ckProfiler')
+    parser.add_argument('-o', '--output', default='-', help='allow-list file, - for stdout')
+    parser.add_argument('--tolerance', type=float, default=0,
+                        help='also keep the instances at most this fraction slower than the best')
+    parser.add_argument('--source', action='append', default=[],
+                        help='pattern of the instance sources to build, e.g. '
+                        'device_gemm_xdl_c_shuffle_f16_*, instead of the sources found for the '
+                        'selected instances')
+    parser.add_argument('--source-dir', default=SOURCE_DIR,
+                        help='directory of the instance sources, default %(default)s')
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+
+    # time of each supported instance passing verification, for each problem
+    times = {}
+    parameters = {}
+
+    for path in args.results:
+        for result in read_results(path):
+            if str(result['supported']).lower() != 'true':
+                continue
+            if result.get('verification') == 'fail':
+                continue
+
+            problem = get_problem(result)
+            instances = times.setdefault(problem, {})
+            instance = result['instance']
+            time = float(result['ave_time_ms'])
+            instances[instance] = min(time, instances.get(instance, time))
+            parameters[problem] = get_parameters(result)
+
+    selected = set()
+    source_names = set(args.source)
+    sources = read_sources(args.source_dir) if not args.source else {}
+
+    for problem, instances in times.items():
+        best = min(instances.values())
+
+        for instance, time in instances.items():
+            if time > best * (1 + args.tolerance):
+                continue
+
+            selected.add(instance)
+
+            if args.source:
+                continue
+
+            names = match_sources(sources, instance, parameters[problem])
+
+            if not names:
+                sys.exit('no instance source found in {} for {} of {}, give the sources with '
+                         '--source'.format(args.source_dir, instance, problem[0]))
+
+            source_names.update(names)
+
+    out = sys.stdout if args.output == '-' else open(args.output, 'w')
+
+    out.write('# {} instances for {} problems of {}\n'.format(len(selected), len(times),
+                                                               ' '.join(args.results)))
+    for source in sorted(source_names):
+        out.write(source + '\n')
+    for instance in sorted(selected):
+        out.write(instance + '\n')
+
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_stream_k.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using ck::BlockToCTileMap_GemmStreamK;
+using ck::index_t;
+using ck::make_multi_index;
+using ck::Number;
+namespace math = ck::math;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <index_t MPerBlock, index_t NPerBlock, index_t KPerBlock>
+void check_coverage_and_balance(index_t M, index_t N, index_t K, index_t grid_size)
+{
+    const BlockToCTileMap_GemmStreamK<MPerBlock, NPerBlock, KPerBlock> tile_map(
+        M, N, K, grid_size);
+
+    const index_t num_tile       = tile_map.GetNumTile();
+    const index_t iters_per_tile = tile_map.GetItersPerTile();
+
+    ASSERT_EQ(num_tile,
+              math::integer_divide_ceil(M, MPerBlock) * math::integer_divide_ceil(N, NPerBlock));
+    ASSERT_EQ(iters_per_tile, math::integer_divide_ceil(K, KPerBlock));
+    const auto c_grid_desc_m_n = ck::make_naive_tensor_descriptor_packed(ck::make_tuple(M, N));
+
+    ASSERT_TRUE(tile_map.CheckValidity(c_grid_desc_m_n));
+
+    // the iteration ranges of the workgroups partition the iteration space ...
+    std::vector<index_t> num_run(tile_map.GetNumIter(), 0);
+
+    index_t min_num_iter = tile_map.GetNumIter();
+    index_t max_num_iter = 0;
+
+    for(index_t block_id = 0; block_id < grid_size; ++block_id)
+    {
+        const index_t iter_begin = tile_map.GetIterBegin(block_id);
+        const index_t iter_end   = tile_map.GetIterEnd(block_id);
+
+        ASSERT_LE(iter_begin, iter_end);
+
+        for(index_t iter = iter_begin; iter < iter_end; ++iter)
+        {
+            ++num_run[iter];
+            ASSERT_EQ(tile_map.GetBlockOfIter(iter), block_id);
+        }
+
+        min_num_iter = std::min(min_num_iter, iter_end - iter_begin);
+        max_num_iter = std::max(max_num_iter, iter_end - iter_begin);
+    }
+
+    EXPECT_TRUE(std::all_of(num_run.begin(), num_run.end(), [](auto n) { return n == 1; }));
+
+    // ... in ranges differing by at most one iteration
+    EXPECT_LE(max_num_iter - min_num_iter, 1);
+
+    // every tile has one owner, the other workgroups running it write one partial each
+    std::vector<index_t> num_partial_written(grid_size, 0);
+
+    for(index_t tile = 0; tile < num_tile; ++tile)
+    {
+        const index_t owner = tile_map.GetTileOwner(tile);
+
+        EXPECT_LE(tile_map.GetIterBegin(owner), tile_map.GetTileIterBegin(tile));
+        EXPECT_LT(tile_map.GetTileIterBegin(tile), tile_map.GetIterEnd(owner));
+
+        const auto partial_block_range = tile_map.GetPartialBlockRange(tile);
+
+        for(index_t block_id = partial_block_range[Number<0>{}];
+            block_id < partial_block_range[Number<1>{}];
+            ++block_id)
+        {
+            EXPECT_TRUE(tile_map.HasPartial(block_id));
+            EXPECT_EQ(tile_map.GetTileOfIter(tile_map.GetIterBegin(block_id)), tile);
+
+            ++num_partial_written[block_id];
+        }
+    }
+
+    for(index_t block_id = 0; block_id < grid_size; ++block_id)
+    {
+        EXPECT_EQ(num_partial_written[block_id], tile_map.HasPartial(block_id) ? 1 : 0);
+    }
+
+    // tile ids map to distinct C tiles
+    std::vector<index_t> num_visit(num_tile, 0);
+
+    for(index_t tile = 0; tile < num_tile; ++tile)
+    {
+        const auto m0_n0 = tile_map.CalculateBottomIndex(make_multi_index(tile));
+
+        const index_t m0 = m0_n0[Number<0>{}];
+        const index_t n0 = m0_n0[Number<1>{}];
+
+        ASSERT_LT(m0, math::integer_divide_ceil(M, MPerBlock));
+        ASSERT_LT(n0, math::integer_divide_ceil(N, NPerBlock));
+
+        ++num_visit[m0 * math::integer_divide_ceil(N, NPerBlock) + n0];
+    }
+
+    EXPECT_TRUE(std::all_of(num_visit.begin(), num_visit.end(), [](auto n) { return n == 1; }));
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_GemmStreamK_CoverageAndBalance)
+{
+    for(const index_t M : {128, 1000, 3840})
+    {
+        for(const index_t N : {256, 4095})
+        {
+            for(const index_t K : {32, 100, 4096})
+            {
+                for(const index_t grid_size : {1, 7, 110, 220, 10000})
+                {
+                    SCOPED_TRACE(testing::Message() << "M " << M << ", N " << N << ", K " << K
+                                                    << ", grid size " << grid_size);
+
+                    check_coverage_and_balance<256, 128, 32>(M, N, K, grid_size);
+                }
+            }
+        }
+    }
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_GemmStreamK_LastWave)
+{
+    // 121 tiles of 64 iterations on 120 workgroups: a tile map of whole tiles runs 2 waves with
+    // the second one almost empty, Stream-K gives every workgroup 64 or 65 iterations
+    const BlockToCTileMap_GemmStreamK<256, 128, 32> tile_map(11 * 256, 11 * 128, 2048, 120);
+
+    EXPECT_EQ(tile_map.GetNumTile(), 121);
+
+    for(index_t block_id = 0; block_id < 120; ++block_id)
+    {
+        const index_t num_iter = tile_map.GetIterEnd(block_id) - tile_map.GetIterBegin(block_id);
+
+        EXPECT_EQ(num_iter, block_id < 64 ? 65 : 64);
+    }
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_GemmStreamK_CheckValidity)
+{
+    using TileMap = BlockToCTileMap_GemmStreamK<256, 128, 32>;
+
+    const auto c_grid_desc_m_n = ck::make_naive_tensor_descriptor_packed(ck::make_tuple(1, 1));
+
+    EXPECT_TRUE(TileMap(1, 1, 1, 1).CheckValidity(c_grid_desc_m_n));
+
+    EXPECT_FALSE(TileMap(0, 256, 64, 120).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(256, 0, 64, 120).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(256, 256, 0, 120).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(-1000, 256, 64, 120).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(256, -1, 64, 120).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(256, 256, -64, 120).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(256, 256, 64, 0).CheckValidity(c_grid_desc_m_n));
+    EXPECT_FALSE(TileMap(256, 256, 64, 120, 0).CheckValidity(c_grid_desc_m_n));
+}
+
+TEST(BlockToCTileMap, TestBlockToCTileMap_GemmStreamK_ReferenceModel)
+{
+    const index_t M = 300;
+    const index_t N = 200;
+    const index_t K = 333;
+
+    Tensor<float> a_m_k(HostTensorDescriptor(std::vector<std::size_t>{M, K}));
+    Tensor<float> b_k_n(HostTensorDescriptor(std::vector<std::size_t>{K, N}));
+    Tensor<float> c_m_n_ref(HostTensorDescriptor(std::vector<std::size_t>{M, N}));
+    Tensor<float> c_m_n(HostTensorDescriptor(std::vector<std::size_t>{M, N}));
+
+    // small integers, so that the sum is exact in any order
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto ref_argument = ReferenceGemm::MakeArgument(
+        a_m_k, b_k_n, c_m_n_ref, PassThrough{}, PassThrough{}, PassThrough{});
+    ReferenceGemm::MakeInvoker().Run(ref_argument);
+
+    using ReferenceGemmStreamK = ck::tensor_operation::host::ReferenceGemmStreamK<float,
+                                                                                  float,
+                                                                                  float,
+                                                                                  float,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  64,
+                                                                                  64,
+                                                                                  32>;
+
+    for(const index_t grid_size : {1, 5, 13, 20, 100, 1000})
+    {
+        c_m_n.SetZero();
+
+        auto argument = ReferenceGemmStreamK::MakeArgument(
+            a_m_k, b_k_n, c_m_n, grid_size, PassThrough{}, PassThrough{}, PassThrough{});
+        ReferenceGemmStreamK::MakeInvoker().Run(argument);
+
+        EXPECT_TRUE(ck::utils::check_err(c_m_n, c_m_n_ref)) << "grid size " << grid_size;
+    }
+
+    // no main loop iteration
+    Tensor<float> a_m_0(HostTensorDescriptor(std::vector<std::size_t>{M, 0}));
+    Tensor<float> b_0_n(HostTensorDescriptor(std::vector<std::size_t>{0, N}));
+
+    auto argument = ReferenceGemmStreamK::MakeArgument(
+        a_m_0, b_0_n, c_m_n, 100, PassThrough{}, PassThrough{}, PassThrough{});
+
+    EXPECT_FALSE(ReferenceGemmStreamK{}.IsSupportedArgument(&argument));
+}
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+#include "ck/library/utility/tile_schedule_simulator.hpp"
+
+using namespace ck;
+using ck::utils::TileScheduleProblem;
+using ck::utils::TileScheduleSimulatorConfig;
+
+TEST(TileScheduleSimulator, ReplayBlockToCTileMap)
+{
+    const index_t M         = 512;
+    const index_t N         = 256;
+    const index_t MPerBlock = 128;
+    const index_t NPerBlock = 128;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    BlockToCTileMap_M00_N0_M01<MPerBlock, NPerBlock, decltype(c_grid_desc_m_n)> tile_map(
+        c_grid_desc_m_n, 2);
+
+    const auto schedule =
+        ck::utils::make_tile_schedule(tile_map, tile_map.CalculateGridSize(c_grid_desc_m_n));
+
+    // M01 consecutive workgroups walk down M, then move to the next N0
+    const std::vector<std::vector<index_t>> expected_m0_n0 = {
+        {0, 0}, {1, 0}, {0, 1}, {1, 1}, {2, 0}, {3, 0}, {2, 1}, {3, 1}};
+
+    ASSERT_EQ(schedule.size(), expected_m0_n0.size());
+
+    for(std::size_t i = 0; i < schedule.size(); ++i)
+    {
+        EXPECT_EQ(schedule[i].k_batch_id_, 0);
+        EXPECT_EQ((std::vector<index_t>{schedule[i].m0_, schedule[i].n0_}), expected_m0_n0[i]);
+    }
+
+    // OffsettedBlockToCTileMap sees workgroup ids starting from the block start
+    OffsettedBlockToCTileMap<decltype(tile_map)> offsetted_tile_map(tile_map, 100);
+
+    const auto offsetted_schedule = ck::utils::make_tile_schedule(offsetted_tile_map, 8, 100);
+
+    for(std::size_t i = 0; i < schedule.size(); ++i)
+    {
+        EXPECT_EQ(offsetted_schedule[i].m0_, schedule[i].m0_);
+        EXPECT_EQ(offsetted_schedule[i].n0_, schedule[i].n0_);
+    }
+}
+
+TEST(TileScheduleSimulator, L2CapacityBounds)
+{
+    const index_t M = 4096;
+    const index_t N = 4096;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    BlockToCTileMap_M00_N0_M01Adapt<256, 128, decltype(c_grid_desc_m_n)> tile_map(c_grid_desc_m_n);
+
+    const TileScheduleProblem problem{M, N, 1024, 256, 128, 32};
+    const index_t grid_size = tile_map.CalculateGridSize(c_grid_desc_m_n);
+
+    // a large enough L2 loads every slice from DRAM once
+    const auto unbounded = ck::utils::simulate_tile_schedule(
+        tile_map, grid_size, problem, TileScheduleSimulatorConfig{110, 2, 1LL << 40});
+
+    EXPECT_EQ(unbounded.grid_size_, 512);
+    EXPECT_EQ(unbounded.num_wave_, 3);
+    EXPECT_EQ(unbounded.num_idle_block_, 0);
+    EXPECT_EQ(unbounded.num_a_access_, 512 * 32);
+    EXPECT_EQ(unbounded.dram_bytes_, unbounded.min_dram_bytes_);
+    EXPECT_EQ(unbounded.min_dram_bytes_, (M + N) * 1024 * 2);
+    EXPECT_DOUBLE_EQ(unbounded.GetAReuse(), 32.);
+    EXPECT_DOUBLE_EQ(unbounded.GetBReuse(), 16.);
+
+    // an L2 smaller than a slice serves nothing
+    const auto no_l2 = ck::utils::simulate_tile_schedule(
+        tile_map, grid_size, problem, TileScheduleSimulatorConfig{110, 2, 1024});
+
+    EXPECT_EQ(no_l2.num_a_miss_, no_l2.num_a_access_);
+    EXPECT_EQ(no_l2.num_b_miss_, no_l2.num_b_access_);
+    EXPECT_DOUBLE_EQ(no_l2.GetL2HitRate(), 0.);
+}
+
+TEST(TileScheduleSimulator, M01ImprovesReuse)
+{
+    const index_t M = 8192;
+    const index_t N = 8192;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    using TileMap = BlockToCTileMap_M00_N0_M01Adapt<256, 128, decltype(c_grid_desc_m_n)>;
+
+    const TileScheduleProblem problem{M, N, 4096, 256, 128, 32};
+    const TileScheduleSimulatorConfig config{110, 2, 8 * 1024 * 1024};
+
+    const auto get_stat = [&](index_t M01) {
+        TileMap tile_map(c_grid_desc_m_n, M01);
+
+        return ck::utils::simulate_tile_schedule(
+            tile_map, tile_map.CalculateGridSize(c_grid_desc_m_n), problem, config);
+    };
+
+    const auto row_major = get_stat(1);
+    const auto grouped   = get_stat(8);
+
+    // a wave of row-major tiles spans all the B panels, grouping rows shrinks its footprint
+    EXPECT_DOUBLE_EQ(row_major.average_n0_per_wave_, 64.);
+    EXPECT_LT(grouped.average_n0_per_wave_, row_major.average_n0_per_wave_);
+
+    EXPECT_LT(grouped.dram_bytes_, row_major.dram_bytes_);
+    EXPECT_GT(grouped.GetBReuse(), row_major.GetBReuse());
+    EXPECT_EQ(grouped.min_dram_bytes_, row_major.min_dram_bytes_);
+}
+
+TEST(TileScheduleSimulator, KSplit)
+{
+    const index_t M      = 1024;
+    const index_t N      = 1024;
+    const index_t KBatch = 4;
+
+    auto c_grid_desc_m_n = make_naive_tensor_descriptor_packed(make_tuple(M, N));
+
+    BlockToCTileMap_KSplit_M00_N0_M01Adapt<128, 128, decltype(c_grid_desc_m_n)> tile_map(
+        c_grid_desc_m_n, 8, KBatch);
+
+    TileScheduleProblem problem{M, N, 4096, 128, 128, 32};
+    problem.k_batch_ = KBatch;
+
+    const auto stat = ck::utils::simulate_tile_schedule(
+        tile_map,
+        tile_map.CalculateGridSize(c_grid_desc_m_n),
+        problem,
+        TileScheduleSimulatorConfig{110, 2, 1LL << 40});
+
+    // every K slice of every C tile is still loaded once, by one of the K batches
+    EXPECT_EQ(stat.grid_size_, 8 * 8 * KBatch);
+    EXPECT_EQ(stat.num_a_access_, 8 * 8 * 128);
+    EXPECT_EQ(stat.dram_bytes_, (M + N) * 4096 * 2);
+}
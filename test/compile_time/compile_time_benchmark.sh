@@ -0,0 +1,71 @@
+#!/bin/bash
+#
+# Compile-time benchmark
+#
+# Used as compiler launcher, records the wall time and the peak memory of the compilation:
+#   compile_time_benchmark.sh <log> <compiler> <compiler arguments...>
+#
+# Prints the log and fails when a source is over budget, a budget of 0 is not checked:
+#   compile_time_benchmark.sh --check <log> <budget seconds> <budget MB>
+
+if [ "$1" = "--check" ]; then
+    LOG=$2
+    BUDGET_SECONDS=$3
+    BUDGET_MB=$4
+
+    if [ ! -f "$LOG" ]; then
+        echo "no compile-time benchmark log $LOG, build the compile_time_benchmark target"
+        exit 1
+    fi
+
+    awk -v budget_seconds="$BUDGET_SECONDS" -v budget_mb="$BUDGET_MB" '
+    BEGIN { status = 0; printf "%-50s %10s %10s\n", "source", "seconds", "MB" }
+    {
+        mb = $3 / 1024
+        over = (budget_seconds > 0 && $2 > budget_seconds) || (budget_mb > 0 && mb > budget_mb)
+        printf "%-50s %10.2f %10.0f%s\n", $1, $2, mb, over ? "  over budget" : ""
+        if(over) status = 1
+    }
+    END { exit status }' "$LOG"
+
+    exit $?
+fi
+
+LOG=$1
+shift
+
+SOURCE=unknown
+PREVIOUS=""
+for ARG in "$@"; do
+    if [ "$PREVIOUS" = "-c" ]; then
+        SOURCE=$(basename "$ARG")
+    fi
+    PREVIOUS=$ARG
+done
+
+STAT=$(mktemp)
+
+if [ -x /usr/bin/time ]; then
+    /usr/bin/time -f "%e %M" -o "$STAT" "$@"
+    STATUS=$?
+else
+    # peak memory is unknown without GNU time
+    TIMEFORMAT="%R 0"
+    { time "$@" 2>&3 ; } 3>&2 2> "$STAT"
+    STATUS=$?
+fi
+
+if [ $STATUS -eq 0 ]; then
+    # keep the last measurement of each source, sources may be compiled in parallel
+    (
+        flock 9 2> /dev/null
+        touch "$LOG"
+        grep -v "^$SOURCE " "$LOG" > "$LOG.$$"
+        echo "$SOURCE $(tail -n 1 "$STAT")" >> "$LOG.$$"
+        mv "$LOG.$$" "$LOG"
+    ) 9> "$LOG.lock"
+fi
+
+rm -f "$STAT"
+
+exit $STATUS
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+// Compile-only test of the Sequence and Tuple metaprogramming: every check is a static_assert
+// against a hand-written expected sequence or type, building this file is the test.
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+
+namespace {
+
+using namespace ck;
+
+using Less  = math::less<index_t>;
+using Equal = math::equal<index_t>;
+using Plus  = math::plus<index_t>;
+
+// generation
+static_assert(is_same_v<typename arithmetic_sequence_gen<0, 5, 1>::type, Sequence<0, 1, 2, 3, 4>>);
+static_assert(is_same_v<typename arithmetic_sequence_gen<2, 11, 3>::type, Sequence<2, 5, 8>>);
+static_assert(is_same_v<typename arithmetic_sequence_gen<0, 0, 1>::type, Sequence<>>);
+static_assert(is_same_v<uniform_sequence_gen_t<3, 7>, Sequence<7, 7, 7>>);
+static_assert(is_same_v<typename sequence_merge<Sequence<1>, Sequence<>, Sequence<2, 3>>::type,
+                        Sequence<1, 2, 3>>);
+static_assert(is_same_v<typename sequence_reverse<Sequence<1, 2, 3>>::type, Sequence<3, 2, 1>>);
+
+// sort, the map gives the position in the input of each sorted value
+using SortUnsorted = sequence_sort<Sequence<5, 2, 9, 0, 7>, Less>;
+
+static_assert(is_same_v<typename SortUnsorted::type, Sequence<0, 2, 5, 7, 9>>);
+static_assert(is_same_v<typename SortUnsorted::sorted2unsorted_map, Sequence<3, 1, 0, 4, 2>>);
+
+// equal values are ordered as by the merges of the sort: a pair is swapped, and a merge takes the
+// right element
+using SortRepeated = sequence_sort<Sequence<3, 1, 2, 1>, Less>;
+
+static_assert(is_same_v<typename SortRepeated::type, Sequence<1, 1, 2, 3>>);
+static_assert(is_same_v<typename SortRepeated::sorted2unsorted_map, Sequence<3, 1, 2, 0>>);
+
+static_assert(is_same_v<typename sequence_sort<Sequence<4>, Less>::type, Sequence<4>>);
+static_assert(is_same_v<typename sequence_sort<Sequence<>, Less>::type, Sequence<>>);
+
+// unique sort keeps the first of the sorted equal values
+using UniqueSort = sequence_unique_sort<Sequence<3, 1, 2, 1, 3>, Less, Equal>;
+
+static_assert(is_same_v<typename UniqueSort::type, Sequence<1, 2, 3>>);
+static_assert(is_same_v<typename UniqueSort::sorted2unsorted_map, Sequence<3, 2, 4>>);
+
+static_assert(is_same_v<typename sequence_unique_sort<Sequence<6, 6, 6>, Less, Equal>::type,
+                        Sequence<6>>);
+
+// scans
+static_assert(is_same_v<decltype(reverse_inclusive_scan_sequence(
+                            Sequence<1, 2, 3, 4>{}, Plus{}, Number<0>{})),
+                        Sequence<10, 9, 7, 4>>);
+static_assert(is_same_v<decltype(reverse_inclusive_scan_sequence(
+                            Sequence<2, 3, 4>{}, math::multiplies{}, Number<1>{})),
+                        Sequence<24, 12, 4>>);
+static_assert(is_same_v<decltype(reverse_exclusive_scan_sequence(
+                            Sequence<2, 3, 4>{}, math::multiplies{}, Number<1>{})),
+                        Sequence<12, 4, 1>>);
+static_assert(is_same_v<decltype(inclusive_scan_sequence(
+                            Sequence<1, 2, 3, 4>{}, Plus{}, Number<0>{})),
+                        Sequence<1, 3, 6, 10>>);
+static_assert(
+    is_same_v<decltype(reverse_inclusive_scan_sequence(Sequence<>{}, Plus{}, Number<0>{})),
+              Sequence<>>);
+
+// map inverse
+static_assert(is_same_v<typename sequence_map_inverse<Sequence<2, 0, 3, 1>>::type,
+                        Sequence<1, 3, 0, 2>>);
+static_assert(is_same_v<typename sequence_map_inverse<Sequence<0, 1, 2>>::type,
+                        Sequence<0, 1, 2>>);
+static_assert(is_valid_sequence_map<Sequence<2, 0, 3, 1>>::value);
+static_assert(!is_valid_sequence_map<Sequence<2, 0, 2, 1>>::value);
+
+// pick and modify
+static_assert(is_same_v<decltype(pick_sequence_elements_by_ids(Sequence<5, 6, 7, 8>{},
+                                                               Sequence<3, 0>{})),
+                        Sequence<8, 5>>);
+static_assert(is_same_v<decltype(pick_sequence_elements_by_mask(Sequence<5, 6, 7, 8>{},
+                                                                Sequence<1, 0, 1, 1>{})),
+                        Sequence<5, 7, 8>>);
+static_assert(is_same_v<decltype(pick_sequence_elements_by_mask(Sequence<5, 6>{},
+                                                                Sequence<0, 0>{})),
+                        Sequence<>>);
+static_assert(is_same_v<decltype(modify_sequence_elements_by_ids(
+                            Sequence<5, 6, 7, 8>{}, Sequence<2, 1>{}, Sequence<3, 0>{})),
+                        Sequence<1, 6, 7, 2>>);
+// the last value wins for a repeated id
+static_assert(is_same_v<decltype(modify_sequence_elements_by_ids(
+                            Sequence<5, 6, 7, 8>{}, Sequence<1, 2>{}, Sequence<1, 1>{})),
+                        Sequence<5, 2, 7, 8>>);
+
+// tuple element, with the qualifiers of the element
+using TupleOfTypes = Tuple<int, const float, Sequence<1, 2>, Number<3>, double, char, bool, long>;
+
+static_assert(is_same_v<tuple_element_t<0, TupleOfTypes>, int>);
+static_assert(is_same_v<tuple_element_t<1, TupleOfTypes>, const float>);
+static_assert(is_same_v<tuple_element_t<2, TupleOfTypes>, Sequence<1, 2>>);
+static_assert(is_same_v<tuple_element_t<3, TupleOfTypes>, Number<3>>);
+static_assert(is_same_v<tuple_element_t<7, TupleOfTypes>, long>);
+static_assert(is_same_v<remove_cvref_t<decltype(TupleOfTypes{}.At(Number<6>{}))>, bool>);
+static_assert(TupleOfTypes::Size() == 8);
+
+} // namespace
+
+int main() { return 0; }
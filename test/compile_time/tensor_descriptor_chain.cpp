@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+// Compile-time benchmark: a 3D forward convolution lowered to the A grid descriptor of an XDL
+// GEMM, the longest transform chains built by the device operations. What is measured is the
+// time and memory to compile this file.
+
+#include <array>
+#include <iostream>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+
+namespace {
+
+using namespace ck;
+
+constexpr index_t MPerBlock = 256;
+constexpr index_t KPerBlock = 32;
+constexpr index_t AK1       = 8;
+
+template <tensor_operation::device::ConvolutionForwardSpecialization ConvSpec>
+auto make_conv_fwd_a_grid_desc_ak0_m_ak1(const std::array<index_t, 6>& a_g_n_c_wis_lengths,
+                                         const std::array<index_t, 6>& a_g_n_c_wis_strides,
+                                         const std::array<index_t, 6>& b_g_k_c_xs_lengths,
+                                         const std::array<index_t, 6>& c_g_n_k_wos_lengths,
+                                         const std::array<index_t, 3>& conv_filter_strides,
+                                         const std::array<index_t, 3>& conv_filter_dilations,
+                                         const std::array<index_t, 3>& input_left_pads,
+                                         const std::array<index_t, 3>& input_right_pads)
+{
+    using ConvToGemm = tensor_operation::TransformConvFwdToGemm<3, ConvSpec>;
+
+    const auto a_grid_desc_mraw_kraw =
+        ConvToGemm::template MakeADescriptor_M_K<tensor_layout::convolution::NDHWGC>(
+            a_g_n_c_wis_lengths,
+            a_g_n_c_wis_strides,
+            b_g_k_c_xs_lengths,
+            {},
+            c_g_n_k_wos_lengths,
+            {},
+            conv_filter_strides,
+            conv_filter_dilations,
+            input_left_pads,
+            input_right_pads);
+
+    const auto MRaw = a_grid_desc_mraw_kraw.GetLength(Number<0>{});
+    const auto KRaw = a_grid_desc_mraw_kraw.GetLength(Number<1>{});
+
+    const auto M = math::integer_divide_ceil(MRaw, MPerBlock) * MPerBlock;
+    const auto K = math::integer_divide_ceil(KRaw, KPerBlock) * KPerBlock;
+
+    const auto a_grid_desc_m_k =
+        transform_tensor_descriptor(a_grid_desc_mraw_kraw,
+                                    make_tuple(make_right_pad_transform(MRaw, M - MRaw),
+                                               make_right_pad_transform(KRaw, K - KRaw)),
+                                    make_tuple(Sequence<0>{}, Sequence<1>{}),
+                                    make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    return transform_tensor_descriptor(
+        a_grid_desc_m_k,
+        make_tuple(make_unmerge_transform(make_tuple(K / AK1, Number<AK1>{})),
+                   make_pass_through_transform(M)),
+        make_tuple(Sequence<1>{}, Sequence<0>{}),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}));
+}
+
+// offset calculation and coordinate movement, as done by the threadwise transfers
+template <typename Desc>
+index_t walk_grid_desc(const Desc& desc)
+{
+    auto coord = make_tensor_coordinate(desc, make_multi_index(0, 0, 0));
+
+    const auto step = make_tensor_coordinate_step(desc, make_multi_index(KPerBlock / AK1, 0, 0));
+
+    index_t sum = 0;
+
+    for(index_t i = 0; i < 4; ++i)
+    {
+        sum += coord.GetOffset() +
+               static_cast<index_t>(coordinate_has_valid_offset_assuming_visible_index_is_valid(
+                   desc, coord));
+
+        move_tensor_coordinate(desc, coord, step);
+    }
+
+    return sum + desc.CalculateOffset(make_multi_index(1, 1, 1));
+}
+
+// stride 1 convolution of a 2x8x28x28x64 input, with the same output size
+template <tensor_operation::device::ConvolutionForwardSpecialization ConvSpec>
+index_t run_conv_fwd_descriptor_chain(index_t filter_size)
+{
+    const index_t pad = filter_size / 2;
+
+    const std::array<index_t, 6> in_lengths{1, 2, 64, 8, 28, 28};
+    const std::array<index_t, 6> in_strides{64, 8 * 28 * 28 * 64, 1, 28 * 28 * 64, 28 * 64, 64};
+    const std::array<index_t, 6> wei_lengths{1, 128, 64, filter_size, filter_size, filter_size};
+    const std::array<index_t, 6> out_lengths{1, 2, 128, 8, 28, 28};
+
+    const auto desc = make_conv_fwd_a_grid_desc_ak0_m_ak1<ConvSpec>(in_lengths,
+                                                                    in_strides,
+                                                                    wei_lengths,
+                                                                    out_lengths,
+                                                                    {1, 1, 1},
+                                                                    {1, 1, 1},
+                                                                    {pad, pad, pad},
+                                                                    {pad, pad, pad});
+
+    return walk_grid_desc(desc) + static_cast<index_t>(desc.GetElementSpaceSize());
+}
+
+} // namespace
+
+int main()
+{
+    using ck::tensor_operation::device::ConvolutionForwardSpecialization;
+
+    std::cout << run_conv_fwd_descriptor_chain<ConvolutionForwardSpecialization::Default>(3) << ", "
+              << run_conv_fwd_descriptor_chain<ConvolutionForwardSpecialization::Filter1x1Pad0>(1)
+              << ", "
+              << run_conv_fwd_descriptor_chain<
+                     ConvolutionForwardSpecialization::Filter1x1Stride1Pad0>(1)
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/cpu/elementwise.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using F16         = ck::half_t;
+using F32         = float;
+using Add         = ck::tensor_operation::element_wise::Add;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using CpuBackend  = ck::tensor_operation::device::instance::CpuBackend;
+
+template <typename... Ts>
+using Tuple = ck::Tuple<Ts...>;
+
+namespace {
+
+template <std::size_t N>
+std::array<ck::index_t, N> to_index_array(const std::vector<std::size_t>& values)
+{
+    std::array<ck::index_t, N> result{};
+
+    std::copy(values.begin(), values.end(), result.begin());
+
+    return result;
+}
+
+} // namespace
+
+// c[m, n] = a[n, m] with a transposed input and a padded output
+TEST(ElementwiseCpu, PassThroughTranspose)
+{
+    using DeviceOp = ck::tensor_operation::device::
+        DeviceElementwiseBase<Tuple<F16>, Tuple<F16>, PassThrough, 2>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>;
+
+    constexpr ck::index_t M = 67;
+    constexpr ck::index_t N = 129;
+
+    Tensor<F16> a(HostTensorDescriptor({M, N}, {1, M}));
+    Tensor<F16> c(HostTensorDescriptor({M, N}, {N + 5, 1}));
+
+    a.GenerateTensorValue(GeneratorTensor_3<F16>{-1, 1});
+
+    const auto op_ptrs = Factory::GetInstances();
+
+    EXPECT_FALSE(op_ptrs.empty());
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        c.SetZero();
+
+        auto argument_ptr =
+            op_ptr->MakeArgumentPointer(to_index_array<2>(a.mDesc.GetLengths()),
+                                        {to_index_array<2>(a.mDesc.GetStrides())},
+                                        {to_index_array<2>(c.mDesc.GetStrides())},
+                                        {a.mData.data()},
+                                        {c.mData.data()},
+                                        PassThrough{});
+
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get()));
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        for(ck::index_t m = 0; m < M; ++m)
+        {
+            for(ck::index_t n = 0; n < N; ++n)
+            {
+                EXPECT_EQ(ck::type_convert<F32>(c(m, n)), ck::type_convert<F32>(a(m, n)))
+                    << op_ptr->GetTypeString();
+            }
+        }
+    }
+}
+
+// c[n, c, h, w] = a[n, h, w, c] + b[c], with a in NHWC layout and b broadcast
+TEST(ElementwiseCpu, AddBroadcast)
+{
+    using DeviceOp = ck::tensor_operation::device::
+        DeviceElementwiseBase<Tuple<F32, F32>, Tuple<F32>, Add, 4>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>;
+
+    constexpr ck::index_t N  = 3;
+    constexpr ck::index_t C  = 17;
+    constexpr ck::index_t H  = 9;
+    constexpr ck::index_t W  = 33;
+    constexpr ck::index_t HW = H * W;
+
+    Tensor<F32> a(HostTensorDescriptor({N, C, H, W}, {HW * C, 1, W * C, C}));
+    Tensor<F32> b(HostTensorDescriptor({N, C, H, W}, {0, 1, 0, 0}));
+    Tensor<F32> c(HostTensorDescriptor({N, C, H, W}));
+
+    a.GenerateTensorValue(GeneratorTensor_3<F32>{-1, 1});
+    b.GenerateTensorValue(GeneratorTensor_3<F32>{-1, 1});
+
+    const auto op_ptrs = Factory::GetInstances();
+
+    EXPECT_FALSE(op_ptrs.empty());
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        c.SetZero();
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(
+            to_index_array<4>(a.mDesc.GetLengths()),
+            {to_index_array<4>(a.mDesc.GetStrides()), to_index_array<4>(b.mDesc.GetStrides())},
+            {to_index_array<4>(c.mDesc.GetStrides())},
+            {a.mData.data(), b.mData.data()},
+            {c.mData.data()},
+            Add{});
+
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get()));
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        Tensor<F32> c_ref(c.mDesc);
+
+        c_ref.ForEach([&](auto& self, auto idx) { self(idx) = a(idx) + b(idx); });
+
+        EXPECT_TRUE(ck::utils::check_err(c, c_ref, op_ptr->GetTypeString()));
+    }
+}
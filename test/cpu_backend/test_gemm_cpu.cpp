@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <type_traits>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/cpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/cpu/batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using F16         = ck::half_t;
+using F32         = float;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using CpuBackend  = ck::tensor_operation::device::instance::CpuBackend;
+
+namespace {
+
+template <typename Layout>
+HostTensorDescriptor
+make_host_tensor_descriptor(ck::index_t row, ck::index_t col, ck::index_t stride)
+{
+    if constexpr(std::is_same_v<Layout, Row>)
+    {
+        return HostTensorDescriptor({row, col}, {stride, 1});
+    }
+    else
+    {
+        return HostTensorDescriptor({row, col}, {1, stride});
+    }
+}
+
+template <typename Layout>
+HostTensorDescriptor
+make_host_tensor_descriptor(ck::index_t batch, ck::index_t row, ck::index_t col, ck::index_t stride)
+{
+    if constexpr(std::is_same_v<Layout, Row>)
+    {
+        return HostTensorDescriptor({batch, row, col}, {row * stride, stride, 1});
+    }
+    else
+    {
+        return HostTensorDescriptor({batch, row, col}, {col * stride, 1, stride});
+    }
+}
+
+template <typename Layout>
+ck::index_t get_packed_stride(ck::index_t row, ck::index_t col)
+{
+    return std::is_same_v<Layout, Row> ? col : row;
+}
+
+// runs every supported CPU instance of c[M, N] = a[M, K] * b[K, N] and checks it against
+// ReferenceGemm, returns the number of instances run
+template <typename ALayout, typename BLayout, typename DataType>
+int run_gemm_cpu(ck::index_t M, ck::index_t N, ck::index_t K)
+{
+    using DeviceOp = ck::tensor_operation::device::DeviceGemm<ALayout,
+                                                              BLayout,
+                                                              Row,
+                                                              DataType,
+                                                              DataType,
+                                                              DataType,
+                                                              PassThrough,
+                                                              PassThrough,
+                                                              PassThrough>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>;
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<DataType, DataType, DataType, F32, PassThrough, PassThrough, PassThrough>;
+
+    const ck::index_t StrideA = get_packed_stride<ALayout>(M, K);
+    const ck::index_t StrideB = get_packed_stride<BLayout>(K, N);
+    const ck::index_t StrideC = N;
+
+    Tensor<DataType> a(make_host_tensor_descriptor<ALayout>(M, K, StrideA));
+    Tensor<DataType> b(make_host_tensor_descriptor<BLayout>(K, N, StrideB));
+    Tensor<DataType> c_ref(make_host_tensor_descriptor<Row>(M, N, StrideC));
+    Tensor<DataType> c(make_host_tensor_descriptor<Row>(M, N, StrideC));
+
+    a.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+    b.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+
+    auto ref_gemm     = ReferenceGemm{};
+    auto ref_argument = ref_gemm.MakeArgument(a, b, c_ref, {}, {}, {});
+
+    ref_gemm.MakeInvoker().Run(ref_argument);
+
+    const auto op_ptrs = Factory::GetInstances();
+
+    EXPECT_EQ(op_ptrs.size(), Factory::GetInstanceDescriptors().size());
+
+    // FMA micro-kernels round differently from the reference
+    constexpr double tolerance = std::is_same_v<DataType, F32> ? 1e-4 : 1e-3;
+
+    int num_run = 0;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(
+            a.data(), b.data(), c.data(), M, N, K, StrideA, StrideB, StrideC, {}, {}, {});
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            continue;
+        }
+
+        c.SetZero();
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        EXPECT_TRUE(ck::utils::check_err(c, c_ref, op_ptr->GetTypeString(), tolerance, tolerance));
+
+        ++num_run;
+    }
+
+    return num_run;
+}
+
+template <typename ALayout, typename BLayout, typename DataType>
+int run_batched_gemm_cpu(ck::index_t M, ck::index_t N, ck::index_t K, ck::index_t Batch)
+{
+    using DeviceOp = ck::tensor_operation::device::DeviceBatchedGemm<ALayout,
+                                                                     BLayout,
+                                                                     Row,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     DataType,
+                                                                     PassThrough,
+                                                                     PassThrough,
+                                                                     PassThrough>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>;
+
+    using ReferenceBatchedGemm = ck::tensor_operation::host::ReferenceBatchedGemm<DataType,
+                                                                                  DataType,
+                                                                                  DataType,
+                                                                                  F32,
+                                                                                  PassThrough,
+                                                                                  PassThrough,
+                                                                                  PassThrough>;
+
+    const ck::index_t StrideA = get_packed_stride<ALayout>(M, K);
+    const ck::index_t StrideB = get_packed_stride<BLayout>(K, N);
+    const ck::index_t StrideC = N;
+
+    Tensor<DataType> a(make_host_tensor_descriptor<ALayout>(Batch, M, K, StrideA));
+    Tensor<DataType> b(make_host_tensor_descriptor<BLayout>(Batch, K, N, StrideB));
+    Tensor<DataType> c_ref(make_host_tensor_descriptor<Row>(Batch, M, N, StrideC));
+    Tensor<DataType> c(make_host_tensor_descriptor<Row>(Batch, M, N, StrideC));
+
+    const auto BatchStrideA = static_cast<ck::index_t>(a.mDesc.GetStrides()[0]);
+    const auto BatchStrideB = static_cast<ck::index_t>(b.mDesc.GetStrides()[0]);
+    const auto BatchStrideC = static_cast<ck::index_t>(c.mDesc.GetStrides()[0]);
+
+    a.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+    b.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+
+    auto ref_gemm     = ReferenceBatchedGemm{};
+    auto ref_argument = ref_gemm.MakeArgument(a, b, c_ref, {}, {}, {});
+
+    ref_gemm.MakeInvoker().Run(ref_argument);
+
+    // FMA micro-kernels round differently from the reference
+    constexpr double tolerance = std::is_same_v<DataType, F32> ? 1e-4 : 1e-3;
+
+    int num_run = 0;
+
+    for(const auto& op_ptr : Factory::GetInstances())
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(a.data(),
+                                                        b.data(),
+                                                        c.data(),
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        StrideA,
+                                                        StrideB,
+                                                        StrideC,
+                                                        BatchStrideA,
+                                                        BatchStrideB,
+                                                        BatchStrideC,
+                                                        Batch,
+                                                        {},
+                                                        {},
+                                                        {});
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            continue;
+        }
+
+        c.SetZero();
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        EXPECT_TRUE(ck::utils::check_err(c, c_ref, op_ptr->GetTypeString(), tolerance, tolerance));
+
+        ++num_run;
+    }
+
+    return num_run;
+}
+
+} // namespace
+
+// sizes are not multiples of any block tile and K spans several KPerBlock slices
+TEST(GemmCpu, F32)
+{
+    EXPECT_GT((run_gemm_cpu<Row, Row, F32>(131, 77, 300)), 0);
+    EXPECT_GT((run_gemm_cpu<Row, Col, F32>(131, 77, 300)), 0);
+    EXPECT_GT((run_gemm_cpu<Col, Row, F32>(131, 77, 300)), 0);
+    EXPECT_GT((run_gemm_cpu<Col, Col, F32>(131, 77, 300)), 0);
+}
+
+TEST(GemmCpu, F16)
+{
+    EXPECT_GT((run_gemm_cpu<Row, Row, F16>(64, 96, 40)), 0);
+    EXPECT_GT((run_gemm_cpu<Col, Col, F16>(33, 17, 129)), 0);
+}
+
+TEST(GemmCpu, Degenerate)
+{
+    EXPECT_GT((run_gemm_cpu<Row, Row, F32>(1, 1, 1)), 0);
+    EXPECT_GT((run_gemm_cpu<Row, Col, F32>(5, 3, 0)), 0);
+}
+
+TEST(BatchedGemmCpu, F32)
+{
+    EXPECT_GT((run_batched_gemm_cpu<Row, Row, F32>(70, 45, 130, 3)), 0);
+    EXPECT_GT((run_batched_gemm_cpu<Col, Col, F32>(70, 45, 130, 3)), 0);
+}
+
+TEST(BatchedGemmCpu, F16)
+{
+    EXPECT_GT((run_batched_gemm_cpu<Row, Col, F16>(32, 50, 64, 2)), 0);
+}
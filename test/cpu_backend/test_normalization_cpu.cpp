@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/cpu/normalization.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using F16         = ck::half_t;
+using F32         = float;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using CpuBackend  = ck::tensor_operation::device::instance::CpuBackend;
+
+namespace {
+
+// runs every CPU instance of the layernorm of x[M, N] over N and checks it against
+// ReferenceLayernorm, x is viewed as x[M, N0, .., Nk] by the instances when Rank > 2, returns the
+// number of instances run
+template <typename DataType, ck::index_t Rank, ck::index_t NumReduceDim>
+int run_normalization_cpu(ck::index_t M,
+                          const std::vector<ck::index_t>& reduce_lengths,
+                          ck::index_t x_row_stride)
+{
+    static_assert(Rank == NumReduceDim + 1, "wrong! only the leading dimension is invariant");
+
+    using DeviceOp = ck::tensor_operation::device::DeviceNormalization<DataType,
+                                                                       DataType,
+                                                                       DataType,
+                                                                       F32,
+                                                                       DataType,
+                                                                       PassThrough,
+                                                                       Rank,
+                                                                       NumReduceDim>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>;
+
+    using ReferenceLayernorm = ck::tensor_operation::host::
+        ReferenceLayernorm<DataType, DataType, DataType, DataType, F32, PassThrough, 2, 1>;
+
+    // packed strides of the reduced dimensions, and broadcast of gamma and beta along M
+    std::vector<ck::index_t> lengths{M};
+    std::vector<ck::index_t> x_strides{x_row_stride};
+    std::vector<ck::index_t> gamma_strides{0};
+    std::vector<ck::index_t> reduce_dims;
+
+    ck::index_t N = 1;
+
+    for(auto length : reduce_lengths)
+    {
+        N *= length;
+    }
+
+    ck::index_t stride = N;
+
+    for(std::size_t i = 0; i < reduce_lengths.size(); ++i)
+    {
+        stride /= reduce_lengths[i];
+
+        lengths.push_back(reduce_lengths[i]);
+        x_strides.push_back(stride);
+        gamma_strides.push_back(stride);
+        reduce_dims.push_back(static_cast<ck::index_t>(i + 1));
+    }
+
+    Tensor<DataType> x(HostTensorDescriptor({M, N}, {x_row_stride, 1}));
+    Tensor<DataType> gamma(HostTensorDescriptor({N}));
+    Tensor<DataType> beta(HostTensorDescriptor({N}));
+    Tensor<DataType> y_ref(HostTensorDescriptor({M, N}, {x_row_stride, 1}));
+    Tensor<DataType> y(HostTensorDescriptor({M, N}, {x_row_stride, 1}));
+
+    x.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+    gamma.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+    beta.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+
+    constexpr F32 epsilon = 1e-4f;
+
+    auto ref_layernorm = ReferenceLayernorm{};
+    auto ref_argument =
+        ref_layernorm.MakeArgument(x, gamma, beta, y_ref, PassThrough{}, {M, N}, {1}, epsilon);
+
+    ref_layernorm.MakeInvoker().Run(ref_argument);
+
+    // Welford and the two pass reference round differently
+    constexpr double tolerance = std::is_same_v<DataType, F32> ? 1e-4 : 1e-2;
+
+    int num_run = 0;
+
+    for(const auto& op_ptr : Factory::GetInstances())
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(lengths,
+                                                        x_strides,
+                                                        gamma_strides,
+                                                        gamma_strides,
+                                                        x_strides,
+                                                        reduce_dims,
+                                                        epsilon,
+                                                        x.mData.data(),
+                                                        gamma.mData.data(),
+                                                        beta.mData.data(),
+                                                        y.mData.data(),
+                                                        nullptr,
+                                                        nullptr,
+                                                        PassThrough{});
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            continue;
+        }
+
+        y.SetZero();
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        EXPECT_TRUE(ck::utils::check_err(y, y_ref, op_ptr->GetTypeString(), tolerance, tolerance));
+
+        ++num_run;
+    }
+
+    return num_run;
+}
+
+} // namespace
+
+TEST(NormalizationCpu, Rank2)
+{
+    EXPECT_GT((run_normalization_cpu<F32, 2, 1>(37, {1000}, 1000)), 0);
+    EXPECT_GT((run_normalization_cpu<F32, 2, 1>(5, {7}, 11)), 0);
+    EXPECT_GT((run_normalization_cpu<F16, 2, 1>(64, {256}, 256)), 0);
+}
+
+TEST(NormalizationCpu, Rank4)
+{
+    EXPECT_GT((run_normalization_cpu<F32, 4, 3>(8, {5, 6, 17}, 510)), 0);
+    EXPECT_GT((run_normalization_cpu<F16, 4, 3>(3, {4, 4, 64}, 1100)), 0);
+}
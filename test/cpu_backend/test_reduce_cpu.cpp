@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/cpu/reduce.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_reduction.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using ck::tensor_operation::device::instance::PassThrough;
+using ck::tensor_operation::device::instance::ReduceAdd;
+using ck::tensor_operation::device::instance::ReduceAMax;
+using ck::tensor_operation::device::instance::ReduceMax;
+using ck::tensor_operation::device::instance::UnaryAbs;
+using ck::tensor_operation::device::instance::UnaryDivide;
+using ck::tensor_operation::device::instance::UnarySqrt;
+using ck::tensor_operation::device::instance::UnarySquare;
+
+namespace {
+
+template <ck::index_t Rank, ck::index_t NumReduceDim>
+std::array<int, Rank - NumReduceDim> get_invariant_dims(const std::array<int, NumReduceDim>& dims)
+{
+    std::array<int, Rank - NumReduceDim> invariant_dims{};
+
+    std::size_t i = 0;
+
+    for(int dim = 0; dim < Rank; ++dim)
+    {
+        if(std::find(dims.begin(), dims.end(), dim) == dims.end())
+        {
+            invariant_dims[i++] = dim;
+        }
+    }
+
+    return invariant_dims;
+}
+
+template <std::size_t N>
+std::array<ck::index_t, N> to_index_array(const std::vector<std::size_t>& values)
+{
+    std::array<ck::index_t, N> result{};
+
+    std::copy(values.begin(), values.end(), result.begin());
+
+    return result;
+}
+
+// runs every CPU instance of the reduction of in[lengths] over reduce_dims and checks it against
+// ReductionHost, integer input values make the results independent of the accumulation order
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          ck::index_t Rank,
+          ck::index_t NumReduceDim,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool OutputIndex>
+void run_reduce_cpu(const std::vector<std::size_t>& lengths,
+                    const std::array<int, NumReduceDim>& reduce_dims,
+                    float alpha,
+                    float beta,
+                    InElementwiseOperation in_elementwise_op   = {},
+                    AccElementwiseOperation acc_elementwise_op = {})
+{
+    constexpr ck::index_t NumOutDim = std::max(Rank - NumReduceDim, 1);
+
+    using ReferenceReduce = ReductionHost<InDataType,
+                                          AccDataType,
+                                          OutDataType,
+                                          ReduceOperation,
+                                          InElementwiseOperation,
+                                          AccElementwiseOperation,
+                                          Rank,
+                                          NumReduceDim,
+                                          false,
+                                          OutputIndex>;
+
+    const auto invariant_dims = get_invariant_dims<Rank, NumReduceDim>(reduce_dims);
+
+    std::vector<std::size_t> out_lengths;
+
+    for(auto dim : invariant_dims)
+    {
+        out_lengths.push_back(lengths[static_cast<std::size_t>(dim)]);
+    }
+
+    if(out_lengths.empty())
+    {
+        out_lengths.push_back(1);
+    }
+
+    Tensor<InDataType> in(lengths);
+    Tensor<OutDataType> out_ref(out_lengths);
+    Tensor<OutDataType> out(out_lengths);
+    Tensor<int32_t> out_index_ref(out_lengths);
+    Tensor<int32_t> out_index(out_lengths);
+
+    in.GenerateTensorValue(GeneratorTensor_2<InDataType>{-5, 5});
+    out_ref.GenerateTensorValue(GeneratorTensor_2<OutDataType>{-5, 5});
+
+    const auto out_init = out_ref.mData;
+
+    ReferenceReduce reduction_host(in.mDesc, out_ref.mDesc, invariant_dims, reduce_dims);
+
+    reduction_host.Run(alpha,
+                       in.mData.data(),
+                       beta,
+                       out_ref.mData.data(),
+                       out_index_ref.mData.data(),
+                       in_elementwise_op,
+                       acc_elementwise_op);
+
+    std::vector<ck::tensor_operation::device::DeviceReducePtr<Rank,
+                                                              NumReduceDim,
+                                                              InElementwiseOperation,
+                                                              AccElementwiseOperation>>
+        op_ptrs;
+
+    ck::tensor_operation::device::instance::add_device_reduce_instance_cpu<InDataType,
+                                                                           AccDataType,
+                                                                           OutDataType,
+                                                                           Rank,
+                                                                           NumReduceDim,
+                                                                           ReduceOperation,
+                                                                           InElementwiseOperation,
+                                                                           AccElementwiseOperation,
+                                                                           false,
+                                                                           OutputIndex>(op_ptrs);
+
+    EXPECT_FALSE(op_ptrs.empty());
+
+    const auto in_lengths  = to_index_array<Rank>(in.mDesc.GetLengths());
+    const auto in_strides  = to_index_array<Rank>(in.mDesc.GetStrides());
+    const auto out_strides = to_index_array<NumOutDim>(out.mDesc.GetStrides());
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        out.mData = out_init;
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(in_lengths,
+                                                        in_strides,
+                                                        to_index_array<NumOutDim>(out_lengths),
+                                                        out_strides,
+                                                        reduce_dims,
+                                                        alpha,
+                                                        beta,
+                                                        in.mData.data(),
+                                                        nullptr,
+                                                        out.mData.data(),
+                                                        out_index.mData.data(),
+                                                        in_elementwise_op,
+                                                        acc_elementwise_op);
+
+        ASSERT_TRUE(op_ptr->IsSupportedArgument(argument_ptr.get()));
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        EXPECT_TRUE(ck::utils::check_err(out, out_ref, op_ptr->GetTypeString()));
+
+        if constexpr(OutputIndex)
+        {
+            EXPECT_TRUE(ck::utils::check_err(out_index, out_index_ref, op_ptr->GetTypeString()));
+        }
+    }
+}
+
+} // namespace
+
+TEST(ReduceCpu, Add)
+{
+    run_reduce_cpu<F32, F32, F32, 4, 3, ReduceAdd, PassThrough, PassThrough, false>(
+        {5, 6, 7, 70}, {1, 2, 3}, 1.0f, 0.0f);
+    run_reduce_cpu<F32, F32, F32, 4, 1, ReduceAdd, PassThrough, PassThrough, false>(
+        {5, 67, 7, 3}, {1}, 2.0f, 0.5f);
+    run_reduce_cpu<F32, F32, F32, 2, 1, ReduceAdd, PassThrough, PassThrough, false>(
+        {2, 200000}, {1}, 1.0f, 0.0f);
+    run_reduce_cpu<F16, F32, F16, 4, 4, ReduceAdd, PassThrough, PassThrough, false>(
+        {3, 4, 5, 6}, {0, 1, 2, 3}, 1.0f, 0.0f);
+}
+
+TEST(ReduceCpu, AvgAndNorm2)
+{
+    run_reduce_cpu<F32, F32, F32, 4, 3, ReduceAdd, PassThrough, UnaryDivide, false>(
+        {5, 6, 7, 8}, {1, 2, 3}, 1.0f, 0.0f, PassThrough{}, UnaryDivide{6 * 7 * 8});
+    run_reduce_cpu<F16, F32, F16, 4, 3, ReduceAdd, UnarySquare, UnarySqrt, false>(
+        {5, 6, 7, 8}, {0, 1, 2}, 1.0f, 0.0f);
+}
+
+TEST(ReduceCpu, MaxWithIndex)
+{
+    run_reduce_cpu<F32, F32, F32, 4, 1, ReduceMax, PassThrough, PassThrough, true>(
+        {5, 67, 7, 3}, {1}, 1.0f, 0.0f);
+    run_reduce_cpu<F16, F16, F16, 4, 3, ReduceAMax, UnaryAbs, PassThrough, true>(
+        {5, 6, 7, 70}, {1, 2, 3}, 1.0f, 0.0f);
+    run_reduce_cpu<F32, F32, F32, 2, 1, ReduceMax, PassThrough, PassThrough, true>(
+        {3, 100000}, {1}, 1.0f, 0.0f);
+}
+
+// fewer rows than threads, so that the rows are split and the partial results merged
+TEST(ReduceCpu, SplitRows)
+{
+    using GridwiseReduce = ck::tensor_operation::cpu::GridwiseReductionCpu<F32,
+                                                                           F32,
+                                                                           F32,
+                                                                           int32_t,
+                                                                           ReduceMax,
+                                                                           PassThrough,
+                                                                           PassThrough,
+                                                                           false,
+                                                                           true,
+                                                                           8,
+                                                                           1024>;
+
+    const std::vector<ck::index_t> lengths{3, 10000};
+    const std::vector<ck::index_t> strides{1, 3};
+
+    std::vector<F32> in(30000);
+    std::vector<F32> out(3);
+    std::vector<int32_t> out_index(3);
+
+    for(std::size_t i = 0; i < in.size(); ++i)
+    {
+        in[i] = static_cast<F32>((i * 7919) % 30011);
+    }
+
+    const typename GridwiseReduce::Problem problem{
+        ck::tensor_operation::cpu::TensorIndexer{lengths, strides, std::vector<int>{0}},
+        ck::tensor_operation::cpu::TensorIndexer{lengths, strides, std::vector<int>{1}},
+        ck::tensor_operation::cpu::TensorIndexer{std::vector<int>{3}, std::vector<int>{1}},
+        1.0f,
+        0.0f};
+
+    GridwiseReduce::Run(in.data(), out.data(), out_index.data(), problem, {}, {}, 8);
+
+    for(std::size_t row = 0; row < 3; ++row)
+    {
+        std::size_t index = 0;
+
+        for(std::size_t j = 1; j < 10000; ++j)
+        {
+            if(in[row + 3 * j] > in[row + 3 * index])
+            {
+                index = j;
+            }
+        }
+
+        EXPECT_EQ(out[row], in[row + 3 * index]);
+        EXPECT_EQ(out_index[row], static_cast<int32_t>(index));
+    }
+}
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/cpu/softmax.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+using F16         = ck::half_t;
+using F32         = float;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using CpuBackend  = ck::tensor_operation::device::instance::CpuBackend;
+
+namespace {
+
+// runs every CPU instance with NumReduceDim reduced dimensions of the softmax of in[lengths] over
+// reduce_dims and checks it against ReferenceSoftmax, returns the number of instances run
+template <typename DataType, ck::index_t Rank>
+int run_softmax_cpu(const std::vector<std::size_t>& lengths,
+                    const std::vector<ck::index_t>& reduce_dims,
+                    F32 alpha,
+                    F32 beta)
+{
+    using DeviceOp = ck::tensor_operation::device::
+        DeviceSoftmax<DataType, F32, DataType, PassThrough, PassThrough, Rank>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp,
+                                                                               CpuBackend>;
+
+    using ReferenceSoftmax = ck::tensor_operation::host::ReferenceSoftmax<DataType, DataType, F32>;
+
+    Tensor<DataType> in(lengths);
+    Tensor<DataType> out_ref(lengths);
+    Tensor<DataType> out(lengths);
+
+    in.GenerateTensorValue(GeneratorTensor_3<DataType>{-5, 5});
+    out_ref.GenerateTensorValue(GeneratorTensor_3<DataType>{-1, 1});
+
+    const auto out_init = out_ref.mData;
+
+    auto ref_softmax  = ReferenceSoftmax{};
+    auto ref_argument = ref_softmax.MakeArgument(in, out_ref, alpha, beta, reduce_dims);
+
+    ref_softmax.MakeInvoker().Run(ref_argument);
+
+    const std::vector<ck::index_t> in_lengths(in.mDesc.GetLengths().begin(),
+                                              in.mDesc.GetLengths().end());
+    const std::vector<ck::index_t> in_strides(in.mDesc.GetStrides().begin(),
+                                              in.mDesc.GetStrides().end());
+
+    constexpr double tolerance = std::is_same_v<DataType, F32> ? 1e-5 : 1e-3;
+
+    int num_run = 0;
+
+    for(const auto& op_ptr : Factory::GetInstances())
+    {
+        if(op_ptr->GetNumReduceDim() != static_cast<ck::index_t>(reduce_dims.size()))
+        {
+            continue;
+        }
+
+        out.mData = out_init;
+
+        auto argument_ptr = op_ptr->MakeArgumentPointer(in_lengths,
+                                                        in_strides,
+                                                        reduce_dims,
+                                                        &alpha,
+                                                        &beta,
+                                                        in.mData.data(),
+                                                        out.mData.data(),
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            continue;
+        }
+
+        op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        EXPECT_TRUE(
+            ck::utils::check_err(out, out_ref, op_ptr->GetTypeString(), tolerance, tolerance));
+
+        ++num_run;
+    }
+
+    return num_run;
+}
+
+} // namespace
+
+TEST(SoftmaxCpu, InnermostDim)
+{
+    EXPECT_GT((run_softmax_cpu<F32, 3>({4, 5, 1000}, {2}, 1.0f, 0.0f)), 0);
+    EXPECT_GT((run_softmax_cpu<F32, 3>({4, 5, 13}, {2}, 2.0f, 0.5f)), 0);
+    EXPECT_GT((run_softmax_cpu<F16, 4>({2, 3, 4, 256}, {3}, 1.0f, 0.0f)), 0);
+}
+
+TEST(SoftmaxCpu, StridedDims)
+{
+    EXPECT_GT((run_softmax_cpu<F32, 3>({64, 7, 9}, {0}, 1.0f, 0.0f)), 0);
+    EXPECT_GT((run_softmax_cpu<F32, 4>({3, 16, 5, 16}, {1, 3}, 1.0f, 0.0f)), 0);
+    EXPECT_GT((run_softmax_cpu<F16, 4>({3, 4, 5, 6}, {1, 2, 3}, 1.0f, 0.5f)), 0);
+}
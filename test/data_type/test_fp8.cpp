@@ -0,0 +1,493 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_type_convert.hpp"
+
+using ck::bf8_t;
+using ck::f8_t;
+using ck::half_t;
+using ck::type_convert;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+namespace {
+
+template <typename T>
+uint8_t to_bits(T x)
+{
+    return ck::bit_cast<uint8_t>(x);
+}
+
+template <typename T>
+T from_bits(uint32_t bits)
+{
+    return ck::bit_cast<T>(static_cast<uint8_t>(bits));
+}
+
+float float_from_bits(uint32_t bits)
+{
+    float x;
+
+    std::memcpy(&x, &bits, sizeof(float));
+
+    return x;
+}
+
+template <typename T>
+struct Traits;
+
+template <>
+struct Traits<f8_t>
+{
+    static constexpr int exponent_bits = 4;
+    static constexpr int mantissa_bits = 3;
+};
+
+template <>
+struct Traits<bf8_t>
+{
+    static constexpr int exponent_bits = 5;
+    static constexpr int mantissa_bits = 2;
+};
+
+// the value of bits, from the definition of the encoding
+template <typename T>
+double reference_value(uint32_t bits)
+{
+    constexpr int mantissa_bits = Traits<T>::mantissa_bits;
+    constexpr int bias          = 1 << (Traits<T>::exponent_bits - 1);
+
+    if(bits == 0x80)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    const int exponent = (bits & 0x7f) >> mantissa_bits;
+    const int mantissa = bits & ((1 << mantissa_bits) - 1);
+
+    const double magnitude =
+        exponent == 0
+            ? std::ldexp(mantissa, 1 - bias - mantissa_bits)
+            : std::ldexp((1 << mantissa_bits) + mantissa, exponent - bias - mantissa_bits);
+
+    return bits & 0x80 ? -magnitude : magnitude;
+}
+
+// the nearest value, ties to even, by search over all values; -1 when out of range
+template <typename T>
+int reference_round(double x)
+{
+    constexpr int mantissa_bits = Traits<T>::mantissa_bits;
+
+    const double max = reference_value<T>(0x7f);
+    // the value after the largest one, where rounding overflows
+    const double overflow = max + std::ldexp(1.0, std::ilogb(max) - mantissa_bits);
+
+    const double magnitude = std::abs(x);
+
+    if(magnitude >= overflow || (magnitude > max && magnitude - max >= overflow - magnitude))
+    {
+        return -1;
+    }
+
+    uint32_t best = 0;
+
+    for(uint32_t bits = 1; bits <= 0x7f; ++bits)
+    {
+        const double d      = std::abs(reference_value<T>(bits) - magnitude);
+        const double d_best = std::abs(reference_value<T>(best) - magnitude);
+
+        if(d < d_best || (d == d_best && bits % 2 == 0))
+        {
+            best = bits;
+        }
+    }
+
+    return best == 0 || x > 0 ? best : best | 0x80;
+}
+
+// floats spread over all the bit patterns, and those around the rounding boundaries
+template <typename T>
+std::vector<float> make_float_values(uint32_t stride)
+{
+    std::vector<float> values;
+
+    for(uint64_t bits = 0; bits <= 0xffffffff; bits += stride)
+    {
+        values.push_back(float_from_bits(bits));
+    }
+
+    for(uint32_t bits = 0; bits < 0x80; ++bits)
+    {
+        const float a = static_cast<float>(reference_value<T>(bits));
+        const float b = static_cast<float>(reference_value<T>(bits + 1));
+
+        // after the largest value, the boundary is with the value it would have next
+        const float boundary =
+            bits == 0x7f ? a + (a - static_cast<float>(reference_value<T>(0x7e))) / 2 : (a + b) / 2;
+
+        for(const float x : {a,
+                             boundary,
+                             std::nextafter(boundary, 0.f),
+                             std::nextafter(boundary, 1e30f),
+                             std::nextafter(a, 1e30f)})
+        {
+            values.push_back(x);
+            values.push_back(-x);
+        }
+    }
+
+    for(const float x : {std::numeric_limits<float>::infinity(),
+                         std::numeric_limits<float>::quiet_NaN(),
+                         std::numeric_limits<float>::denorm_min(),
+                         1e30f})
+    {
+        values.push_back(x);
+        values.push_back(-x);
+    }
+
+    return values;
+}
+
+template <typename T>
+void test_to_float()
+{
+    for(uint32_t bits = 0; bits < 256; ++bits)
+    {
+        const float x = type_convert<float>(from_bits<T>(bits));
+
+        if(bits == 0x80)
+        {
+            EXPECT_TRUE(std::isnan(x));
+        }
+        else
+        {
+            EXPECT_EQ(x, static_cast<float>(reference_value<T>(bits))) << "bits " << bits;
+            EXPECT_EQ(static_cast<float>(type_convert<half_t>(from_bits<T>(bits))), x);
+        }
+    }
+}
+
+template <typename T>
+void test_from_float()
+{
+    for(const float x : make_float_values<T>(0x10003))
+    {
+        const int expected = std::isnan(x) ? 0x80 : reference_round<T>(x);
+
+        const uint8_t saturated     = to_bits(type_convert<T>(x));
+        const uint8_t not_saturated = to_bits(ck::f8_convert_no_saturate<T>(x));
+
+        if(expected < 0)
+        {
+            EXPECT_EQ(saturated, x > 0 ? 0x7f : 0xff) << "x " << x;
+            EXPECT_EQ(not_saturated, 0x80) << "x " << x;
+        }
+        else
+        {
+            EXPECT_EQ(saturated, expected) << "x " << x;
+            EXPECT_EQ(not_saturated, expected) << "x " << x;
+        }
+    }
+}
+
+template <typename T>
+void test_stochastic_rounding()
+{
+    std::mt19937 gen(1234);
+
+    constexpr int num_sample = 1 << 16;
+
+    for(const float x : {0.3f, -1.1f, 7.7f, 0.001f, -13.3f})
+    {
+        // the values around x, rounded toward and away from zero
+        const float toward = type_convert<float>(ck::f8_convert_sr<T>(x, 0));
+        const float away   = type_convert<float>(ck::f8_convert_sr<T>(x, 0xffffffff));
+
+        ASSERT_NE(toward, away) << "x " << x;
+
+        double sum = 0;
+
+        for(int i = 0; i < num_sample; ++i)
+        {
+            const float y = type_convert<float>(ck::f8_convert_sr<T>(x, gen()));
+
+            EXPECT_TRUE(y == toward || y == away) << "x " << x << " y " << y;
+
+            sum += y;
+        }
+
+        // unbiased, within a few standard deviations of at most half the spacing
+        const double spacing = std::abs(away - toward);
+
+        EXPECT_NEAR(sum / num_sample, x, 4 * spacing / std::sqrt(num_sample)) << "x " << x;
+    }
+
+    // exact values are kept whatever the random number
+    for(const uint32_t rng : {0U, 0x80000000U, 0xffffffffU})
+    {
+        EXPECT_EQ(type_convert<float>(ck::f8_convert_sr<T>(1.5f, rng)), 1.5f);
+        EXPECT_EQ(to_bits(ck::f8_convert_sr<T>(half_t{-2}, rng)), to_bits(type_convert<T>(-2.f)));
+    }
+
+    // values out of range saturate
+    EXPECT_EQ(to_bits(ck::f8_convert_sr<T>(1e20f, 0xffffffff)), 0x7f);
+}
+
+// the number of floats whose bulk conversion differs in bits from type_convert
+template <typename T>
+std::size_t count_mismatches(const std::vector<float>& values)
+{
+    std::vector<T> bulk(values.size());
+
+    ck::utils::bulk_type_convert(values.data(), bulk.data(), values.size());
+
+    std::size_t num_mismatch = 0;
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        num_mismatch += to_bits(bulk[i]) != to_bits(type_convert<T>(values[i]));
+    }
+
+    return num_mismatch;
+}
+
+template <typename T>
+void test_bulk()
+{
+    EXPECT_EQ(count_mismatches<T>(make_float_values<T>(0x1003)), std::size_t{0});
+
+    std::vector<T> all(256);
+    std::vector<float> all_float(256);
+
+    for(uint32_t bits = 0; bits < 256; ++bits)
+    {
+        all[bits] = from_bits<T>(bits);
+    }
+
+    ck::utils::bulk_type_convert(all.data(), all_float.data(), all.size());
+
+    for(uint32_t bits = 0; bits < 256; ++bits)
+    {
+        const float x = type_convert<float>(all[bits]);
+
+        EXPECT_TRUE(all_float[bits] == x || (std::isnan(x) && std::isnan(all_float[bits])));
+    }
+}
+
+} // namespace
+
+TEST(FP8, ToFloat)
+{
+    test_to_float<f8_t>();
+    test_to_float<bf8_t>();
+}
+
+TEST(FP8, FromFloat)
+{
+    test_from_float<f8_t>();
+    test_from_float<bf8_t>();
+
+    // there is no negative zero
+    EXPECT_EQ(to_bits(type_convert<f8_t>(-0.f)), 0);
+    EXPECT_EQ(to_bits(type_convert<bf8_t>(-1e-30f)), 0);
+}
+
+TEST(FP8, FromHalf)
+{
+    for(uint32_t bits = 0; bits < 0x10000; ++bits)
+    {
+        const half_t x = ck::bit_cast<half_t>(static_cast<uint16_t>(bits));
+
+        EXPECT_EQ(to_bits(type_convert<f8_t>(x)), to_bits(type_convert<f8_t>(float(x))));
+        EXPECT_EQ(to_bits(type_convert<bf8_t>(x)), to_bits(type_convert<bf8_t>(float(x))));
+    }
+}
+
+TEST(FP8, StochasticRounding)
+{
+    test_stochastic_rounding<f8_t>();
+    test_stochastic_rounding<bf8_t>();
+}
+
+TEST(FP8, NumericLimits)
+{
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<f8_t>::Max()), 240.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<f8_t>::Lowest()), -240.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<f8_t>::Min()), std::ldexp(1.f, -7));
+    EXPECT_TRUE(std::isnan(type_convert<float>(ck::NumericLimits<f8_t>::QuietNaN())));
+
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<bf8_t>::Max()), 57344.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<bf8_t>::Lowest()), -57344.f);
+    EXPECT_EQ(type_convert<float>(ck::NumericLimits<bf8_t>::Min()), std::ldexp(1.f, -15));
+    EXPECT_TRUE(std::isnan(type_convert<float>(ck::NumericLimits<bf8_t>::QuietNaN())));
+}
+
+TEST(FP8, VectorType)
+{
+    // the storage types have no arithmetic, and their vectors have the size of the bits
+    static_assert(!std::is_arithmetic_v<f8_t> && !std::is_arithmetic_v<bf8_t>);
+    static_assert(!std::is_same_v<f8_t, bf8_t> && !std::is_same_v<f8_t, int8_t>);
+    static_assert(sizeof(ck::f8x16_t) == 16 && sizeof(ck::bf8x64_t) == 64);
+    static_assert(std::is_same_v<ck::scalar_type<ck::f8x4_t>::type, f8_t>);
+
+    ck::vector_type<f8_t, 4> v;
+
+    v.AsType<f8_t>()(ck::Number<2>{}) = type_convert<f8_t>(1.5f);
+
+    const auto bits = ck::bit_cast<uint32_t>(v.AsType<ck::f8x4_t>()[ck::Number<0>{}]);
+
+    EXPECT_EQ(bits, uint32_t{to_bits(type_convert<f8_t>(1.5f))} << 16);
+}
+
+TEST(FP8, BulkTypeConvert)
+{
+    test_bulk<f8_t>();
+    test_bulk<bf8_t>();
+}
+
+TEST(FP8, CheckErr)
+{
+    std::vector<f8_t> out(100);
+    std::vector<f8_t> ref(100);
+
+    ck::utils::FillUniformDistribution<f8_t>{-10.f, 10.f}(out);
+    ck::utils::FillUniformDistribution<f8_t>{-10.f, 10.f}(ref);
+
+    EXPECT_TRUE(ck::utils::check_err(out, ref));
+
+    out[17] = type_convert<f8_t>(type_convert<float>(out[17]) + 1.f);
+
+    EXPECT_FALSE(ck::utils::check_err(out, ref, "expected error"));
+    EXPECT_TRUE(ck::utils::check_err(out, ref, "", 0, 1.f));
+}
+
+TEST(FP8, Generator)
+{
+    Tensor<bf8_t> a(std::vector<std::size_t>{13, 17});
+
+    a.GenerateTensorValue(GeneratorTensor_2<bf8_t>{-5, 5});
+
+    for(const bf8_t x : a.mData)
+    {
+        const float v = type_convert<float>(x);
+
+        EXPECT_EQ(v, std::round(v));
+        EXPECT_GE(v, -5.f);
+        EXPECT_LT(v, 5.f);
+    }
+
+    a.GenerateTensorValue(GeneratorTensor_1<bf8_t>{});
+
+    EXPECT_EQ(type_convert<float>(a(3, 4)), 1.f);
+}
+
+TEST(FP8, ReferenceGemm)
+{
+    constexpr std::size_t M = 19;
+    constexpr std::size_t N = 23;
+    constexpr std::size_t K = 37;
+
+    Tensor<f8_t> a_m_k(std::vector<std::size_t>{M, K});
+    Tensor<bf8_t> b_k_n(std::vector<std::size_t>{K, N});
+
+    ck::utils::FillUniformDistribution<f8_t>{-2.f, 2.f}(a_m_k);
+    ck::utils::FillUniformDistribution<bf8_t>{-2.f, 2.f}(b_k_n);
+
+    Tensor<float> c_m_n(std::vector<std::size_t>{M, N});
+    Tensor<f8_t> c_m_n_f8(std::vector<std::size_t>{M, N});
+    Tensor<float> c_m_n_ref(std::vector<std::size_t>{M, N});
+
+    const auto a_m_k_float = a_m_k.CopyAsType<float>();
+    const auto b_k_n_float = b_k_n.CopyAsType<float>();
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::
+        ReferenceGemm<f8_t, bf8_t, float, float, PassThrough, PassThrough, PassThrough>;
+    using ReferenceGemmF8OutInstance = ck::tensor_operation::host::
+        ReferenceGemm<f8_t, bf8_t, f8_t, float, PassThrough, PassThrough, PassThrough>;
+    using ReferenceGemmFloatInstance = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto argument = ReferenceGemmInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_f8 = ReferenceGemmF8OutInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n_f8, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_ref = ReferenceGemmFloatInstance::MakeArgument(
+        a_m_k_float, b_k_n_float, c_m_n_ref, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemmInstance::MakeInvoker().Run(argument);
+    ReferenceGemmF8OutInstance::MakeInvoker().Run(argument_f8);
+    ReferenceGemmFloatInstance::MakeInvoker().Run(argument_ref);
+
+    EXPECT_EQ(c_m_n.mData, c_m_n_ref.mData);
+    EXPECT_TRUE(ck::utils::check_err(c_m_n_f8, c_m_n_ref.CopyAsType<f8_t>()));
+}
+
+TEST(FP8, ReferenceBatchedGemm)
+{
+    constexpr std::size_t G = 3;
+    constexpr std::size_t M = 7;
+    constexpr std::size_t N = 9;
+    constexpr std::size_t K = 11;
+
+    Tensor<bf8_t> a_g_m_k(std::vector<std::size_t>{G, M, K});
+    Tensor<f8_t> b_g_k_n(std::vector<std::size_t>{G, K, N});
+
+    ck::utils::FillUniformDistribution<bf8_t>{-2.f, 2.f}(a_g_m_k);
+    ck::utils::FillUniformDistribution<f8_t>{-2.f, 2.f}(b_g_k_n);
+
+    Tensor<bf8_t> c_g_m_n(std::vector<std::size_t>{G, M, N});
+    Tensor<float> c_g_m_n_ref(std::vector<std::size_t>{G, M, N});
+
+    const auto a_g_m_k_float = a_g_m_k.CopyAsType<float>();
+    const auto b_g_k_n_float = b_g_k_n.CopyAsType<float>();
+
+    using ReferenceBatchedGemmInstance = ck::tensor_operation::host::
+        ReferenceBatchedGemm<bf8_t, f8_t, bf8_t, float, PassThrough, PassThrough, PassThrough>;
+    using ReferenceBatchedGemmFloatInstance = ck::tensor_operation::host::
+        ReferenceBatchedGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto argument = ReferenceBatchedGemmInstance::MakeArgument(
+        a_g_m_k, b_g_k_n, c_g_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+    auto argument_ref = ReferenceBatchedGemmFloatInstance::MakeArgument(
+        a_g_m_k_float, b_g_k_n_float, c_g_m_n_ref, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceBatchedGemmInstance::MakeInvoker().Run(argument);
+    ReferenceBatchedGemmFloatInstance::MakeInvoker().Run(argument_ref);
+
+    EXPECT_TRUE(ck::utils::check_err(c_g_m_n, c_g_m_n_ref.CopyAsType<bf8_t>()));
+}
+
+// all the floats, run with --gtest_also_run_disabled_tests
+TEST(FP8, DISABLED_AllFloats)
+{
+    std::vector<float> values(std::size_t{1} << 24);
+
+    for(uint64_t begin = 0; begin <= 0xffffffff; begin += values.size())
+    {
+        for(std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = float_from_bits(begin + i);
+        }
+
+        EXPECT_EQ(count_mismatches<f8_t>(values), std::size_t{0});
+        EXPECT_EQ(count_mismatches<bf8_t>(values), std::size_t{0});
+    }
+}
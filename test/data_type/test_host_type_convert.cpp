@@ -0,0 +1,220 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_type_convert.hpp"
+
+using ck::bhalf_t;
+using ck::half_t;
+
+namespace {
+
+template <typename T>
+auto to_bits(T x)
+{
+    using Bits = std::conditional_t<sizeof(T) == 4,
+                                    uint32_t,
+                                    std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>;
+
+    Bits bits;
+
+    std::memcpy(&bits, &x, sizeof(T));
+
+    return bits;
+}
+
+template <typename T>
+T from_bits(uint64_t bits)
+{
+    T x;
+
+    std::memcpy(&x, &bits, sizeof(T));
+
+    return x;
+}
+
+// the number of elements whose bulk conversion differs in bits from type_convert
+template <typename Y, typename X>
+std::size_t count_mismatches(const std::vector<X>& src)
+{
+    std::vector<Y> dst(src.size());
+
+    ck::utils::bulk_type_convert(src.data(), dst.data(), src.size());
+
+    std::size_t num_mismatch = 0;
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+    {
+        if(to_bits(dst[i]) != to_bits(ck::type_convert<Y>(src[i])))
+        {
+            ++num_mismatch;
+        }
+    }
+
+    return num_mismatch;
+}
+
+// every bit pattern of a 16-bit or 8-bit type
+template <typename T>
+std::vector<T> make_all_values()
+{
+    std::vector<T> values;
+
+    for(uint64_t bits = 0; bits < (uint64_t{1} << (8 * sizeof(T))); ++bits)
+    {
+        values.push_back(from_bits<T>(bits));
+    }
+
+    return values;
+}
+
+// floats spread over all the bit patterns, with the rounding ties and the NaN of 16-bit types
+std::vector<float> make_float_values(uint32_t stride)
+{
+    std::vector<float> values;
+
+    for(uint64_t bits = 0; bits <= 0xffffffff; bits += stride)
+    {
+        values.push_back(from_bits<float>(bits));
+    }
+
+    for(const uint32_t sign : {0x00000000U, 0x80000000U})
+    {
+        for(const uint32_t bits : {0x00008000U, // bhalf_t tie, rounded to even 0
+                                   0x00018000U, // bhalf_t tie, rounded to even 2
+                                   0x3f808000U,
+                                   0x3f818000U,
+                                   0x7f7f8000U, // rounded to Inf
+                                   0x7f800000U, // Inf
+                                   0x7f800001U, // signaling NaN, lower bits only
+                                   0x7f810000U,
+                                   0x7fc00000U, // quiet NaN
+                                   0x33000000U, // half_t tie, rounded to even 0
+                                   0x33000001U,
+                                   0x387fc000U, // half_t subnormal
+                                   0x477ff000U, // half_t tie, rounded to Inf
+                                   0x3f801000U})
+        {
+            values.push_back(from_bits<float>(sign | bits));
+        }
+    }
+
+    return values;
+}
+
+} // namespace
+
+TEST(HostTypeConvert, Half)
+{
+    EXPECT_EQ((count_mismatches<half_t>(make_float_values(251))), std::size_t{0});
+    EXPECT_EQ((count_mismatches<float>(make_all_values<half_t>())), std::size_t{0});
+}
+
+TEST(HostTypeConvert, BHalf)
+{
+    EXPECT_EQ((count_mismatches<bhalf_t>(make_float_values(251))), std::size_t{0});
+    EXPECT_EQ((count_mismatches<float>(make_all_values<bhalf_t>())), std::size_t{0});
+}
+
+TEST(HostTypeConvert, Int8)
+{
+    std::vector<float> values;
+
+    for(float x = -128.75f; x < 128.f; x += 0.125f)
+    {
+        values.push_back(x);
+    }
+
+    EXPECT_EQ((count_mismatches<int8_t>(values)), std::size_t{0});
+    EXPECT_EQ((count_mismatches<float>(make_all_values<int8_t>())), std::size_t{0});
+}
+
+TEST(HostTypeConvert, Tail)
+{
+    const auto values = make_float_values(0x01000193);
+
+    // every length and misalignment around the vector width
+    for(std::size_t offset = 0; offset < 8; ++offset)
+    {
+        for(std::size_t n = 0; n <= 33; ++n)
+        {
+            const std::vector<float> src(values.begin() + offset, values.begin() + offset + n);
+
+            EXPECT_EQ((count_mismatches<half_t>(src)), std::size_t{0});
+            EXPECT_EQ((count_mismatches<bhalf_t>(src)), std::size_t{0});
+        }
+    }
+}
+
+TEST(HostTypeConvert, Parallel)
+{
+    const auto src = make_float_values(1021);
+
+    std::vector<bhalf_t> serial(src.size());
+    std::vector<bhalf_t> parallel(src.size());
+
+    ck::utils::bulk_type_convert(src.data(), serial.data(), src.size());
+    ck::utils::parallel_bulk_type_convert(src.data(), parallel.data(), src.size(), 7);
+
+    EXPECT_EQ(parallel, serial);
+}
+
+TEST(HostTypeConvert, CopyAsType)
+{
+    Tensor<float> a({37, 129});
+
+    ck::utils::FillUniformDistribution<float>{-10.f, 10.f}(a);
+
+    const auto b = a.CopyAsType<half_t>();
+
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+    {
+        EXPECT_EQ(to_bits(b.mData[i]), to_bits(ck::type_convert<half_t>(a.mData[i])));
+    }
+}
+
+TEST(HostTypeConvert, Fill)
+{
+    // a vector takes the bulk path, a list the one-by-one path
+    std::vector<bhalf_t> bulk(3001);
+    std::list<bhalf_t> one_by_one(bulk.size());
+
+    ck::utils::FillUniformDistribution<bhalf_t>{-3.f, 3.f}(bulk);
+    ck::utils::FillUniformDistribution<bhalf_t>{-3.f, 3.f}(one_by_one);
+
+    EXPECT_TRUE(std::equal(bulk.begin(), bulk.end(), one_by_one.begin()));
+
+    std::vector<int8_t> bulk_int(3001);
+    std::list<int8_t> one_by_one_int(bulk_int.size());
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-5.f, 5.f}(bulk_int);
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-5.f, 5.f}(one_by_one_int);
+
+    EXPECT_TRUE(std::equal(bulk_int.begin(), bulk_int.end(), one_by_one_int.begin()));
+}
+
+// all the floats, run with --gtest_also_run_disabled_tests
+TEST(HostTypeConvert, DISABLED_AllFloats)
+{
+    std::vector<float> values(std::size_t{1} << 24);
+
+    for(uint64_t begin = 0; begin <= 0xffffffff; begin += values.size())
+    {
+        for(std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = from_bits<float>(begin + i);
+        }
+
+        EXPECT_EQ((count_mismatches<half_t>(values)), std::size_t{0});
+        EXPECT_EQ((count_mismatches<bhalf_t>(values)), std::size_t{0});
+    }
+}
@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_packed_int4.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/packed_int4_tensor.hpp"
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+namespace {
+
+// every int4 value, in an order with no period of 2
+std::vector<int8_t> make_int4_values(std::size_t n)
+{
+    std::vector<int8_t> values(n);
+
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        values[i] = static_cast<int8_t>(static_cast<int>((i * 7 + i / 16) % 16) - 8);
+    }
+
+    return values;
+}
+
+// a tensor of lengths {rows, cols} in row or column major order, with a padded leading dimension
+template <typename TensorType>
+TensorType make_matrix(std::size_t rows, std::size_t cols, bool row_major, std::size_t pad)
+{
+    if(row_major)
+    {
+        return TensorType(std::vector<std::size_t>{rows, cols},
+                          std::vector<std::size_t>{cols + pad, 1});
+    }
+    else
+    {
+        return TensorType(std::vector<std::size_t>{rows, cols},
+                          std::vector<std::size_t>{1, rows + pad});
+    }
+}
+
+struct Scale
+{
+    template <typename Y, typename X>
+    void operator()(Y& y, const X& x) const
+    {
+        y = ck::type_convert<Y>(3 * x - 1);
+    }
+};
+
+template <typename AElementwiseOperation, typename BElementwiseOperation>
+void test_gemm(std::size_t M, std::size_t N, std::size_t K, bool a_row_major, bool b_row_major)
+{
+    using ReferenceGemmInstance = ck::tensor_operation::host::
+        ReferenceGemm<int8_t, int8_t, int32_t, int32_t, AElementwiseOperation,
+                      BElementwiseOperation, PassThrough>;
+    using ReferenceGemmPackedInt4Instance = ck::tensor_operation::host::
+        ReferenceGemmPackedInt4<int32_t, int32_t, AElementwiseOperation, BElementwiseOperation,
+                                PassThrough>;
+
+    auto a_m_k = make_matrix<Tensor<int8_t>>(M, K, a_row_major, 3);
+    auto b_k_n = make_matrix<Tensor<int8_t>>(K, N, b_row_major, 1);
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-8.f, 7.f}(a_m_k);
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-5.f, 7.f}(b_k_n);
+
+    Tensor<int32_t> c_m_n(std::vector<std::size_t>{M, N});
+    Tensor<int32_t> c_m_n_packed(std::vector<std::size_t>{M, N});
+
+    auto ref_argument = ReferenceGemmInstance::MakeArgument(
+        a_m_k, b_k_n, c_m_n, AElementwiseOperation{}, BElementwiseOperation{}, PassThrough{});
+
+    ReferenceGemmInstance::MakeInvoker().Run(ref_argument);
+
+    const PackedInt4Tensor a_m_k_packed(a_m_k);
+    const PackedInt4Tensor b_k_n_packed(b_k_n);
+
+    auto argument = ReferenceGemmPackedInt4Instance::MakeArgument(a_m_k_packed,
+                                                                  b_k_n_packed,
+                                                                  c_m_n_packed,
+                                                                  AElementwiseOperation{},
+                                                                  BElementwiseOperation{},
+                                                                  PassThrough{});
+
+    ReferenceGemmPackedInt4Instance::MakeInvoker().Run(argument);
+
+    EXPECT_EQ(c_m_n_packed.mData, c_m_n.mData)
+        << "M " << M << " N " << N << " K " << K << " a_row_major " << a_row_major
+        << " b_row_major " << b_row_major;
+}
+
+} // namespace
+
+TEST(PackedInt4, GetSet)
+{
+    const auto values = make_int4_values(33);
+
+    std::vector<uint8_t> packed(17, 0);
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        ck::utils::set_packed_int4(packed.data(), i, values[i]);
+    }
+
+    for(std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(ck::utils::get_packed_int4(packed.data(), i), values[i]);
+    }
+
+    // only the low 4 bits are kept, as by a conversion to int4_t
+    ck::utils::set_packed_int4(packed.data(), 0, 9);
+    EXPECT_EQ(ck::utils::get_packed_int4(packed.data(), 0), -7);
+    EXPECT_EQ(ck::utils::get_packed_int4(packed.data(), 1), values[1]);
+}
+
+TEST(PackedInt4, PackUnpack)
+{
+    const auto values = make_int4_values(300);
+
+    // every start and length around the vector width, over bytes holding other elements
+    for(std::size_t first = 0; first < 4; ++first)
+    {
+        for(std::size_t n = 0; n <= 140; ++n)
+        {
+            std::vector<uint8_t> packed((first + n + 1) / 2 + 1, 0xa5);
+            std::vector<uint8_t> expected = packed;
+
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                ck::utils::set_packed_int4(expected.data(), first + i, values[i]);
+            }
+
+            ck::utils::pack_int4(values.data(), n, packed.data(), first);
+
+            EXPECT_EQ(packed, expected) << "first " << first << " n " << n;
+
+            std::vector<int8_t> unpacked(n + 1, 42);
+
+            ck::utils::unpack_int4(packed.data(), first, n, unpacked.data());
+
+            EXPECT_TRUE(std::equal(values.begin(), values.begin() + n, unpacked.begin()))
+                << "first " << first << " n " << n;
+            EXPECT_EQ(unpacked[n], 42);
+        }
+    }
+}
+
+TEST(PackedInt4, Tensor)
+{
+    Tensor<int8_t> a(std::vector<std::size_t>{5, 7}, std::vector<std::size_t>{1, 6});
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-8.f, 7.f}(a);
+
+    PackedInt4Tensor a_packed(a);
+
+    EXPECT_EQ(a_packed.GetElementSpaceSize(), std::size_t{41});
+    EXPECT_EQ(a_packed.GetElementSpaceSizeInBytes(), std::size_t{21});
+
+    for(std::size_t m = 0; m < 5; ++m)
+    {
+        for(std::size_t k = 0; k < 7; ++k)
+        {
+            EXPECT_EQ(a_packed(m, k), a(m, k));
+            EXPECT_EQ(std::as_const(a_packed)(m, k), a(m, k));
+        }
+    }
+
+    EXPECT_EQ(a_packed.CopyAsType<int8_t>().mData, a.mData);
+    EXPECT_EQ(a_packed.CopyAsType<float>().mData, a.CopyAsType<float>().mData);
+
+    // writes through the proxy only change their own nibble
+    a_packed(2, 3) = int8_t{-8};
+    a(2, 3)        = -8;
+    a_packed(2, 4) = a_packed(0, 0);
+    a(2, 4)        = a(0, 0);
+
+    EXPECT_EQ(a_packed.CopyAsType<int8_t>().mData, a.mData);
+
+    std::vector<int8_t> column(5);
+
+    a_packed.GetElements(a_packed.mDesc.GetOffsetFromMultiIndex(0, 3), 1, 5, column.data());
+
+    for(std::size_t m = 0; m < 5; ++m)
+    {
+        EXPECT_EQ(column[m], a(m, 3));
+    }
+}
+
+TEST(PackedInt4, Fill)
+{
+    // generators write through the iterators, the same values as into a tensor of int8_t
+    Tensor<int8_t> a(std::vector<std::size_t>{37, 19});
+    PackedInt4Tensor a_packed(std::vector<std::size_t>{37, 19});
+
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-8.f, 7.f}(a);
+    ck::utils::FillUniformDistributionIntegerValue<int8_t>{-8.f, 7.f}(a_packed);
+
+    const auto& a_packed_const = a_packed;
+
+    EXPECT_TRUE(std::equal(a_packed_const.begin(), a_packed_const.end(), a.mData.begin()));
+    EXPECT_EQ(a_packed_const.end() - a_packed_const.begin(), 37 * 19);
+
+    std::fill(a_packed.begin() + 3, a_packed.end() - 2, int8_t{5});
+
+    EXPECT_TRUE(std::all_of(
+        a_packed_const.begin() + 3, a_packed_const.end() - 2, [](int8_t x) { return x == 5; }));
+    EXPECT_EQ(a_packed_const.begin()[2], a.mData[2]);
+    EXPECT_EQ(*(a_packed_const.end() - 1), a.mData.back());
+}
+
+TEST(PackedInt4, ReferenceGemm)
+{
+    for(const bool a_row_major : {true, false})
+    {
+        for(const bool b_row_major : {true, false})
+        {
+            test_gemm<PassThrough, PassThrough>(37, 21, 67, a_row_major, b_row_major);
+            test_gemm<PassThrough, PassThrough>(16, 8, 128, a_row_major, b_row_major);
+            test_gemm<PassThrough, PassThrough>(1, 3, 1, a_row_major, b_row_major);
+            test_gemm<Scale, PassThrough>(19, 5, 33, a_row_major, b_row_major);
+        }
+    }
+}
@@ -62,22 +62,22 @@ using gemm_f16_nn_128x64 = std::tuple<
 
 void add_gemm_f16_nn_256x256(std::vector<std::unique_ptr<BaseOperator>>& instances)
 {
-    add_device_operation_instances(instances, gemm_f16_nn_256x256{});
+    add_device_operation_instances<gemm_f16_nn_256x256>(instances);
 }
 
 void add_gemm_f16_nn_256x128(std::vector<std::unique_ptr<BaseOperator>>& instances)
 {
-    add_device_operation_instances(instances, gemm_f16_nn_256x128{});
+    add_device_operation_instances<gemm_f16_nn_256x128>(instances);
 }
 
 void add_gemm_f16_nn_128x128(std::vector<std::unique_ptr<BaseOperator>>& instances)
 {
-    add_device_operation_instances(instances, gemm_f16_nn_128x128{});
+    add_device_operation_instances<gemm_f16_nn_128x128>(instances);
 }
 
 void add_gemm_f16_nn_128x64(std::vector<std::unique_ptr<BaseOperator>>& instances)
 {
-    add_device_operation_instances(instances, gemm_f16_nn_128x64{});
+    add_device_operation_instances<gemm_f16_nn_128x64>(instances);
 }
 
 } // namespace instance
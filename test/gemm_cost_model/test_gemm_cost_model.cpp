@@ -0,0 +1,264 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/gemm_cost_model.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::BlockTileDescriptor;
+using ck::tensor_operation::device::GemmInstanceMetadata;
+using ck::tensor_operation::device::GemmSpecialization;
+using ck::utils::GemmCostModel;
+using ck::utils::GemmCostModelCoefficients;
+using ck::utils::GemmCostSample;
+using ck::utils::GemmProblemDescriptor;
+
+namespace {
+
+GemmInstanceMetadata make_metadata(index_t block_size,
+                                   index_t m_per_block,
+                                   index_t n_per_block,
+                                   index_t k_per_block,
+                                   GemmSpecialization gemm_spec = GemmSpecialization::Default,
+                                   index_t num_prefetch         = 1)
+{
+    using namespace ck::tensor_operation::device;
+
+    return GemmInstanceMetadata{
+        true,
+        BlockTileDescriptor{
+            block_size, m_per_block, n_per_block, k_per_block, num_prefetch, 1, false},
+        gemm_spec,
+        is_m_padded(gemm_spec),
+        is_n_padded(gemm_spec),
+        is_k_padded(gemm_spec),
+        8,
+        8,
+        true,
+        true,
+        8,
+        true,
+        8,
+        8};
+}
+
+GemmCostModel make_gfx90a_model(const GemmCostModelCoefficients& coefficients = {})
+{
+    return GemmCostModel{ck::utils::get_gemm_device_descriptor("gfx90a", 2), coefficients};
+}
+
+} // namespace
+
+TEST(GemmCostModel, WaveQuantization)
+{
+    const auto model = make_gfx90a_model();
+
+    // 15 x 32 tiles over 110 CUs with 2 resident workgroups each: 3 waves, the last one partial
+    const auto features = model.GetFeatures(make_metadata(256, 256, 128, 32),
+                                            GemmProblemDescriptor{3840, 4096, 4096});
+
+    EXPECT_EQ(features.num_tile_, 480);
+    EXPECT_EQ(features.block_per_cu_, 2);
+    EXPECT_EQ(features.num_wave_, 3);
+    EXPECT_EQ(features.num_k_loop_, 128);
+    EXPECT_DOUBLE_EQ(features.wave_efficiency_, 480. / 660.);
+    EXPECT_DOUBLE_EQ(features.padding_efficiency_, 1.);
+    EXPECT_DOUBLE_EQ(features.roofline_us_,
+                     std::max({features.compute_us_,
+                               features.lds_us_,
+                               features.l2_us_,
+                               features.dram_us_}));
+}
+
+TEST(GemmCostModel, PaddingWaste)
+{
+    const auto model = make_gfx90a_model();
+
+    const auto padded = make_metadata(256, 256, 128, 32, GemmSpecialization::MNKPadding);
+
+    const auto features = model.GetFeatures(padded, GemmProblemDescriptor{257, 136, 40});
+
+    EXPECT_EQ(features.num_tile_, 4);
+    EXPECT_EQ(features.num_k_loop_, 2);
+    EXPECT_DOUBLE_EQ(features.padding_efficiency_, (257. * 136. * 40.) / (512. * 256. * 64.));
+
+    // the unpadded instance does not support the problem and is left out of the shortlist
+    const auto ranked = model.Rank(
+        {make_metadata(256, 256, 128, 32), padded}, GemmProblemDescriptor{257, 136, 40}, 10);
+
+    ASSERT_EQ(ranked.size(), 1);
+    EXPECT_EQ(ranked[0].id_, 1);
+}
+
+TEST(GemmCostModel, RankedShortlist)
+{
+    const auto model = make_gfx90a_model();
+
+    const std::vector<GemmInstanceMetadata> metadatas{make_metadata(256, 256, 128, 32),
+                                                      make_metadata(256, 128, 256, 32),
+                                                      GemmInstanceMetadata{},
+                                                      make_metadata(256, 128, 128, 32),
+                                                      make_metadata(128, 128, 64, 32),
+                                                      make_metadata(64, 64, 64, 32)};
+
+    const auto ranked = model.Rank(metadatas, GemmProblemDescriptor{4096, 4096, 4096}, 3);
+
+    ASSERT_EQ(ranked.size(), 3);
+
+    for(std::size_t i = 0; i < ranked.size(); ++i)
+    {
+        EXPECT_NE(ranked[i].id_, 2) << "instances without metadata cannot be ranked";
+        EXPECT_DOUBLE_EQ(ranked[i].time_us_, model.GetTime(ranked[i].features_));
+
+        if(i > 0)
+        {
+            EXPECT_LE(ranked[i - 1].time_us_, ranked[i].time_us_);
+        }
+    }
+}
+
+TEST(GemmCostModel, TileSizeFollowsProblemSize)
+{
+    const auto model = make_gfx90a_model();
+
+    const std::vector<GemmInstanceMetadata> metadatas{make_metadata(256, 256, 128, 32),
+                                                      make_metadata(128, 128, 64, 32)};
+
+    // a large problem fills the device with either tile, the large one moves less data
+    EXPECT_EQ(model.Rank(metadatas, GemmProblemDescriptor{8192, 8192, 8192}, 1)[0].id_, 0);
+
+    // a small problem only fills the device with the small tile
+    EXPECT_EQ(model.Rank(metadatas, GemmProblemDescriptor{1024, 1024, 4096}, 1)[0].id_, 1);
+}
+
+TEST(GemmCostModel, ParseProfilerLog)
+{
+    std::istringstream log{
+        "found 3 instances\n"
+        "Perf:   0.104 ms, 165.2 TFlops, 484.1 GB/s, DeviceGemm_Xdl_CShuffle<256, 256, 128, 32, "
+        "8, 8> LoopScheduler: Default, PipelineVersion: v1\n"
+        "DeviceGemmDl<256, 128, 128, 16, 2> does not support this problem\n"
+        "Perf:   0.121 ms, 142.0 TFlops, 416.1 GB/s, DeviceGemmXdl<256, 128, 128, 4, 8> "
+        "NumPrefetch: 1, LoopScheduler: Default, PipelineVersion: v1\n"
+        "Best Perf for datatype = f16 ALayout =  RowMajor BLayout =  ColumnMajor M = 3840 N = "
+        "4096 K = 4096 StrideA = 4096 StrideB = 4096 StrideC = 4096 : 0.104 ms, 165.2 TFlops, "
+        "484.1 GB/s, DeviceGemm_Xdl_CShuffle<256, 256, 128, 32, 8, 8> LoopScheduler: Default, "
+        "PipelineVersion: v1\n"
+        "Perf:   0.5 ms, 1 TFlops, 1 GB/s, interrupted run\n"};
+
+    const auto records = ck::utils::parse_gemm_profiler_log(log);
+
+    ASSERT_EQ(records.size(), 2);
+
+    EXPECT_EQ(records[0].M_, 3840);
+    EXPECT_EQ(records[0].N_, 4096);
+    EXPECT_EQ(records[0].K_, 4096);
+    EXPECT_DOUBLE_EQ(records[0].time_ms_, 0.104);
+    EXPECT_EQ(records[0].op_name_,
+              "DeviceGemm_Xdl_CShuffle<256, 256, 128, 32, 8, 8> LoopScheduler: Default, "
+              "PipelineVersion: v1");
+    EXPECT_DOUBLE_EQ(records[1].time_ms_, 0.121);
+    EXPECT_EQ(records[1].K_, 4096);
+}
+
+TEST(GemmCostModel, CalibrateOnNoisyTimings)
+{
+    const std::vector<GemmInstanceMetadata> metadatas{
+        make_metadata(256, 256, 128, 32, GemmSpecialization::MNKPadding),
+        make_metadata(256, 128, 128, 32, GemmSpecialization::MNKPadding),
+        make_metadata(128, 128, 64, 32, GemmSpecialization::MNKPadding),
+        make_metadata(64, 64, 64, 32, GemmSpecialization::MNKPadding),
+        make_metadata(256, 128, 128, 64, GemmSpecialization::MNKPadding, 2)};
+
+    // Timings of a made-up device that the model does not describe: after a fixed launch time,
+    // the instances reach a fraction of the peak of 1.9e8 flop/us that grows with the number of
+    // tiles, with up to 10% of noise
+    const std::vector<double> peak_fractions{0.8, 0.75, 0.6, 0.4, 0.85};
+
+    const std::vector<GemmProblemDescriptor> problems{{256, 256, 256},
+                                                      {512, 512, 512},
+                                                      {1000, 1000, 1000},
+                                                      {1024, 1024, 1024},
+                                                      {1024, 1024, 4096},
+                                                      {2048, 2048, 2048},
+                                                      {3840, 4096, 4096},
+                                                      {4096, 4096, 4096},
+                                                      {8192, 8192, 1024},
+                                                      {128, 8192, 8192},
+                                                      {8192, 128, 8192}};
+
+    std::mt19937 gen(1234);
+
+    std::vector<GemmCostSample> samples;
+
+    for(const auto& problem : problems)
+    {
+        for(std::size_t i = 0; i < metadatas.size(); ++i)
+        {
+            const auto& tile = metadatas[i].tile_;
+
+            const double num_tile = std::ceil(double(problem.M_) / tile.m_per_block_) *
+                                    std::ceil(double(problem.N_) / tile.n_per_block_);
+            const double flop     = 2. * problem.M_ * problem.N_ * problem.K_;
+            const double fraction = peak_fractions[i] * std::sqrt(std::min(1., num_tile / 220));
+            const double noise    = 0.9 + 0.2 * gen() / double(std::mt19937::max());
+
+            samples.push_back(
+                GemmCostSample{metadatas[i], problem, (12 + flop / (fraction * 1.9e8)) * noise});
+        }
+    }
+
+    const auto get_mean_relative_error = [&](const GemmCostModel& model) {
+        double error = 0;
+
+        for(const auto& sample : samples)
+        {
+            error += std::abs(model.EstimateTime(sample.metadata_, sample.problem_) -
+                              sample.time_us_) /
+                     sample.time_us_;
+        }
+
+        return error / samples.size();
+    };
+
+    auto model = make_gfx90a_model();
+
+    const double default_error = get_mean_relative_error(model);
+
+    model.Calibrate(samples);
+
+    const auto& coefficients = model.GetCoefficients();
+
+    EXPECT_GE(coefficients.launch_us_, 0);
+    EXPECT_GE(coefficients.roofline_, 0);
+    EXPECT_GE(coefficients.k_loop_us_, 0);
+    EXPECT_GE(coefficients.tile_wave_us_, 0);
+
+    EXPECT_LT(get_mean_relative_error(model), default_error);
+    EXPECT_LT(get_mean_relative_error(model), 0.15);
+
+    // the instance ranked first is close to the fastest one, within the noise
+    for(std::size_t p = 0; p < problems.size(); ++p)
+    {
+        const auto begin = samples.begin() + p * metadatas.size();
+
+        const double best_time =
+            std::min_element(begin, begin + metadatas.size(), [](const auto& a, const auto& b) {
+                return a.time_us_ < b.time_us_;
+            })->time_us_;
+
+        const auto ranked = model.Rank(metadatas, problems[p], 1);
+
+        ASSERT_EQ(ranked.size(), 1);
+        EXPECT_LT(begin[ranked[0].id_].time_us_, 1.2 * best_time) << "problem " << p;
+    }
+
+    EXPECT_THROW(model.Calibrate(std::vector<GemmCostSample>(samples.begin(), samples.begin() + 3)),
+                 std::runtime_error);
+}
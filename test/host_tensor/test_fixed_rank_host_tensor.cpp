@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/fixed_rank_host_tensor.hpp"
+
+TEST(FixedRankHostTensorDescriptor, SameAsDynamicRank)
+{
+    const HostTensorDescriptor dynamic_desc({3, 4, 5}, {41, 1, 8});
+
+    const FixedRankHostTensorDescriptor<3> desc(dynamic_desc);
+
+    EXPECT_EQ(desc.GetElementSize(), dynamic_desc.GetElementSize());
+    EXPECT_EQ(desc.GetElementSpaceSize(), dynamic_desc.GetElementSpaceSize());
+
+    for(const auto [index, offset] : dynamic_desc.GetIndexRange())
+    {
+        EXPECT_EQ(desc.GetOffsetFromMultiIndex(index[0], index[1], index[2]), offset);
+        EXPECT_EQ(desc.GetOffsetFromMultiIndex({index[0], index[1], index[2]}), offset);
+    }
+
+    // and back
+    const HostTensorDescriptor converted = desc;
+
+    EXPECT_EQ(converted.GetLengths(), dynamic_desc.GetLengths());
+    EXPECT_EQ(converted.GetStrides(), dynamic_desc.GetStrides());
+
+    // packed strides
+    const FixedRankHostTensorDescriptor<3> packed({3, 4, 5});
+
+    EXPECT_EQ(packed.GetStrides(), (std::array<std::size_t, 3>{20, 5, 1}));
+    EXPECT_EQ(packed.GetElementSpaceSize(), std::size_t{60});
+
+    EXPECT_THROW(FixedRankHostTensorDescriptor<2>{dynamic_desc}, std::runtime_error);
+}
+
+TEST(FixedRankTensor, Access)
+{
+    Tensor<int> dynamic_tensor({4, 3, 5}, {1, 20, 4});
+
+    dynamic_tensor.ForEach([](auto& self, const auto& idx) {
+        self(idx) = static_cast<int>(idx[0] * 100 + idx[1] * 10 + idx[2]);
+    });
+
+    FixedRankTensor<int, 3> t(dynamic_tensor);
+
+    int count = 0;
+
+    t.ForEach([&](auto& self, const auto& idx) {
+        EXPECT_EQ(self(idx), dynamic_tensor(idx[0], idx[1], idx[2]));
+        EXPECT_EQ(self(idx[0], idx[1], idx[2]),
+                  static_cast<int>(idx[0] * 100 + idx[1] * 10 + idx[2]));
+        ++count;
+    });
+
+    EXPECT_EQ(count, 4 * 3 * 5);
+
+    t.GenerateTensorValue(
+        [](auto i0, auto i1, auto i2) { return -static_cast<int>(i0 + i1 + i2); }, 3);
+
+    const Tensor<int> back = t.ToTensor();
+
+    EXPECT_EQ(back.mDesc.GetStrides(), dynamic_tensor.mDesc.GetStrides());
+
+    back.ForEach([&](const auto& self, const auto& idx) {
+        EXPECT_EQ(self(idx), -static_cast<int>(idx[0] + idx[1] + idx[2]));
+    });
+
+    std::atomic<int> sum{0};
+
+    const FixedRankTensor<int, 3>& ct = t;
+
+    ct.ParallelForEach([&](const auto& self, const auto& idx) { sum += self(idx); }, 4);
+
+    // sum of i0 + i1 + i2 over all elements: 3 * 5 * 6 + 4 * 5 * 3 + 4 * 3 * 10
+    EXPECT_EQ(sum, -(90 + 60 + 120));
+}
+
+TEST(FixedRankTensor, ForEachWithOffset)
+{
+    FixedRankTensor<int, 3> t({4, 3, 5}, {1, 20, 4});
+
+    int i = 0;
+
+    // row-major order of the lengths, whatever the strides
+    t.ForEach([&](auto& self, const auto& idx, std::size_t offset) {
+        EXPECT_EQ(offset, self.mDesc.GetOffsetFromMultiIndex(idx));
+        EXPECT_EQ(static_cast<int>((idx[0] * 3 + idx[1]) * 5 + idx[2]), i++);
+        self.mData[offset] = static_cast<int>(offset);
+    });
+
+    EXPECT_EQ(i, 4 * 3 * 5);
+
+    std::atomic<int> count{0};
+
+    t.ParallelForEach(
+        [&](const auto& self, const auto& idx, std::size_t offset) {
+            EXPECT_EQ(self(idx), static_cast<int>(offset));
+            ++count;
+        },
+        7);
+
+    EXPECT_EQ(count, 4 * 3 * 5);
+}
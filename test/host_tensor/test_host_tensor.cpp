@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace {
+
+// row-major multi-index of the element-th element
+std::vector<std::size_t> get_index(const std::vector<std::size_t>& lens, std::size_t element)
+{
+    std::vector<std::size_t> idx(lens.size());
+
+    for(std::size_t i = lens.size(); i-- > 0;)
+    {
+        idx[i] = element % lens[i];
+        element /= lens[i];
+    }
+
+    return idx;
+}
+
+} // namespace
+
+TEST(HostTensorIndexRange, IndexAndOffset)
+{
+    // permuted, padded strides
+    const HostTensorDescriptor desc({3, 4, 5, 2}, {7, 100, 1, 401});
+
+    std::size_t element = 0;
+
+    for(const auto [index, offset] : desc.GetIndexRange())
+    {
+        const auto expected = get_index(desc.GetLengths(), element);
+
+        ASSERT_EQ(index.size(), expected.size());
+        EXPECT_TRUE(std::equal(index.begin(), index.end(), expected.begin()));
+        EXPECT_EQ(offset, desc.GetOffsetFromMultiIndex(expected));
+
+        ++element;
+    }
+
+    EXPECT_EQ(element, desc.GetElementSize());
+
+    // a sub-range starts in the middle of the lengths
+    element = 37;
+
+    for(const auto [index, offset] : desc.GetIndexRange(37, 95))
+    {
+        EXPECT_EQ(offset, desc.GetOffsetFromMultiIndex(get_index(desc.GetLengths(), element)));
+
+        ++element;
+    }
+
+    EXPECT_EQ(element, std::size_t{95});
+    EXPECT_EQ(desc.GetIndexRange(37, 95).size(), std::size_t{58});
+}
+
+TEST(HostTensorIndexRange, Empty)
+{
+    const HostTensorDescriptor desc({3, 0, 5});
+
+    EXPECT_TRUE(desc.GetIndexRange().begin() == desc.GetIndexRange().end());
+
+    // a rank-0 tensor has a single element
+    const HostTensorDescriptor scalar(std::vector<std::size_t>{});
+
+    EXPECT_EQ(scalar.GetIndexRange().size(), std::size_t{1});
+    EXPECT_EQ((*scalar.GetIndexRange().begin()).offset, std::size_t{0});
+}
+
+TEST(HostTensor, ForEach)
+{
+    Tensor<int> t({4, 3, 5}, {1, 20, 4});
+
+    int i = 0;
+
+    t.ForEach([&](auto& self, const auto& idx) { self(idx) = i++; });
+
+    const Tensor<int>& ct = t;
+
+    i = 0;
+
+    ct.ForEach([&](const auto& self, const auto& idx) {
+        EXPECT_EQ(self(idx), i);
+        EXPECT_EQ(idx, get_index(t.GetLengths(), static_cast<std::size_t>(i)));
+        ++i;
+    });
+
+    EXPECT_EQ(i, 4 * 3 * 5);
+}
+
+TEST(HostTensor, ForEachWithOffset)
+{
+    Tensor<int> t({4, 3, 5}, {1, 20, 4});
+
+    t.ForEach([&](auto& self, const auto& idx, std::size_t offset) {
+        EXPECT_EQ(offset, self.mDesc.GetOffsetFromMultiIndex(idx));
+        self.mData[offset] = static_cast<int>(offset);
+    });
+
+    std::atomic<int> count{0};
+
+    t.ParallelForEach(
+        [&](const auto& self, const auto& idx, std::size_t offset) {
+            EXPECT_EQ(self(idx), static_cast<int>(offset));
+            ++count;
+        },
+        3);
+
+    EXPECT_EQ(count, 4 * 3 * 5);
+}
+
+TEST(HostTensor, ParallelForEach)
+{
+    Tensor<int> t({7, 3, 2, 5});
+
+    t.ParallelForEach(
+        [&](auto& self, const auto& idx) {
+            self(idx) = static_cast<int>(t.mDesc.GetOffsetFromMultiIndex(idx));
+        },
+        4);
+
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+    {
+        EXPECT_EQ(t.mData[i], static_cast<int>(i));
+    }
+
+    // more threads than elements
+    std::atomic<int> count{0};
+
+    const Tensor<int>& ct = t;
+
+    ct.ParallelForEach([&](const auto&, const auto&) { ++count; }, 1000);
+
+    EXPECT_EQ(count, 7 * 3 * 2 * 5);
+}
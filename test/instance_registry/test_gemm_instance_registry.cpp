@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <set>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_registry.hpp"
+
+using F16         = ck::half_t;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using DeviceOp = ck::tensor_operation::device::
+    DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+using Factory  = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>;
+using Registry = ck::tensor_operation::device::instance::DeviceOperationInstanceRegistry<DeviceOp>;
+
+TEST(GemmInstanceRegistry, DescriptorsMatchEagerInstances)
+{
+    const auto op_ptrs   = Factory::GetInstances();
+    const auto& op_descs = Registry::GetDescriptors();
+
+    ASSERT_EQ(op_ptrs.size(), op_descs.size());
+
+    for(std::size_t i = 0; i < op_descs.size(); ++i)
+    {
+        EXPECT_EQ(op_descs[i].id_, i);
+        EXPECT_EQ(op_descs[i].type_string_, op_ptrs[i]->GetTypeString());
+        EXPECT_EQ(op_descs[i].MakeInstance()->GetTypeString(), op_ptrs[i]->GetTypeString());
+        EXPECT_EQ(Registry::MakeInstance(i)->GetTypeString(), op_ptrs[i]->GetTypeString());
+    }
+}
+
+TEST(GemmInstanceRegistry, DescriptorListIsCached)
+{
+    EXPECT_EQ(&Registry::GetDescriptors(), &Registry::GetDescriptors());
+    EXPECT_THROW(Registry::MakeInstance(Registry::GetNumInstances()), std::runtime_error);
+}
+
+TEST(GemmInstanceRegistry, FilterByBlockTile)
+{
+    const auto is_256x128 = [](const auto& op_desc) {
+        return op_desc.tile_.m_per_block_ == 256 && op_desc.tile_.n_per_block_ == 128;
+    };
+
+    const auto selected = Registry::FilterDescriptors(is_256x128);
+    const auto op_ptrs  = Registry::MakeInstances(is_256x128);
+
+    ASSERT_FALSE(selected.empty());
+    ASSERT_EQ(selected.size(), op_ptrs.size());
+
+    for(std::size_t i = 0; i < selected.size(); ++i)
+    {
+        EXPECT_EQ(selected[i]->tile_.m_per_block_, 256);
+        EXPECT_EQ(selected[i]->tile_.n_per_block_, 128);
+        EXPECT_EQ(selected[i]->type_string_, op_ptrs[i]->GetTypeString());
+    }
+}
+
+TEST(GemmInstanceRegistry, FilterByPipeline)
+{
+    std::set<int> pipelines;
+
+    for(const auto& op_desc : Registry::GetDescriptors())
+    {
+        pipelines.insert(op_desc.tile_.pipeline_version_);
+    }
+
+    std::size_t num_selected = 0;
+
+    for(int pipeline : pipelines)
+    {
+        const auto selected = Registry::FilterDescriptors(
+            [&](const auto& op_desc) { return op_desc.tile_.pipeline_version_ == pipeline; });
+
+        num_selected += selected.size();
+    }
+
+    EXPECT_EQ(num_selected, Registry::GetNumInstances());
+}
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_fwd_multiple_d_xdl_cshuffle.hpp"
+#include "ck/library/tensor_operation_instance/gpu/gemm.hpp"
+
+using F16         = ck::half_t;
+using F32         = float;
+using Row         = ck::tensor_layout::gemm::RowMajor;
+using Col         = ck::tensor_layout::gemm::ColumnMajor;
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using ck::tensor_operation::device::ConvFwdInstanceMetadata;
+using ck::tensor_operation::device::GemmInstanceMetadata;
+using ck::tensor_operation::device::GemmSpecialization;
+
+static constexpr auto GemmDefault    = GemmSpecialization::Default;
+static constexpr auto GemmMNKPadding = GemmSpecialization::MNKPadding;
+
+static constexpr auto ConvFwd1x1S1P0 =
+    ck::tensor_operation::device::ConvolutionForwardSpecialization::Filter1x1Stride1Pad0;
+
+// clang-format off
+template <GemmSpecialization GemmSpec, ck::PipelineVersion PipelineVer>
+using DeviceGemmInstance = ck::tensor_operation::device::DeviceGemm_Xdl_CShuffle
+//######| ALayout| BLayout| CLayout| AData| BData| CData| AccData| CShuffle|           A|           B|           C|           GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths|  CBlockTransfer|                 Loop|    Pipeline|
+//######|        |        |        |  Type|  Type|  Type|    Type| DataType| Elementwise| Elementwise| Elementwise| Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|  SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl| ScalarPerVector|            Scheduler|     Version|
+//######|        |        |        |      |      |      |        |         |   Operation|   Operation|   Operation|               |    Stage|      |      |      |      |    |    |     |     | Wave| Wave| Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          | Lengths_K0_N_K1|   ArrangeOrder|               |              |      PerVector|   PerVector_K1|          |  PerShuffle|  PerShuffle|         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl|                     |            |
+//######|        |        |        |      |      |      |        |         |            |            |            |               |         |      |      |      |      |    |    |     |     |     |     |                |               |               |               |               |               |          |                |               |               |              |               |               |          |            |            |                             |                |                     |            |
+        <     Row,     Col,     Row,   F16,   F16,   F16,     F32,      F16, PassThrough, PassThrough, PassThrough,       GemmSpec,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,               S<1, 32, 1, 8>,              8, ck::LoopScheduler::Default, PipelineVer>;
+
+using DeviceConvFwdInstance = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD_Xdl_CShuffle
+//########################################|     NumDim| A| B|          Ds| E| AData| BData| AccData| CShuffle|     Ds| EData|           A|           B|         CDE|    ConvForward|           GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths|  CBlockTransfer|
+//########################################|    Spatial|  |  |            |  |  Type|  Type|    Type| DataType|   Type|  Type| Elementwise| Elementwise| Elementwise| Specialization| Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|  SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl| ScalarPerVector|
+//########################################|           |  |  |            |  |      |      |        |         |       |      |   Operation|   Operation|   Operation|               |               |    Stage|      |      |      |      |    |    |     |     | Wave| Wave| Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          | Lengths_K0_N_K1|   ArrangeOrder|               |              |      PerVector|   PerVector_K1|          |  PerShuffle|  PerShuffle|         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl|
+//########################################|           |  |  |            |  |      |      |        |         |       |      |            |            |            |               |               |         |      |      |      |      |    |    |     |     |     |     |                |               |               |               |               |               |          |                |               |               |              |               |               |          |            |            |                             |                |
+                                         <          2, ck::tensor_layout::convolution::GNHWC, ck::tensor_layout::convolution::GKYXC, ck::Tuple<>, ck::tensor_layout::convolution::GNHWK, F16, F16, F32, F16, ck::Tuple<>, F16, PassThrough, PassThrough, PassThrough, ConvFwd1x1S1P0, GemmMNKPadding, 1, 256, 128, 256, 32, 8, 8, 32, 32, 2, 4, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1, 1, 1, S<1, 32, 1, 8>, 8>;
+// clang-format on
+
+TEST(InstanceMetadata, GemmMetadataMatchesTemplateParameters)
+{
+    using DeviceOp = DeviceGemmInstance<GemmDefault, ck::PipelineVersion::v1>;
+
+    constexpr GemmInstanceMetadata metadata = DeviceOp::InstanceMetadata;
+
+    static_assert(metadata.is_valid_, "metadata is available at compile time");
+
+    EXPECT_EQ(metadata.tile_.block_size_, 256);
+    EXPECT_EQ(metadata.tile_.m_per_block_, 256);
+    EXPECT_EQ(metadata.tile_.n_per_block_, 128);
+    EXPECT_EQ(metadata.tile_.k_per_block_, 32);
+    EXPECT_EQ(metadata.tile_.pipeline_version_, 1);
+    EXPECT_FALSE(metadata.pad_m_ || metadata.pad_n_ || metadata.pad_k_);
+    EXPECT_TRUE(metadata.c_n_contiguous_);
+    EXPECT_EQ(metadata.a_src_scalar_per_vector_, 8);
+    EXPECT_EQ(metadata.c_dst_scalar_per_vector_, 8);
+
+    // the same metadata is reachable through the type-erased interface
+    EXPECT_EQ(DeviceOp{}.GetInstanceMetadata().tile_.m_per_block_, 256);
+}
+
+TEST(InstanceMetadata, GemmPredicate)
+{
+    constexpr auto v1 = DeviceGemmInstance<GemmDefault, ck::PipelineVersion::v1>::InstanceMetadata;
+    constexpr auto v2 = DeviceGemmInstance<GemmDefault, ck::PipelineVersion::v2>::InstanceMetadata;
+    constexpr auto padded =
+        DeviceGemmInstance<GemmMNKPadding, ck::PipelineVersion::v1>::InstanceMetadata;
+
+    static_assert(v1.IsSupportedProblem(3840, 4096, 4096), "evaluated at compile time");
+
+    // tile divisibility
+    EXPECT_TRUE(v1.IsSupportedProblem(256, 128, 32));
+    EXPECT_FALSE(v1.IsSupportedProblem(255, 128, 32));
+    EXPECT_FALSE(v1.IsSupportedProblem(256, 129, 32));
+    EXPECT_FALSE(v1.IsSupportedProblem(256, 128, 48));
+
+    // pipeline v2 needs an even number of K loops
+    EXPECT_TRUE(v2.IsSupportedProblem(256, 128, 64));
+    EXPECT_FALSE(v2.IsSupportedProblem(256, 128, 96));
+
+    // padding relaxes tile divisibility, but not the vector access
+    EXPECT_TRUE(padded.IsSupportedProblem(255, 129, 48));
+    EXPECT_FALSE(padded.IsSupportedProblem(256, 128, 44));
+    EXPECT_FALSE(padded.IsSupportedProblem(256, 130, 48));
+
+    // instances without metadata are never pruned
+    EXPECT_TRUE(GemmInstanceMetadata{}.IsSupportedProblem(1, 1, 1));
+}
+
+TEST(InstanceMetadata, ConvFwdPredicate)
+{
+    constexpr ConvFwdInstanceMetadata<2> metadata = DeviceConvFwdInstance::InstanceMetadata;
+
+    static_assert(metadata.is_valid_, "metadata is available at compile time");
+
+    EXPECT_EQ(metadata.gemm_.tile_.n_per_block_, 256);
+    EXPECT_TRUE(metadata.gemm_.pad_m_ && metadata.gemm_.pad_n_ && metadata.gemm_.pad_k_);
+
+    const std::array<ck::index_t, 2> ones{1, 1};
+    const std::array<ck::index_t, 2> zeros{0, 0};
+    const std::array<ck::index_t, 2> twos{2, 2};
+
+    // G, N, C, Hi, Wi / G, K, C, Y, X / G, N, K, Ho, Wo
+    EXPECT_TRUE(metadata.IsSupportedProblem(
+        {1, 4, 64, 7, 7}, {1, 128, 64, 1, 1}, {1, 4, 128, 7, 7}, ones, zeros, zeros));
+
+    // not a 1x1, stride 1, pad 0 convolution
+    EXPECT_FALSE(metadata.IsSupportedProblem(
+        {1, 4, 64, 7, 7}, {1, 128, 64, 3, 3}, {1, 4, 128, 5, 5}, ones, zeros, zeros));
+    EXPECT_FALSE(metadata.IsSupportedProblem(
+        {1, 4, 64, 7, 7}, {1, 128, 64, 1, 1}, {1, 4, 128, 4, 4}, twos, zeros, zeros));
+    EXPECT_FALSE(metadata.IsSupportedProblem(
+        {1, 4, 64, 7, 7}, {1, 128, 64, 1, 1}, {1, 4, 128, 9, 9}, ones, ones, ones));
+
+    // vector access along C and K
+    EXPECT_FALSE(metadata.IsSupportedProblem(
+        {1, 4, 60, 7, 7}, {1, 128, 60, 1, 1}, {1, 4, 128, 7, 7}, ones, zeros, zeros));
+    EXPECT_FALSE(metadata.IsSupportedProblem(
+        {1, 4, 64, 7, 7}, {1, 100, 64, 1, 1}, {1, 4, 100, 7, 7}, ones, zeros, zeros));
+}
+
+TEST(InstanceMetadata, PruneFactoryInstances)
+{
+    using DeviceOp = ck::tensor_operation::device::
+        DeviceGemm<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>;
+
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    std::size_t num_pruned = 0;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        const auto metadata = op_ptr->GetInstanceMetadata();
+
+        if(!metadata.IsSupportedProblem(1000, 1000, 1000))
+        {
+            ++num_pruned;
+        }
+
+        // every tile-aligned problem with an even number of K loops passes the predicate
+        if(metadata.is_valid_)
+        {
+            const ck::index_t k_per_block = metadata.tile_.k_per_block_;
+
+            EXPECT_TRUE(metadata.IsSupportedProblem(
+                metadata.tile_.m_per_block_ * 8, metadata.tile_.n_per_block_ * 8, k_per_block * 8))
+                << op_ptr->GetTypeString();
+        }
+    }
+
+    // a ragged problem rules out all non-padded instances
+    EXPECT_GT(num_pruned, 0);
+}
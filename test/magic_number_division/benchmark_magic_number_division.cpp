@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+// Host micro-benchmark of magic number division against the built-in division
+//   benchmark_magic_number_division [number of dividends] [number of repeats]
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+
+namespace {
+
+// nanoseconds per division of the fastest repeat, the sum of the quotients keeps the loop alive
+template <typename Divide>
+double time_division(const Divide& divide, std::size_t num_repeat, uint64_t& sum)
+{
+    double best_ns = std::numeric_limits<double>::max();
+
+    for(std::size_t r = 0; r < num_repeat; ++r)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        const std::size_t num = divide(sum);
+
+        const auto stop = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count() / num;
+
+        best_ns = ns < best_ns ? ns : best_ns;
+    }
+
+    return best_ns;
+}
+
+template <typename T>
+void run_benchmark(const std::string& type_name,
+                   const std::vector<T>& divisors,
+                   std::size_t num_dividend,
+                   std::size_t num_repeat)
+{
+    using UT = typename std::make_unsigned<T>::type;
+
+    std::mt19937_64 gen(1234);
+
+    std::vector<T> dividends(num_dividend);
+
+    for(auto& dividend : dividends)
+    {
+        dividend = T(UT(gen()));
+
+        // the built-in division overflows for this pair
+        if(std::is_signed<T>::value && dividend == std::numeric_limits<T>::min())
+        {
+            dividend = 0;
+        }
+    }
+
+    uint64_t sum = 0;
+
+    for(const T d : divisors)
+    {
+        // the divisor is only known at run time, as it is in a kernel argument
+        volatile T volatile_divisor = d;
+
+        const T divisor = volatile_divisor;
+
+        const double builtin_ns = time_division(
+            [&](uint64_t& s) {
+                for(const T dividend : dividends)
+                {
+                    s += UT(dividend / divisor);
+                }
+
+                return dividends.size();
+            },
+            num_repeat,
+            sum);
+
+        T multiplier{};
+        uint32_t shift{};
+
+        ck::tie(multiplier, shift) = ck::MagicDivisionFullRange::CalculateMagicNumbers(divisor);
+
+        const double magic_ns = time_division(
+            [&](uint64_t& s) {
+                for(const T dividend : dividends)
+                {
+                    s += UT(ck::MagicDivisionFullRange::DoMagicDivision(
+                        dividend, multiplier, shift));
+                }
+
+                return dividends.size();
+            },
+            num_repeat,
+            sum);
+
+        std::cout << std::setw(10) << type_name << std::setw(22) << +d << std::setw(12)
+                  << std::fixed << std::setprecision(3) << builtin_ns << std::setw(12)
+                  << magic_ns << std::setw(10) << std::setprecision(2) << builtin_ns / magic_ns
+                  << std::endl;
+    }
+
+    // the quotients of both divisions, so the sum cannot be folded away
+    if(sum == 0)
+    {
+        std::cout << "sum of quotients is 0" << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::size_t num_dividend = 1 << 20;
+    std::size_t num_repeat   = 10;
+
+    if(argc > 1)
+    {
+        num_dividend = std::stoull(argv[1]);
+    }
+
+    if(argc > 2)
+    {
+        num_repeat = std::stoull(argv[2]);
+    }
+
+    std::cout << std::setw(10) << "type" << std::setw(22) << "divisor" << std::setw(12)
+              << "builtin ns" << std::setw(12) << "magic ns" << std::setw(10) << "speedup"
+              << std::endl;
+
+    run_benchmark<uint32_t>(
+        "uint32_t", {3, 7, 641, 65537, 0x7fffffff, 0xfffffffb}, num_dividend, num_repeat);
+    run_benchmark<int32_t>(
+        "int32_t", {3, -7, 641, -65537, 0x7fffffff}, num_dividend, num_repeat);
+    run_benchmark<uint64_t>("uint64_t",
+                            {3, 7, 641, 0x100000001ULL, 0xfffffffffffffffbULL},
+                            num_dividend,
+                            num_repeat);
+    run_benchmark<int64_t>(
+        "int64_t", {3, -7, 641, -0x100000001LL, 0x7fffffffffffffffLL}, num_dividend, num_repeat);
+
+    return 0;
+}
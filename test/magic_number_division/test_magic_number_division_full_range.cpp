@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+
+using ck::MagicDivisionFullRange;
+
+namespace {
+
+// the number of dividends whose magic division differs from the built-in division
+template <typename T>
+std::size_t count_mismatches(T divisor, const std::vector<T>& dividends)
+{
+    T multiplier{};
+    uint32_t shift{};
+
+    ck::tie(multiplier, shift) = MagicDivisionFullRange::CalculateMagicNumbers(divisor);
+
+    std::size_t num_mismatch = 0;
+
+    for(const T dividend : dividends)
+    {
+        // overflows, as the built-in division does
+        if(std::is_signed<T>::value && divisor == T(-1) &&
+           dividend == std::numeric_limits<T>::min())
+        {
+            continue;
+        }
+
+        if(MagicDivisionFullRange::DoMagicDivision(dividend, multiplier, shift) !=
+           dividend / divisor)
+        {
+            ++num_mismatch;
+        }
+    }
+
+    return num_mismatch;
+}
+
+// powers of two, their neighbours and the extremes of T, and their negations for a signed T
+template <typename T>
+std::vector<T> make_edge_values()
+{
+    using UT = typename std::make_unsigned<T>::type;
+
+    std::vector<T> values{0,
+                          1,
+                          2,
+                          3,
+                          std::numeric_limits<T>::max(),
+                          T(std::numeric_limits<T>::max() - 1),
+                          std::numeric_limits<T>::min(),
+                          T(std::numeric_limits<T>::min() + 1)};
+
+    for(uint32_t i = 2; i < sizeof(T) * 8; ++i)
+    {
+        const UT power = UT{1} << i;
+
+        for(const UT value : {UT(power - 1), power, UT(power + 1)})
+        {
+            values.push_back(T(value));
+
+            if(std::is_signed<T>::value)
+            {
+                values.push_back(T(UT{0} - value));
+            }
+        }
+    }
+
+    return values;
+}
+
+// edge values, small values, and random values of every bit width
+template <typename T>
+std::vector<T> make_test_values(std::size_t num_small, std::size_t num_random_per_width)
+{
+    using UT = typename std::make_unsigned<T>::type;
+
+    std::vector<T> values = make_edge_values<T>();
+
+    for(std::size_t i = 1; i <= num_small; ++i)
+    {
+        values.push_back(T(i));
+
+        if(std::is_signed<T>::value)
+        {
+            values.push_back(T(UT{0} - UT(i)));
+        }
+    }
+
+    std::mt19937_64 gen(1234);
+
+    for(uint32_t width = 1; width <= sizeof(T) * 8; ++width)
+    {
+        const UT mask = width == sizeof(T) * 8 ? ~UT{0} : (UT{1} << width) - 1;
+
+        for(std::size_t i = 0; i < num_random_per_width; ++i)
+        {
+            values.push_back(T(UT(gen()) & mask));
+        }
+    }
+
+    return values;
+}
+
+template <typename T>
+void test_divisors_and_dividends(std::size_t num_small, std::size_t num_random_per_width)
+{
+    const auto values = make_test_values<T>(num_small, num_random_per_width);
+
+    for(const T divisor : values)
+    {
+        if(divisor != 0)
+        {
+            EXPECT_EQ(count_mismatches(divisor, values), std::size_t{0})
+                << "divisor " << divisor;
+        }
+    }
+}
+
+// Magic division computes floor(m * n / 2^k) for an unsigned dividend n, which is monotonic in n
+// as the built-in division is: checking the dividends on both sides of every multiple of the
+// divisor checks all the dividends.
+template <typename T>
+void test_all_quotients(T divisor)
+{
+    std::vector<T> dividends{0, std::numeric_limits<T>::max()};
+
+    for(T q = 1; q <= std::numeric_limits<T>::max() / divisor; ++q)
+    {
+        dividends.push_back(q * divisor - 1);
+        dividends.push_back(q * divisor);
+    }
+
+    EXPECT_EQ(count_mismatches(divisor, dividends), std::size_t{0})
+        << "divisor " << divisor;
+}
+
+} // namespace
+
+TEST(MagicNumberDivisionFullRange, UInt32) { test_divisors_and_dividends<uint32_t>(1024, 32); }
+
+TEST(MagicNumberDivisionFullRange, Int32) { test_divisors_and_dividends<int32_t>(1024, 32); }
+
+TEST(MagicNumberDivisionFullRange, UInt64) { test_divisors_and_dividends<uint64_t>(512, 16); }
+
+TEST(MagicNumberDivisionFullRange, Int64) { test_divisors_and_dividends<int64_t>(512, 16); }
+
+TEST(MagicNumberDivisionFullRange, UInt32AllQuotients)
+{
+    for(const uint32_t divisor :
+        {65535U, 65536U, 65537U, 1000003U, 0x7fffffffU, 0x80000000U, 0x80000001U, 0xfffffffeU})
+    {
+        test_all_quotients(divisor);
+    }
+
+    std::mt19937 gen(1234);
+
+    for(int i = 0; i < 64; ++i)
+    {
+        test_all_quotients(std::uniform_int_distribution<uint32_t>(1U << 16, 0xffffffffU)(gen));
+    }
+}
+
+TEST(MagicNumberDivisionFullRange, UInt64AllQuotients)
+{
+    for(const uint64_t divisor :
+        {0xffffffff00000000ULL, 0x8000000000000001ULL, 0xfffffffffffffffeULL, 0xffff00000001ULL})
+    {
+        test_all_quotients(divisor);
+    }
+}
+
+TEST(MagicNumberDivisionFullRange, KnownAtCompileTime)
+{
+    constexpr auto magic_numbers = MagicDivisionFullRange::CalculateMagicNumbers(int32_t{-7});
+
+    constexpr int32_t multiplier = magic_numbers[ck::Number<0>{}];
+    constexpr uint32_t shift     = magic_numbers[ck::Number<1>{}];
+
+    EXPECT_EQ(MagicDivisionFullRange::DoMagicDivision(int32_t{-50}, multiplier, shift), 7);
+    EXPECT_EQ(MagicDivisionFullRange::DoMagicDivision(int32_t{50}, multiplier, shift), -7);
+}
+
+// all the 32-bit dividends, run with --gtest_also_run_disabled_tests
+TEST(MagicNumberDivisionFullRange, DISABLED_UInt32AllDividends)
+{
+    for(const uint32_t divisor : {3U, 7U, 641U, 0x7fffffffU})
+    {
+        uint32_t multiplier{};
+        uint32_t shift{};
+
+        ck::tie(multiplier, shift) = MagicDivisionFullRange::CalculateMagicNumbers(divisor);
+
+        std::size_t num_mismatch = 0;
+        uint32_t dividend        = 0;
+
+        do
+        {
+            if(MagicDivisionFullRange::DoMagicDivision(dividend, multiplier, shift) !=
+               dividend / divisor)
+            {
+                ++num_mismatch;
+            }
+        } while(dividend++ != std::numeric_limits<uint32_t>::max());
+
+        EXPECT_EQ(num_mismatch, std::size_t{0}) << "divisor " << divisor;
+    }
+}
+
+TEST(MagicNumberDivisionFullRange, DISABLED_Int32AllDividends)
+{
+    for(const int32_t divisor : {-3, 7, -641, std::numeric_limits<int32_t>::min()})
+    {
+        int32_t multiplier{};
+        uint32_t shift{};
+
+        ck::tie(multiplier, shift) = MagicDivisionFullRange::CalculateMagicNumbers(divisor);
+
+        std::size_t num_mismatch = 0;
+        int64_t dividend         = std::numeric_limits<int32_t>::min();
+
+        for(; dividend <= std::numeric_limits<int32_t>::max(); ++dividend)
+        {
+            if(MagicDivisionFullRange::DoMagicDivision(int32_t(dividend), multiplier, shift) !=
+               int32_t(dividend) / divisor)
+            {
+                ++num_mismatch;
+            }
+        }
+
+        EXPECT_EQ(num_mismatch, std::size_t{0}) << "divisor " << divisor;
+    }
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_batch.hpp"
+#include "profiler/profiler_result.hpp"
+
+using ck::profiler::InstanceResult;
+using ck::profiler::ProblemSummary;
+
+using Problems = std::vector<std::vector<std::string>>;
+
+namespace {
+
+Problems read_problems(const std::string& str)
+{
+    std::istringstream is(str);
+
+    return ck::profiler::read_problem_file(is);
+}
+
+} // namespace
+
+TEST(ProfilerBatch, ReadProblemFile)
+{
+    const auto problems = read_problems("# gemm problems\n"
+                                        "gemm 1 1 1 1 0 1 256 256 256 256 256 256\n"
+                                        "\n"
+                                        "   \t\n"
+                                        "softmax 1 0 2 0 1 --length 8 16\n"
+                                        "gemm  1 1 1 1 0 1 256 256 256 256 256\t256\n"
+                                        "gemm 1 1 1 1 0 1 512 256 256 256 256 256");
+
+    EXPECT_EQ(problems,
+              (Problems{{"gemm", "1", "1", "1", "1", "0", "1", "256", "256", "256", "256", "256",
+                         "256"},
+                        {"softmax", "1", "0", "2", "0", "1", "--length", "8", "16"},
+                        {"gemm", "1", "1", "1", "1", "0", "1", "512", "256", "256", "256", "256",
+                         "256"}}));
+}
+
+TEST(ProfilerBatch, ReadProblemFileErrors)
+{
+    // the common options apply to all the problems
+    EXPECT_THROW(read_problems("gemm 1 1 --repeat=20\n"), std::runtime_error);
+    EXPECT_THROW(ck::profiler::read_problem_file("no_such_problem_file.txt"), std::runtime_error);
+    EXPECT_TRUE(read_problems("").empty());
+}
+
+TEST(ProfilerBatch, ProblemSummary)
+{
+    auto& sink = ck::profiler::ProfilerResultSink::GetInstance();
+
+    auto& summaries = sink.GetProblemSummaries();
+    summaries.clear();
+
+    InstanceResult slow{"DeviceGemm<64>", ck::TimingStatistics{}, 2.0f, 1.0f, 1.0f};
+    InstanceResult fast{"DeviceGemm<128>", ck::TimingStatistics{}, 1.0f, 2.0f, 2.0f};
+    InstanceResult fastest{"DeviceGemm<256>", ck::TimingStatistics{}, 0.5f, 4.0f, 4.0f};
+
+    std::vector<float> out{1.0f};
+    std::vector<float> ref{2.0f};
+
+    fastest.AddVerification(false, out, ref);
+
+    // the summaries are kept while the sink is not open
+    sink.SetProblem("gemm", {"1", "256"});
+    ck::profiler::report_result(slow);
+    ck::profiler::report_result(InstanceResult{"DeviceGemm<32>"});
+    ck::profiler::report_result(fastest);
+    ck::profiler::report_result(fast);
+
+    sink.SetProblem("gemm", {"1", "512"});
+    ck::profiler::report_result(InstanceResult{"DeviceGemm<32>"});
+    summaries.back().completed_ = false;
+
+    ASSERT_EQ(summaries.size(), 2);
+
+    EXPECT_EQ(summaries[0].num_instance_, 4);
+    EXPECT_EQ(summaries[0].num_supported_, 3);
+    EXPECT_EQ(summaries[0].num_failed_, 1);
+    EXPECT_TRUE(summaries[0].best_.supported_);
+    EXPECT_EQ(summaries[0].best_.instance_, "DeviceGemm<128>");
+    EXPECT_FALSE(summaries[1].best_.supported_);
+
+    std::ostringstream os;
+
+    ck::profiler::print_problem_summaries(os, summaries);
+
+    EXPECT_EQ(os.str(),
+              "problems: 2\n"
+              "[0] gemm 1 256: 3/4 instances supported, 1 failed verification, best: 1 ms, "
+              "2 TFlops, 2 GB/s, DeviceGemm<128>\n"
+              "[1] gemm 1 512: error, 0/1 instances supported, 0 failed verification\n"
+              "problems with an error: 1, problems with failed verification: 1\n");
+
+    summaries.clear();
+}
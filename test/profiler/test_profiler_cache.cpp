@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_cache.hpp"
+
+using ck::profiler::get_device_buffer;
+using ck::profiler::ProfilerCache;
+using ck::profiler::ProfilerCacheScope;
+
+TEST(ProfilerCache, DeviceBufferOutsideOfScope)
+{
+    EXPECT_THROW(get_device_buffer("buf", 64), std::runtime_error);
+    EXPECT_TRUE(ProfilerCache::GetInstance().IsEmpty());
+}
+
+TEST(ProfilerCache, ReuseInNestedScopes)
+{
+    {
+        ProfilerCacheScope outer_scope;
+
+        DeviceMem* buf = nullptr;
+
+        {
+            ProfilerCacheScope scope;
+            buf = &get_device_buffer("buf", 64);
+            EXPECT_EQ(buf->GetBufferSize(), 64u);
+        }
+
+        EXPECT_FALSE(ProfilerCache::GetInstance().IsEmpty());
+
+        {
+            ProfilerCacheScope scope;
+            EXPECT_EQ(&get_device_buffer("buf", 32), buf);
+            EXPECT_EQ(&get_device_buffer("buf", 128), buf);
+            EXPECT_EQ(buf->GetBufferSize(), 128u);
+        }
+    }
+
+    EXPECT_TRUE(ProfilerCache::GetInstance().IsEmpty());
+}
+
+TEST(ProfilerCache, FreedAtEndOfScope)
+{
+    {
+        ProfilerCacheScope scope;
+        get_device_buffer("buf", 64);
+    }
+
+    EXPECT_TRUE(ProfilerCache::GetInstance().IsEmpty());
+}
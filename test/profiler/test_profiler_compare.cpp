@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_compare.hpp"
+#include "profiler/profiler_result.hpp"
+
+using ck::profiler::InstanceResult;
+using ck::profiler::PerformanceChange;
+using ck::profiler::ProfilerResultSink;
+using ck::profiler::ResultSet;
+
+namespace {
+
+InstanceResult make_result(const std::string& instance, const std::vector<float>& times)
+{
+    InstanceResult result{
+        instance, ck::TimingStatistics::Compute(times, false), times.empty() ? 0 : times[0], 0, 0};
+
+    return result;
+}
+
+// result set of the results written by the sink in format, for one GEMM problem
+ResultSet read_results(ProfilerResultSink::Format format,
+                       const std::vector<InstanceResult>& results)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    std::stringstream ss;
+
+    sink.Open(ss, format);
+    sink.SetProblem("gemm", {"1", "1"});
+    sink.SetProblemParameters({{"ADataType", "f16"}, {"M", "256"}});
+
+    for(const auto& result : results)
+    {
+        sink.Write(result);
+    }
+
+    sink.Close();
+    sink.GetProblemSummaries().clear();
+
+    ResultSet result_set;
+
+    result_set.Read(ss);
+
+    return result_set;
+}
+
+} // namespace
+
+TEST(ProfilerCompare, MannWhitney)
+{
+    const std::vector<double> x{1, 2, 3, 4, 5};
+    const std::vector<double> y{6, 7, 8, 9, 10};
+
+    // U = 0, z = (12.5 - 0.5) / sqrt(25 * 11 / 12)
+    EXPECT_NEAR(ck::profiler::mann_whitney_p_value(x, y), 0.01218, 1e-4);
+    EXPECT_NEAR(ck::profiler::mann_whitney_p_value(y, x), 0.01218, 1e-4);
+
+    // interleaved
+    EXPECT_GT(ck::profiler::mann_whitney_p_value({1, 3, 5, 7}, {2, 4, 6, 8}), 0.5);
+
+    // all tied, or no times
+    EXPECT_DOUBLE_EQ(ck::profiler::mann_whitney_p_value({1, 1}, {1, 1}), 1);
+    EXPECT_DOUBLE_EQ(ck::profiler::mann_whitney_p_value({}, {1}), 1);
+}
+
+TEST(ProfilerCompare, Json)
+{
+    const auto value = ck::profiler::JsonParser::Parse(
+        R"({"a":"x\"A\n","b":[1,-2.5e3,null],"c":{"d":true}, "e":false})");
+
+    EXPECT_EQ(value.Find("a")->string_, "x\"A\n");
+    ASSERT_EQ(value.Find("b")->array_.size(), 3);
+    EXPECT_DOUBLE_EQ(value.Find("b")->array_[1].GetNumber(), -2500);
+    EXPECT_EQ(value.Find("b")->array_[2].type_, ck::profiler::JsonValue::Type::Null);
+    EXPECT_TRUE(value.Find("c")->Find("d")->bool_);
+    EXPECT_FALSE(value.Find("e")->bool_);
+    EXPECT_EQ(value.Find("f"), nullptr);
+
+    EXPECT_THROW(ck::profiler::JsonParser::Parse(R"({"a":1)"), std::runtime_error);
+    EXPECT_THROW(ck::profiler::JsonParser::Parse(R"({"a":1} x)"), std::runtime_error);
+}
+
+TEST(ProfilerCompare, ReadResults)
+{
+    const std::vector<InstanceResult> results{make_result("DeviceGemm<256, 128>", {1, 2, 3}),
+                                              InstanceResult{"DeviceGemm<64, 64>"}};
+
+    const auto json = read_results(ProfilerResultSink::Format::Json, results);
+    const auto csv  = read_results(ProfilerResultSink::Format::Csv, results);
+
+    const ResultSet::Problem problem{"gemm", "ADataType=f16;M=256"};
+
+    // the times of the runs from JSON, the mean time from CSV, no unsupported instance
+    ASSERT_EQ(json.times_.count(problem), 1);
+    ASSERT_EQ(csv.times_.count(problem), 1);
+    EXPECT_EQ(json.times_.at(problem).at("DeviceGemm<256, 128>"), (std::vector<double>{1, 2, 3}));
+    EXPECT_EQ(csv.times_.at(problem).at("DeviceGemm<256, 128>"), (std::vector<double>{1}));
+    EXPECT_EQ(json.times_.at(problem).size(), 1);
+
+    // the problem without parameters is the arguments
+    ResultSet result_set;
+    std::istringstream is("operation,arguments,problem,instance,supported,ave_time_ms\n"
+                          "reduce,\"-D 64,4 -R 0\",,DeviceReduce,true,0.5\n"
+                          "reduce,\"-D 64,4 -R 0\",,DeviceReduce,true,0.75\n");
+
+    result_set.Read(is);
+
+    EXPECT_EQ(result_set.times_.at({"reduce", "-D 64,4 -R 0"}).at("DeviceReduce"),
+              (std::vector<double>{0.5, 0.75}));
+}
+
+TEST(ProfilerCompare, Compare)
+{
+    const ResultSet::Problem gemm{"gemm", "M=256"};
+    const ResultSet::Problem conv{"conv_fwd", "N=1"};
+
+    ResultSet baseline;
+    ResultSet candidate;
+
+    baseline.Add(gemm, "A", {1.0, 1.01, 0.99, 1.0, 1.02});
+    baseline.Add(gemm, "B", {2.0, 2.01, 1.99, 2.0, 2.02});
+    baseline.Add(gemm, "C", {3.0});
+    baseline.Add(conv, "D", {1.0, 1.0, 1.0});
+
+    // A regresses, B improves but A stays the best, C is only in the baseline, E only in the
+    // candidate and D is noisy
+    candidate.Add(gemm, "A", {1.2, 1.21, 1.19, 1.2, 1.22});
+    candidate.Add(gemm, "B", {1.5, 1.51, 1.49, 1.5, 1.52});
+    candidate.Add(gemm, "E", {5.0});
+    candidate.Add(conv, "D", {0.5, 1.5, 1.1});
+
+    const auto report = ck::profiler::compare_result_sets(baseline, candidate);
+
+    ASSERT_EQ(report.instances_.size(), 3);
+    ASSERT_EQ(report.best_.size(), 2);
+    EXPECT_EQ(report.num_baseline_only_, 1);
+    EXPECT_EQ(report.num_candidate_only_, 1);
+
+    // sorted by problem, then by instance
+    EXPECT_EQ(report.instances_[0].instance_, "D");
+    EXPECT_EQ(report.instances_[0].change_, PerformanceChange::Unchanged);
+    EXPECT_EQ(report.instances_[1].instance_, "A");
+    EXPECT_EQ(report.instances_[1].change_, PerformanceChange::Regression);
+    EXPECT_DOUBLE_EQ(report.instances_[1].GetRatio(), 1.2);
+    EXPECT_EQ(report.instances_[2].change_, PerformanceChange::Improvement);
+
+    EXPECT_EQ(report.best_[1].instance_, "A");
+    EXPECT_EQ(report.best_[1].change_, PerformanceChange::Regression);
+    EXPECT_EQ(report.GetNumRegression(true), 1);
+    EXPECT_EQ(report.GetNumRegression(false), 1);
+
+    std::ostringstream os;
+
+    ck::profiler::print_comparison_report(os, report);
+
+    EXPECT_NE(os.str().find("gemm: 1 regressions, 0 improvements, 0 untested changes of the best"),
+              std::string::npos);
+    EXPECT_NE(os.str().find("regression of best: gemm M=256, A: 1 ms -> 1.2 ms (+20%"),
+              std::string::npos);
+    EXPECT_NE(os.str().find("improvement of instance: gemm M=256, B"), std::string::npos);
+}
+
+TEST(ProfilerCompare, FewTimes)
+{
+    ResultSet baseline;
+    ResultSet candidate;
+
+    // one time on each side, e.g. from CSV, the change is reported untested beyond the threshold
+    // and is not a regression
+    baseline.Add({"gemm", "M=256"}, "A", {1.0});
+    candidate.Add({"gemm", "M=256"}, "A", {1.01});
+    baseline.Add({"gemm", "M=512"}, "A", {1.0});
+    candidate.Add({"gemm", "M=512"}, "A", {1.1});
+
+    const auto report = ck::profiler::compare_result_sets(baseline, candidate);
+
+    ASSERT_EQ(report.instances_.size(), 2);
+    EXPECT_EQ(report.instances_[0].change_, PerformanceChange::Unchanged);
+    EXPECT_EQ(report.instances_[1].change_, PerformanceChange::Untested);
+    EXPECT_EQ(report.GetNumRegression(false), 0);
+    EXPECT_EQ(report.GetNumRegression(true), 0);
+    EXPECT_EQ(report.GetNumChange(PerformanceChange::Untested, true), 1);
+
+    std::ostringstream os;
+
+    ck::profiler::print_comparison_report(os, report);
+
+    EXPECT_NE(os.str().find("gemm: 0 regressions, 0 improvements, 1 untested changes of the best"),
+              std::string::npos);
+    EXPECT_NE(os.str().find("untested change of best: gemm M=512, A"), std::string::npos);
+}
@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_options.hpp"
+#include "profiler/profiler_result.hpp"
+
+using ck::profiler::InstanceResult;
+using ck::profiler::ProfilerOptions;
+using ck::profiler::ProfilerResultSink;
+
+namespace {
+
+ck::TimingStatistics make_timing()
+{
+    ck::TimingStatistics timing;
+
+    timing.num_run_     = 10;
+    timing.num_outlier_ = 1;
+    timing.mean_        = 0.5f;
+    timing.min_         = 0.25f;
+    timing.median_      = 0.5f;
+    timing.p90_         = 0.75f;
+    timing.max_         = 1.0f;
+    timing.stddev_      = 0.125f;
+    timing.ci95_        = 0.0625f;
+    timing.times_       = {0.25f, 1.0f};
+
+    return timing;
+}
+
+// writes results to a string with the sink, which is closed afterwards
+std::string write_results(ProfilerResultSink::Format format,
+                          const std::vector<InstanceResult>& results)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    std::ostringstream os;
+
+    sink.Open(os, format);
+    sink.SetProblem("gemm", {"1", "0", "1", "\"quoted\""});
+    sink.SetProblemParameters({{"ADataType", "f16"}, {"M", "256"}, {"Ms", "1x2"}});
+
+    for(const auto& result : results)
+    {
+        sink.Write(result);
+    }
+
+    sink.Close();
+
+    return os.str();
+}
+
+// parses argv as ckProfiler does, returns the remaining arguments
+std::vector<std::string> parse(ProfilerOptions& options, std::vector<std::string> args)
+{
+    std::vector<char*> argv;
+
+    for(auto& arg : args)
+    {
+        argv.push_back(arg.data());
+    }
+
+    const int argc = options.Parse(static_cast<int>(argv.size()), argv.data());
+
+    return std::vector<std::string>(argv.begin(), argv.begin() + argc);
+}
+
+} // namespace
+
+TEST(ProfilerResult, JsonLine)
+{
+    InstanceResult result{"DeviceGemm<256, 128>", make_timing(), 0.5f, 100.0f, 2.0f};
+
+    std::vector<float> out{1.0f, 2.0f, 3.5f};
+    std::vector<float> ref{1.0f, 2.5f, 3.0f};
+
+    result.AddVerification(true, out, ref);
+
+    const std::string str = write_results(ProfilerResultSink::Format::Json, {result});
+
+    EXPECT_EQ(str,
+              "{\"operation\":\"gemm\",\"arguments\":\"1 0 1 \\\"quoted\\\"\","
+              "\"problem\":{\"ADataType\":\"f16\",\"M\":256,\"Ms\":\"1x2\"},"
+              "\"instance\":\"DeviceGemm<256, 128>\",\"supported\":true,\"ave_time_ms\":0.5,"
+              "\"timing\":{\"num_run\":10,\"num_outlier\":1,\"mean_ms\":0.5,\"min_ms\":0.25,"
+              "\"median_ms\":0.5,\"p90_ms\":0.75,\"max_ms\":1,\"stddev_ms\":0.125,"
+              "\"ci95_ms\":0.0625,\"times_ms\":[0.25,1]},\"tflops\":100,\"gb_per_sec\":2,"
+              "\"verification\":\"pass\",\"max_abs_error\":0.5,"
+              "\"max_rel_error\":0.20000000000000001,"
+              "\"roofline\":{\"device\":\"\",\"bound\":\"unknown\",\"arithmetic_intensity\":null,"
+              "\"roofline_tflops\":null,\"percent_of_peak\":null}}\n");
+}
+
+TEST(ProfilerResult, JsonNonFinite)
+{
+    // an instance run without timing has a mean time of 0, and infinite TFlops
+    InstanceResult result{"DeviceGemm", ck::TimingStatistics{}, 0, 0, 0};
+
+    result.tflops_     = std::numeric_limits<float>::infinity();
+    result.gb_per_sec_ = std::numeric_limits<float>::quiet_NaN();
+
+    const std::string str = write_results(ProfilerResultSink::Format::Json, {result});
+
+    EXPECT_NE(str.find("\"tflops\":null,\"gb_per_sec\":null,\"verification\":\"none\""),
+              std::string::npos);
+}
+
+TEST(ProfilerResult, JsonUnsupported)
+{
+    const std::string str =
+        write_results(ProfilerResultSink::Format::Json, {InstanceResult{"DeviceGemm\n"}});
+
+    EXPECT_NE(str.find("\"instance\":\"DeviceGemm\\n\",\"supported\":false}\n"),
+              std::string::npos);
+    EXPECT_EQ(str.find("ave_time_ms"), std::string::npos);
+}
+
+TEST(ProfilerResult, JsonParameterNumbers)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    std::ostringstream os;
+
+    sink.Open(os, ProfilerResultSink::Format::Json);
+    sink.SetProblem("gemm", {});
+    sink.SetProblemParameters({{"a", "0"},
+                               {"b", "-12.5e+3"},
+                               {"c", "1E-2"},
+                               {"d", "0x10"},
+                               {"e", "inf"},
+                               {"f", "nan"},
+                               {"g", " 1"},
+                               {"h", "007"},
+                               {"i", "1."},
+                               {"j", ".5"},
+                               {"k", "+1"},
+                               {"l", "1e"},
+                               {"m", ""}});
+    sink.Write(InstanceResult{"DeviceGemm"});
+    sink.Close();
+
+    // only the decimal numbers of the JSON grammar are written unquoted
+    EXPECT_NE(os.str().find("\"problem\":{\"a\":0,\"b\":-12.5e+3,\"c\":1E-2,\"d\":\"0x10\","
+                            "\"e\":\"inf\",\"f\":\"nan\",\"g\":\" 1\",\"h\":\"007\","
+                            "\"i\":\"1.\",\"j\":\".5\",\"k\":\"+1\",\"l\":\"1e\",\"m\":\"\"}"),
+              std::string::npos)
+        << os.str();
+}
+
+TEST(ProfilerResult, Csv)
+{
+    InstanceResult result{"DeviceGemm<256, 128>", make_timing(), 0.5f, 100.0f, 2.0f};
+
+    std::vector<float> out{1.0f};
+    std::vector<float> ref{2.0f};
+
+    result.AddVerification(false, out, ref);
+
+    const std::string str = write_results(ProfilerResultSink::Format::Csv,
+                                          {result, InstanceResult{"DeviceGemm<64, 64>"}});
+
+    EXPECT_EQ(str,
+              "operation,arguments,problem,instance,supported,ave_time_ms,num_run,num_outlier,"
+              "mean_ms,min_ms,median_ms,p90_ms,max_ms,stddev_ms,ci95_ms,tflops,gb_per_sec,"
+              "verification,max_abs_error,max_rel_error,device,bound,arithmetic_intensity,"
+              "roofline_tflops,percent_of_peak\n"
+              "gemm,\"1 0 1 \"\"quoted\"\"\",ADataType=f16;M=256;Ms=1x2,\"DeviceGemm<256, 128>\","
+              "true,0.5,10,1,0.5,0.25,0.5,0.75,1,0.125,0.0625,100,2,fail,1,0.5,,unknown,,,\n"
+              "gemm,\"1 0 1 \"\"quoted\"\"\",ADataType=f16;M=256;Ms=1x2,\"DeviceGemm<64, 64>\","
+              "false,,,,,,,,,,,,,,,,,,,,\n");
+}
+
+TEST(ProfilerResult, CsvHeaderOnce)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    std::ostringstream os;
+
+    sink.Open(os, ProfilerResultSink::Format::Csv);
+    sink.Close();
+
+    // appending to a stream that is not empty
+    sink.Open(os, ProfilerResultSink::Format::Csv);
+    sink.Close();
+
+    EXPECT_EQ(os.str().find("operation,"), 0);
+    EXPECT_EQ(os.str().find("operation,", 1), std::string::npos);
+}
+
+TEST(ProfilerResult, ClosedSinkWritesNothing)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    EXPECT_FALSE(sink.IsOpen());
+
+    // must not throw or write anywhere
+    ck::profiler::report_result(InstanceResult{"DeviceGemm"});
+
+    EXPECT_THROW(sink.Open("result.txt", "xml"), std::runtime_error);
+    EXPECT_FALSE(sink.IsOpen());
+}
+
+TEST(ProfilerResult, VerificationErrors)
+{
+    InstanceResult result{"DeviceGemm", ck::TimingStatistics{}, 0, 0, 0};
+
+    std::vector<ck::half_t> out{ck::type_convert<ck::half_t>(1.0f)};
+    std::vector<ck::half_t> ref{ck::type_convert<ck::half_t>(0.0f)};
+    std::vector<double> out_2{3.0, 4.0};
+    std::vector<double> ref_2{2.0, 4.0};
+
+    // the zero of ref is left out of the relative error
+    result.AddVerification(true, out, ref);
+
+    EXPECT_EQ(result.verification_, ck::profiler::VerificationStatus::Pass);
+    EXPECT_DOUBLE_EQ(result.max_abs_error_, 1.0);
+    EXPECT_DOUBLE_EQ(result.max_rel_error_, 0.0);
+
+    // an instance fails when any of its outputs fails
+    result.AddVerification(false, out_2, ref_2);
+    result.AddVerification(true, out_2, ref_2);
+
+    EXPECT_EQ(result.verification_, ck::profiler::VerificationStatus::Fail);
+    EXPECT_DOUBLE_EQ(result.max_abs_error_, 1.0);
+    EXPECT_DOUBLE_EQ(result.max_rel_error_, 0.5);
+}
+
+TEST(ProfilerResult, ParameterString)
+{
+    EXPECT_EQ(ck::profiler::get_parameter_string(std::vector<int>{3, 224, 224}), "3x224x224");
+    EXPECT_EQ(ck::profiler::get_parameter_string(std::vector<int>{}), "");
+    EXPECT_EQ(ck::profiler::get_parameter_string(0.5f), "0.5");
+}
+
+TEST(ProfilerOptions, Parse)
+{
+    ProfilerOptions options;
+
+    const auto args = parse(options,
+                            {"ckProfiler",
+                             "--repeat=20",
+                             "gemm",
+                             "1",
+                             "--warmup=3",
+                             "--target-ci=0.01",
+                             "--max-repeat=200",
+                             "--reject-outliers=1",
+                             "--result-file=out.csv",
+                             "--result-format=json",
+                             "--problem-file=problems.txt",
+                             "--verify-threads=2",
+                             "--device-file=mi250x.txt",
+                             "2",
+                             "--length",
+                             "--inLengths=64,4"});
+
+    // the options of the operation are left in place
+    EXPECT_EQ(args,
+              (std::vector<std::string>{
+                  "ckProfiler", "gemm", "1", "2", "--length", "--inLengths=64,4"}));
+    EXPECT_EQ(options.nrepeat_, 20);
+    EXPECT_EQ(options.cold_niters_, 3);
+    EXPECT_FLOAT_EQ(options.target_ci_, 0.01f);
+    EXPECT_EQ(options.max_nrepeat_, 200);
+    EXPECT_TRUE(options.reject_outliers_);
+    EXPECT_EQ(options.result_file_, "out.csv");
+    EXPECT_EQ(options.result_format_, "json");
+    EXPECT_EQ(options.problem_file_, "problems.txt");
+    EXPECT_EQ(options.verify_threads_, 2u);
+    EXPECT_EQ(options.device_file_, "mi250x.txt");
+
+    const StreamConfig stream_config = options.GetStreamConfig(true);
+
+    EXPECT_TRUE(stream_config.time_kernel_);
+    EXPECT_EQ(stream_config.nrepeat_, 20);
+    EXPECT_EQ(stream_config.cold_niters_, 3);
+    EXPECT_FLOAT_EQ(stream_config.target_ci_, 0.01f);
+    EXPECT_EQ(stream_config.max_nrepeat_, 200);
+    EXPECT_TRUE(stream_config.reject_outliers_);
+
+    // outliers are only rejected when asked for, ckProfiler keeps the plain mean like the others
+    EXPECT_FALSE(ProfilerOptions{}.GetStreamConfig(true).reject_outliers_);
+    EXPECT_FALSE(StreamConfig{}.reject_outliers_);
+}
+
+TEST(ProfilerOptions, ParseErrors)
+{
+    ProfilerOptions options;
+
+    EXPECT_THROW(parse(options, {"ckProfiler", "--repeat"}), std::runtime_error);
+    EXPECT_THROW(parse(options, {"ckProfiler", "--repeat="}), std::runtime_error);
+}
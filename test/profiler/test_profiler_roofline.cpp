@@ -0,0 +1,129 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_batch.hpp"
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_roofline.hpp"
+
+using ck::DeviceCapability;
+using ck::profiler::InstanceResult;
+using ck::profiler::ProfilerResultSink;
+using ck::profiler::RooflineBound;
+
+namespace {
+
+// ridge point at 100 flops per byte for f16, and no peak for f32
+DeviceCapability make_device()
+{
+    DeviceCapability device;
+
+    device.name_                 = "gfx90a";
+    device.bandwidth_gb_per_sec_ = 1000;
+    device.peak_tflops_["f16"]   = 100;
+
+    return device;
+}
+
+} // namespace
+
+TEST(ProfilerRoofline, Bound)
+{
+    const DeviceCapability device = make_device();
+
+    // 50 flops per byte, the roofline is 50 TFlops
+    auto roofline = ck::profiler::get_roofline(device, "f16", 25, 500);
+
+    EXPECT_EQ(roofline.bound_, RooflineBound::Memory);
+    EXPECT_FLOAT_EQ(roofline.arithmetic_intensity_, 50);
+    EXPECT_FLOAT_EQ(roofline.roofline_tflops_, 50);
+    EXPECT_FLOAT_EQ(roofline.percent_of_peak_, 50);
+
+    // 400 flops per byte, the roofline is the peak
+    roofline = ck::profiler::get_roofline(device, "f16", 80, 200);
+
+    EXPECT_EQ(roofline.bound_, RooflineBound::Compute);
+    EXPECT_FLOAT_EQ(roofline.arithmetic_intensity_, 400);
+    EXPECT_FLOAT_EQ(roofline.roofline_tflops_, 100);
+    EXPECT_FLOAT_EQ(roofline.percent_of_peak_, 80);
+
+    // an operation without flops is compared to the bandwidth
+    roofline = ck::profiler::get_roofline(device, "f32", 0, 250);
+
+    EXPECT_EQ(roofline.bound_, RooflineBound::Memory);
+    EXPECT_FLOAT_EQ(roofline.percent_of_peak_, 25);
+
+    // no peak for the data type, or no bandwidth
+    EXPECT_EQ(ck::profiler::get_roofline(device, "f32", 10, 250).bound_, RooflineBound::Unknown);
+    EXPECT_EQ(ck::profiler::get_roofline(DeviceCapability{}, "f16", 0, 250).bound_,
+              RooflineBound::Unknown);
+}
+
+TEST(ProfilerRoofline, DeviceFile)
+{
+    DeviceCapability device = make_device();
+
+    std::istringstream is("# one GCD\n"
+                          "num_cu=110\n"
+                          "  lds_size=65536\n"
+                          "\n"
+                          "bandwidth_gb_per_sec=1638.4\r\n"
+                          "peak_tflops.f16=191.5\n"
+                          "peak_tflops.int8=383\n");
+
+    ck::profiler::read_device_file(is, device);
+
+    EXPECT_EQ(device.name_, "gfx90a");
+    EXPECT_EQ(device.num_cu_, 110);
+    EXPECT_EQ(device.lds_size_, 65536u);
+    EXPECT_FLOAT_EQ(device.bandwidth_gb_per_sec_, 1638.4f);
+    EXPECT_FLOAT_EQ(device.peak_tflops_["f16"], 191.5f);
+    EXPECT_FLOAT_EQ(device.peak_tflops_["int8"], 383);
+
+    std::istringstream unknown("peak_flops=1\n");
+    std::istringstream no_value("num_cu=\n");
+
+    EXPECT_THROW(ck::profiler::read_device_file(unknown, device), std::runtime_error);
+    EXPECT_THROW(ck::profiler::read_device_file(no_value, device), std::runtime_error);
+    EXPECT_THROW(ck::profiler::read_device_file("no_such_device_file.txt", device),
+                 std::runtime_error);
+}
+
+TEST(ProfilerRoofline, Sink)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    auto& summaries = sink.GetProblemSummaries();
+    summaries.clear();
+
+    std::ostringstream os;
+
+    sink.SetDeviceCapability(make_device());
+    sink.Open(os, ProfilerResultSink::Format::Csv);
+    sink.SetProblem("gemm", {"1"});
+
+    // the data type is the first data type parameter
+    sink.SetProblemParameters({{"M", "256"}, {"ADataType", "f16"}, {"BDataType", "f32"}});
+    sink.Write(InstanceResult{"DeviceGemm", ck::TimingStatistics{}, 1, 80, 200});
+    sink.Close();
+    sink.SetDeviceCapability(DeviceCapability{});
+
+    EXPECT_NE(os.str().find(",gfx90a,compute,400,100,80\n"), std::string::npos);
+
+    ASSERT_EQ(summaries.size(), 1);
+    EXPECT_EQ(summaries[0].best_.roofline_.bound_, RooflineBound::Compute);
+
+    std::ostringstream summary;
+
+    ck::profiler::print_problem_summaries(summary, summaries);
+
+    EXPECT_NE(
+        summary.str().find("80 TFlops, 200 GB/s, 80% of roofline (compute bound), DeviceGemm"),
+        std::string::npos);
+
+    summaries.clear();
+}
@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_sweep.hpp"
+
+using ck::profiler::InstanceResult;
+using ck::profiler::ProblemSummary;
+using ck::profiler::RooflineBound;
+using ck::profiler::SweepParameter;
+
+namespace {
+
+InstanceResult make_result(const std::string& instance, float ave_time, float percent_of_peak)
+{
+    InstanceResult result{instance, ck::TimingStatistics{}, ave_time, 1, 1};
+
+    result.roofline_.bound_           = RooflineBound::Compute;
+    result.roofline_.percent_of_peak_ = percent_of_peak;
+
+    return result;
+}
+
+} // namespace
+
+TEST(ProfilerSweep, ParseParameter)
+{
+    using Values = std::vector<std::string>;
+
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("M=1,3,,7").values_, (Values{"1", "3", "7"}));
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("M=64:1024:x2").values_,
+              (Values{"64", "128", "256", "512", "1024"}));
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("M=64:1000:x2").values_.back(), "512");
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("K=1:2:x1.2").values_, (Values{"1", "2"}));
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("C=8:32:+8").values_,
+              (Values{"8", "16", "24", "32"}));
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("Y=1:3").values_, (Values{"1", "2", "3"}));
+    EXPECT_EQ(ck::profiler::parse_sweep_parameter("Y=1:3").name_, "Y");
+
+    EXPECT_THROW(ck::profiler::parse_sweep_parameter("M"), std::runtime_error);
+    EXPECT_THROW(ck::profiler::parse_sweep_parameter("M="), std::runtime_error);
+    EXPECT_THROW(ck::profiler::parse_sweep_parameter("M=8:4:x2"), std::runtime_error);
+    EXPECT_THROW(ck::profiler::parse_sweep_parameter("M=8:16:x1"), std::runtime_error);
+}
+
+TEST(ProfilerSweep, Expand)
+{
+    const std::vector<SweepParameter> parameters{{"M", {"64", "128"}}, {"N", {"32", "96", "160"}}};
+
+    const auto points = ck::profiler::expand_sweep(
+        {{"gemm", "{M}", "{N}", "{M}"}, {"gemm", "{N}", "4096"}}, parameters);
+
+    ASSERT_EQ(points.size(), 9u);
+
+    // the grid of the first problem, with the last parameter changing fastest
+    EXPECT_EQ(points[0].problem_, (std::vector<std::string>{"gemm", "64", "32", "64"}));
+    EXPECT_EQ(points[1].problem_, (std::vector<std::string>{"gemm", "64", "96", "64"}));
+    EXPECT_EQ(points[5].problem_, (std::vector<std::string>{"gemm", "128", "160", "128"}));
+    ASSERT_EQ(points[5].values_.size(), 2u);
+    EXPECT_EQ(points[5].values_[0].second, "128");
+    EXPECT_EQ(points[5].values_[1].second, "160");
+
+    // the second problem only uses N
+    EXPECT_EQ(points[8].problem_, (std::vector<std::string>{"gemm", "160", "4096"}));
+    EXPECT_EQ(points[8].values_.size(), 1u);
+
+    EXPECT_THROW(ck::profiler::expand_sweep({{"gemm", "{K}"}}, parameters), std::runtime_error);
+    EXPECT_THROW(ck::profiler::expand_sweep({{"gemm", "{M}"}}, parameters), std::runtime_error);
+}
+
+TEST(ProfilerSweep, Report)
+{
+    const std::vector<SweepParameter> parameters{{"M", {"64", "4096"}}};
+
+    const auto points = ck::profiler::expand_sweep({{"gemm", "{M}"}}, parameters);
+
+    std::vector<ProblemSummary> summaries{{"gemm", {"64"}}, {"gemm", {"4096"}}};
+
+    // A wins the small point far from the roofline, B the large one, C never wins and D never
+    // supports a point
+    summaries[0].Add(make_result("A", 1, 20));
+    summaries[0].Add(make_result("B", 2, 10));
+    summaries[0].Add(make_result("C", 3, 5));
+    summaries[0].Add(InstanceResult{"D"});
+    summaries[1].Add(make_result("A", 2, 40));
+    summaries[1].Add(make_result("B", 1, 80));
+    summaries[1].Add(InstanceResult{"D"});
+
+    std::ostringstream os;
+
+    ck::profiler::print_sweep_report(os, points, summaries, 50);
+
+    const std::string report = os.str();
+
+    EXPECT_NE(report.find("[0] M=64: 1 ms, 1 TFlops, 1 GB/s, 20% of roofline (compute bound), A"),
+              std::string::npos);
+    EXPECT_NE(report.find("instances: 4, winning at least one point: 2"), std::string::npos);
+    EXPECT_NE(report.find("never winning: 1\n  1 supported: C\n"), std::string::npos);
+    EXPECT_NE(report.find("supporting no point: 1\n  D\n"), std::string::npos);
+    EXPECT_NE(report.find("below 50% of roofline: 1/2\n  M=64: 1/1 points\n"), std::string::npos);
+    EXPECT_NE(report.find("[1] M=4096: 1 ms, 1 TFlops, 1 GB/s, 80% of roofline (compute bound), B"),
+              std::string::npos);
+
+    summaries.pop_back();
+
+    EXPECT_THROW(ck::profiler::print_sweep_report(os, points, summaries, 50), std::runtime_error);
+}
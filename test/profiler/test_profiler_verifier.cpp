@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profiler_result.hpp"
+#include "profiler/profiler_verifier.hpp"
+
+using ck::profiler::InstanceResult;
+using ck::profiler::ProblemSummary;
+using ck::profiler::ProfilerResultSink;
+using ck::profiler::ProfilerVerifier;
+
+namespace {
+
+InstanceResult make_result(const std::string& instance)
+{
+    return InstanceResult{instance, ck::TimingStatistics{}, 1.0f, 1.0f, 1.0f};
+}
+
+// checks that out equals the reference, after the reference is done
+bool check(InstanceResult& result, const std::vector<float>& out, const std::vector<float>& ref)
+{
+    const bool pass = out == ref;
+
+    result.AddVerification(pass, out, ref);
+
+    return pass;
+}
+
+// verifies instances with outputs outs, returns the summary of the results the verifier reported
+std::vector<ProblemSummary> verify(std::size_t num_thread,
+                                   const std::vector<std::vector<float>>& outs,
+                                   bool& pass)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    sink.GetProblemSummaries().clear();
+    sink.SetProblem("gemm", {});
+
+    std::vector<float> ref(4, 0.0f);
+
+    ProfilerVerifier verifier(false, num_thread);
+
+    verifier.RunReference([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        ref.assign(4, 1.0f);
+    });
+
+    for(std::size_t i = 0; i < outs.size(); ++i)
+    {
+        verifier.Add(make_result(std::to_string(i)), [&, out = outs[i]](InstanceResult& result) {
+            return check(result, out, ref);
+        });
+    }
+
+    verifier.Add(InstanceResult{"unsupported"});
+
+    pass = verifier.Wait();
+
+    auto summaries = sink.GetProblemSummaries();
+
+    sink.GetProblemSummaries().clear();
+
+    return summaries;
+}
+
+} // namespace
+
+TEST(ProfilerVerifier, ChecksAfterReference)
+{
+    for(std::size_t num_thread : {0, 1, 3})
+    {
+        bool pass = false;
+
+        const auto summaries =
+            verify(num_thread, std::vector<std::vector<float>>(8, {1, 1, 1, 1}), pass);
+
+        EXPECT_TRUE(pass);
+        ASSERT_EQ(summaries.size(), 1);
+        EXPECT_EQ(summaries[0].num_instance_, 9);
+        EXPECT_EQ(summaries[0].num_supported_, 8);
+        EXPECT_EQ(summaries[0].num_failed_, 0);
+    }
+}
+
+TEST(ProfilerVerifier, Fail)
+{
+    for(std::size_t num_thread : {0, 2})
+    {
+        bool pass = true;
+
+        const auto summaries =
+            verify(num_thread, {{1, 1, 1, 1}, {1, 2, 1, 1}, {1, 1, 1, 1}, {0, 0, 0, 0}}, pass);
+
+        EXPECT_FALSE(pass);
+        ASSERT_EQ(summaries.size(), 1);
+        EXPECT_EQ(summaries[0].num_failed_, 2);
+    }
+}
+
+TEST(ProfilerVerifier, ReportInOrder)
+{
+    auto& sink = ProfilerResultSink::GetInstance();
+
+    std::ostringstream os;
+
+    sink.Open(os, ProfilerResultSink::Format::Csv);
+    sink.SetProblem("gemm", {});
+
+    ProfilerVerifier verifier(false, 4);
+
+    std::atomic<int> num_check{0};
+
+    for(int i = 0; i < 6; ++i)
+    {
+        // the first checks end last
+        verifier.Add(make_result("instance" + std::to_string(i)), [&, i](InstanceResult&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5 * (6 - i)));
+
+            ++num_check;
+
+            return true;
+        });
+    }
+
+    EXPECT_TRUE(verifier.Wait());
+    EXPECT_EQ(num_check, 6);
+
+    sink.Close();
+    sink.GetProblemSummaries().clear();
+
+    std::size_t pos = 0;
+
+    for(int i = 0; i < 6; ++i)
+    {
+        const std::size_t next = os.str().find("instance" + std::to_string(i), pos);
+
+        ASSERT_NE(next, std::string::npos);
+
+        pos = next;
+    }
+}
+
+TEST(ProfilerVerifier, Exception)
+{
+    ProfilerVerifier verifier(false, 2);
+
+    verifier.RunReference([] { throw std::runtime_error("wrong! reference"); });
+
+    verifier.Add(make_result("instance"), [](InstanceResult&) { return true; });
+
+    EXPECT_THROW(verifier.Wait(), std::runtime_error);
+
+    ProfilerResultSink::GetInstance().GetProblemSummaries().clear();
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/tensor_space_filling_curve.hpp"
+#include "ck/library/utility/host_space_filling_curve.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::HostSpaceFillingCurve;
+
+using Vec = std::vector<std::size_t>;
+
+namespace {
+
+template <typename Seq>
+std::vector<std::size_t> to_vector(Seq)
+{
+    std::vector<std::size_t> v;
+
+    ck::static_for<0, Seq::Size(), 1>{}([&](auto i) { v.push_back(Seq::At(i)); });
+
+    return v;
+}
+
+// the runtime curve against ck::SpaceFillingCurve, access by access
+template <typename TensorLengths,
+          typename DimAccessOrder,
+          typename ScalarsPerAccess,
+          bool SnakeCurved>
+void test_same_as_compile_time()
+{
+    using SpaceFillingCurve =
+        ck::SpaceFillingCurve<TensorLengths, DimAccessOrder, ScalarsPerAccess, SnakeCurved>;
+
+    constexpr ck::index_t num_access = SpaceFillingCurve::GetNumOfAccess();
+    constexpr ck::index_t ndim       = TensorLengths::Size();
+
+    const HostSpaceFillingCurve curve(to_vector(TensorLengths{}),
+                                      to_vector(DimAccessOrder{}),
+                                      to_vector(ScalarsPerAccess{}),
+                                      SnakeCurved);
+
+    ASSERT_EQ(curve.GetNumOfAccess(), static_cast<std::size_t>(num_access));
+    EXPECT_EQ(curve.GetScalarPerVector(),
+              static_cast<std::size_t>(SpaceFillingCurve::ScalarPerVector));
+
+    auto it = curve.begin();
+
+    ck::static_for<0, num_access, 1>{}([&](auto i) {
+        constexpr auto idx = SpaceFillingCurve::GetIndex(i);
+
+        const auto host_idx = curve.GetIndex(i);
+
+        ck::static_for<0, ndim, 1>{}([&](auto d) {
+            EXPECT_EQ(host_idx[d], static_cast<std::size_t>(idx[d]));
+            EXPECT_EQ((*it).index[d], static_cast<std::size_t>(idx[d]));
+        });
+
+        if constexpr(i < num_access - 1)
+        {
+            constexpr auto step = SpaceFillingCurve::GetForwardStep(i);
+
+            const auto host_step = curve.GetForwardStep(i);
+
+            ck::static_for<0, ndim, 1>{}(
+                [&](auto d) { EXPECT_EQ(host_step[d], static_cast<std::ptrdiff_t>(step[d])); });
+        }
+
+        if constexpr(i > 0)
+        {
+            constexpr auto step = SpaceFillingCurve::GetBackwardStep(i);
+
+            const auto host_step = curve.GetBackwardStep(i);
+
+            ck::static_for<0, ndim, 1>{}(
+                [&](auto d) { EXPECT_EQ(host_step[d], static_cast<std::ptrdiff_t>(step[d])); });
+        }
+
+        ++it;
+    });
+
+    EXPECT_TRUE(it == curve.end());
+}
+
+} // namespace
+
+TEST(HostSpaceFillingCurve, SameAsCompileTime)
+{
+    using ck::Sequence;
+    using S = Sequence<4, 3, 2, 5>;
+
+    test_same_as_compile_time<Sequence<3, 2, 2>, Sequence<2, 0, 1>, Sequence<1, 1, 1>, false>();
+    test_same_as_compile_time<Sequence<16, 10, 9>, Sequence<2, 0, 1>, Sequence<4, 2, 3>, true>();
+    test_same_as_compile_time<S, Sequence<1, 3, 0, 2>, Sequence<1, 1, 2, 1>, true>();
+    test_same_as_compile_time<S, Sequence<3, 2, 1, 0>, Sequence<2, 3, 1, 5>, false>();
+    test_same_as_compile_time<Sequence<7>, Sequence<0>, Sequence<1>, true>();
+}
+
+TEST(HostSpaceFillingCurve, Offsets)
+{
+    // a permuted, padded layout: each access is visited once, at the offset of its index
+    const HostTensorDescriptor desc(std::vector<std::size_t>{6, 5, 8},
+                                    std::vector<std::size_t>{3, 18 * 8, 18});
+
+    for(const bool snake_curved : {true, false})
+    {
+        const auto curve =
+            HostSpaceFillingCurve::MakeMemoryOrdered(desc, {3, 1, 2}, snake_curved);
+
+        EXPECT_EQ(HostSpaceFillingCurve::GetDimAccessOrderByStrides(desc),
+                  (Vec{1, 2, 0}));
+
+        std::vector<std::size_t> offsets;
+        std::size_t access_idx_1d = 0;
+
+        curve.ForEach([&](const std::vector<std::size_t>& idx, std::size_t offset) {
+            EXPECT_EQ(offset, desc.GetOffsetFromMultiIndex(idx));
+            EXPECT_EQ(offset, curve.GetOffset(access_idx_1d));
+            EXPECT_EQ(idx, curve.GetIndex(access_idx_1d));
+
+            offsets.push_back(offset);
+            ++access_idx_1d;
+        });
+
+        EXPECT_EQ(access_idx_1d, std::size_t{2 * 5 * 4});
+
+        std::sort(offsets.begin(), offsets.end());
+
+        EXPECT_TRUE(std::adjacent_find(offsets.begin(), offsets.end()) == offsets.end());
+    }
+
+    // a packed tensor in row-major access order without snake curve visits memory in order
+    const HostSpaceFillingCurve packed(Vec{4, 3, 5}, {0, 1, 2}, {1, 1, 1}, false);
+
+    std::size_t expected_offset = 0;
+
+    for(const auto access : packed)
+    {
+        EXPECT_EQ(access.offset, expected_offset++);
+    }
+}
+
+TEST(HostSpaceFillingCurve, Empty)
+{
+    const HostSpaceFillingCurve curve(Vec{4, 0, 5}, {0, 1, 2}, {1, 1, 1});
+
+    EXPECT_EQ(curve.GetNumOfAccess(), std::size_t{0});
+    EXPECT_TRUE(curve.begin() == curve.end());
+}
+
+TEST(HostSpaceFillingCurve, Invalid)
+{
+    EXPECT_THROW(HostSpaceFillingCurve(Vec{4, 3}, {0, 0}, {1, 1}), std::runtime_error);
+    EXPECT_THROW(HostSpaceFillingCurve(Vec{4, 3}, {0, 1}, {3, 1}), std::runtime_error);
+    EXPECT_THROW(HostSpaceFillingCurve(Vec{4, 3}, {0, 1, 2}, {1, 1}), std::runtime_error);
+}
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_adaptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+#include "ck/library/utility/tensor_descriptor_analyzer.hpp"
+
+using ck::index_t;
+using ck::long_index_t;
+using ck::make_tuple;
+using ck::Number;
+using ck::Sequence;
+
+namespace {
+
+// Enumerates every visible index of both descriptors, by moving a coordinate and by
+// CalculateOffset, and compares offsets and validity
+template <typename Desc, typename SimplifiedDesc>
+void check_equivalence(const Desc& desc, const SimplifiedDesc& simplified_desc)
+{
+    constexpr index_t ndim = Desc::GetNumOfDimension();
+
+    static_assert(SimplifiedDesc::GetNumOfDimension() == ndim, "wrong! # of dimension changed");
+
+    const auto tile = ck::utils::make_transform_chain_tile(desc);
+
+    ck::static_for<0, ndim, 1>{}(
+        [&](auto i) { EXPECT_EQ(simplified_desc.GetLength(i), desc.GetLength(i)); });
+
+    EXPECT_EQ(simplified_desc.GetElementSpaceSize(), desc.GetElementSpaceSize());
+
+    std::vector<long_index_t> offsets;
+    std::vector<bool> is_valid;
+
+    ck::utils::for_each_tile_offset(desc, tile, [&](const auto&, long_index_t offset, bool valid) {
+        offsets.push_back(offset);
+        is_valid.push_back(valid);
+    });
+
+    std::size_t i = 0;
+
+    ck::utils::for_each_tile_offset(
+        simplified_desc, tile, [&](const auto& idx, long_index_t offset, bool valid) {
+            ck::MultiIndex<ndim> multi_idx;
+
+            ck::static_for<0, ndim, 1>{}([&](auto d) { multi_idx(d) = idx[d]; });
+
+            EXPECT_EQ(is_valid[i], valid);
+
+            if(valid)
+            {
+                EXPECT_EQ(offsets[i], offset);
+                EXPECT_EQ(offsets[i], simplified_desc.CalculateOffset(multi_idx));
+            }
+
+            ++i;
+        });
+
+    EXPECT_EQ(i, offsets.size());
+}
+
+} // namespace
+
+TEST(TensorAdaptorSimplification, UnMergeMerge)
+{
+    // packed M x K merged back into M * K
+    const auto desc = ck::transform_tensor_descriptor(
+        ck::make_naive_tensor_descriptor_packed(make_tuple(Number<6>{}, Number<10>{})),
+        make_tuple(ck::make_merge_transform(make_tuple(Number<6>{}, Number<10>{}))),
+        make_tuple(Sequence<0, 1>{}),
+        make_tuple(Sequence<0>{}));
+
+    const auto simplified_desc = ck::simplify_tensor_descriptor(desc);
+
+    EXPECT_EQ(desc.GetNumOfTransform(), 2);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 1);
+    EXPECT_EQ(simplified_desc.GetNumOfHiddenDimension(), 2);
+
+    check_equivalence(desc, simplified_desc);
+}
+
+TEST(TensorAdaptorSimplification, UnMergeMergeRuntimeLengths)
+{
+    // the lengths may differ, so the UnMerge and the Merge are kept
+    const auto desc = ck::transform_tensor_descriptor(
+        ck::make_naive_tensor_descriptor_packed(make_tuple(6, 10)),
+        make_tuple(ck::make_merge_transform(make_tuple(6, 10))),
+        make_tuple(Sequence<0, 1>{}),
+        make_tuple(Sequence<0>{}));
+
+    const auto simplified_desc = ck::simplify_tensor_descriptor(desc);
+
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 2);
+
+    check_equivalence(desc, simplified_desc);
+}
+
+TEST(TensorAdaptorSimplification, UnMergeMergeDifferentLengths)
+{
+    // T -> (T0, T1) with lengths (4, 6) -> T' with lengths (6, 4) is not the identity
+    const auto adaptor = ck::chain_tensor_adaptors(
+        ck::make_single_stage_tensor_adaptor(
+            make_tuple(ck::make_unmerge_transform(make_tuple(Number<6>{}, Number<4>{}))),
+            make_tuple(Sequence<0>{}),
+            make_tuple(Sequence<0, 1>{})),
+        ck::make_single_stage_tensor_adaptor(
+            make_tuple(ck::make_merge_transform(make_tuple(Number<4>{}, Number<6>{}))),
+            make_tuple(Sequence<0, 1>{}),
+            make_tuple(Sequence<0>{})));
+
+    const auto simplified_adaptor = ck::simplify_tensor_adaptor(adaptor);
+
+    EXPECT_EQ(simplified_adaptor.GetNumOfTransform(), 2);
+
+    for(index_t t = 0; t < 24; ++t)
+    {
+        const auto idx      = adaptor.CalculateBottomIndex(ck::make_multi_index(t));
+        const auto idx_simp = simplified_adaptor.CalculateBottomIndex(ck::make_multi_index(t));
+
+        EXPECT_EQ(idx_simp[Number<0>{}], idx[Number<0>{}]) << "t " << t;
+    }
+
+    // e.g. T = 6 is (1, 0) in (4, 6), which is 4 in (6, 4)
+    EXPECT_EQ(simplified_adaptor.CalculateBottomIndex(ck::make_multi_index(6))[Number<0>{}], 4);
+}
+
+TEST(TensorAdaptorSimplification, ComposeEmbed)
+{
+    // 1x1 convolution with stride 2: the output image embedded in the strided input image
+    const index_t N = 2, Hi = 9, Wi = 11, C = 8;
+    const index_t Ho = 5, Wo = 6;
+
+    const auto in_desc = ck::make_naive_tensor_descriptor(make_tuple(N, Hi, Wi, C),
+                                                          make_tuple(Hi * Wi * C, Wi * C, C, 1));
+
+    const auto desc = ck::transform_tensor_descriptor(
+        in_desc,
+        make_tuple(ck::make_pass_through_transform(N),
+                   ck::make_embed_transform(make_tuple(Ho), make_tuple(2)),
+                   ck::make_embed_transform(make_tuple(Wo), make_tuple(2)),
+                   ck::make_pass_through_transform(C)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}, Sequence<2>{}, Sequence<3>{}));
+
+    const auto simplified_desc = ck::simplify_tensor_descriptor(desc);
+
+    // a single embed from the output index to the offset
+    EXPECT_EQ(desc.GetNumOfTransform(), 5);
+    EXPECT_EQ(simplified_desc.GetNumOfTransform(), 1);
+    EXPECT_EQ(simplified_desc.GetNumOfHiddenDimension(), 5);
+
+    check_equivalence(desc, simplified_desc);
+}
+
+TEST(TensorAdaptorSimplification, ConvFwdToGemm)
+{
+    using ConvToGemm = ck::tensor_operation::TransformConvFwdToGemm<
+        2,
+        ck::tensor_operation::device::ConvolutionForwardSpecialization::Default>;
+
+    const index_t N = 2, C = 4, K = 8, Hi = 6, Wi = 7, Y = 3, X = 3;
+    const index_t Ho = 6, Wo = 7;
+
+    using InLayout = ck::tensor_layout::convolution::NHWGC;
+
+    const auto desc = ConvToGemm::template MakeADescriptor_M_K<InLayout>(
+        {1, N, C, Hi, Wi},
+        {C, Hi * Wi * C, 1, Wi * C, C},
+        {1, K, C, Y, X},
+        {},
+        {1, N, K, Ho, Wo},
+        {},
+        {1, 1},
+        {1, 1},
+        {1, 1},
+        {1, 1});
+
+    // split K in K0 x K1, as the gridwise GEMMs do
+    const auto desc_k0_m_k1 = ck::transform_tensor_descriptor(
+        desc,
+        make_tuple(ck::make_unmerge_transform(make_tuple(Y * X * C / 4, Number<4>{})),
+                   ck::make_pass_through_transform(N * Ho * Wo)),
+        make_tuple(Sequence<1>{}, Sequence<0>{}),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}));
+
+    const auto simplified_desc = ck::simplify_tensor_descriptor(desc_k0_m_k1);
+
+    EXPECT_LT(simplified_desc.GetNumOfTransform(), desc_k0_m_k1.GetNumOfTransform());
+    EXPECT_LT(simplified_desc.GetNumOfHiddenDimension(), desc_k0_m_k1.GetNumOfHiddenDimension());
+
+    check_equivalence(desc_k0_m_k1, simplified_desc);
+}
+
+TEST(TensorAdaptorSimplification, KnownAtCompileTime)
+{
+    const auto desc = ck::transform_tensor_descriptor(
+        ck::make_naive_tensor_descriptor_packed(make_tuple(Number<4>{}, Number<8>{})),
+        make_tuple(ck::make_pass_through_transform(Number<4>{}),
+                   ck::make_unmerge_transform(make_tuple(Number<2>{}, Number<4>{}))),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}));
+
+    const auto simplified_desc = ck::simplify_tensor_descriptor(desc);
+
+    static_assert(decltype(simplified_desc)::IsKnownAtCompileTime(), "wrong!");
+    static_assert(decltype(simplified_desc)::GetNumOfTransform() == 1, "wrong!");
+
+    check_equivalence(desc, simplified_desc);
+}
+
+TEST(TensorAdaptorSimplification, Adaptor)
+{
+    // (M0, M1) -> M -> (M0', M1'), then a pass-through, then (M0', M1') -> M'
+    const auto adaptor = ck::chain_tensor_adaptors(
+        ck::make_single_stage_tensor_adaptor(make_tuple(ck::make_merge_transform(make_tuple(3, 4))),
+                                             make_tuple(Sequence<0, 1>{}),
+                                             make_tuple(Sequence<0>{})),
+        ck::make_single_stage_tensor_adaptor(make_tuple(ck::make_pass_through_transform(12)),
+                                             make_tuple(Sequence<0>{}),
+                                             make_tuple(Sequence<0>{})),
+        ck::make_single_stage_tensor_adaptor(
+            make_tuple(ck::make_unmerge_transform(make_tuple(Number<2>{}, Number<6>{}))),
+            make_tuple(Sequence<0>{}),
+            make_tuple(Sequence<0, 1>{})),
+        ck::make_single_stage_tensor_adaptor(
+            make_tuple(ck::make_merge_transform(make_tuple(Number<2>{}, Number<6>{}))),
+            make_tuple(Sequence<0, 1>{}),
+            make_tuple(Sequence<0>{})));
+
+    const auto simplified_adaptor = ck::simplify_tensor_adaptor(adaptor);
+
+    EXPECT_EQ(adaptor.GetNumOfTransform(), 4);
+    EXPECT_EQ(simplified_adaptor.GetNumOfTransform(), 1);
+    EXPECT_EQ(simplified_adaptor.GetNumOfHiddenDimension(), 3);
+
+    for(index_t m = 0; m < 12; ++m)
+    {
+        const auto idx      = adaptor.CalculateBottomIndex(ck::make_multi_index(m));
+        const auto idx_simp = simplified_adaptor.CalculateBottomIndex(ck::make_multi_index(m));
+
+        EXPECT_EQ(idx_simp[Number<0>{}], idx[Number<0>{}]);
+        EXPECT_EQ(idx_simp[Number<1>{}], idx[Number<1>{}]);
+    }
+}
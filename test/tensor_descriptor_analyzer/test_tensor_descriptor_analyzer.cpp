@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+#include "ck/library/utility/tensor_descriptor_analyzer.hpp"
+
+using ck::index_t;
+using ck::long_index_t;
+using ck::make_tuple;
+using ck::Sequence;
+using ck::utils::analyze_vector_access;
+using ck::utils::TransformChainTile;
+using ck::utils::VectorAccessAnalyzerConfig;
+using ck::utils::VectorAccessBlocker;
+
+namespace {
+
+// A descriptor of a 2D NHWC forward convolution lowered to GEMM M x K, K being Y * X * C
+auto make_conv_fwd_a_grid_desc_m_k(index_t C, index_t filter_size, index_t pad)
+{
+    using ConvToGemm = ck::tensor_operation::TransformConvFwdToGemm<
+        2,
+        ck::tensor_operation::device::ConvolutionForwardSpecialization::Default>;
+
+    const index_t N  = 2;
+    const index_t K  = 16;
+    const index_t Hi = 7;
+    const index_t Wi = 7;
+    const index_t Ho = Hi + 2 * pad - filter_size + 1;
+    const index_t Wo = Wi + 2 * pad - filter_size + 1;
+
+    return ConvToGemm::template MakeADescriptor_M_K<ck::tensor_layout::convolution::NHWGC>(
+        {1, N, C, Hi, Wi},
+        {C, Hi * Wi * C, 1, Wi * C, C},
+        {1, K, C, filter_size, filter_size},
+        {},
+        {1, N, K, Ho, Wo},
+        {},
+        {1, 1},
+        {1, 1},
+        {pad, pad},
+        {pad, pad});
+}
+
+// checks the offsets of the tile against CalculateOffset, returns their number
+template <typename Desc>
+long_index_t check_tile_offsets(const Desc& desc, const TransformChainTile<2>& tile)
+{
+    long_index_t count = 0;
+
+    ck::utils::for_each_tile_offset(desc, tile, [&](const auto& idx, long_index_t offset, bool) {
+        EXPECT_EQ(offset, desc.CalculateOffset(ck::make_multi_index(idx[0], idx[1])));
+
+        ++count;
+    });
+
+    return count;
+}
+
+} // namespace
+
+TEST(TensorDescriptorAnalyzer, OffsetsOfTile)
+{
+    const auto desc = make_conv_fwd_a_grid_desc_m_k(4, 3, 1);
+
+    // the whole descriptor, and a tile not starting at the origin
+    const auto full_tile = ck::utils::make_transform_chain_tile(desc);
+
+    const auto tile = TransformChainTile<2>{{5, 3}, {17, 29}};
+
+    EXPECT_EQ(check_tile_offsets(desc, full_tile), full_tile.GetElementSize());
+    EXPECT_EQ(check_tile_offsets(desc, tile), tile.GetElementSize());
+}
+
+TEST(TensorDescriptorAnalyzer, OffsetsOfAdaptor)
+{
+    const auto adaptor = ck::make_single_stage_tensor_adaptor(
+        make_tuple(ck::make_unmerge_transform(make_tuple(3, 4))),
+        make_tuple(Sequence<0>{}),
+        make_tuple(Sequence<0, 1>{}));
+
+    std::vector<long_index_t> offsets;
+
+    const auto tile = TransformChainTile<2>{{0, 0}, {3, 4}};
+
+    ck::utils::for_each_tile_offset(adaptor, tile, [&](const auto&, long_index_t offset, bool) {
+        offsets.push_back(offset);
+    });
+
+    ASSERT_EQ(offsets.size(), std::size_t{12});
+
+    for(std::size_t i = 0; i < offsets.size(); ++i)
+    {
+        EXPECT_EQ(offsets[i], static_cast<long_index_t>(i));
+    }
+
+    const auto analysis = analyze_vector_access(adaptor, 1, tile);
+
+    EXPECT_EQ(analysis.max_vector_length_, 4);
+    EXPECT_EQ(analysis.blocker_, VectorAccessBlocker::TileLength);
+}
+
+TEST(TensorDescriptorAnalyzer, RowMajor)
+{
+    const auto desc = ck::make_naive_tensor_descriptor_packed(make_tuple(8, 32));
+    const auto tile = ck::utils::make_transform_chain_tile(desc);
+
+    const auto k_analysis = analyze_vector_access(desc, 1, tile);
+
+    EXPECT_EQ(k_analysis.max_vector_length_, 16);
+    EXPECT_EQ(k_analysis.blocker_, VectorAccessBlocker::None);
+
+    const auto m_analysis = analyze_vector_access(desc, 0, tile);
+
+    EXPECT_EQ(m_analysis.max_vector_length_, 1);
+    EXPECT_EQ(m_analysis.blocker_, VectorAccessBlocker::Stride);
+    EXPECT_EQ(m_analysis.blocking_transform_, -1);
+}
+
+TEST(TensorDescriptorAnalyzer, RowStride)
+{
+    // rows of 32 elements, 36 elements apart
+    const auto desc = ck::make_naive_tensor_descriptor(make_tuple(8, 32), make_tuple(36, 1));
+    const auto tile = ck::utils::make_transform_chain_tile(desc);
+
+    const auto analysis = analyze_vector_access(desc, 1, tile);
+
+    EXPECT_EQ(analysis.max_vector_length_, 4);
+    EXPECT_EQ(analysis.blocker_, VectorAccessBlocker::Alignment);
+    EXPECT_EQ(analysis.blocked_vector_origin_, (std::vector<index_t>{1, 0}));
+
+    VectorAccessAnalyzerConfig config;
+
+    config.check_alignment_ = false;
+
+    EXPECT_EQ(analyze_vector_access(desc, 1, tile, config).max_vector_length_, 16);
+}
+
+TEST(TensorDescriptorAnalyzer, RightPad)
+{
+    // K padded from 30 to 32
+    const auto desc = ck::transform_tensor_descriptor(
+        ck::make_naive_tensor_descriptor_packed(make_tuple(4, 30)),
+        make_tuple(ck::make_pass_through_transform(4), ck::make_right_pad_transform(30, 2)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto analysis =
+        analyze_vector_access(desc, 1, ck::utils::make_transform_chain_tile(desc));
+
+    EXPECT_EQ(analysis.max_vector_length_, 2);
+    EXPECT_EQ(analysis.blocker_, VectorAccessBlocker::Validity);
+    EXPECT_EQ(analysis.blocking_transform_name_, "RightPad");
+    EXPECT_EQ(analysis.blocked_vector_origin_, (std::vector<index_t>{0, 28}));
+    EXPECT_EQ(analysis.transform_path_, (std::vector<std::string>{"RightPad", "UnMerge"}));
+
+    std::stringstream ss;
+
+    ss << analysis;
+
+    EXPECT_NE(ss.str().find("blocked by Validity in RightPad"), std::string::npos);
+}
+
+TEST(TensorDescriptorAnalyzer, Merge)
+{
+    // rows of 6 elements, 8 elements apart, merged into a single dimension
+    const auto desc = ck::transform_tensor_descriptor(
+        ck::make_naive_tensor_descriptor(make_tuple(4, 6), make_tuple(8, 1)),
+        make_tuple(ck::make_merge_transform(make_tuple(4, 6))),
+        make_tuple(Sequence<0, 1>{}),
+        make_tuple(Sequence<0>{}));
+
+    const auto analysis =
+        analyze_vector_access(desc, 0, ck::utils::make_transform_chain_tile(desc));
+
+    EXPECT_EQ(analysis.max_vector_length_, 2);
+    EXPECT_EQ(analysis.blocker_, VectorAccessBlocker::NonAffine);
+    EXPECT_EQ(analysis.blocking_transform_, 1);
+    EXPECT_EQ(analysis.blocked_vector_origin_, (std::vector<index_t>{4}));
+}
+
+TEST(TensorDescriptorAnalyzer, ConvFwdToGemm)
+{
+    // C multiple of the vector length: vectors stay within C
+    {
+        const auto desc = make_conv_fwd_a_grid_desc_m_k(64, 3, 1);
+        const auto tile = ck::utils::make_transform_chain_tile(desc);
+
+        EXPECT_TRUE(ck::utils::is_vector_access_supported(desc, 1, 8, tile));
+        EXPECT_FALSE(ck::utils::is_vector_access_supported(desc, 0, 2, tile));
+    }
+
+    // C = 4 and X = 2: a vector of 8 spans two filter columns, which is contiguous in memory, but
+    // partly padding on the left and right edges, and misaligned for odd input columns
+    {
+        const auto desc = make_conv_fwd_a_grid_desc_m_k(4, 2, 1);
+        const auto tile = ck::utils::make_transform_chain_tile(desc);
+
+        const auto analysis = analyze_vector_access(desc, 1, tile);
+
+        EXPECT_EQ(analysis.max_vector_length_, 4);
+        EXPECT_EQ(analysis.blocker_, VectorAccessBlocker::Validity);
+        EXPECT_EQ(analysis.blocking_transform_name_, "Pad");
+
+        const auto no_pad_desc = make_conv_fwd_a_grid_desc_m_k(4, 2, 0);
+        const auto no_pad_tile = ck::utils::make_transform_chain_tile(no_pad_desc);
+
+        EXPECT_EQ(analyze_vector_access(no_pad_desc, 1, no_pad_tile).blocker_,
+                  VectorAccessBlocker::Alignment);
+    }
+
+    // C = 3: no vector access
+    {
+        const auto desc = make_conv_fwd_a_grid_desc_m_k(3, 3, 1);
+
+        const auto tile     = TransformChainTile<2>{{0, 0}, {16, 24}};
+        const auto analysis = analyze_vector_access(desc, 1, tile);
+
+        EXPECT_EQ(analysis.max_vector_length_, 1);
+    }
+}
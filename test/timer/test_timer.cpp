@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2022, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/cpu_kernel_launch.hpp"
+#include "ck/host_utility/timer.hpp"
+
+using ck::TimingStatistics;
+
+namespace {
+
+// clock returning the times of a script, repeated, instead of measuring them
+struct ScriptedClock
+{
+    void Start() {}
+
+    void Stop() { times_.push_back(script_[times_.size() % script_.size()]); }
+
+    std::vector<float> GetElapsedTimes() const { return times_; }
+
+    void Reset() { times_.clear(); }
+
+    std::vector<float> script_;
+    std::vector<float> times_;
+};
+
+} // namespace
+
+TEST(TimingStatistics, Compute)
+{
+    const auto statistics = TimingStatistics::Compute({4, 2, 1, 3, 5}, false);
+
+    EXPECT_EQ(statistics.num_run_, 5);
+    EXPECT_EQ(statistics.num_outlier_, 0);
+    EXPECT_FLOAT_EQ(statistics.mean_, 3);
+    EXPECT_FLOAT_EQ(statistics.min_, 1);
+    EXPECT_FLOAT_EQ(statistics.median_, 3);
+    EXPECT_FLOAT_EQ(statistics.p90_, 4.6f);
+    EXPECT_FLOAT_EQ(statistics.max_, 5);
+    EXPECT_FLOAT_EQ(statistics.stddev_, 1.5811388f);
+    // t(0.975, 4) * stddev / sqrt(5)
+    EXPECT_NEAR(statistics.ci95_, 2.776f * 1.5811388f / 2.2360680f, 1e-5f);
+}
+
+TEST(TimingStatistics, RejectOutliers)
+{
+    const std::vector<float> times{1.0f, 1.1f, 0.9f, 1.0f, 1.05f, 0.95f, 10.0f};
+
+    const auto all      = TimingStatistics::Compute(times, false);
+    const auto filtered = TimingStatistics::Compute(times, true);
+
+    EXPECT_EQ(all.num_outlier_, 0);
+    EXPECT_FLOAT_EQ(all.max_, 10.0f);
+
+    EXPECT_EQ(filtered.num_run_, 7);
+    EXPECT_EQ(filtered.num_outlier_, 1);
+    EXPECT_FLOAT_EQ(filtered.mean_, 1.0f);
+    EXPECT_FLOAT_EQ(filtered.max_, 1.1f);
+
+    // the outliers are kept in the times of the runs
+    EXPECT_EQ(filtered.times_, times);
+}
+
+TEST(TimingStatistics, Empty)
+{
+    const auto statistics = TimingStatistics::Compute({}, true);
+
+    EXPECT_EQ(statistics.num_run_, 0);
+    EXPECT_EQ(statistics.mean_, 0);
+    EXPECT_EQ(statistics.GetRelativeCI95(), 0);
+}
+
+TEST(Benchmark, FixedRepeat)
+{
+    ScriptedClock clock{{2.0f, 4.0f}, {}};
+    TimingStatistics statistics;
+
+    StreamConfig stream_config{nullptr, true};
+
+    stream_config.cold_niters_       = 3;
+    stream_config.nrepeat_           = 8;
+    stream_config.timing_statistics_ = &statistics;
+
+    int num_call = 0;
+
+    const float time = ck::benchmark(stream_config, clock, [&]() { ++num_call; });
+
+    EXPECT_EQ(num_call, 11);
+    EXPECT_FLOAT_EQ(time, 3.0f);
+    EXPECT_EQ(statistics.num_run_, 8);
+    EXPECT_FLOAT_EQ(statistics.mean_, 3.0f);
+}
+
+TEST(Benchmark, TargetCI)
+{
+    StreamConfig stream_config{nullptr, true};
+
+    stream_config.cold_niters_ = 0;
+    stream_config.nrepeat_     = 10;
+    stream_config.max_nrepeat_ = 1000;
+    stream_config.target_ci_   = 0.01f;
+
+    TimingStatistics statistics;
+
+    stream_config.timing_statistics_ = &statistics;
+
+    // constant times, the first batch is enough
+    ScriptedClock constant_clock{{1.0f}, {}};
+
+    ck::benchmark(stream_config, constant_clock, []() {});
+
+    EXPECT_EQ(statistics.num_run_, 10);
+
+    // noisy times, batches are added until the interval is within 1% of the mean
+    ScriptedClock noisy_clock{{1.0f, 1.2f, 0.8f, 1.1f, 0.9f}, {}};
+
+    ck::benchmark(stream_config, noisy_clock, []() {});
+
+    EXPECT_GT(statistics.num_run_, 10);
+    EXPECT_LT(statistics.num_run_, 1000);
+    EXPECT_EQ(statistics.num_run_ % 10, 0);
+    EXPECT_LE(statistics.GetRelativeCI95(), 0.01f);
+
+    // the interval can not get within 0.01% of the mean before max_nrepeat_ runs
+    stream_config.target_ci_ = 1e-4f;
+
+    ck::benchmark(stream_config, noisy_clock, []() {});
+
+    EXPECT_EQ(statistics.num_run_, 1000);
+}
+
+#if CK_TIME_KERNEL
+TEST(Benchmark, CpuKernel)
+{
+    TimingStatistics statistics;
+
+    StreamConfig stream_config{nullptr, true};
+
+    stream_config.nrepeat_           = 5;
+    stream_config.timing_statistics_ = &statistics;
+
+    int num_call = 0;
+
+    const float time = ck::launch_and_time_cpu_kernel(stream_config, [&]() { ++num_call; });
+
+    EXPECT_EQ(num_call, 6);
+    EXPECT_EQ(statistics.num_run_, 5);
+    EXPECT_GE(time, 0);
+    EXPECT_EQ(time, statistics.mean_);
+}
+#endif